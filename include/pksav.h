@@ -9,7 +9,12 @@
 
 #include <pksav/config.h>
 
+#include <pksav/async.h>
+#include <pksav/batch.h>
+#include <pksav/bulk.h>
+#include <pksav/detect.h>
 #include <pksav/error.h>
+#include <pksav/io.h>
 #include <pksav/version.h>
 
 #include <pksav/common/condition.h>
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#ifndef PKSAV_ASYNC_H
+#define PKSAV_ASYNC_H
+
+#include <pksav/config.h>
+#include <pksav/error.h>
+
+#include <stdlib.h>
+
+//! The number of threads used if none is given.
+#define PKSAV_ASYNC_DEFAULT_NUM_THREADS 2
+
+/*!
+ * @brief A pool of threads that writes saves in the background.
+ *
+ * Saves are submitted with the pksav_*_save_save_async functions, which
+ * encode the save on the caller's thread and leave only the file I/O to
+ * the pool.
+ *
+ * Writes to the same filepath happen in the order they were submitted.
+ * If a write is submitted while an earlier one to the same filepath is
+ * still waiting for a thread, the earlier one is dropped, since the newer
+ * one would overwrite it anyway. Its callback is still called, with the
+ * result of the newer write.
+ */
+struct pksav_async_writer
+{
+    //! Internal use only.
+    void* p_internal;
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//! Start a pool of threads to write saves.
+/*!
+ * On platforms without threads, saves are written as they're submitted.
+ *
+ * \param num_threads how many threads to use, or 0 for ::PKSAV_ASYNC_DEFAULT_NUM_THREADS
+ * \param p_writer_out where to set up the pool
+ * \returns PKSAV_ERROR_NONE upon success
+ * \returns PKSAV_ERROR_NULL_POINTER if p_writer_out is NULL
+ * \returns PKSAV_ERROR_OUT_OF_MEMORY if the pool couldn't be set up, in which
+ *          case p_writer_out->p_internal is left NULL
+ */
+PKSAV_API enum pksav_error pksav_async_writer_init(
+    size_t num_threads,
+    struct pksav_async_writer* p_writer_out
+);
+
+//! Get how many writes haven't finished yet.
+/*!
+ * A write has finished once its callbacks have returned.
+ *
+ * \param p_writer the pool to check
+ * \param p_num_pending_out where to place the number of unfinished writes
+ * \returns PKSAV_ERROR_NONE upon success
+ * \returns PKSAV_ERROR_NULL_POINTER if either parameter is NULL
+ */
+PKSAV_API enum pksav_error pksav_async_writer_get_num_pending(
+    struct pksav_async_writer* p_writer,
+    size_t* p_num_pending_out
+);
+
+//! Wait for every write submitted so far to finish.
+/*!
+ * \param p_writer the pool to wait on
+ * \returns PKSAV_ERROR_NONE upon success
+ * \returns PKSAV_ERROR_NULL_POINTER if p_writer is NULL
+ */
+PKSAV_API enum pksav_error pksav_async_writer_wait(
+    struct pksav_async_writer* p_writer
+);
+
+//! Finish every pending write and stop the pool.
+/*!
+ * \param p_writer the pool to stop
+ * \returns PKSAV_ERROR_NONE upon success
+ * \returns PKSAV_ERROR_NULL_POINTER if p_writer is NULL
+ */
+PKSAV_API enum pksav_error pksav_async_writer_free(
+    struct pksav_async_writer* p_writer
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PKSAV_ASYNC_H */
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#ifndef PKSAV_BATCH_H
+#define PKSAV_BATCH_H
+
+#include <pksav/config.h>
+#include <pksav/error.h>
+
+/*!
+ * @brief A group of saves to be written to disk together.
+ *
+ * Saves are added with the pksav_*_save_save_to_batch functions, each of
+ * which writes the save to a temporary file in the same directory as its
+ * destination. Nothing at the destination changes until the batch is
+ * committed, at which point every temporary file is synced to disk and
+ * then renamed over its destination.
+ *
+ * A crash at any point leaves each destination with either its old
+ * contents or its new contents, never a partial write. Syncing the whole
+ * batch at once also costs much less than syncing each save as it's
+ * written.
+ */
+struct pksav_save_batch
+{
+    //! Internal use only.
+    void* p_internal;
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//! Start an empty batch.
+/*!
+ * \param p_batch_out where to set up the batch
+ * \returns PKSAV_ERROR_NONE upon success
+ * \returns PKSAV_ERROR_NULL_POINTER if p_batch_out is NULL
+ * \returns PKSAV_ERROR_OUT_OF_MEMORY if the batch couldn't be allocated, in
+ *          which case p_batch_out->p_internal is left NULL
+ */
+PKSAV_API enum pksav_error pksav_save_batch_init(
+    struct pksav_save_batch* p_batch_out
+);
+
+//! Sync every save in a batch and move each one into place.
+/*!
+ * If any save can't be synced, nothing is moved into place, and the
+ * commit can be retried. Otherwise, each save is renamed over its
+ * destination, and the batch is left empty to be reused.
+ *
+ * If the same destination was added more than once, the last save added
+ * is the one that ends up there.
+ *
+ * \param p_batch the batch to commit
+ * \returns PKSAV_ERROR_NONE upon success
+ * \returns PKSAV_ERROR_NULL_POINTER if p_batch is NULL
+ * \returns PKSAV_ERROR_FILE_IO if a save couldn't be synced or moved
+ * \returns PKSAV_ERROR_OUT_OF_MEMORY if the saves were moved, but their
+ *          directories couldn't be synced for lack of memory
+ */
+PKSAV_API enum pksav_error pksav_save_batch_commit(
+    struct pksav_save_batch* p_batch
+);
+
+//! Free a batch, discarding any saves that weren't committed.
+/*!
+ * \param p_batch the batch to free
+ * \returns PKSAV_ERROR_NONE upon success
+ * \returns PKSAV_ERROR_NULL_POINTER if p_batch is NULL
+ */
+PKSAV_API enum pksav_error pksav_save_batch_free(
+    struct pksav_save_batch* p_batch
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PKSAV_BATCH_H */
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#ifndef PKSAV_BULK_H
+#define PKSAV_BULK_H
+
+#include <pksav/config.h>
+#include <pksav/error.h>
+
+#include <stdlib.h>
+
+//! How the bulk loaders read files.
+enum pksav_bulk_backend
+{
+    //! Use the fastest backend available on this platform.
+    PKSAV_BULK_BACKEND_AUTO = 0,
+    /*!
+     * @brief Submit opens and reads through io_uring on the calling thread.
+     *
+     * Only available on Linux 5.6 and later.
+     */
+    PKSAV_BULK_BACKEND_IO_URING,
+    //! Load files on a pool of threads, each with one file in flight.
+    PKSAV_BULK_BACKEND_THREADS,
+    //! Load files one at a time on the calling thread.
+    PKSAV_BULK_BACKEND_SERIAL
+};
+
+//! Options for the bulk loaders.
+struct pksav_bulk_load_options
+{
+    /*!
+     * @brief The most files that can be in flight at once.
+     *
+     * Each file in flight holds a buffer the size of the file, so this
+     * bounds memory use as well. If 0, ::PKSAV_BULK_DEFAULT_QUEUE_DEPTH is
+     * used.
+     */
+    size_t queue_depth;
+
+    //! Which backend to use.
+    enum pksav_bulk_backend backend;
+};
+
+//! The queue depth used if none is given.
+#define PKSAV_BULK_DEFAULT_QUEUE_DEPTH 32
+
+#endif /* PKSAV_BULK_H */
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#ifndef PKSAV_DETECT_H
+#define PKSAV_DETECT_H
+
+#include <pksav/config.h>
+#include <pksav/error.h>
+
+#include <pksav/gen1/common.h>
+#include <pksav/gen2/common.h>
+#include <pksav/gen3/common.h>
+
+#include <stdint.h>
+#include <stdlib.h>
+
+//! The generations whose saves can be detected.
+enum pksav_generation
+{
+    PKSAV_GENERATION_NONE = 0,
+    PKSAV_GENERATION_1,
+    PKSAV_GENERATION_2,
+    PKSAV_GENERATION_3
+};
+
+//! Which generation and game a save is from.
+struct pksav_save_type
+{
+    //! The save's generation, or ::PKSAV_GENERATION_NONE if it isn't a save.
+    enum pksav_generation generation;
+
+    //! Only set if generation is ::PKSAV_GENERATION_1.
+    enum pksav_gen1_save_type gen1_save_type;
+    //! Only set if generation is ::PKSAV_GENERATION_2.
+    enum pksav_gen2_save_type gen2_save_type;
+    //! Only set if generation is ::PKSAV_GENERATION_3.
+    enum pksav_gen3_save_type gen3_save_type;
+};
+
+//! Options for the scanners.
+struct pksav_scan_options
+{
+    /*!
+     * @brief How many threads to scan with, including the calling thread.
+     *
+     * If 0, ::PKSAV_SCAN_DEFAULT_NUM_THREADS is used.
+     */
+    size_t num_threads;
+};
+
+//! The number of threads used if none is given.
+#define PKSAV_SCAN_DEFAULT_NUM_THREADS 4
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//! Detect which generation and game a save buffer is from.
+/*!
+ * The buffer's size rules out most generations before any checks are run,
+ * and the checks for the remaining ones are run cheapest first.
+ *
+ * \param p_buffer the buffer to check
+ * \param buffer_len the size of p_buffer
+ * \param p_save_type_out where to place the save type
+ * \returns PKSAV_ERROR_NONE upon success
+ * \returns PKSAV_ERROR_NULL_POINTER if p_buffer or p_save_type_out is NULL
+ * \returns PKSAV_ERROR_INVALID_SAVE if the buffer isn't a save from any
+ *          generation, in which case the generation is set to
+ *          ::PKSAV_GENERATION_NONE
+ */
+PKSAV_API enum pksav_error pksav_detect_save_type(
+    const uint8_t* p_buffer,
+    size_t buffer_len,
+    struct pksav_save_type* p_save_type_out
+);
+
+//! Detect which generation and game a save file is from.
+/*!
+ * Unlike calling each generation's pksav_*_get_file_save_type in turn, the
+ * file is only opened once, and only the parts needed to check it are read.
+ *
+ * \param p_filepath the file to check
+ * \param p_save_type_out where to place the save type
+ * \returns PKSAV_ERROR_NONE upon success
+ * \returns PKSAV_ERROR_NULL_POINTER if p_filepath or p_save_type_out is NULL
+ * \returns PKSAV_ERROR_FILE_IO if the file can't be read
+ * \returns PKSAV_ERROR_INVALID_SAVE if the file isn't a save from any
+ *          generation
+ * \returns PKSAV_ERROR_OUT_OF_MEMORY if the file can't be mapped and there
+ *          isn't enough memory to read it instead
+ */
+PKSAV_API enum pksav_error pksav_detect_file_save_type(
+    const char* p_filepath,
+    struct pksav_save_type* p_save_type_out
+);
+
+//! Detect the save type of every file in a list, on a pool of threads.
+/*!
+ * Each thread starts with an even share of the list, and threads that run
+ * out take half of what's left from another thread's share, so a few slow
+ * files don't hold up the rest.
+ *
+ * The callback is called once per file, with the result of
+ * ::pksav_detect_file_save_type. Calls may come from any of the threads,
+ * but never at the same time, and p_save_type is only valid during the call.
+ *
+ * \param pp_filepaths the files to check
+ * \param num_filepaths how many files are in pp_filepaths
+ * \param p_options how to scan, or NULL for the defaults
+ * \param p_callback called with each file's result
+ * \param p_user_data passed to p_callback
+ * \returns PKSAV_ERROR_NONE once every file has been reported
+ * \returns PKSAV_ERROR_NULL_POINTER if pp_filepaths or p_callback is NULL
+ */
+PKSAV_API enum pksav_error pksav_scan_save_files(
+    const char* const* pp_filepaths,
+    size_t num_filepaths,
+    const struct pksav_scan_options* p_options,
+    void (*p_callback)(
+        const char* p_filepath,
+        enum pksav_error error,
+        const struct pksav_save_type* p_save_type,
+        void* p_user_data
+    ),
+    void* p_user_data
+);
+
+//! Detect the save type of every file in a directory, on a pool of threads.
+/*!
+ * Only regular files directly inside the directory are checked, in no
+ * particular order. Each path passed to the callback starts with
+ * p_dirpath. Otherwise, this works like ::pksav_scan_save_files.
+ *
+ * \param p_dirpath the directory to scan
+ * \param p_options how to scan, or NULL for the defaults
+ * \param p_callback called with each file's result
+ * \param p_user_data passed to p_callback
+ * \returns PKSAV_ERROR_NONE once every file has been reported
+ * \returns PKSAV_ERROR_NULL_POINTER if p_dirpath or p_callback is NULL
+ * \returns PKSAV_ERROR_FILE_IO if the directory can't be listed
+ */
+PKSAV_API enum pksav_error pksav_scan_save_directory(
+    const char* p_dirpath,
+    const struct pksav_scan_options* p_options,
+    void (*p_callback)(
+        const char* p_filepath,
+        enum pksav_error error,
+        const struct pksav_save_type* p_save_type,
+        void* p_user_data
+    ),
+    void* p_user_data
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PKSAV_DETECT_H */
@@ -27,7 +27,9 @@ enum pksav_error
     //! The filepath passed in the function is not a valid save file for the given generation.
     PKSAV_ERROR_INVALID_SAVE,
     //! A null pointer was passed as a parameter.
-    PKSAV_ERROR_NULL_POINTER
+    PKSAV_ERROR_NULL_POINTER,
+    //! Memory couldn't be allocated.
+    PKSAV_ERROR_OUT_OF_MEMORY
 };
 
 #ifdef __cplusplus
@@ -7,8 +7,12 @@
 #ifndef PKSAV_GEN2_SAVE_H
 #define PKSAV_GEN2_SAVE_H
 
+#include <pksav/async.h>
+#include <pksav/batch.h>
+#include <pksav/bulk.h>
 #include <pksav/config.h>
 #include <pksav/error.h>
+#include <pksav/io.h>
 
 #include <pksav/gen2/common.h>
 #include <pksav/gen2/daycare_data.h>
@@ -291,6 +295,45 @@ struct pksav_gen2_save
     void* p_internal;
 };
 
+/*!
+ * @brief A summary of a save, read without loading the whole thing.
+ *
+ * This is filled by ::pksav_gen2_peek_save_from_file and
+ * ::pksav_gen2_peek_save_from_io. Values are stored the same way as they are
+ * in the save.
+ */
+struct pksav_gen2_save_peek
+{
+    enum pksav_gen2_save_type save_type;
+
+    /*!
+     * @brief The trainer's name, including its terminator.
+     *
+     * This value should be accessed with ::pksav_gen2_import_text with a
+     * num_chars value of 7.
+     */
+    uint8_t trainer_name[PKSAV_GEN2_TRAINER_NAME_LENGTH + 1];
+
+    /*!
+     * @brief The trainer's ID (stored in big-endian).
+     *
+     * This value should be accessed with ::pksav_bigendian16.
+     */
+    uint16_t trainer_id;
+
+    struct pksav_gen2_time time_played;
+
+    //! How many Pokémon are in the party (0-6).
+    uint8_t party_count;
+
+    /*!
+     * @brief The species indices of the Pokémon in the party.
+     *
+     * Entries past party_count are 0.
+     */
+    uint8_t party_species[PKSAV_GEN2_PARTY_NUM_POKEMON];
+};
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -306,6 +349,54 @@ PKSAV_API enum pksav_error pksav_gen2_get_file_save_type(
     enum pksav_gen2_save_type* p_save_type_out
 );
 
+//! Get the type of the save behind an I/O backend.
+/*!
+ * \param p_io the backend to read from
+ * \param p_save_type_out where to place the save type
+ * \returns PKSAV_ERROR_NONE upon success
+ * \returns PKSAV_ERROR_NULL_POINTER if p_io, p_save_type_out, or a needed
+ *          callback is NULL
+ * \returns PKSAV_ERROR_FILE_IO if the backend fails
+ * \returns PKSAV_ERROR_OUT_OF_MEMORY if the save couldn't be read into memory
+ */
+PKSAV_API enum pksav_error pksav_gen2_get_io_save_type(
+    const struct pksav_io* p_io,
+    enum pksav_gen2_save_type* p_save_type_out
+);
+
+//! Read a summary of a save file without loading it.
+/*!
+ * Only the trainer info and the party are read, along with whatever else
+ * is needed to validate the save.
+ *
+ * \param p_filepath the save file to read
+ * \param p_peek_out where to place the summary
+ * \returns PKSAV_ERROR_NONE upon success
+ * \returns PKSAV_ERROR_NULL_POINTER if p_filepath or p_peek_out is NULL
+ * \returns PKSAV_ERROR_FILE_IO if the file can't be read
+ * \returns PKSAV_ERROR_INVALID_SAVE if the file isn't a valid save
+ */
+PKSAV_API enum pksav_error pksav_gen2_peek_save_from_file(
+    const char* p_filepath,
+    struct pksav_gen2_save_peek* p_peek_out
+);
+
+//! Read a summary of the save behind an I/O backend without loading it.
+/*!
+ * \param p_io the backend to read from
+ * \param p_peek_out where to place the summary
+ * \returns PKSAV_ERROR_NONE upon success
+ * \returns PKSAV_ERROR_NULL_POINTER if p_io, p_peek_out, or a needed
+ *          callback is NULL
+ * \returns PKSAV_ERROR_FILE_IO if the backend fails
+ * \returns PKSAV_ERROR_INVALID_SAVE if the backend doesn't contain a valid save
+ * \returns PKSAV_ERROR_OUT_OF_MEMORY if the save couldn't be read into memory
+ */
+PKSAV_API enum pksav_error pksav_gen2_peek_save_from_io(
+    const struct pksav_io* p_io,
+    struct pksav_gen2_save_peek* p_peek_out
+);
+
 PKSAV_API enum pksav_error pksav_gen2_load_save_from_buffer(
     uint8_t* buffer,
     size_t buffer_len,
@@ -317,11 +408,217 @@ PKSAV_API enum pksav_error pksav_gen2_load_save_from_file(
     struct pksav_gen2_save* p_gen2_save_out
 );
 
+//! Load a save so that edits are made directly to the file.
+/*!
+ * The file is mapped into memory and shared with anything else that has it
+ * open, such as an emulator, so edits become visible to them immediately.
+ * Call ::pksav_gen2_save_commit to make the save valid again and flush the
+ * changes to disk.
+ *
+ * This needs mmap, so it's not available on every platform.
+ *
+ * \param p_filepath the save file to load
+ * \param p_gen2_save_out where to load the save
+ * \returns PKSAV_ERROR_NONE upon success
+ * \returns PKSAV_ERROR_NULL_POINTER if p_filepath or p_gen2_save_out is NULL
+ * \returns PKSAV_ERROR_FILE_IO if the file can't be mapped
+ * \returns PKSAV_ERROR_INVALID_SAVE if the file isn't a valid save
+ */
+PKSAV_API enum pksav_error pksav_gen2_load_save_from_file_in_place(
+    const char* p_filepath,
+    struct pksav_gen2_save* p_gen2_save_out
+);
+
+//! Load a save through an I/O backend.
+/*!
+ * The save is read into memory, so the backend doesn't need to outlive the
+ * loaded save.
+ *
+ * \param p_io the backend to read from
+ * \param p_gen2_save_out where to load the save
+ * \returns PKSAV_ERROR_NONE upon success
+ * \returns PKSAV_ERROR_NULL_POINTER if p_io, p_gen2_save_out, or a needed
+ *          callback is NULL
+ * \returns PKSAV_ERROR_FILE_IO if the backend fails
+ * \returns PKSAV_ERROR_INVALID_SAVE if the backend doesn't contain a valid save
+ * \returns PKSAV_ERROR_OUT_OF_MEMORY if the save couldn't be read into memory
+ */
+PKSAV_API enum pksav_error pksav_gen2_load_save_from_io(
+    const struct pksav_io* p_io,
+    struct pksav_gen2_save* p_gen2_save_out
+);
+
+//! Load many save files, passing each one to a callback.
+/*!
+ * On Linux, opens and reads are submitted through io_uring, with up to
+ * the queue depth in flight at once. Elsewhere, or if io_uring isn't
+ * available, a pool of threads does the same. Each file is then loaded
+ * as if by ::pksav_gen2_load_save_from_buffer.
+ *
+ * The callback is called once per file, in no particular order and never
+ * concurrently, but possibly from another thread. If the file couldn't be
+ * loaded, error says why and p_gen2_save is NULL. The save is freed
+ * once the callback returns. Files over 1 MiB are rejected without being
+ * read.
+ *
+ * \param pp_filepaths the save files to load
+ * \param num_filepaths how many save files to load
+ * \param p_options how to load the files, or NULL for the defaults
+ * \param p_callback called with each result
+ * \param p_user_data passed to p_callback
+ * \returns PKSAV_ERROR_NONE upon success, even if some files failed to load
+ * \returns PKSAV_ERROR_NULL_POINTER if pp_filepaths, a filepath, or p_callback is NULL
+ * \returns PKSAV_ERROR_FILE_IO if ::PKSAV_BULK_BACKEND_IO_URING was requested
+ *          but isn't available
+ */
+PKSAV_API enum pksav_error pksav_gen2_bulk_load_saves(
+    const char* const* pp_filepaths,
+    size_t num_filepaths,
+    const struct pksav_bulk_load_options* p_options,
+    void (*p_callback)(
+        size_t filepath_index,
+        enum pksav_error error,
+        struct pksav_gen2_save* p_gen2_save,
+        void* p_user_data
+    ),
+    void* p_user_data
+);
+
 PKSAV_API enum pksav_error pksav_gen2_save_save(
     const char* p_filepath,
     struct pksav_gen2_save* p_gen2_save
 );
 
+//! Write a save to a buffer instead of a file.
+/*!
+ * If p_buffer is the buffer the save was loaded from, the save is updated
+ * in place and nothing is copied.
+ *
+ * \param p_gen2_save the save to write
+ * \param p_buffer where to write the save
+ * \param buffer_len the size of p_buffer (at least ::PKSAV_GEN2_SAVE_SIZE bytes)
+ * \returns PKSAV_ERROR_NONE upon success
+ * \returns PKSAV_ERROR_NULL_POINTER if p_gen2_save or p_buffer is NULL
+ * \returns PKSAV_ERROR_PARAM_OUT_OF_RANGE if buffer_len is too small
+ */
+PKSAV_API enum pksav_error pksav_gen2_save_save_to_buffer(
+    struct pksav_gen2_save* p_gen2_save,
+    uint8_t* p_buffer,
+    size_t buffer_len
+);
+
+//! Write a save through an I/O backend.
+/*!
+ * \param p_gen2_save the save to write
+ * \param p_io the backend to write to
+ * \returns PKSAV_ERROR_NONE upon success
+ * \returns PKSAV_ERROR_NULL_POINTER if p_gen2_save, p_io, or p_io->write_at
+ *          is NULL
+ * \returns PKSAV_ERROR_FILE_IO if the backend fails
+ */
+PKSAV_API enum pksav_error pksav_gen2_save_save_to_io(
+    struct pksav_gen2_save* p_gen2_save,
+    const struct pksav_io* p_io
+);
+
+//! Write only what changed in a save back to an existing file.
+/*!
+ * The file's current contents are read and compared against the save, and
+ * only the bytes that differ are written.
+ *
+ * \param p_filepath the existing file to write to
+ * \param p_gen2_save the save to write
+ * \param should_sync whether to wait for the changes to reach storage
+ * \returns PKSAV_ERROR_NONE upon success
+ * \returns PKSAV_ERROR_NULL_POINTER if p_filepath or p_gen2_save is NULL
+ * \returns PKSAV_ERROR_FILE_IO if the file can't be opened, written, or synced
+ */
+PKSAV_API enum pksav_error pksav_gen2_save_save_changes(
+    const char* p_filepath,
+    struct pksav_gen2_save* p_gen2_save,
+    bool should_sync
+);
+
+//! Write only what changed in a save through an I/O backend.
+/*!
+ * The backend's current contents are read and compared against the save,
+ * and only the bytes that differ are written.
+ *
+ * \param p_gen2_save the save to write
+ * \param p_io the backend to write to
+ * \returns PKSAV_ERROR_NONE upon success
+ * \returns PKSAV_ERROR_NULL_POINTER if p_gen2_save, p_io, or a needed
+ *          callback is NULL
+ * \returns PKSAV_ERROR_FILE_IO if the backend fails
+ */
+PKSAV_API enum pksav_error pksav_gen2_save_save_changes_to_io(
+    struct pksav_gen2_save* p_gen2_save,
+    const struct pksav_io* p_io
+);
+
+//! Write a save in the background.
+/*!
+ * The save is encoded into a snapshot before this returns, so it can be
+ * edited or freed right away. The snapshot is then written to the file by
+ * one of the writer's threads.
+ *
+ * \param p_filepath where to write the save
+ * \param p_gen2_save the save to write
+ * \param p_writer the pool to write with
+ * \param p_callback called with the result once the write finishes, or NULL
+ * \param p_user_data passed to p_callback
+ * \returns PKSAV_ERROR_NONE if the write was queued
+ * \returns PKSAV_ERROR_NULL_POINTER if p_filepath, p_gen2_save, or p_writer is NULL
+ * \returns PKSAV_ERROR_OUT_OF_MEMORY if the write couldn't be queued, in
+ *          which case p_callback is never called
+ */
+PKSAV_API enum pksav_error pksav_gen2_save_save_async(
+    const char* p_filepath,
+    struct pksav_gen2_save* p_gen2_save,
+    struct pksav_async_writer* p_writer,
+    void (*p_callback)(
+        enum pksav_error error,
+        void* p_user_data
+    ),
+    void* p_user_data
+);
+
+//! Add a save to a batch, to be written when the batch is committed.
+/*!
+ * The save is written to a temporary file next to p_filepath before this
+ * returns, so it can be edited or freed right away. The file at
+ * p_filepath isn't touched until ::pksav_save_batch_commit.
+ *
+ * \param p_filepath where to write the save
+ * \param p_gen2_save the save to write
+ * \param p_batch the batch to add the save to
+ * \returns PKSAV_ERROR_NONE upon success
+ * \returns PKSAV_ERROR_NULL_POINTER if p_filepath, p_gen2_save, or p_batch is NULL
+ * \returns PKSAV_ERROR_FILE_IO if the temporary file couldn't be written
+ * \returns PKSAV_ERROR_OUT_OF_MEMORY if the batch couldn't grow
+ */
+PKSAV_API enum pksav_error pksav_gen2_save_save_to_batch(
+    const char* p_filepath,
+    struct pksav_gen2_save* p_gen2_save,
+    struct pksav_save_batch* p_batch
+);
+
+//! Commit a save loaded with ::pksav_gen2_load_save_from_file_in_place.
+/*!
+ * Instead of rewriting the whole file, its checksums are fixed up, and the
+ * pages that were written to are flushed. A checksum is only written if it
+ * changed.
+ *
+ * \param p_gen2_save the save to commit
+ * \returns PKSAV_ERROR_NONE upon success
+ * \returns PKSAV_ERROR_NULL_POINTER if p_gen2_save is NULL
+ * \returns PKSAV_ERROR_PARAM_OUT_OF_RANGE if the save wasn't loaded in place
+ * \returns PKSAV_ERROR_FILE_IO if the changes couldn't be flushed
+ */
+PKSAV_API enum pksav_error pksav_gen2_save_commit(
+    struct pksav_gen2_save* p_gen2_save
+);
+
 PKSAV_API enum pksav_error pksav_gen2_free_save(
     struct pksav_gen2_save* p_gen2_save
 );
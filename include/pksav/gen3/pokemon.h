@@ -7,6 +7,9 @@
 #ifndef PKSAV_GEN3_POKEMON_H
 #define PKSAV_GEN3_POKEMON_H
 
+#include <pksav/config.h>
+#include <pksav/error.h>
+
 #include <pksav/common/constants.h>
 #include <pksav/common/contest_stats.h>
 #include <pksav/common/trainer_id.h>
@@ -14,6 +17,8 @@
 #include <pksav/gen3/common.h>
 #include <pksav/gen3/ribbons.h>
 
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #define PKSAV_GEN3_BOX_NUM_POKEMON   (30)
@@ -401,4 +406,60 @@ struct pksav_gen3_pokemon_pc
 
 #pragma pack(pop)
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief Encrypts or decrypts an array of Game Boy Advance Pokémon in place.
+ *
+ * Pokémon in save files are stored encrypted, with their blocks shuffled
+ * based on their personality. This works on any contiguous array, such as
+ * a PC box or Pokémon loaded from .pk3 files, not just Pokémon in a save
+ * loaded by PKSav, which are decrypted automatically.
+ *
+ * Checksums are neither checked nor updated. When encrypting, set each
+ * Pokémon's checksum first, or the game will treat it as a Bad Egg.
+ *
+ * \param p_pokemon_array The Pokémon to encrypt or decrypt
+ * \param num_pokemon How many Pokémon are in the array
+ * \param should_encrypt Whether to encrypt (true) or decrypt (false)
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if p_pokemon_array is NULL
+ */
+PKSAV_API enum pksav_error pksav_gen3_crypt_pokemon_array(
+    struct pksav_gen3_pc_pokemon* p_pokemon_array,
+    size_t num_pokemon,
+    bool should_encrypt
+);
+
+/*!
+ * @brief Checks the checksums of an array of Game Boy Advance Pokémon.
+ *
+ * A Pokémon whose checksum doesn't match its data is treated by the game
+ * as a Bad Egg. The checksum doesn't depend on block order, so encrypted
+ * Pokémon can be checked without decrypting them.
+ *
+ * The output is a bitmap with one bit per Pokémon, least significant bit
+ * first, set if that Pokémon's checksum is bad. It must be at least
+ * (num_pokemon + 7) / 8 bytes long.
+ *
+ * \param p_pokemon_array The Pokémon to check
+ * \param num_pokemon How many Pokémon are in the array
+ * \param are_encrypted Whether the Pokémon are encrypted
+ * \param p_bad_checksums_out Where to write the bitmap
+ * \returns ::PKSAV_ERROR_NONE upon success
+ * \returns ::PKSAV_ERROR_NULL_POINTER if either pointer is NULL
+ */
+PKSAV_API enum pksav_error pksav_gen3_verify_pokemon_checksums(
+    const struct pksav_gen3_pc_pokemon* p_pokemon_array,
+    size_t num_pokemon,
+    bool are_encrypted,
+    uint8_t* p_bad_checksums_out
+);
+
+#ifdef __cplusplus
+}
+#endif
+
 #endif /* PKSAV_GEN3_POKEMON_H */
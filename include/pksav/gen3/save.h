@@ -7,8 +7,12 @@
 #ifndef PKSAV_GEN3_SAVE_H
 #define PKSAV_GEN3_SAVE_H
 
+#include <pksav/async.h>
+#include <pksav/batch.h>
+#include <pksav/bulk.h>
 #include <pksav/config.h>
 #include <pksav/error.h>
+#include <pksav/io.h>
 
 #include <pksav/common/trainer_id.h>
 
@@ -32,6 +36,97 @@
 #define PKSAV_GEN3_SAVE_MONEY_MAX_VALUE        (999999)
 #define PKSAV_GEN3_SAVE_CASINO_COINS_MAX_VALUE (9999)
 
+/*!
+ * @brief Flags that change how a Game Boy Advance save is loaded.
+ *
+ * These can be combined and passed into
+ * ::pksav_gen3_load_save_from_buffer_with_flags or
+ * ::pksav_gen3_load_save_from_file_with_flags.
+ */
+enum pksav_gen3_load_flags
+{
+    //! Decrypt everything when the save is loaded.
+    PKSAV_GEN3_LOAD_FLAGS_NONE = 0,
+    /*!
+     * @brief Leave PC boxes encrypted until they are first accessed.
+     *
+     * With this flag set, the Pokémon in pksav_gen3_pokemon_storage.p_pc
+     * must be accessed through ::pksav_gen3_save_get_pc_box, which decrypts
+     * each box on first use. The box names, wallpapers, and current box are
+     * always accessible. When saving, only boxes that were accessed are
+     * re-encrypted.
+     */
+    PKSAV_GEN3_LOAD_LAZY_PC = (1 << 0),
+    /*!
+     * @brief Check every Pokémon's checksum while the save is loaded.
+     *
+     * The result is available through
+     * ::pksav_gen3_save_get_pokemon_checksum_report.
+     */
+    PKSAV_GEN3_LOAD_VERIFY_POKEMON_CHECKSUMS = (1 << 1),
+    /*!
+     * @brief Keep as little in memory as possible.
+     *
+     * The PC is left in the raw save. ::pksav_gen3_save_get_pc_box decrypts
+     * just the requested box into its own buffer, and only
+     * ::pksav_gen3_save_get_pc brings the whole PC into memory, so
+     * pksav_gen3_pokemon_storage.p_pc is NULL until then.
+     */
+    PKSAV_GEN3_LOAD_COMPACT = (1 << 2)
+};
+
+/*!
+ * @brief Which Pokémon in a save have bad checksums.
+ *
+ * Each field is a bitmap, least significant bit first, with a bit set for
+ * each Pokémon whose checksum doesn't match its data. The game treats these
+ * Pokémon as Bad Eggs.
+ */
+struct pksav_gen3_pokemon_checksum_report
+{
+    //! One bit for each party slot.
+    uint8_t party;
+    //! One bit for each slot in each PC box.
+    uint32_t pc_boxes[PKSAV_GEN3_NUM_POKEMON_BOXES];
+    //! One bit for each daycare slot.
+    uint8_t daycare;
+};
+
+/*!
+ * @brief A summary of a save, read without loading the whole thing.
+ *
+ * This is filled by ::pksav_gen3_peek_save_from_file and
+ * ::pksav_gen3_peek_save_from_io. Values are stored the same way as they are
+ * in the save.
+ */
+struct pksav_gen3_save_peek
+{
+    enum pksav_gen3_save_type save_type;
+
+    /*!
+     * @brief The trainer's name, including its terminator.
+     *
+     * This value should be accessed with ::pksav_gen3_import_text with a
+     * num_chars value of 7.
+     */
+    uint8_t trainer_name[PKSAV_GEN3_TRAINER_NAME_LENGTH + 1];
+
+    union pksav_trainer_id trainer_id;
+
+    struct pksav_gen3_time time_played;
+
+    //! How many Pokémon are in the party (0-6).
+    uint8_t party_count;
+
+    /*!
+     * @brief The species of each Pokémon in the party.
+     *
+     * These values are stored in little-endian, so access them with
+     * ::pksav_littleendian16. Entries past party_count are 0.
+     */
+    uint16_t party_species[PKSAV_GEN3_PARTY_NUM_POKEMON];
+};
+
 struct pksav_gen3_options
 {
     uint8_t* p_button_mode;
@@ -141,6 +236,54 @@ PKSAV_API enum pksav_error pksav_gen3_get_file_save_type(
     enum pksav_gen3_save_type* p_save_type_out
 );
 
+//! Get the type of the save behind an I/O backend.
+/*!
+ * Only the active slot's section footers and section 0 are read.
+ *
+ * \param p_io the backend to read from
+ * \param p_save_type_out where to place the save type
+ * \returns PKSAV_ERROR_NONE upon success
+ * \returns PKSAV_ERROR_NULL_POINTER if p_io, p_save_type_out, or a needed
+ *          callback is NULL
+ * \returns PKSAV_ERROR_FILE_IO if the backend fails
+ */
+PKSAV_API enum pksav_error pksav_gen3_get_io_save_type(
+    const struct pksav_io* p_io,
+    enum pksav_gen3_save_type* p_save_type_out
+);
+
+//! Read a summary of a save file without loading it.
+/*!
+ * Only the section footers, the trainer info, and the party are read, so
+ * this is much cheaper than loading the save when only these are needed.
+ *
+ * \param p_filepath the save file to read
+ * \param p_peek_out where to place the summary
+ * \returns PKSAV_ERROR_NONE upon success
+ * \returns PKSAV_ERROR_NULL_POINTER if p_filepath or p_peek_out is NULL
+ * \returns PKSAV_ERROR_FILE_IO if the file can't be read
+ * \returns PKSAV_ERROR_INVALID_SAVE if the file isn't a valid save
+ */
+PKSAV_API enum pksav_error pksav_gen3_peek_save_from_file(
+    const char* p_filepath,
+    struct pksav_gen3_save_peek* p_peek_out
+);
+
+//! Read a summary of the save behind an I/O backend without loading it.
+/*!
+ * \param p_io the backend to read from
+ * \param p_peek_out where to place the summary
+ * \returns PKSAV_ERROR_NONE upon success
+ * \returns PKSAV_ERROR_NULL_POINTER if p_io, p_peek_out, or a needed
+ *          callback is NULL
+ * \returns PKSAV_ERROR_FILE_IO if the backend fails
+ * \returns PKSAV_ERROR_INVALID_SAVE if the backend doesn't contain a valid save
+ */
+PKSAV_API enum pksav_error pksav_gen3_peek_save_from_io(
+    const struct pksav_io* p_io,
+    struct pksav_gen3_save_peek* p_peek_out
+);
+
 PKSAV_API enum pksav_error pksav_gen3_load_save_from_buffer(
     uint8_t* p_buffer,
     size_t buffer_len,
@@ -152,11 +295,305 @@ PKSAV_API enum pksav_error pksav_gen3_load_save_from_file(
     struct pksav_gen3_save* p_gen3_save_out
 );
 
+PKSAV_API enum pksav_error pksav_gen3_load_save_from_buffer_with_flags(
+    uint8_t* p_buffer,
+    size_t buffer_len,
+    uint32_t load_flags,
+    struct pksav_gen3_save* p_gen3_save_out
+);
+
+PKSAV_API enum pksav_error pksav_gen3_load_save_from_file_with_flags(
+    const char* p_filepath,
+    uint32_t load_flags,
+    struct pksav_gen3_save* p_gen3_save_out
+);
+
+//! Load a save so that edits are made directly to the file.
+/*!
+ * The file is mapped into memory and shared with anything else that has it
+ * open, such as an emulator. Edits to the party and to the first five sections
+ * are made to decrypted copies, so they only reach the file when
+ * ::pksav_gen3_save_commit writes the next save slot and flushes it to disk.
+ * Saving to anywhere else leaves the file untouched.
+ *
+ * This needs mmap, so it's not available on every platform.
+ *
+ * \param p_filepath the save file to load
+ * \param load_flags any combination of ::pksav_gen3_load_flags
+ * \param p_gen3_save_out where to load the save
+ * \returns PKSAV_ERROR_NONE upon success
+ * \returns PKSAV_ERROR_NULL_POINTER if p_filepath or p_gen3_save_out is NULL
+ * \returns PKSAV_ERROR_FILE_IO if the file can't be mapped
+ * \returns PKSAV_ERROR_INVALID_SAVE if the file isn't a valid save
+ * \returns PKSAV_ERROR_OUT_OF_MEMORY if the loaded save couldn't be allocated
+ */
+PKSAV_API enum pksav_error pksav_gen3_load_save_from_file_in_place(
+    const char* p_filepath,
+    uint32_t load_flags,
+    struct pksav_gen3_save* p_gen3_save_out
+);
+
+//! Load a save through an I/O backend.
+/*!
+ * The save is read into memory, so the backend doesn't need to outlive the
+ * loaded save.
+ *
+ * \param p_io the backend to read from
+ * \param load_flags any combination of ::pksav_gen3_load_flags
+ * \param p_gen3_save_out where to load the save
+ * \returns PKSAV_ERROR_NONE upon success
+ * \returns PKSAV_ERROR_NULL_POINTER if p_io, p_gen3_save_out, or a needed
+ *          callback is NULL
+ * \returns PKSAV_ERROR_FILE_IO if the backend fails
+ * \returns PKSAV_ERROR_INVALID_SAVE if the backend doesn't contain a valid save
+ * \returns PKSAV_ERROR_OUT_OF_MEMORY if the save couldn't be read into memory
+ *          or the loaded save couldn't be allocated
+ */
+PKSAV_API enum pksav_error pksav_gen3_load_save_from_io(
+    const struct pksav_io* p_io,
+    uint32_t load_flags,
+    struct pksav_gen3_save* p_gen3_save_out
+);
+
+//! Load many save files, passing each one to a callback.
+/*!
+ * On Linux, opens and reads are submitted through io_uring, with up to
+ * the queue depth in flight at once. Elsewhere, or if io_uring isn't
+ * available, a pool of threads does the same. Each file is then loaded
+ * as if by ::pksav_gen3_load_save_from_buffer_with_flags.
+ *
+ * The callback is called once per file, in no particular order and never
+ * concurrently, but possibly from another thread. If the file couldn't be
+ * loaded, error says why and p_gen3_save is NULL. The save is freed
+ * once the callback returns. Files over 1 MiB are rejected without being
+ * read.
+ *
+ * \param pp_filepaths the save files to load
+ * \param num_filepaths how many save files to load
+ * \param load_flags any combination of ::pksav_gen3_load_flags
+ * \param p_options how to load the files, or NULL for the defaults
+ * \param p_callback called with each result
+ * \param p_user_data passed to p_callback
+ * \returns PKSAV_ERROR_NONE upon success, even if some files failed to load
+ * \returns PKSAV_ERROR_NULL_POINTER if pp_filepaths, a filepath, or p_callback is NULL
+ * \returns PKSAV_ERROR_FILE_IO if ::PKSAV_BULK_BACKEND_IO_URING was requested
+ *          but isn't available
+ */
+PKSAV_API enum pksav_error pksav_gen3_bulk_load_saves(
+    const char* const* pp_filepaths,
+    size_t num_filepaths,
+    uint32_t load_flags,
+    const struct pksav_bulk_load_options* p_options,
+    void (*p_callback)(
+        size_t filepath_index,
+        enum pksav_error error,
+        struct pksav_gen3_save* p_gen3_save,
+        void* p_user_data
+    ),
+    void* p_user_data
+);
+
+//! Get a decrypted PC box from a loaded save.
+/*!
+ * If the save was loaded with ::PKSAV_GEN3_LOAD_LAZY_PC, the box is decrypted
+ * the first time it is accessed. If it was loaded with
+ * ::PKSAV_GEN3_LOAD_COMPACT, the box is also read into its own buffer, which
+ * moves into the PC if ::pksav_gen3_save_get_pc is called later. Otherwise,
+ * this returns a pointer into the already-decrypted PC.
+ *
+ * \param p_gen3_save the save containing the PC
+ * \param box_num which box to access (0-13)
+ * \param pp_box_out where to place the pointer to the box
+ * \returns PKSAV_ERROR_NONE upon success
+ * \returns PKSAV_ERROR_NULL_POINTER if p_gen3_save or pp_box_out is NULL
+ * \returns PKSAV_ERROR_PARAM_OUT_OF_RANGE if box_num is not a valid box
+ * \returns PKSAV_ERROR_OUT_OF_MEMORY if the box couldn't be allocated
+ */
+PKSAV_API enum pksav_error pksav_gen3_save_get_pc_box(
+    struct pksav_gen3_save* p_gen3_save,
+    uint8_t box_num,
+    struct pksav_gen3_pokemon_box** pp_box_out
+);
+
+//! Get a loaded save's PC, with every box decrypted.
+/*!
+ * This is mainly for saves loaded with ::PKSAV_GEN3_LOAD_COMPACT, whose PC
+ * isn't otherwise accessible until a box is accessed.
+ *
+ * \param p_gen3_save the save containing the PC
+ * \param pp_pc_out where to place the pointer to the PC
+ * \returns PKSAV_ERROR_NONE upon success
+ * \returns PKSAV_ERROR_NULL_POINTER if p_gen3_save or pp_pc_out is NULL
+ * \returns PKSAV_ERROR_OUT_OF_MEMORY if the PC couldn't be allocated
+ */
+PKSAV_API enum pksav_error pksav_gen3_save_get_pc(
+    struct pksav_gen3_save* p_gen3_save,
+    struct pksav_gen3_pokemon_pc** pp_pc_out
+);
+
+//! Get which Pokémon in a loaded save have bad checksums.
+/*!
+ * If the save was loaded with ::PKSAV_GEN3_LOAD_VERIFY_POKEMON_CHECKSUMS,
+ * this returns the report made while loading. Otherwise, the Pokémon are
+ * checked in their current state when this is called, including PC boxes
+ * that are still encrypted.
+ *
+ * \param p_gen3_save the save to check
+ * \param p_report_out where to place the report
+ * \returns PKSAV_ERROR_NONE upon success
+ * \returns PKSAV_ERROR_NULL_POINTER if p_gen3_save or p_report_out is NULL
+ */
+PKSAV_API enum pksav_error pksav_gen3_save_get_pokemon_checksum_report(
+    const struct pksav_gen3_save* p_gen3_save,
+    struct pksav_gen3_pokemon_checksum_report* p_report_out
+);
+
 PKSAV_API enum pksav_error pksav_gen3_save_save(
     const char* p_filepath,
     struct pksav_gen3_save* p_gen3_save
 );
 
+//! Write a save to a buffer instead of a file.
+/*!
+ * If p_buffer is the buffer the save was loaded from, the save is updated
+ * in place and nothing is copied.
+ *
+ * \param p_gen3_save the save to write
+ * \param p_buffer where to write the save
+ * \param buffer_len the size of p_buffer, which must be at least the size of
+ *                   the buffer or file the save was loaded from
+ * \returns PKSAV_ERROR_NONE upon success
+ * \returns PKSAV_ERROR_NULL_POINTER if p_gen3_save or p_buffer is NULL
+ * \returns PKSAV_ERROR_PARAM_OUT_OF_RANGE if buffer_len is too small
+ */
+PKSAV_API enum pksav_error pksav_gen3_save_save_to_buffer(
+    struct pksav_gen3_save* p_gen3_save,
+    uint8_t* p_buffer,
+    size_t buffer_len
+);
+
+//! Write a save through an I/O backend.
+/*!
+ * \param p_gen3_save the save to write
+ * \param p_io the backend to write to
+ * \returns PKSAV_ERROR_NONE upon success
+ * \returns PKSAV_ERROR_NULL_POINTER if p_gen3_save, p_io, or p_io->write_at
+ *          is NULL
+ * \returns PKSAV_ERROR_FILE_IO if the backend fails
+ * \returns PKSAV_ERROR_OUT_OF_MEMORY if a save loaded in place couldn't be
+ *          copied to write from
+ */
+PKSAV_API enum pksav_error pksav_gen3_save_save_to_io(
+    struct pksav_gen3_save* p_gen3_save,
+    const struct pksav_io* p_io
+);
+
+//! Write only what changed in a save back to an existing file.
+/*!
+ * Only the slot the save is written to is written, as a single write, so
+ * the file must already contain the rest of the save, such as the file
+ * the save was loaded from.
+ *
+ * \param p_filepath the existing file to write to
+ * \param p_gen3_save the save to write
+ * \param should_sync whether to wait for the changes to reach storage
+ * \returns PKSAV_ERROR_NONE upon success
+ * \returns PKSAV_ERROR_NULL_POINTER if p_filepath or p_gen3_save is NULL
+ * \returns PKSAV_ERROR_PARAM_OUT_OF_RANGE if the file is smaller than the save
+ * \returns PKSAV_ERROR_FILE_IO if the file can't be opened, written, or synced
+ * \returns PKSAV_ERROR_OUT_OF_MEMORY if a save loaded in place couldn't be
+ *          copied to write from
+ */
+PKSAV_API enum pksav_error pksav_gen3_save_save_changes(
+    const char* p_filepath,
+    struct pksav_gen3_save* p_gen3_save,
+    bool should_sync
+);
+
+//! Write only what changed in a save through an I/O backend.
+/*!
+ * Only the slot the save is written to is written, so the backend must
+ * already contain the rest of the save.
+ *
+ * \param p_gen3_save the save to write
+ * \param p_io the backend to write to
+ * \returns PKSAV_ERROR_NONE upon success
+ * \returns PKSAV_ERROR_NULL_POINTER if p_gen3_save, p_io, or a needed
+ *          callback is NULL
+ * \returns PKSAV_ERROR_PARAM_OUT_OF_RANGE if the backend is smaller than
+ *          the save
+ * \returns PKSAV_ERROR_FILE_IO if the backend fails
+ * \returns PKSAV_ERROR_OUT_OF_MEMORY if a save loaded in place couldn't be
+ *          copied to write from
+ */
+PKSAV_API enum pksav_error pksav_gen3_save_save_changes_to_io(
+    struct pksav_gen3_save* p_gen3_save,
+    const struct pksav_io* p_io
+);
+
+//! Write a save in the background.
+/*!
+ * The save is encoded into a snapshot before this returns, so it can be
+ * edited or freed right away. The snapshot is then written to the file by
+ * one of the writer's threads.
+ *
+ * \param p_filepath where to write the save
+ * \param p_gen3_save the save to write
+ * \param p_writer the pool to write with
+ * \param p_callback called with the result once the write finishes, or NULL
+ * \param p_user_data passed to p_callback
+ * \returns PKSAV_ERROR_NONE if the write was queued
+ * \returns PKSAV_ERROR_NULL_POINTER if p_filepath, p_gen3_save, or p_writer is NULL
+ * \returns PKSAV_ERROR_OUT_OF_MEMORY if the write couldn't be queued, in
+ *          which case p_callback is never called
+ */
+PKSAV_API enum pksav_error pksav_gen3_save_save_async(
+    const char* p_filepath,
+    struct pksav_gen3_save* p_gen3_save,
+    struct pksav_async_writer* p_writer,
+    void (*p_callback)(
+        enum pksav_error error,
+        void* p_user_data
+    ),
+    void* p_user_data
+);
+
+//! Add a save to a batch, to be written when the batch is committed.
+/*!
+ * The save is written to a temporary file next to p_filepath before this
+ * returns, so it can be edited or freed right away. The file at
+ * p_filepath isn't touched until ::pksav_save_batch_commit.
+ *
+ * \param p_filepath where to write the save
+ * \param p_gen3_save the save to write
+ * \param p_batch the batch to add the save to
+ * \returns PKSAV_ERROR_NONE upon success
+ * \returns PKSAV_ERROR_NULL_POINTER if p_filepath, p_gen3_save, or p_batch is NULL
+ * \returns PKSAV_ERROR_FILE_IO if the temporary file couldn't be written
+ * \returns PKSAV_ERROR_OUT_OF_MEMORY if the batch couldn't grow, or if a save
+ *          loaded in place couldn't be copied to write from
+ */
+PKSAV_API enum pksav_error pksav_gen3_save_save_to_batch(
+    const char* p_filepath,
+    struct pksav_gen3_save* p_gen3_save,
+    struct pksav_save_batch* p_batch
+);
+
+//! Commit a save loaded with ::pksav_gen3_load_save_from_file_in_place.
+/*!
+ * Instead of rewriting the whole file, the save is encrypted into the less
+ * recent of the file's two slots, and only that slot is flushed.
+ *
+ * \param p_gen3_save the save to commit
+ * \returns PKSAV_ERROR_NONE upon success
+ * \returns PKSAV_ERROR_NULL_POINTER if p_gen3_save is NULL
+ * \returns PKSAV_ERROR_PARAM_OUT_OF_RANGE if the save wasn't loaded in place
+ * \returns PKSAV_ERROR_FILE_IO if the changes couldn't be flushed
+ */
+PKSAV_API enum pksav_error pksav_gen3_save_commit(
+    struct pksav_gen3_save* p_gen3_save
+);
+
 PKSAV_API enum pksav_error pksav_gen3_free_save(
     struct pksav_gen3_save* p_gen3_save
 );
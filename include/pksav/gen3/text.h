@@ -10,9 +10,14 @@
 #include <pksav/config.h>
 #include <pksav/error.h>
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
 
+//! The smallest output arena ::pksav_gen3_import_text_batch accepts.
+#define PKSAV_GEN3_TEXT_BATCH_ARENA_LEN(num_records,num_chars) \
+    ((num_records) * (num_chars) * 3)
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -37,6 +42,67 @@ PKSAV_API enum pksav_error pksav_gen3_import_text(
     size_t num_chars
 );
 
+//! Convert a string from Game Boy Advance format to a UTF-8 C string of a given size
+/*!
+ * Unlike ::pksav_gen3_import_text, the size of the output buffer is passed
+ * separately from the number of characters, and the output is always
+ * NUL-terminated. Nothing is allocated.
+ *
+ * \param p_input_buffer Game Boy Advance string
+ * \param num_chars the maximum number of characters to convert
+ * \param p_output_text output buffer in which to place converted text
+ * \param output_text_len the size of p_output_text, including the NUL
+ * \param p_num_bytes_out where to place the number of bytes written, not
+ *                        including the NUL
+ * \param p_is_truncated_out where to place whether the text was cut short
+ *                           because p_output_text was full
+ * \returns PKSAV_ERROR_NONE upon success
+ * \returns PKSAV_ERROR_NULL_POINTER if any pointer parameter is NULL
+ * \returns PKSAV_ERROR_PARAM_OUT_OF_RANGE if output_text_len is 0
+ */
+PKSAV_API enum pksav_error pksav_gen3_import_text_bounded(
+    const uint8_t* p_input_buffer,
+    size_t num_chars,
+    char* p_output_text,
+    size_t output_text_len,
+    size_t* p_num_bytes_out,
+    bool* p_is_truncated_out
+);
+
+//! Convert many fixed-size Game Boy Advance strings to UTF-8 at once
+/*!
+ * This converts an array of records in one call, such as every nickname in
+ * a box, with SIMD table lookups where the CPU supports them.
+ *
+ * Record i starts at p_records + (i * record_stride) and is num_chars
+ * characters long, so a name can be picked out of an array of structs. Its
+ * UTF-8 text is placed in p_output_arena, from p_offsets_out[i] up to
+ * p_offsets_out[i+1], with no NUL.
+ *
+ * \param p_records the first record
+ * \param record_stride the number of bytes from one record to the next
+ * \param num_records how many records to convert
+ * \param num_chars the number of characters in each record
+ * \param p_output_arena where to place the converted text
+ * \param output_arena_len the size of p_output_arena, which must be at least
+ *                         PKSAV_GEN3_TEXT_BATCH_ARENA_LEN(num_records, num_chars)
+ * \param p_offsets_out where to place each record's offset into the arena,
+ *                      which must have room for num_records + 1 entries
+ * \returns PKSAV_ERROR_NONE upon success
+ * \returns PKSAV_ERROR_NULL_POINTER if any pointer parameter is NULL
+ * \returns PKSAV_ERROR_PARAM_OUT_OF_RANGE if records overlap or the arena is
+ *          too small
+ */
+PKSAV_API enum pksav_error pksav_gen3_import_text_batch(
+    const uint8_t* p_records,
+    size_t record_stride,
+    size_t num_records,
+    size_t num_chars,
+    char* p_output_arena,
+    size_t output_arena_len,
+    size_t* p_offsets_out
+);
+
 //! Convert a UTF-8 string to Game Boy Advance format
 /*!
  * In Game Boy Advance games, strings are stored with a proprietary character
@@ -57,6 +123,30 @@ PKSAV_API enum pksav_error pksav_gen3_export_text(
     size_t num_chars
 );
 
+//! Convert a UTF-8 C string to Game Boy Advance format, reporting what was converted
+/*!
+ * This works like ::pksav_gen3_export_text, but also reports how many
+ * characters were written, and whether any of the input was left over,
+ * either because it didn't fit or because it has a character that can't be
+ * stored in Game Boy Advance format.
+ *
+ * \param p_input_text C string to convert
+ * \param p_output_buffer output buffer in which to place Game Boy Advance string
+ * \param num_chars the size of p_output_buffer, in characters
+ * \param p_num_chars_out where to place the number of characters written
+ * \param p_is_truncated_out where to place whether any of p_input_text wasn't
+ *                           converted
+ * \returns PKSAV_ERROR_NONE upon success
+ * \returns PKSAV_ERROR_NULL_POINTER if any pointer parameter is NULL
+ */
+PKSAV_API enum pksav_error pksav_gen3_export_text_bounded(
+    const char* p_input_text,
+    uint8_t* p_output_buffer,
+    size_t num_chars,
+    size_t* p_num_chars_out,
+    bool* p_is_truncated_out
+);
+
 #ifdef __cplusplus
 }
 #endif
@@ -10,6 +10,7 @@
 #include <pksav/config.h>
 #include <pksav/error.h>
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
 
@@ -36,6 +37,33 @@ PKSAV_API enum pksav_error pksav_gen5_import_text(
     size_t num_chars
 );
 
+//! Convert a string from Generation V format to a UTF-8 C string of a given size
+/*!
+ * Unlike ::pksav_gen5_import_text, the size of the output buffer is passed
+ * separately from the number of characters, and the output is always
+ * NUL-terminated. Nothing is allocated.
+ *
+ * \param p_input_buffer Generation V string
+ * \param num_chars the maximum number of characters to convert
+ * \param p_output_text output buffer in which to place converted text
+ * \param output_text_len the size of p_output_text, including the NUL
+ * \param p_num_bytes_out where to place the number of bytes written, not
+ *                        including the NUL
+ * \param p_is_truncated_out where to place whether the text was cut short
+ *                           because p_output_text was full
+ * \returns PKSAV_ERROR_NONE upon success
+ * \returns PKSAV_ERROR_NULL_POINTER if any pointer parameter is NULL
+ * \returns PKSAV_ERROR_PARAM_OUT_OF_RANGE if output_text_len is 0
+ */
+PKSAV_API enum pksav_error pksav_gen5_import_text_bounded(
+    const uint16_t* p_input_buffer,
+    size_t num_chars,
+    char* p_output_text,
+    size_t output_text_len,
+    size_t* p_num_bytes_out,
+    bool* p_is_truncated_out
+);
+
 //! Convert a multi-byte C string to a string in Generation V's format
 /*!
  * In Generation V, strings are stored in Unicode.
@@ -55,6 +83,30 @@ PKSAV_API enum pksav_error pksav_gen5_export_text(
     size_t num_chars
 );
 
+//! Convert a UTF-8 C string to Generation V format, reporting what was converted
+/*!
+ * This works like ::pksav_gen5_export_text, but also reports how many
+ * characters were written, and whether any of the input was left over,
+ * either because it didn't fit or because it has a character that can't be
+ * stored in Generation V format.
+ *
+ * \param p_input_text C string to convert
+ * \param p_output_buffer output buffer in which to place Generation V string
+ * \param num_chars the size of p_output_buffer, in characters
+ * \param p_num_chars_out where to place the number of characters written
+ * \param p_is_truncated_out where to place whether any of p_input_text wasn't
+ *                           converted
+ * \returns PKSAV_ERROR_NONE upon success
+ * \returns PKSAV_ERROR_NULL_POINTER if any pointer parameter is NULL
+ */
+PKSAV_API enum pksav_error pksav_gen5_export_text_bounded(
+    const char* p_input_text,
+    uint16_t* p_output_buffer,
+    size_t num_chars,
+    size_t* p_num_chars_out,
+    bool* p_is_truncated_out
+);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#ifndef PKSAV_IO_H
+#define PKSAV_IO_H
+
+#include <pksav/config.h>
+#include <pksav/error.h>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/*!
+ * @brief An I/O backend for loading and saving saves.
+ *
+ * Loaders read and write through these callbacks with explicit offsets, so
+ * they don't depend on where the save is stored or on any stream position.
+ * Backends for file descriptors, FILE pointers, and memory buffers are
+ * provided, but any struct with valid callbacks can be used.
+ */
+struct pksav_io
+{
+    /*!
+     * @brief Read num_bytes bytes starting at the given offset.
+     *
+     * Reading fewer bytes than requested is an error.
+     */
+    enum pksav_error (*read_at)(
+        const struct pksav_io* p_io,
+        size_t offset,
+        uint8_t* p_buffer_out,
+        size_t num_bytes
+    );
+
+    /*!
+     * @brief Write num_bytes bytes starting at the given offset.
+     *
+     * This may be NULL for a read-only backend.
+     */
+    enum pksav_error (*write_at)(
+        const struct pksav_io* p_io,
+        size_t offset,
+        const uint8_t* p_buffer,
+        size_t num_bytes
+    );
+
+    //! Get the total size of the underlying storage.
+    enum pksav_error (*get_size)(
+        const struct pksav_io* p_io,
+        size_t* p_size_out
+    );
+
+    /*!
+     * @brief Make sure everything written so far has reached storage.
+     *
+     * This may be NULL if the backend has nothing to flush.
+     */
+    enum pksav_error (*sync)(
+        const struct pksav_io* p_io
+    );
+
+    //! Passed to the callbacks as part of p_io.
+    void* p_context;
+
+    //! Used by the built-in backends. Custom backends can ignore this.
+    union
+    {
+        int fd;
+        size_t buffer_len;
+    } builtin_state;
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//! Use an open file descriptor as an I/O backend.
+/*!
+ * Reads and writes are positioned, so the descriptor's offset is never
+ * used or changed. Syncing uses fdatasync where it's available. The
+ * descriptor is not closed by PKSav.
+ *
+ * \param fd an open file descriptor
+ * \param p_io_out where to set up the backend
+ * \returns PKSAV_ERROR_NONE upon success
+ * \returns PKSAV_ERROR_NULL_POINTER if p_io_out is NULL
+ * \returns PKSAV_ERROR_PARAM_OUT_OF_RANGE if fd is negative
+ * \returns PKSAV_ERROR_FILE_IO if positioned I/O isn't available on this platform
+ */
+PKSAV_API enum pksav_error pksav_io_init_fd(
+    int fd,
+    struct pksav_io* p_io_out
+);
+
+//! Use an open FILE pointer as an I/O backend.
+/*!
+ * Every read and write seeks first, so the stream's position is not
+ * preserved. Every write is flushed to the OS, and syncing also flushes
+ * the OS's buffers where possible. The stream is not closed by PKSav.
+ *
+ * \param p_file an open stream
+ * \param p_io_out where to set up the backend
+ * \returns PKSAV_ERROR_NONE upon success
+ * \returns PKSAV_ERROR_NULL_POINTER if p_file or p_io_out is NULL
+ */
+PKSAV_API enum pksav_error pksav_io_init_file(
+    FILE* p_file,
+    struct pksav_io* p_io_out
+);
+
+//! Use a memory buffer as an I/O backend.
+/*!
+ * The buffer must outlive the backend. Writes past the end of the buffer
+ * fail rather than growing it. There is nothing to sync, so the sync
+ * callback is NULL.
+ *
+ * \param p_buffer the buffer to read from and write to
+ * \param buffer_len the size of p_buffer
+ * \param p_io_out where to set up the backend
+ * \returns PKSAV_ERROR_NONE upon success
+ * \returns PKSAV_ERROR_NULL_POINTER if p_buffer or p_io_out is NULL
+ */
+PKSAV_API enum pksav_error pksav_io_init_memory(
+    uint8_t* p_buffer,
+    size_t buffer_len,
+    struct pksav_io* p_io_out
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PKSAV_IO_H */
@@ -8,84 +8,67 @@
 #include "util/text_common.h"
 #include "common/xds_common.h"
 
-#include <assert.h>
-#include <string.h>
+#include <stdbool.h>
 
 #define PKSAV_XDS_TERMINATOR 0xFFFF
 
-static enum pksav_error _pksav_xds_import_widetext(
-    const uint16_t* p_input_buffer,
-    wchar_t* p_output_widetext,
-    size_t num_chars
+static uint32_t _pksav_xds_import_char(
+    uint16_t game_char
 )
 {
-    assert(p_input_buffer != NULL);
-    assert(p_output_widetext != NULL);
-
-    memset(p_output_widetext, 0, sizeof(wchar_t)*num_chars);
-
-    for(size_t char_index = 0; char_index < num_chars; ++char_index)
-    {
-        if(p_input_buffer[char_index] == PKSAV_XDS_TERMINATOR)
-        {
-            break;
-        }
-        else
-        {
-            p_output_widetext[char_index] = (wchar_t)p_input_buffer[char_index];
-        }
-    }
-
-    return PKSAV_ERROR_NONE;
+    // Code units are UCS-2, so a lone surrogate half ends the string.
+    return (game_char == PKSAV_XDS_TERMINATOR) ? 0 : game_char;
 }
 
-static enum pksav_error _pksav_xds_export_widetext(
-    const wchar_t* p_input_widetext,
-    uint16_t* p_output_buffer,
-    size_t num_chars
+static ssize_t _pksav_xds_export_char(
+    uint32_t code_point
 )
 {
-    assert(p_input_widetext != NULL);
-    assert(p_output_buffer != NULL);
-
-    memset(p_output_buffer, 0xFF, sizeof(uint16_t)*num_chars);
-
-    for(size_t char_index = 0; char_index < num_chars; ++char_index)
-    {
-        if(p_input_widetext[char_index] == 0)
-        {
-            break;
-        }
-        else
-        {
-            p_output_buffer[char_index] = (uint16_t)p_input_widetext[char_index];
-        }
-    }
-
-    return PKSAV_ERROR_NONE;
+    // Code units are UCS-2, so there's no way to store anything past the
+    // Basic Multilingual Plane.
+    return (code_point > 0xFFFF) ? -1 : (ssize_t)code_point;
 }
 
+static const struct pksav_text_codec PKSAV_XDS_TEXT_CODEC =
+{
+    .char_size = sizeof(uint16_t),
+    .terminator = PKSAV_XDS_TERMINATOR,
+    .p_import_char = _pksav_xds_import_char,
+    .p_export_char = _pksav_xds_export_char
+};
+
 enum pksav_error pksav_xds_import_text(
     const uint16_t* p_input_buffer,
     char* p_output_text,
     size_t num_chars
 )
 {
-    if(!p_input_buffer || !p_output_text)
-    {
-        return PKSAV_ERROR_NULL_POINTER;
-    }
-
-    wchar_t* p_widetext = calloc(num_chars, sizeof(wchar_t));
-    _pksav_xds_import_widetext(
-        p_input_buffer, p_widetext, num_chars
-    );
-
-    memset(p_output_text, 0, num_chars);
-    pksav_wcstombs(p_output_text, p_widetext, num_chars);
-    free(p_widetext);
+    return pksav_text_import(
+               &PKSAV_XDS_TEXT_CODEC,
+               p_input_buffer,
+               p_output_text,
+               num_chars
+           );
+}
 
-    return PKSAV_ERROR_NONE;
+enum pksav_error pksav_xds_import_text_bounded(
+    const uint16_t* p_input_buffer,
+    size_t num_chars,
+    char* p_output_text,
+    size_t output_text_len,
+    size_t* p_num_bytes_out,
+    bool* p_is_truncated_out
+)
+{
+    return pksav_text_import_bounded(
+               &PKSAV_XDS_TEXT_CODEC,
+               p_input_buffer,
+               num_chars,
+               p_output_text,
+               output_text_len,
+               p_num_bytes_out,
+               p_is_truncated_out
+           );
 }
 
 enum pksav_error pksav_xds_export_text(
@@ -94,19 +77,28 @@ enum pksav_error pksav_xds_export_text(
     size_t num_chars
 )
 {
-    if(!p_input_text || !p_output_buffer)
-    {
-        return PKSAV_ERROR_NULL_POINTER;
-    }
-
-    wchar_t* p_widetext = calloc(num_chars, sizeof(wchar_t));
-    pksav_mbstowcs(p_widetext, p_input_text, num_chars);
-
-    _pksav_xds_export_widetext(
-        p_widetext, p_output_buffer, num_chars
-    );
-
-    free(p_widetext);
+    return pksav_text_export(
+               &PKSAV_XDS_TEXT_CODEC,
+               p_input_text,
+               p_output_buffer,
+               num_chars
+           );
+}
 
-    return PKSAV_ERROR_NONE;
+enum pksav_error pksav_xds_export_text_bounded(
+    const char* p_input_text,
+    uint16_t* p_output_buffer,
+    size_t num_chars,
+    size_t* p_num_chars_out,
+    bool* p_is_truncated_out
+)
+{
+    return pksav_text_export_bounded(
+               &PKSAV_XDS_TEXT_CODEC,
+               p_input_text,
+               p_output_buffer,
+               num_chars,
+               p_num_chars_out,
+               p_is_truncated_out
+           );
 }
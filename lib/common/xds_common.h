@@ -9,6 +9,7 @@
 
 #include <pksav/error.h>
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
 
@@ -19,6 +20,16 @@ enum pksav_error pksav_xds_import_text(
     size_t num_chars
 );
 
+//! Like pksav_xds_import_text, but with a separate, NUL-terminated output size.
+enum pksav_error pksav_xds_import_text_bounded(
+    const uint16_t* p_input_buffer,
+    size_t num_chars,
+    char* p_output_text,
+    size_t output_text_len,
+    size_t* p_num_bytes_out,
+    bool* p_is_truncated_out
+);
+
 //! Convert a multi-byte C string to in-game Unicode.
 enum pksav_error pksav_xds_export_text(
     const char* p_input_text,
@@ -26,4 +37,13 @@ enum pksav_error pksav_xds_export_text(
     size_t num_chars
 );
 
+//! Like pksav_xds_export_text, but reports what was converted.
+enum pksav_error pksav_xds_export_text_bounded(
+    const char* p_input_text,
+    uint16_t* p_output_buffer,
+    size_t num_chars,
+    size_t* p_num_chars_out,
+    bool* p_is_truncated_out
+);
+
 #endif /* PKSAV_COMMON_XDS_COMMON_H */
@@ -0,0 +1,486 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "gen3/save_internal.h"
+#include "util/fs.h"
+
+#include <pksav/detect.h>
+
+#include <pksav/gen1/save.h>
+#include <pksav/gen2/save.h>
+#include <pksav/gen3/save.h>
+
+#include <assert.h>
+#include <stdbool.h>
+#include <string.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#    include <unistd.h>
+#endif
+
+#if defined(_POSIX_THREADS) && (_POSIX_THREADS > 0)
+#    define PKSAV_SCAN_HAVE_THREADS
+#    include <pthread.h>
+#endif
+
+enum pksav_error pksav_detect_save_type(
+    const uint8_t* p_buffer,
+    size_t buffer_len,
+    struct pksav_save_type* p_save_type_out
+)
+{
+    if(!p_buffer || !p_save_type_out)
+    {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    memset(p_save_type_out, 0, sizeof(*p_save_type_out));
+
+    // Game Boy saves are smaller than a single Generation III save slot,
+    // so only buffers large enough for a slot need the Generation III
+    // check. It usually fails on the first section footer it reads.
+    if(buffer_len >= PKSAV_GEN3_SAVE_SLOT_SIZE)
+    {
+        enum pksav_gen3_save_type gen3_save_type = PKSAV_GEN3_SAVE_TYPE_NONE;
+        pksav_gen3_get_buffer_save_type(
+            p_buffer,
+            buffer_len,
+            &gen3_save_type
+        );
+        if(gen3_save_type != PKSAV_GEN3_SAVE_TYPE_NONE)
+        {
+            p_save_type_out->generation = PKSAV_GENERATION_3;
+            p_save_type_out->gen3_save_type = gen3_save_type;
+
+            return PKSAV_ERROR_NONE;
+        }
+    }
+
+    // Generation I and II saves are the same size. Generation II is checked
+    // first, since a Generation II save is much likelier to match the
+    // one-byte Generation I checksum by chance than the other way around.
+    if(buffer_len >= PKSAV_GEN2_SAVE_SIZE)
+    {
+        enum pksav_gen2_save_type gen2_save_type = PKSAV_GEN2_SAVE_TYPE_NONE;
+        pksav_gen2_get_buffer_save_type(
+            p_buffer,
+            buffer_len,
+            &gen2_save_type
+        );
+        if(gen2_save_type != PKSAV_GEN2_SAVE_TYPE_NONE)
+        {
+            p_save_type_out->generation = PKSAV_GENERATION_2;
+            p_save_type_out->gen2_save_type = gen2_save_type;
+
+            return PKSAV_ERROR_NONE;
+        }
+    }
+
+    if(buffer_len >= PKSAV_GEN1_SAVE_SIZE)
+    {
+        enum pksav_gen1_save_type gen1_save_type = PKSAV_GEN1_SAVE_TYPE_NONE;
+        pksav_gen1_get_buffer_save_type(
+            p_buffer,
+            buffer_len,
+            &gen1_save_type
+        );
+        if(gen1_save_type != PKSAV_GEN1_SAVE_TYPE_NONE)
+        {
+            p_save_type_out->generation = PKSAV_GENERATION_1;
+            p_save_type_out->gen1_save_type = gen1_save_type;
+
+            return PKSAV_ERROR_NONE;
+        }
+    }
+
+    return PKSAV_ERROR_INVALID_SAVE;
+}
+
+enum pksav_error pksav_detect_file_save_type(
+    const char* p_filepath,
+    struct pksav_save_type* p_save_type_out
+)
+{
+    if(!p_filepath || !p_save_type_out)
+    {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    memset(p_save_type_out, 0, sizeof(*p_save_type_out));
+
+    // Where the file can be mapped, only the pages the checks look at are
+    // ever read.
+    struct pksav_fs_file_buffer file_buffer = {NULL, 0, false, false};
+    enum pksav_error error = pksav_fs_map_file(
+                                 p_filepath,
+                                 PKSAV_FS_MAP_READ_ONLY,
+                                 &file_buffer
+                             );
+    if(!error)
+    {
+        error = pksav_detect_save_type(
+                    file_buffer.p_buffer,
+                    file_buffer.buffer_len,
+                    p_save_type_out
+                );
+        pksav_fs_unmap_file(&file_buffer);
+    }
+
+    return error;
+}
+
+/*
+ * Scanning
+ */
+
+struct pksav_scanner
+{
+    const char* const* pp_filepaths;
+
+    void (*p_callback)(
+        const char* p_filepath,
+        enum pksav_error error,
+        const struct pksav_save_type* p_save_type,
+        void* p_user_data
+    );
+    void* p_user_data;
+};
+
+static void _pksav_scanner_scan_file(
+    const struct pksav_scanner* p_scanner,
+    size_t filepath_index
+)
+{
+    assert(p_scanner != NULL);
+
+    const char* p_filepath = p_scanner->pp_filepaths[filepath_index];
+
+    struct pksav_save_type save_type;
+    enum pksav_error error = pksav_detect_file_save_type(
+                                 p_filepath,
+                                 &save_type
+                             );
+
+    p_scanner->p_callback(
+        p_filepath,
+        error,
+        &save_type,
+        p_scanner->p_user_data
+    );
+}
+
+#ifdef PKSAV_SCAN_HAVE_THREADS
+
+// The part of the list a thread hasn't gotten to yet.
+struct pksav_scan_worker
+{
+    pthread_mutex_t mutex;
+    size_t next_index;
+    size_t end_index;
+};
+
+struct pksav_scan_pool
+{
+    const struct pksav_scanner* p_scanner;
+
+    struct pksav_scan_worker* p_workers;
+    size_t num_workers;
+
+    // Keeps callbacks from overlapping.
+    pthread_mutex_t callback_mutex;
+};
+
+struct pksav_scan_thread_arg
+{
+    struct pksav_scan_pool* p_pool;
+    size_t worker_index;
+
+    pthread_t thread;
+    bool is_thread_created;
+};
+
+static bool _pksav_scan_worker_pop(
+    struct pksav_scan_worker* p_worker,
+    size_t* p_filepath_index_out
+)
+{
+    assert(p_worker != NULL);
+    assert(p_filepath_index_out != NULL);
+
+    bool has_work = false;
+
+    pthread_mutex_lock(&p_worker->mutex);
+    if(p_worker->next_index < p_worker->end_index)
+    {
+        *p_filepath_index_out = p_worker->next_index++;
+        has_work = true;
+    }
+    pthread_mutex_unlock(&p_worker->mutex);
+
+    return has_work;
+}
+
+/*
+ * Takes the back half of the first other worker's remaining share. Only
+ * one worker's lock is held at a time, and a worker only steals once its
+ * own share is empty, so nothing else can be changing it.
+ */
+static bool _pksav_scan_worker_steal(
+    struct pksav_scan_pool* p_pool,
+    size_t worker_index
+)
+{
+    assert(p_pool != NULL);
+    assert(worker_index < p_pool->num_workers);
+
+    for(size_t offset = 1; offset < p_pool->num_workers; ++offset)
+    {
+        struct pksav_scan_worker* p_victim =
+            &p_pool->p_workers[(worker_index + offset) % p_pool->num_workers];
+
+        size_t stolen_begin = 0;
+        size_t stolen_end = 0;
+
+        pthread_mutex_lock(&p_victim->mutex);
+        size_t num_remaining = p_victim->end_index - p_victim->next_index;
+        if(num_remaining > 0)
+        {
+            stolen_end = p_victim->end_index;
+            stolen_begin = stolen_end - ((num_remaining + 1) / 2);
+            p_victim->end_index = stolen_begin;
+        }
+        pthread_mutex_unlock(&p_victim->mutex);
+
+        if(stolen_begin < stolen_end)
+        {
+            struct pksav_scan_worker* p_worker = &p_pool->p_workers[worker_index];
+
+            pthread_mutex_lock(&p_worker->mutex);
+            p_worker->next_index = stolen_begin;
+            p_worker->end_index = stolen_end;
+            pthread_mutex_unlock(&p_worker->mutex);
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static void* _pksav_scan_thread(
+    void* p_arg
+)
+{
+    assert(p_arg != NULL);
+
+    struct pksav_scan_thread_arg* p_thread_arg = p_arg;
+    struct pksav_scan_pool* p_pool = p_thread_arg->p_pool;
+    struct pksav_scan_worker* p_worker = &p_pool->p_workers[p_thread_arg->worker_index];
+
+    do
+    {
+        size_t filepath_index = 0;
+        while(_pksav_scan_worker_pop(p_worker, &filepath_index))
+        {
+            const char* p_filepath = p_pool->p_scanner->pp_filepaths[filepath_index];
+
+            // Detection happens outside the lock, so only the callbacks
+            // are serialized.
+            struct pksav_save_type save_type;
+            enum pksav_error error = pksav_detect_file_save_type(
+                                         p_filepath,
+                                         &save_type
+                                     );
+
+            pthread_mutex_lock(&p_pool->callback_mutex);
+            p_pool->p_scanner->p_callback(
+                p_filepath,
+                error,
+                &save_type,
+                p_pool->p_scanner->p_user_data
+            );
+            pthread_mutex_unlock(&p_pool->callback_mutex);
+        }
+    } while(_pksav_scan_worker_steal(p_pool, p_thread_arg->worker_index));
+
+    return NULL;
+}
+
+static bool _pksav_scan_files_threads(
+    const struct pksav_scanner* p_scanner,
+    size_t num_filepaths,
+    size_t num_threads
+)
+{
+    assert(p_scanner != NULL);
+    assert(num_threads > 1);
+
+    struct pksav_scan_pool pool =
+    {
+        .p_scanner = p_scanner,
+        .p_workers = calloc(num_threads, sizeof(struct pksav_scan_worker)),
+        .num_workers = num_threads
+    };
+    struct pksav_scan_thread_arg* p_thread_args = calloc(
+                                                      num_threads,
+                                                      sizeof(struct pksav_scan_thread_arg)
+                                                  );
+    if(!pool.p_workers || !p_thread_args ||
+       pthread_mutex_init(&pool.callback_mutex, NULL))
+    {
+        free(p_thread_args);
+        free(pool.p_workers);
+
+        return false;
+    }
+
+    // Each worker starts with an even share of the list.
+    for(size_t worker_index = 0; worker_index < num_threads; ++worker_index)
+    {
+        struct pksav_scan_worker* p_worker = &pool.p_workers[worker_index];
+
+        pthread_mutex_init(&p_worker->mutex, NULL);
+        p_worker->next_index = (num_filepaths * worker_index) / num_threads;
+        p_worker->end_index = (num_filepaths * (worker_index + 1)) / num_threads;
+
+        p_thread_args[worker_index].p_pool = &pool;
+        p_thread_args[worker_index].worker_index = worker_index;
+    }
+
+    // The calling thread is worker 0. If a thread can't be created, its
+    // share is left to be stolen.
+    for(size_t worker_index = 1; worker_index < num_threads; ++worker_index)
+    {
+        struct pksav_scan_thread_arg* p_thread_arg = &p_thread_args[worker_index];
+
+        p_thread_arg->is_thread_created = !pthread_create(
+                                              &p_thread_arg->thread,
+                                              NULL,
+                                              _pksav_scan_thread,
+                                              p_thread_arg
+                                          );
+    }
+
+    _pksav_scan_thread(&p_thread_args[0]);
+
+    for(size_t worker_index = 1; worker_index < num_threads; ++worker_index)
+    {
+        if(p_thread_args[worker_index].is_thread_created)
+        {
+            pthread_join(p_thread_args[worker_index].thread, NULL);
+        }
+    }
+
+    for(size_t worker_index = 0; worker_index < num_threads; ++worker_index)
+    {
+        pthread_mutex_destroy(&pool.p_workers[worker_index].mutex);
+    }
+    pthread_mutex_destroy(&pool.callback_mutex);
+
+    free(p_thread_args);
+    free(pool.p_workers);
+
+    return true;
+}
+
+#endif /* PKSAV_SCAN_HAVE_THREADS */
+
+enum pksav_error pksav_scan_save_files(
+    const char* const* pp_filepaths,
+    size_t num_filepaths,
+    const struct pksav_scan_options* p_options,
+    void (*p_callback)(
+        const char* p_filepath,
+        enum pksav_error error,
+        const struct pksav_save_type* p_save_type,
+        void* p_user_data
+    ),
+    void* p_user_data
+)
+{
+    if(!pp_filepaths || !p_callback)
+    {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    struct pksav_scanner scanner =
+    {
+        .pp_filepaths = pp_filepaths,
+        .p_callback = p_callback,
+        .p_user_data = p_user_data
+    };
+
+    size_t num_threads = p_options ? p_options->num_threads : 0;
+    if(num_threads == 0)
+    {
+        num_threads = PKSAV_SCAN_DEFAULT_NUM_THREADS;
+    }
+    if(num_threads > num_filepaths)
+    {
+        num_threads = num_filepaths;
+    }
+
+#ifdef PKSAV_SCAN_HAVE_THREADS
+    if((num_threads > 1) && _pksav_scan_files_threads(&scanner, num_filepaths, num_threads))
+    {
+        return PKSAV_ERROR_NONE;
+    }
+#endif
+
+    for(size_t filepath_index = 0;
+        filepath_index < num_filepaths;
+        ++filepath_index)
+    {
+        _pksav_scanner_scan_file(&scanner, filepath_index);
+    }
+
+    return PKSAV_ERROR_NONE;
+}
+
+enum pksav_error pksav_scan_save_directory(
+    const char* p_dirpath,
+    const struct pksav_scan_options* p_options,
+    void (*p_callback)(
+        const char* p_filepath,
+        enum pksav_error error,
+        const struct pksav_save_type* p_save_type,
+        void* p_user_data
+    ),
+    void* p_user_data
+)
+{
+    if(!p_dirpath || !p_callback)
+    {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    char** pp_filepaths = NULL;
+    size_t num_filepaths = 0;
+    enum pksav_error error = pksav_fs_list_directory(
+                                 p_dirpath,
+                                 &pp_filepaths,
+                                 &num_filepaths
+                             );
+    if(!error)
+    {
+        // An empty directory leaves the list NULL.
+        if(num_filepaths > 0)
+        {
+            error = pksav_scan_save_files(
+                        (const char* const*)pp_filepaths,
+                        num_filepaths,
+                        p_options,
+                        p_callback,
+                        p_user_data
+                    );
+        }
+
+        pksav_fs_free_directory_list(pp_filepaths, num_filepaths);
+    }
+
+    return error;
+}
@@ -16,7 +16,8 @@ static const char* PKSAV_ERROR_STRS[] =
     "Parameter out of range",
     "Invalid stat enum",
     "Invalid save file",
-    "Null pointer passed as parameter"
+    "Null pointer passed as parameter",
+    "Out of memory"
 };
 static const size_t NUM_ERRORS =
     sizeof(PKSAV_ERROR_STRS)/sizeof(PKSAV_ERROR_STRS[0]);
@@ -8,6 +8,8 @@
 #ifndef PKSAV_GEN1_SAVE_INTERNAL_H
 #define PKSAV_GEN1_SAVE_INTERNAL_H
 
+#include "util/fs.h"
+
 #include <assert.h>
 #include <stdbool.h>
 #include <stdint.h>
@@ -19,6 +21,8 @@ struct pksav_gen1_save_internal
     uint8_t* p_checksum;
 
     bool is_buffer_ours;
+    // Only set if is_buffer_ours is true.
+    struct pksav_fs_file_buffer file_buffer;
 };
 
 // Offsets in a Generation I save
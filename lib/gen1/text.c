@@ -5,15 +5,12 @@
  * or copy at http://opensource.org/licenses/MIT)
  */
 
+#include "util/text_batch.h"
 #include "util/text_common.h"
 
 #include <pksav/gen1/text.h>
 
-#include <assert.h>
-#include <string.h>
-
-#define PKSAV_GEN1_TEXT_SPACE (0x7F)
-#define ASCII_SPACE           (0x20)
+#include <stdbool.h>
 
 /*
  * Character map for Generation I
@@ -45,115 +42,227 @@ static const wchar_t PKSAV_GEN1_CHAR_MAP[] =
     0x27,0x3C,0x3E,0x2D,0x00,0x00,0x3F,0x21,0x2E,0x00,0x00,0x00,0x00,0x00,0x00,0x2642,
     0x00,0xD7,0x00,0x2F,0x2C,0x2640,0x30,0x31,0x32,0x33,0x34,0x35,0x36,0x37,0x38,0x39
 };
-static const size_t PKSAV_GEN1_CHAR_MAP_SIZE =
-    sizeof(PKSAV_GEN1_CHAR_MAP)/sizeof(PKSAV_GEN1_CHAR_MAP[0]);
 
-static enum pksav_error _pksav_gen1_import_widetext(
-    const uint8_t* p_input_buffer,
-    wchar_t* p_output_widetext,
-    size_t num_chars
-)
+// Generated from PKSAV_GEN1_CHAR_MAP by scripts/generate_char_tables.py.
+static const struct pksav_text_reverse_map_entry PKSAV_GEN1_REVERSE_CHAR_MAP[] =
 {
-    assert(p_input_buffer != NULL);
-    assert(p_output_widetext != NULL);
-
-    memset(p_output_widetext, 0, sizeof(wchar_t)*num_chars);
+    {0x0020,0x7F},{0x0021,0xE7},{0x0027,0xE0},{0x0028,0x9A},{0x0029,0x9B},{0x002C,0xF4},{0x002D,0xE3},{0x002E,0xE8},
+    {0x002F,0xF3},{0x0030,0xF6},{0x0031,0xF7},{0x0032,0xF8},{0x0033,0xF9},{0x0034,0xFA},{0x0035,0xFB},{0x0036,0xFC},
+    {0x0037,0xFD},{0x0038,0xFE},{0x0039,0xFF},{0x003A,0x9C},{0x003B,0x9D},{0x003C,0xE1},{0x003E,0xE2},{0x003F,0xE6},
+    {0x0041,0x80},{0x0042,0x81},{0x0043,0x82},{0x0044,0x83},{0x0045,0x84},{0x0046,0x85},{0x0047,0x86},{0x0048,0x87},
+    {0x0049,0x88},{0x004A,0x89},{0x004B,0x8A},{0x004C,0x8B},{0x004D,0x8C},{0x004E,0x8D},{0x004F,0x8E},{0x0050,0x8F},
+    {0x0051,0x90},{0x0052,0x91},{0x0053,0x92},{0x0054,0x93},{0x0055,0x94},{0x0056,0x95},{0x0057,0x96},{0x0058,0x97},
+    {0x0059,0x98},{0x005A,0x99},{0x005B,0x9E},{0x005D,0x9F},{0x0061,0xA0},{0x0062,0xA1},{0x0063,0xA2},{0x0064,0xA3},
+    {0x0065,0xA4},{0x0066,0xA5},{0x0067,0xA6},{0x0068,0xA7},{0x0069,0xA8},{0x006A,0xA9},{0x006B,0xAA},{0x006C,0xAB},
+    {0x006D,0xAC},{0x006E,0xAD},{0x006F,0xAE},{0x0070,0xAF},{0x0071,0xB0},{0x0072,0xB1},{0x0073,0xB2},{0x0074,0xB3},
+    {0x0075,0xB4},{0x0076,0xB5},{0x0077,0xB6},{0x0078,0xB7},{0x0079,0xB8},{0x007A,0xB9},{0x00D7,0xF1},{0x00E9,0xBA},
+    {0x2640,0xF5},{0x2642,0xEF},
+};
+static const size_t PKSAV_GEN1_REVERSE_CHAR_MAP_SIZE =
+    sizeof(PKSAV_GEN1_REVERSE_CHAR_MAP)/sizeof(PKSAV_GEN1_REVERSE_CHAR_MAP[0]);
 
-    for(size_t char_index = 0; char_index < num_chars; ++char_index)
+// Generated from PKSAV_GEN1_CHAR_MAP by scripts/generate_char_tables.py.
+static const struct pksav_text_batch_table PKSAV_GEN1_TEXT_BATCH_TABLE =
+{
+    .utf8 =
     {
-        if(p_input_buffer[char_index] != PKSAV_GEN1_TEXT_TERMINATOR)
-        {
-            p_output_widetext[char_index] = PKSAV_GEN1_CHAR_MAP[p_input_buffer[char_index]];
-        }
-        else
-        {
-            break;
-        }
+        {0},{0},{0},{0},{0},{0},{0},{0},
+        {0},{0},{0},{0},{0},{0},{0},{0},
+        {0},{0},{0},{0},{0},{0},{0},{0},
+        {0},{0},{0},{0},{0},{0},{0},{0},
+        {0},{0},{0},{0},{0},{0},{0},{0},
+        {0},{0},{0},{0},{0},{0},{0},{0},
+        {0},{0},{0},{0},{0},{0},{0},{0},
+        {0},{0},{0},{0},{0},{0},{0},{0},
+        {0},{0},{0},{0},{0},{0},{0},{0},
+        {0},{0},{0},{0},{0},{0},{0},{0},
+        {0},{0},{0},{0},{0},{0},{0},{0},
+        {0},{0},{0},{0},{0},{0},{0},{0},
+        {0},{0},{0},{0},{0},{0},{0},{0},
+        {0},{0},{0},{0},{0},{0},{0},{0},
+        {0},{0},{0},{0},{0},{0},{0},{0},
+        {0},{0},{0},{0},{0},{0},{0},{0x20},
+        {0x41},{0x42},{0x43},{0x44},{0x45},{0x46},{0x47},{0x48},
+        {0x49},{0x4A},{0x4B},{0x4C},{0x4D},{0x4E},{0x4F},{0x50},
+        {0x51},{0x52},{0x53},{0x54},{0x55},{0x56},{0x57},{0x58},
+        {0x59},{0x5A},{0x28},{0x29},{0x3A},{0x3B},{0x5B},{0x5D},
+        {0x61},{0x62},{0x63},{0x64},{0x65},{0x66},{0x67},{0x68},
+        {0x69},{0x6A},{0x6B},{0x6C},{0x6D},{0x6E},{0x6F},{0x70},
+        {0x71},{0x72},{0x73},{0x74},{0x75},{0x76},{0x77},{0x78},
+        {0x79},{0x7A},{0xC3,0xA9},{0},{0},{0},{0},{0},
+        {0},{0},{0},{0},{0},{0},{0},{0},
+        {0},{0},{0},{0},{0},{0},{0},{0},
+        {0},{0},{0},{0},{0},{0},{0},{0},
+        {0},{0},{0},{0},{0},{0},{0},{0},
+        {0x27},{0x3C},{0x3E},{0x2D},{0},{0},{0x3F},{0x21},
+        {0x2E},{0},{0},{0},{0},{0},{0},{0xE2,0x99,0x82},
+        {0},{0xC3,0x97},{0},{0x2F},{0x2C},{0xE2,0x99,0x80},{0x30},{0x31},
+        {0x32},{0x33},{0x34},{0x35},{0x36},{0x37},{0x38},{0x39},
+    },
+    .utf8_len =
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+        1,1,1,1,1,1,1,1,1,1,2,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        1,1,1,1,0,0,1,1,1,0,0,0,0,0,0,3,
+        0,2,0,1,1,3,1,1,1,1,1,1,1,1,1,1,
+    },
+    .ascii =
+    {
+        0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+        0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+        0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+        0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+        0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+        0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+        0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+        0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,
+        0x41,0x42,0x43,0x44,0x45,0x46,0x47,0x48,0x49,0x4A,0x4B,0x4C,0x4D,0x4E,0x4F,0x50,
+        0x51,0x52,0x53,0x54,0x55,0x56,0x57,0x58,0x59,0x5A,0x28,0x29,0x3A,0x3B,0x5B,0x5D,
+        0x61,0x62,0x63,0x64,0x65,0x66,0x67,0x68,0x69,0x6A,0x6B,0x6C,0x6D,0x6E,0x6F,0x70,
+        0x71,0x72,0x73,0x74,0x75,0x76,0x77,0x78,0x79,0x7A,0x00,0x00,0x00,0x00,0x00,0x00,
+        0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+        0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+        0x27,0x3C,0x3E,0x2D,0x00,0x00,0x3F,0x21,0x2E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+        0x00,0x00,0x00,0x2F,0x2C,0x00,0x30,0x31,0x32,0x33,0x34,0x35,0x36,0x37,0x38,0x39,
     }
+};
 
-    return PKSAV_ERROR_NONE;
+static uint32_t _pksav_gen1_import_char(
+    uint16_t game_char
+)
+{
+    // Characters with no mapping are 0, which ends the string.
+    return (game_char == PKSAV_GEN1_TEXT_TERMINATOR) ? 0 : PKSAV_GEN1_CHAR_MAP[game_char];
 }
 
-static enum pksav_error _pksav_gen1_export_widetext(
-    const wchar_t* p_input_widetext,
-    uint8_t* p_output_buffer,
-    size_t num_chars
+static ssize_t _pksav_gen1_export_char(
+    uint32_t code_point
 )
 {
-    assert(p_input_widetext != NULL);
-    assert(p_output_buffer != NULL);
-
-    memset(p_output_buffer, PKSAV_GEN1_TEXT_TERMINATOR, num_chars);
-
-    for(size_t char_index = 0; char_index < num_chars; ++char_index)
-    {
-        if(p_input_widetext[char_index] == ASCII_SPACE)
-        {
-            p_output_buffer[char_index] = PKSAV_GEN1_TEXT_SPACE;
-        }
-        else
-        {
-            ssize_t map_index = wchar_map_index(
-                                    PKSAV_GEN1_CHAR_MAP,
-                                    PKSAV_GEN1_CHAR_MAP_SIZE,
-                                    p_input_widetext[char_index]
-                                );
-            if(map_index != -1)
-            {
-                p_output_buffer[char_index] = (uint8_t)map_index;
-            }
-            else
-            {
-                break;
-            }
-        }
-    }
-
-    return PKSAV_ERROR_NONE;
+    return pksav_text_reverse_map_find(
+               PKSAV_GEN1_REVERSE_CHAR_MAP,
+               PKSAV_GEN1_REVERSE_CHAR_MAP_SIZE,
+               code_point
+           );
 }
 
+static const struct pksav_text_codec PKSAV_GEN1_TEXT_CODEC =
+{
+    .char_size = sizeof(uint8_t),
+    .terminator = PKSAV_GEN1_TEXT_TERMINATOR,
+    .p_import_char = _pksav_gen1_import_char,
+    .p_export_char = _pksav_gen1_export_char
+};
+
 enum pksav_error pksav_gen1_import_text(
     const uint8_t* p_input_buffer,
     char* p_output_text,
     size_t num_chars
 )
 {
-    if(!p_input_buffer || !p_output_text)
+    return pksav_text_import(
+               &PKSAV_GEN1_TEXT_CODEC,
+               p_input_buffer,
+               p_output_text,
+               num_chars
+           );
+}
+
+enum pksav_error pksav_gen1_import_text_bounded(
+    const uint8_t* p_input_buffer,
+    size_t num_chars,
+    char* p_output_text,
+    size_t output_text_len,
+    size_t* p_num_bytes_out,
+    bool* p_is_truncated_out
+)
+{
+    return pksav_text_import_bounded(
+               &PKSAV_GEN1_TEXT_CODEC,
+               p_input_buffer,
+               num_chars,
+               p_output_text,
+               output_text_len,
+               p_num_bytes_out,
+               p_is_truncated_out
+           );
+}
+
+enum pksav_error pksav_gen1_import_text_batch(
+    const uint8_t* p_records,
+    size_t record_stride,
+    size_t num_records,
+    size_t num_chars,
+    char* p_output_arena,
+    size_t output_arena_len,
+    size_t* p_offsets_out
+)
+{
+    if(!p_records || !p_output_arena || !p_offsets_out)
     {
         return PKSAV_ERROR_NULL_POINTER;
     }
 
-    wchar_t* p_widetext = calloc(num_chars, sizeof(wchar_t));
-    _pksav_gen1_import_widetext(
-        p_input_buffer, p_widetext, num_chars
-    );
+    if(((num_records > 1) && (record_stride < num_chars)) ||
+       (output_arena_len < PKSAV_GEN1_TEXT_BATCH_ARENA_LEN(num_records, num_chars)))
+    {
+        return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
 
-    memset(p_output_text, 0, num_chars);
-    pksav_wcstombs(p_output_text, p_widetext, num_chars);
-    free(p_widetext);
+    pksav_text_batch_import(
+        &PKSAV_GEN1_TEXT_BATCH_TABLE,
+        p_records,
+        record_stride,
+        num_records,
+        num_chars,
+        p_output_arena,
+        output_arena_len,
+        p_offsets_out
+    );
 
     return PKSAV_ERROR_NONE;
 }
 
 enum pksav_error pksav_gen1_export_text(
-    const char* input_text,
+    const char* p_input_text,
     uint8_t* p_output_buffer,
     size_t num_chars
 )
 {
-    if(!input_text || !p_output_buffer)
-    {
-        return PKSAV_ERROR_NULL_POINTER;
-    }
-
-    wchar_t* p_widetext = calloc(num_chars, sizeof(wchar_t));
-    pksav_mbstowcs(p_widetext, input_text, num_chars);
-
-    _pksav_gen1_export_widetext(
-        p_widetext, p_output_buffer, num_chars
-    );
-
-    free(p_widetext);
+    return pksav_text_export(
+               &PKSAV_GEN1_TEXT_CODEC,
+               p_input_text,
+               p_output_buffer,
+               num_chars
+           );
+}
 
-    return PKSAV_ERROR_NONE;
+enum pksav_error pksav_gen1_export_text_bounded(
+    const char* p_input_text,
+    uint8_t* p_output_buffer,
+    size_t num_chars,
+    size_t* p_num_chars_out,
+    bool* p_is_truncated_out
+)
+{
+    return pksav_text_export_bounded(
+               &PKSAV_GEN1_TEXT_CODEC,
+               p_input_text,
+               p_output_buffer,
+               num_chars,
+               p_num_chars_out,
+               p_is_truncated_out
+           );
 }
@@ -6,6 +6,9 @@
  */
 
 #include "gen2/save_internal.h"
+#include "util/async_writer.h"
+#include "util/batch.h"
+#include "util/bulk.h"
 #include "util/fs.h"
 
 #include <pksav/gen2/common.h>
@@ -152,10 +155,13 @@ enum pksav_error pksav_gen2_get_buffer_save_type(
             {
                 *p_save_type_out = save_type;
             }
-            else
-            {
-                error = PKSAV_ERROR_INVALID_SAVE;
-            }
+        }
+
+        // A Crystal save fails the Gold/Silver check first, so this can
+        // only be decided once every type has been tried.
+        if(!is_type_found)
+        {
+            error = PKSAV_ERROR_INVALID_SAVE;
         }
     }
 
@@ -174,24 +180,23 @@ enum pksav_error pksav_gen2_get_file_save_type(
 
     enum pksav_error error = PKSAV_ERROR_NONE;
 
-    uint8_t* p_file_buffer = NULL;
-    size_t buffer_len = 0;
-    error = pksav_fs_read_file_to_buffer(
+    struct pksav_fs_file_buffer file_buffer = {NULL, 0, false, false};
+    error = pksav_fs_map_file(
                 p_filepath,
-                &p_file_buffer,
-                &buffer_len
+                PKSAV_FS_MAP_READ_ONLY,
+                &file_buffer
             );
     if(!error)
     {
-        assert(p_file_buffer != NULL);
+        assert(file_buffer.p_buffer != NULL);
 
         enum pksav_gen2_save_type save_type = PKSAV_GEN2_SAVE_TYPE_NONE;
         error = pksav_gen2_get_buffer_save_type(
-                    p_file_buffer,
-                    buffer_len,
+                    file_buffer.p_buffer,
+                    file_buffer.buffer_len,
                     &save_type
                 );
-        free(p_file_buffer);
+        pksav_fs_unmap_file(&file_buffer);
 
         // Only return a result upon success.
         if(!error)
@@ -203,6 +208,211 @@ enum pksav_error pksav_gen2_get_file_save_type(
     return error;
 }
 
+/*
+ * Every range either save type's checksums cover, along with the checksums
+ * themselves, merged into as few reads as possible. The trainer info and
+ * party are in the second range.
+ */
+static const struct
+{
+    size_t start;
+    size_t end;
+} GEN2_CHECKSUMMED_RANGES[] =
+{
+    {0x0C6B, 0x1F0F},
+    {0x2009, 0x2D6B},
+    {0x3D96, 0x3F40},
+    {0x7E39, 0x7E6F}
+};
+static const size_t GEN2_NUM_CHECKSUMMED_RANGES =
+    sizeof(GEN2_CHECKSUMMED_RANGES)/sizeof(GEN2_CHECKSUMMED_RANGES[0]);
+
+/*
+ * Reads only the checksummed ranges into a save-sized buffer, leaving the
+ * rest of the buffer uninitialized.
+ */
+static enum pksav_error _pksav_gen2_read_io_checksummed_ranges(
+    const struct pksav_io* p_io,
+    uint8_t** pp_buffer_out,
+    enum pksav_gen2_save_type* p_save_type_out
+)
+{
+    assert(p_io != NULL);
+    assert(pp_buffer_out != NULL);
+    assert(p_save_type_out != NULL);
+
+    enum pksav_error error = PKSAV_ERROR_NONE;
+
+    size_t io_size = 0;
+    error = p_io->get_size(p_io, &io_size);
+    if(!error && (io_size < PKSAV_GEN2_SAVE_SIZE))
+    {
+        error = PKSAV_ERROR_INVALID_SAVE;
+    }
+    if(!error)
+    {
+        uint8_t* p_buffer = malloc(PKSAV_GEN2_SAVE_SIZE);
+        if(p_buffer)
+        {
+            for(size_t range_index = 0;
+                (range_index < GEN2_NUM_CHECKSUMMED_RANGES) && !error;
+                ++range_index)
+            {
+                const size_t start = GEN2_CHECKSUMMED_RANGES[range_index].start;
+                const size_t end = GEN2_CHECKSUMMED_RANGES[range_index].end;
+
+                error = p_io->read_at(
+                            p_io,
+                            start,
+                            &p_buffer[start],
+                            end - start
+                        );
+            }
+            if(!error)
+            {
+                enum pksav_gen2_save_type save_type = PKSAV_GEN2_SAVE_TYPE_NONE;
+                error = pksav_gen2_get_buffer_save_type(
+                            p_buffer,
+                            PKSAV_GEN2_SAVE_SIZE,
+                            &save_type
+                        );
+                if(!error && (save_type == PKSAV_GEN2_SAVE_TYPE_NONE))
+                {
+                    error = PKSAV_ERROR_INVALID_SAVE;
+                }
+                if(!error)
+                {
+                    *pp_buffer_out = p_buffer;
+                    *p_save_type_out = save_type;
+                }
+            }
+
+            if(error)
+            {
+                free(p_buffer);
+            }
+        }
+        else
+        {
+            error = PKSAV_ERROR_OUT_OF_MEMORY;
+        }
+    }
+
+    return error;
+}
+
+enum pksav_error pksav_gen2_get_io_save_type(
+    const struct pksav_io* p_io,
+    enum pksav_gen2_save_type* p_save_type_out
+)
+{
+    if(!p_io || !p_save_type_out || !p_io->read_at || !p_io->get_size)
+    {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    uint8_t* p_buffer = NULL;
+    enum pksav_gen2_save_type save_type = PKSAV_GEN2_SAVE_TYPE_NONE;
+    enum pksav_error error = _pksav_gen2_read_io_checksummed_ranges(
+                                 p_io,
+                                 &p_buffer,
+                                 &save_type
+                             );
+
+    // Only return a result upon success.
+    if(!error)
+    {
+        *p_save_type_out = save_type;
+        free(p_buffer);
+    }
+
+    return error;
+}
+
+enum pksav_error pksav_gen2_peek_save_from_io(
+    const struct pksav_io* p_io,
+    struct pksav_gen2_save_peek* p_peek_out
+)
+{
+    if(!p_io || !p_peek_out || !p_io->read_at || !p_io->get_size)
+    {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    uint8_t* p_buffer = NULL;
+    enum pksav_gen2_save_type save_type = PKSAV_GEN2_SAVE_TYPE_NONE;
+    enum pksav_error error = _pksav_gen2_read_io_checksummed_ranges(
+                                 p_io,
+                                 &p_buffer,
+                                 &save_type
+                             );
+    if(!error)
+    {
+        const size_t* p_offsets = (save_type == PKSAV_GEN2_SAVE_TYPE_GS) ? GS_OFFSETS
+                                                                         : CRYSTAL_OFFSETS;
+        const struct pksav_gen2_pokemon_party* p_party =
+            (const struct pksav_gen2_pokemon_party*)&p_buffer[p_offsets[PKSAV_GEN2_POKEMON_PARTY]];
+
+        memset(p_peek_out, 0, sizeof(*p_peek_out));
+        p_peek_out->save_type = save_type;
+        memcpy(
+            p_peek_out->trainer_name,
+            &p_buffer[p_offsets[PKSAV_GEN2_PLAYER_NAME]],
+            sizeof(p_peek_out->trainer_name)
+        );
+        memcpy(
+            &p_peek_out->trainer_id,
+            &p_buffer[p_offsets[PKSAV_GEN2_PLAYER_ID]],
+            sizeof(p_peek_out->trainer_id)
+        );
+        memcpy(
+            &p_peek_out->time_played,
+            &p_buffer[p_offsets[PKSAV_GEN2_TIME_PLAYED]],
+            sizeof(p_peek_out->time_played)
+        );
+
+        p_peek_out->party_count = p_party->count;
+        if(p_peek_out->party_count > PKSAV_GEN2_PARTY_NUM_POKEMON)
+        {
+            p_peek_out->party_count = PKSAV_GEN2_PARTY_NUM_POKEMON;
+        }
+        memcpy(
+            p_peek_out->party_species,
+            p_party->species,
+            p_peek_out->party_count
+        );
+
+        free(p_buffer);
+    }
+
+    return error;
+}
+
+enum pksav_error pksav_gen2_peek_save_from_file(
+    const char* p_filepath,
+    struct pksav_gen2_save_peek* p_peek_out
+)
+{
+    if(!p_filepath || !p_peek_out)
+    {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    struct pksav_io io;
+    enum pksav_error error = pksav_fs_open_io(
+                                 p_filepath,
+                                 false, // is_writable
+                                 &io
+                             );
+    if(!error)
+    {
+        error = pksav_gen2_peek_save_from_io(&io, p_peek_out);
+        pksav_fs_close_io(&io);
+    }
+
+    return error;
+}
+
 static void _pksav_gen2_set_save_pointers(
     struct pksav_gen2_save* p_gen2_save,
     uint8_t* p_buffer
@@ -403,6 +613,66 @@ enum pksav_error pksav_gen2_load_save_from_buffer(
            );
 }
 
+// Takes ownership of the given buffer, which is freed if loading fails.
+static enum pksav_error _pksav_gen2_load_save_from_file_buffer(
+    struct pksav_fs_file_buffer* p_file_buffer,
+    struct pksav_gen2_save* p_gen2_save_out
+)
+{
+    assert(p_file_buffer != NULL);
+    assert(p_gen2_save_out != NULL);
+
+    enum pksav_error error = PKSAV_ERROR_NONE;
+
+    error = _pksav_gen2_load_save_from_buffer(
+                p_file_buffer->p_buffer,
+                p_file_buffer->buffer_len,
+                true, // is_buffer_ours
+                p_gen2_save_out
+            );
+    if(!error)
+    {
+        struct pksav_gen2_save_internal* p_internal = p_gen2_save_out->p_internal;
+        p_internal->file_buffer = *p_file_buffer;
+    }
+    else
+    {
+        // We made this buffer, so it's on us to free it if there's
+        // an error.
+        pksav_fs_unmap_file(p_file_buffer);
+    }
+
+    return error;
+}
+
+static enum pksav_error _pksav_gen2_load_save_from_file(
+    const char* p_filepath,
+    enum pksav_fs_map_mode map_mode,
+    struct pksav_gen2_save* p_gen2_save_out
+)
+{
+    assert(p_filepath != NULL);
+    assert(p_gen2_save_out != NULL);
+
+    enum pksav_error error = PKSAV_ERROR_NONE;
+
+    struct pksav_fs_file_buffer file_buffer = {NULL, 0, false, false};
+    error = pksav_fs_map_file(
+                p_filepath,
+                map_mode,
+                &file_buffer
+            );
+    if(!error)
+    {
+        error = _pksav_gen2_load_save_from_file_buffer(
+                    &file_buffer,
+                    p_gen2_save_out
+                );
+    }
+
+    return error;
+}
+
 enum pksav_error pksav_gen2_load_save_from_file(
     const char* p_filepath,
     struct pksav_gen2_save* p_gen2_save_out
@@ -413,33 +683,161 @@ enum pksav_error pksav_gen2_load_save_from_file(
         return PKSAV_ERROR_NULL_POINTER;
     }
 
+    // Map the file copy-on-write so edits never touch the file until
+    // it's explicitly saved.
+    return _pksav_gen2_load_save_from_file(
+               p_filepath,
+               PKSAV_FS_MAP_COPY_ON_WRITE,
+               p_gen2_save_out
+           );
+}
+
+enum pksav_error pksav_gen2_load_save_from_file_in_place(
+    const char* p_filepath,
+    struct pksav_gen2_save* p_gen2_save_out
+)
+{
+    if(!p_filepath || !p_gen2_save_out)
+    {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    return _pksav_gen2_load_save_from_file(
+               p_filepath,
+               PKSAV_FS_MAP_SHARED,
+               p_gen2_save_out
+           );
+}
+
+enum pksav_error pksav_gen2_load_save_from_io(
+    const struct pksav_io* p_io,
+    struct pksav_gen2_save* p_gen2_save_out
+)
+{
+    if(!p_io || !p_gen2_save_out)
+    {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
     enum pksav_error error = PKSAV_ERROR_NONE;
 
-    uint8_t* p_file_buffer = NULL;
-    size_t buffer_len = 0;
-    error = pksav_fs_read_file_to_buffer(
-                p_filepath,
-                &p_file_buffer,
-                &buffer_len
+    struct pksav_fs_file_buffer file_buffer = {NULL, 0, false, false};
+    error = pksav_fs_read_io_to_buffer(
+                p_io,
+                &file_buffer
             );
-
     if(!error)
     {
-        error = _pksav_gen2_load_save_from_buffer(
-                    p_file_buffer,
-                    buffer_len,
-                    true, // is_buffer_ours
+        error = _pksav_gen2_load_save_from_file_buffer(
+                    &file_buffer,
                     p_gen2_save_out
                 );
-        if(error)
+    }
+
+    return error;
+}
+
+struct pksav_gen2_bulk_load_context
+{
+    void (*p_callback)(
+        size_t filepath_index,
+        enum pksav_error error,
+        struct pksav_gen2_save* p_gen2_save,
+        void* p_user_data
+    );
+    void* p_user_data;
+};
+
+static enum pksav_error _pksav_gen2_bulk_load_save(
+    struct pksav_fs_file_buffer* p_file_buffer,
+    void* p_context,
+    void* p_save_out
+)
+{
+    assert(p_file_buffer != NULL);
+    assert(p_save_out != NULL);
+
+    // Nothing about loading a save is configurable.
+    (void)p_context;
+
+    return _pksav_gen2_load_save_from_file_buffer(
+               p_file_buffer,
+               p_save_out
+           );
+}
+
+static void _pksav_gen2_bulk_on_save_loaded(
+    size_t filepath_index,
+    enum pksav_error error,
+    void* p_save,
+    void* p_context
+)
+{
+    assert(p_context != NULL);
+
+    struct pksav_gen2_bulk_load_context* p_bulk_context = p_context;
+    p_bulk_context->p_callback(
+        filepath_index,
+        error,
+        p_save,
+        p_bulk_context->p_user_data
+    );
+}
+
+static void _pksav_gen2_bulk_free_save(
+    void* p_save
+)
+{
+    assert(p_save != NULL);
+
+    pksav_gen2_free_save(p_save);
+}
+
+enum pksav_error pksav_gen2_bulk_load_saves(
+    const char* const* pp_filepaths,
+    size_t num_filepaths,
+    const struct pksav_bulk_load_options* p_options,
+    void (*p_callback)(
+        size_t filepath_index,
+        enum pksav_error error,
+        struct pksav_gen2_save* p_gen2_save,
+        void* p_user_data
+    ),
+    void* p_user_data
+)
+{
+    if(!pp_filepaths || !p_callback)
+    {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+    for(size_t filepath_index = 0; filepath_index < num_filepaths; ++filepath_index)
+    {
+        if(!pp_filepaths[filepath_index])
         {
-            // We made this buffer, so it's on us to free it if there's
-            // an error.
-            free(p_file_buffer);
+            return PKSAV_ERROR_NULL_POINTER;
         }
     }
 
-    return error;
+    struct pksav_gen2_bulk_load_context context =
+    {
+        .p_callback = p_callback,
+        .p_user_data = p_user_data
+    };
+    struct pksav_bulk_loader loader =
+    {
+        .save_size = sizeof(struct pksav_gen2_save),
+        .load_save = _pksav_gen2_bulk_load_save,
+        .on_save_loaded = _pksav_gen2_bulk_on_save_loaded,
+        .free_save = _pksav_gen2_bulk_free_save,
+        .p_context = &context
+    };
+
+    return pksav_bulk_load_saves(
+               pp_filepaths,
+               num_filepaths,
+               p_options,
+               &loader
+           );
 }
 
 enum pksav_error pksav_gen2_save_save(
@@ -471,6 +869,240 @@ enum pksav_error pksav_gen2_save_save(
     return error;
 }
 
+enum pksav_error pksav_gen2_save_save_to_buffer(
+    struct pksav_gen2_save* p_gen2_save,
+    uint8_t* p_buffer,
+    size_t buffer_len
+)
+{
+    if(!p_gen2_save || !p_buffer)
+    {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+    if(buffer_len < PKSAV_GEN2_SAVE_SIZE)
+    {
+        return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
+
+    struct pksav_gen2_save_internal* p_internal = p_gen2_save->p_internal;
+    pksav_gen2_get_save_checksums(
+        p_gen2_save->save_type,
+        p_internal->p_raw_save,
+        p_internal->p_checksum1,
+        p_internal->p_checksum2
+    );
+
+    // If the save was loaded from this buffer, it's already up to date.
+    if(p_buffer != p_internal->p_raw_save)
+    {
+        memcpy(p_buffer, p_internal->p_raw_save, PKSAV_GEN2_SAVE_SIZE);
+    }
+
+    return PKSAV_ERROR_NONE;
+}
+
+enum pksav_error pksav_gen2_save_save_to_io(
+    struct pksav_gen2_save* p_gen2_save,
+    const struct pksav_io* p_io
+)
+{
+    if(!p_gen2_save || !p_io || !p_io->write_at)
+    {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    struct pksav_gen2_save_internal* p_internal = p_gen2_save->p_internal;
+    pksav_gen2_get_save_checksums(
+        p_gen2_save->save_type,
+        p_internal->p_raw_save,
+        p_internal->p_checksum1,
+        p_internal->p_checksum2
+    );
+
+    return p_io->write_at(
+               p_io,
+               0,
+               p_internal->p_raw_save,
+               PKSAV_GEN2_SAVE_SIZE
+           );
+}
+
+enum pksav_error pksav_gen2_save_save_changes(
+    const char* p_filepath,
+    struct pksav_gen2_save* p_gen2_save,
+    bool should_sync
+)
+{
+    if(!p_filepath || !p_gen2_save)
+    {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    struct pksav_io io;
+    enum pksav_error error = pksav_fs_open_io(
+                                 p_filepath,
+                                 true, // is_writable
+                                 &io
+                             );
+    if(!error)
+    {
+        error = pksav_gen2_save_save_changes_to_io(
+                    p_gen2_save,
+                    &io
+                );
+        if(!error && should_sync && io.sync)
+        {
+            error = io.sync(&io);
+        }
+
+        pksav_fs_close_io(&io);
+    }
+
+    return error;
+}
+
+enum pksav_error pksav_gen2_save_save_changes_to_io(
+    struct pksav_gen2_save* p_gen2_save,
+    const struct pksav_io* p_io
+)
+{
+    if(!p_gen2_save || !p_io ||
+       !p_io->read_at || !p_io->write_at || !p_io->get_size)
+    {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    struct pksav_gen2_save_internal* p_internal = p_gen2_save->p_internal;
+    pksav_gen2_get_save_checksums(
+        p_gen2_save->save_type,
+        p_internal->p_raw_save,
+        p_internal->p_checksum1,
+        p_internal->p_checksum2
+    );
+
+    return pksav_fs_write_changes_to_io(
+               p_io,
+               p_internal->p_raw_save,
+               PKSAV_GEN2_SAVE_SIZE
+           );
+}
+
+enum pksav_error pksav_gen2_save_save_async(
+    const char* p_filepath,
+    struct pksav_gen2_save* p_gen2_save,
+    struct pksav_async_writer* p_writer,
+    void (*p_callback)(
+        enum pksav_error error,
+        void* p_user_data
+    ),
+    void* p_user_data
+)
+{
+    if(!p_filepath || !p_gen2_save || !p_writer)
+    {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    enum pksav_error error = PKSAV_ERROR_NONE;
+
+    size_t save_len = PKSAV_GEN2_SAVE_SIZE;
+    uint8_t* p_snapshot = malloc(save_len);
+    if(!p_snapshot)
+    {
+        return PKSAV_ERROR_OUT_OF_MEMORY;
+    }
+
+    error = pksav_gen2_save_save_to_buffer(
+                p_gen2_save,
+                p_snapshot,
+                save_len
+            );
+    if(error)
+    {
+        free(p_snapshot);
+        return error;
+    }
+
+    // The writer takes ownership of the snapshot.
+    return pksav_async_writer_submit(
+               p_writer,
+               p_filepath,
+               p_snapshot,
+               save_len,
+               p_callback,
+               p_user_data
+           );
+}
+
+enum pksav_error pksav_gen2_save_save_to_batch(
+    const char* p_filepath,
+    struct pksav_gen2_save* p_gen2_save,
+    struct pksav_save_batch* p_batch
+)
+{
+    if(!p_filepath || !p_gen2_save || !p_batch)
+    {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    struct pksav_gen2_save_internal* p_internal = p_gen2_save->p_internal;
+    pksav_gen2_get_save_checksums(
+        p_gen2_save->save_type,
+        p_internal->p_raw_save,
+        p_internal->p_checksum1,
+        p_internal->p_checksum2
+    );
+
+    return pksav_save_batch_add(
+               p_batch,
+               p_filepath,
+               p_internal->p_raw_save,
+               PKSAV_GEN2_SAVE_SIZE
+           );
+}
+
+enum pksav_error pksav_gen2_save_commit(
+    struct pksav_gen2_save* p_gen2_save
+)
+{
+    if(!p_gen2_save)
+    {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    struct pksav_gen2_save_internal* p_internal = p_gen2_save->p_internal;
+    if(!p_internal->file_buffer.is_shared)
+    {
+        return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
+
+    uint16_t checksum1 = 0;
+    uint16_t checksum2 = 0;
+    pksav_gen2_get_save_checksums(
+        p_gen2_save->save_type,
+        p_internal->p_raw_save,
+        &checksum1,
+        &checksum2
+    );
+
+    // Writing to the mapping dirties the page even if the value doesn't
+    // change.
+    if(*p_internal->p_checksum1 != checksum1)
+    {
+        *p_internal->p_checksum1 = checksum1;
+    }
+    if(*p_internal->p_checksum2 != checksum2)
+    {
+        *p_internal->p_checksum2 = checksum2;
+    }
+
+    return pksav_fs_sync_file_buffer(
+               &p_internal->file_buffer,
+               0,
+               PKSAV_GEN2_SAVE_SIZE
+           );
+}
+
 enum pksav_error pksav_gen2_free_save(
     struct pksav_gen2_save* p_gen2_save
 )
@@ -483,7 +1115,7 @@ enum pksav_error pksav_gen2_free_save(
     struct pksav_gen2_save_internal* p_internal = p_gen2_save->p_internal;
     if(p_internal->is_buffer_ours)
     {
-        free(p_internal->p_raw_save);
+        pksav_fs_unmap_file(&p_internal->file_buffer);
     }
     free(p_internal);
 
@@ -8,6 +8,8 @@
 #ifndef PKSAV_GEN2_SAVE_INTERNAL_H
 #define PKSAV_GEN2_SAVE_INTERNAL_H
 
+#include "util/fs.h"
+
 #include <pksav/gen2/save.h>
 
 #include <stdint.h>
@@ -26,6 +28,8 @@ struct pksav_gen2_save_internal
     uint16_t* p_checksum2;
 
     bool is_buffer_ours;
+    // Only set if is_buffer_ours is true.
+    struct pksav_fs_file_buffer file_buffer;
 };
 
 enum pksav_gen2_field
@@ -6,10 +6,12 @@
  */
 
 #include "checksum.h"
+#include "checksum_kernels.h"
 
 #include "save_internal.h"
 
 #include <assert.h>
+#include <string.h>
 
 uint16_t pksav_gen3_get_pokemon_checksum(
     const struct pksav_gen3_pc_pokemon* p_gen3_pokemon
@@ -31,41 +33,124 @@ uint16_t pksav_gen3_get_pokemon_checksum(
     return ret;
 }
 
-uint16_t pksav_gen3_get_section_checksum(
-    const struct pksav_gen3_save_section* p_section,
-    size_t section_num
+// The checksum is a sum over all of the blocks, so it doesn't depend on their
+// order. This means an encrypted Pokémon only needs the XOR undone, not its
+// blocks reordered.
+static inline uint16_t _pksav_gen3_get_pokemon_checksum_with_key(
+    const struct pksav_gen3_pc_pokemon* p_gen3_pokemon,
+    uint32_t security_key
 )
 {
-    assert(p_section != NULL);
-    assert(section_num < PKSAV_GEN3_NUM_SAVE_SECTIONS);
+    assert(p_gen3_pokemon != NULL);
 
-    uint32_t checksum = 0;
-    uint16_t* p_checksum = (uint16_t*)&checksum;
+    const union pksav_gen3_pokemon_blocks_internal* p_gen3_pokemon_internal_blocks =
+        (const union pksav_gen3_pokemon_blocks_internal*)&p_gen3_pokemon->blocks;
 
+    uint32_t sum = 0;
     for(size_t index = 0;
-        index < (pksav_gen3_section_sizes[section_num]/4);
+        index < (sizeof(union pksav_gen3_pokemon_blocks_internal)/4);
         ++index)
     {
-        checksum += p_section->data32[index];
+        uint32_t word = p_gen3_pokemon_internal_blocks->blocks32[index] ^ security_key;
+        sum += (word & 0xFFFF) + (word >> 16);
     }
 
-    return (p_checksum[0] + p_checksum[1]);
+    return (uint16_t)sum;
+}
+
+bool pksav_gen3_is_pokemon_checksum_valid(
+    const struct pksav_gen3_pc_pokemon* p_gen3_pokemon,
+    bool is_encrypted
+)
+{
+    assert(p_gen3_pokemon != NULL);
+
+    uint32_t security_key = is_encrypted ? (p_gen3_pokemon->ot_id.id ^ p_gen3_pokemon->personality)
+                                         : 0;
+
+    return (_pksav_gen3_get_pokemon_checksum_with_key(p_gen3_pokemon, security_key) ==
+            p_gen3_pokemon->checksum);
+}
+
+enum pksav_error pksav_gen3_verify_pokemon_checksums(
+    const struct pksav_gen3_pc_pokemon* p_pokemon_array,
+    size_t num_pokemon,
+    bool are_encrypted,
+    uint8_t* p_bad_checksums_out
+)
+{
+    if(!p_pokemon_array || !p_bad_checksums_out)
+    {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    memset(p_bad_checksums_out, 0, ((num_pokemon + 7) / 8));
+
+    for(size_t pokemon_index = 0;
+        pokemon_index < num_pokemon;
+        ++pokemon_index)
+    {
+        if(!pksav_gen3_is_pokemon_checksum_valid(
+                &p_pokemon_array[pokemon_index],
+                are_encrypted
+            ))
+        {
+            p_bad_checksums_out[pokemon_index / 8] |= (uint8_t)(1 << (pokemon_index % 8));
+        }
+    }
+
+    return PKSAV_ERROR_NONE;
+}
+
+uint16_t pksav_gen3_get_data_checksum(
+    const uint32_t* p_data32,
+    size_t num_words
+)
+{
+    assert(p_data32 != NULL);
+
+    uint32_t checksum = pksav_gen3_sum_words(p_data32, num_words);
+
+    return (uint16_t)((checksum & 0xFFFF) + (checksum >> 16));
+}
+
+uint16_t pksav_gen3_get_section_checksum(
+    const struct pksav_gen3_save_section* p_section,
+    size_t section_num
+)
+{
+    assert(p_section != NULL);
+    assert(section_num < PKSAV_GEN3_NUM_SAVE_SECTIONS);
+
+    return pksav_gen3_get_data_checksum(
+               p_section->data32,
+               (pksav_gen3_section_sizes[section_num]/4)
+           );
 }
 
 void pksav_gen3_set_section_checksums(
-    union pksav_gen3_save_slot* p_sections
+    union pksav_gen3_save_slot* p_save_slot,
+    const uint8_t* p_section_nums,
+    uint16_t sections_to_set
 )
 {
-    assert(p_sections != NULL);
+    assert(p_save_slot != NULL);
+    assert(p_section_nums != NULL);
 
     for(size_t section_index = 0;
         section_index < PKSAV_GEN3_NUM_SAVE_SECTIONS;
         ++section_index)
     {
-        p_sections->sections_arr[section_index].footer.checksum =
-            pksav_gen3_get_section_checksum(
-                &p_sections->sections_arr[section_index],
-                section_index
-            );
+        const uint8_t section_id = p_section_nums[section_index];
+        assert(section_id < PKSAV_GEN3_NUM_SAVE_SECTIONS);
+
+        if(sections_to_set & PKSAV_GEN3_SECTION_MASK(section_id))
+        {
+            p_save_slot->sections_arr[section_index].footer.checksum =
+                pksav_gen3_get_section_checksum(
+                    &p_save_slot->sections_arr[section_index],
+                    section_id
+                );
+        }
     }
 }
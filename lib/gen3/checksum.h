@@ -16,6 +16,7 @@
 #include <pksav/gen3/save.h>
 
 #include <assert.h>
+#include <stdbool.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -36,13 +37,29 @@ static inline void pksav_gen3_set_pokemon_checksum(
     p_gen3_pokemon->checksum = pksav_gen3_get_pokemon_checksum(p_gen3_pokemon);
 }
 
+// Works on encrypted Pokémon without decrypting them.
+bool pksav_gen3_is_pokemon_checksum_valid(
+    const struct pksav_gen3_pc_pokemon* p_gen3_pokemon,
+    bool is_encrypted
+);
+
+// The folded 32-bit sum used by section checksums, for data not stored in
+// a section struct.
+uint16_t pksav_gen3_get_data_checksum(
+    const uint32_t* p_data32,
+    size_t num_words
+);
+
 uint16_t pksav_gen3_get_section_checksum(
     const struct pksav_gen3_save_section* p_section,
     size_t section_num
 );
 
+// Works on a shuffled slot, with p_section_nums giving each position's ID.
 void pksav_gen3_set_section_checksums(
-    union pksav_gen3_save_slot* p_sections
+    union pksav_gen3_save_slot* p_save_slot,
+    const uint8_t* p_section_nums,
+    uint16_t sections_to_set
 );
 
 #ifdef __cplusplus
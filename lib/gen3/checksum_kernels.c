@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "checksum_kernels.h"
+
+#include "util/cpu.h"
+
+#include <assert.h>
+
+#if defined(PKSAV_CPU_X86_DISPATCH)
+#    define PKSAV_GEN3_CHECKSUM_X86
+#    include <immintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#    define PKSAV_GEN3_CHECKSUM_NEON
+#    include <arm_neon.h>
+#endif
+
+/*
+ * Scalar
+ */
+
+static bool _pksav_gen3_scalar_is_supported(void)
+{
+    return true;
+}
+
+static uint32_t _pksav_gen3_sum_words_scalar(
+    const uint32_t* p_data32,
+    size_t num_words
+)
+{
+    assert(p_data32 != NULL);
+
+    uint32_t sum = 0;
+    for(size_t index = 0; index < num_words; ++index)
+    {
+        sum += p_data32[index];
+    }
+
+    return sum;
+}
+
+/*
+ * SSE2/AVX2
+ *
+ * 32-bit lane additions wrap the same way the scalar sum does, and addition
+ * mod 2^32 is order-independent, so summing the lanes at the end gives an
+ * identical result. Loads are unaligned since sections live in packed
+ * structs.
+ */
+
+#ifdef PKSAV_GEN3_CHECKSUM_X86
+
+__attribute__((target("sse2")))
+static uint32_t _pksav_gen3_sum_words_sse2(
+    const uint32_t* p_data32,
+    size_t num_words
+)
+{
+    assert(p_data32 != NULL);
+
+    __m128i sum0 = _mm_setzero_si128();
+    __m128i sum1 = _mm_setzero_si128();
+
+    size_t index = 0;
+    for(; (index + 8) <= num_words; index += 8)
+    {
+        sum0 = _mm_add_epi32(sum0, _mm_loadu_si128((const __m128i*)&p_data32[index]));
+        sum1 = _mm_add_epi32(sum1, _mm_loadu_si128((const __m128i*)&p_data32[index+4]));
+    }
+    sum0 = _mm_add_epi32(sum0, sum1);
+
+    // Horizontal sum of the four lanes.
+    sum0 = _mm_add_epi32(sum0, _mm_shuffle_epi32(sum0, _MM_SHUFFLE(1,0,3,2)));
+    sum0 = _mm_add_epi32(sum0, _mm_shuffle_epi32(sum0, _MM_SHUFFLE(2,3,0,1)));
+    uint32_t sum = (uint32_t)_mm_cvtsi128_si32(sum0);
+
+    for(; index < num_words; ++index)
+    {
+        sum += p_data32[index];
+    }
+
+    return sum;
+}
+
+__attribute__((target("avx2")))
+static uint32_t _pksav_gen3_sum_words_avx2(
+    const uint32_t* p_data32,
+    size_t num_words
+)
+{
+    assert(p_data32 != NULL);
+
+    __m256i sum0 = _mm256_setzero_si256();
+    __m256i sum1 = _mm256_setzero_si256();
+
+    size_t index = 0;
+    for(; (index + 16) <= num_words; index += 16)
+    {
+        sum0 = _mm256_add_epi32(sum0, _mm256_loadu_si256((const __m256i*)&p_data32[index]));
+        sum1 = _mm256_add_epi32(sum1, _mm256_loadu_si256((const __m256i*)&p_data32[index+8]));
+    }
+    sum0 = _mm256_add_epi32(sum0, sum1);
+
+    // Horizontal sum of the eight lanes.
+    __m128i sum128 = _mm_add_epi32(
+                         _mm256_castsi256_si128(sum0),
+                         _mm256_extracti128_si256(sum0, 1)
+                     );
+    sum128 = _mm_add_epi32(sum128, _mm_shuffle_epi32(sum128, _MM_SHUFFLE(1,0,3,2)));
+    sum128 = _mm_add_epi32(sum128, _mm_shuffle_epi32(sum128, _MM_SHUFFLE(2,3,0,1)));
+    uint32_t sum = (uint32_t)_mm_cvtsi128_si32(sum128);
+
+    for(; index < num_words; ++index)
+    {
+        sum += p_data32[index];
+    }
+
+    return sum;
+}
+
+#endif /* PKSAV_GEN3_CHECKSUM_X86 */
+
+/*
+ * NEON
+ *
+ * NEON is part of the baseline for every ARM target that defines
+ * __ARM_NEON, so no runtime check is needed.
+ */
+
+#ifdef PKSAV_GEN3_CHECKSUM_NEON
+
+static bool _pksav_gen3_neon_is_supported(void)
+{
+    return true;
+}
+
+static uint32_t _pksav_gen3_sum_words_neon(
+    const uint32_t* p_data32,
+    size_t num_words
+)
+{
+    assert(p_data32 != NULL);
+
+    uint32x4_t sum0 = vdupq_n_u32(0);
+    uint32x4_t sum1 = vdupq_n_u32(0);
+
+    size_t index = 0;
+    for(; (index + 8) <= num_words; index += 8)
+    {
+        sum0 = vaddq_u32(sum0, vreinterpretq_u32_u8(vld1q_u8((const uint8_t*)&p_data32[index])));
+        sum1 = vaddq_u32(sum1, vreinterpretq_u32_u8(vld1q_u8((const uint8_t*)&p_data32[index+4])));
+    }
+    sum0 = vaddq_u32(sum0, sum1);
+
+    uint32x2_t sum64 = vadd_u32(vget_low_u32(sum0), vget_high_u32(sum0));
+    uint32_t sum = vget_lane_u32(sum64, 0) + vget_lane_u32(sum64, 1);
+
+    for(; index < num_words; ++index)
+    {
+        sum += p_data32[index];
+    }
+
+    return sum;
+}
+
+#endif /* PKSAV_GEN3_CHECKSUM_NEON */
+
+/*
+ * Dispatch
+ */
+
+const struct pksav_gen3_checksum_kernel pksav_gen3_checksum_kernels[] =
+{
+    {"scalar", _pksav_gen3_scalar_is_supported, _pksav_gen3_sum_words_scalar},
+#ifdef PKSAV_GEN3_CHECKSUM_X86
+    {"sse2",   pksav_cpu_has_sse2,              _pksav_gen3_sum_words_sse2},
+    {"avx2",   pksav_cpu_has_avx2,              _pksav_gen3_sum_words_avx2},
+#endif
+#ifdef PKSAV_GEN3_CHECKSUM_NEON
+    {"neon",   _pksav_gen3_neon_is_supported,   _pksav_gen3_sum_words_neon},
+#endif
+};
+
+const size_t pksav_gen3_num_checksum_kernels =
+    sizeof(pksav_gen3_checksum_kernels) / sizeof(pksav_gen3_checksum_kernels[0]);
+
+// The fastest kernel the current CPU supports, found on first use.
+static const void* _pksav_gen3_checksum_kernel = NULL;
+
+uint32_t pksav_gen3_sum_words(
+    const uint32_t* p_data32,
+    size_t num_words
+)
+{
+    const struct pksav_gen3_checksum_kernel* p_kernel =
+        PKSAV_CPU_RESOLVE_KERNEL(
+            _pksav_gen3_checksum_kernel,
+            pksav_gen3_checksum_kernels,
+            pksav_gen3_num_checksum_kernels
+        );
+
+    return p_kernel->sum_words(p_data32, num_words);
+}
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef PKSAV_GEN3_CHECKSUM_KERNELS_H
+#define PKSAV_GEN3_CHECKSUM_KERNELS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * An implementation of the 32-bit word sum behind section checksums.
+ *
+ * Every kernel must return exactly what the scalar kernel does, including
+ * overflow, for any input.
+ */
+struct pksav_gen3_checksum_kernel
+{
+    const char* p_name;
+
+    // Whether the current CPU can run this kernel.
+    bool (*is_supported)(void);
+
+    uint32_t (*sum_words)(
+        const uint32_t* p_data32,
+        size_t num_words
+    );
+};
+
+// All kernels compiled into this build, from slowest to fastest. The
+// first is always the scalar kernel.
+extern const struct pksav_gen3_checksum_kernel pksav_gen3_checksum_kernels[];
+extern const size_t pksav_gen3_num_checksum_kernels;
+
+// Sums the given words with the fastest kernel the current CPU supports.
+uint32_t pksav_gen3_sum_words(
+    const uint32_t* p_data32,
+    size_t num_words
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PKSAV_GEN3_CHECKSUM_KERNELS_H */
@@ -8,115 +8,243 @@
 #include "gen3/crypt.h"
 #include "gen3/save_internal.h"
 
+#include "util/cpu.h"
+
 #include <pksav/gen3/common.h>
 
 #include <assert.h>
 #include <string.h>
 
-static const size_t GEN3_BLOCK_ORDERS[24][4] =
+#ifdef PKSAV_CPU_X86_DISPATCH
+#    include <immintrin.h>
+#endif
+
+/*
+ * A Pokémon's four blocks are stored in one of 24 orders, chosen by its
+ * personality. This lists the block at each stored position, indexed by
+ * personality % 24, and the word-level permutations below are generated
+ * from it.
+ */
+#define GEN3_BLOCK_ORDERS(X) \
+    X(G,A,E,M) X(G,A,M,E) X(G,E,A,M) X(G,E,M,A) X(G,M,A,E) X(G,M,E,A) \
+    X(A,G,E,M) X(A,G,M,E) X(A,E,G,M) X(A,E,M,G) X(A,M,G,E) X(A,M,E,G) \
+    X(E,G,A,M) X(E,G,M,A) X(E,A,G,M) X(E,A,M,G) X(E,M,G,A) X(E,M,A,G) \
+    X(M,G,A,E) X(M,G,E,A) X(M,A,G,E) X(M,A,E,G) X(M,E,G,A) X(M,E,A,G)
+
+// Each block's index in struct pksav_gen3_pokemon_blocks
+#define GEN3_BLOCK_G 0
+#define GEN3_BLOCK_A 1
+#define GEN3_BLOCK_E 2
+#define GEN3_BLOCK_M 3
+
+#define GEN3_NUM_BLOCK_WORDS (PKSAV_GEN3_POKEMON_ALL_BLOCKS_SIZE_BYTES/4)
+
+// The three words making up the given block
+#define GEN3_BLOCK_WORDS(block) ((block)*3), ((block)*3+1), ((block)*3+2)
+
+// The stored position of the given block
+#define GEN3_BLOCK_POSITION(block,b0,b1,b2,b3) \
+    ((GEN3_BLOCK_##b0 == (block)) ? 0 : \
+     (GEN3_BLOCK_##b1 == (block)) ? 1 : \
+     (GEN3_BLOCK_##b2 == (block)) ? 2 : 3)
+
+#define GEN3_DECRYPT_WORD_ORDER(b0,b1,b2,b3) \
+    { \
+        GEN3_BLOCK_WORDS(GEN3_BLOCK_POSITION(GEN3_BLOCK_G,b0,b1,b2,b3)), \
+        GEN3_BLOCK_WORDS(GEN3_BLOCK_POSITION(GEN3_BLOCK_A,b0,b1,b2,b3)), \
+        GEN3_BLOCK_WORDS(GEN3_BLOCK_POSITION(GEN3_BLOCK_E,b0,b1,b2,b3)), \
+        GEN3_BLOCK_WORDS(GEN3_BLOCK_POSITION(GEN3_BLOCK_M,b0,b1,b2,b3)) \
+    },
+
+#define GEN3_ENCRYPT_WORD_ORDER(b0,b1,b2,b3) \
+    { \
+        GEN3_BLOCK_WORDS(GEN3_BLOCK_##b0), \
+        GEN3_BLOCK_WORDS(GEN3_BLOCK_##b1), \
+        GEN3_BLOCK_WORDS(GEN3_BLOCK_##b2), \
+        GEN3_BLOCK_WORDS(GEN3_BLOCK_##b3) \
+    },
+
+/*
+ * For each direction and block order, which input word ends up in each
+ * output word. Decrypting uses the inverse of the encrypting permutation, so
+ * after picking a row, both directions are the same operation.
+ */
+static const uint8_t GEN3_BLOCK_WORD_ORDERS[2][24][GEN3_NUM_BLOCK_WORDS] =
 {
-    /* A  E  G  M */
-    /* GAEM */ {1, 2, 0, 3},
-    /* GAME */ {1, 3, 0, 2},
-    /* GEAM */ {2, 1, 0, 3},
-    /* GEMA */ {3, 1, 0, 2},
-    /* GMAE */ {2, 3, 0, 1},
-    /* GMEA */ {3, 2, 0, 1},
-    /* AGEM */ {0, 2, 1, 3},
-    /* AGME */ {0, 3, 1, 2},
-    /* AEGM */ {0, 1, 2, 3},
-    /* AEMG */ {0, 1, 3, 2},
-    /* AMGE */ {0, 3, 2, 1},
-    /* AMEG */ {0, 2, 3, 1},
-    /* EGAM */ {2, 0, 1, 3},
-    /* EGMA */ {3, 0, 1, 2},
-    /* EAGM */ {1, 0, 2, 3},
-    /* EAMG */ {1, 0, 3, 2},
-    /* EMGA */ {3, 0, 2, 1},
-    /* EMAG */ {2, 0, 3, 1},
-    /* MGAE */ {2, 3, 1, 0},
-    /* MGEA */ {3, 2, 1, 0},
-    /* MAGE */ {1, 3, 2, 0},
-    /* MAEG */ {1, 2, 3, 0},
-    /* MEGA */ {3, 1, 2, 0},
-    /* MEAG */ {2, 1, 3, 0}
+    // Decrypt
+    {GEN3_BLOCK_ORDERS(GEN3_DECRYPT_WORD_ORDER)},
+    // Encrypt
+    {GEN3_BLOCK_ORDERS(GEN3_ENCRYPT_WORD_ORDER)}
 };
 
-void pksav_gen3_crypt_pokemon(
-    struct pksav_gen3_pc_pokemon* p_gen3_pokemon,
+/*
+ * Scalar
+ */
+
+static bool _pksav_gen3_crypt_scalar_is_supported(void)
+{
+    return true;
+}
+
+static void _pksav_gen3_crypt_pokemon_scalar(
+    struct pksav_gen3_pc_pokemon* p_pokemon_array,
+    size_t num_pokemon,
     bool should_encrypt
 )
 {
-    assert(p_gen3_pokemon != NULL);
+    assert(p_pokemon_array != NULL);
 
-    union pksav_gen3_pokemon_blocks_internal* p_gen3_pokemon_internal_blocks =
-        (union pksav_gen3_pokemon_blocks_internal*)&p_gen3_pokemon->blocks;
+    for(size_t pokemon_index = 0;
+        pokemon_index < num_pokemon;
+        ++pokemon_index)
+    {
+        struct pksav_gen3_pc_pokemon* p_gen3_pokemon = &p_pokemon_array[pokemon_index];
 
-    uint32_t security_key = p_gen3_pokemon->ot_id.id
-                          ^ p_gen3_pokemon->personality;
+        union pksav_gen3_pokemon_blocks_internal* p_gen3_pokemon_internal_blocks =
+            (union pksav_gen3_pokemon_blocks_internal*)&p_gen3_pokemon->blocks;
 
-    for(size_t index = 0;
-        index < (PKSAV_GEN3_POKEMON_ALL_BLOCKS_SIZE_BYTES/4);
-        ++index)
-    {
-        p_gen3_pokemon_internal_blocks->blocks32[index] ^= security_key;
+        uint32_t security_key = p_gen3_pokemon->ot_id.id
+                              ^ p_gen3_pokemon->personality;
+        const uint8_t* p_word_order =
+            GEN3_BLOCK_WORD_ORDERS[should_encrypt ? 1 : 0][p_gen3_pokemon->personality % 24];
+
+        // Gathering from a copy is left as-is on purpose. Permuting the
+        // blocks in place, either by following the permutation's cycles
+        // or with a fixed three swaps, measured about half as fast here,
+        // since the copy stays in registers and the in-place versions
+        // chain loads behind stores to the same blocks.
+        uint32_t words[GEN3_NUM_BLOCK_WORDS];
+        memcpy(words, p_gen3_pokemon_internal_blocks->blocks32, sizeof(words));
+
+        for(size_t index = 0; index < GEN3_NUM_BLOCK_WORDS; ++index)
+        {
+            p_gen3_pokemon_internal_blocks->blocks32[index] =
+                words[p_word_order[index]] ^ security_key;
+        }
     }
+}
+
+/*
+ * AVX2
+ *
+ * The 12 words are loaded as two overlapping 8-word vectors (words 0-7 and
+ * 4-11) so nothing past the blocks is read. Each output vector is then two
+ * dword permutes and a blend.
+ */
 
-    size_t index         = p_gen3_pokemon->personality % 24;
-    size_t attacks_index = GEN3_BLOCK_ORDERS[index][0];
-    size_t effort_index  = GEN3_BLOCK_ORDERS[index][1];
-    size_t growth_index  = GEN3_BLOCK_ORDERS[index][2];
-    size_t misc_index    = GEN3_BLOCK_ORDERS[index][3];
+#ifdef PKSAV_CPU_X86_DISPATCH
+
+__attribute__((target("avx2")))
+static inline __m256i _pksav_gen3_permute_words_avx2(
+    __m256i words_lo,
+    __m256i words_hi,
+    const uint8_t* p_word_order
+)
+{
+    __m256i indices = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)p_word_order));
+
+    __m256i from_lo = _mm256_permutevar8x32_epi32(words_lo, indices);
+    __m256i from_hi = _mm256_permutevar8x32_epi32(
+                          words_hi,
+                          _mm256_sub_epi32(indices, _mm256_set1_epi32(4))
+                      );
+
+    return _mm256_blendv_epi8(
+               from_lo,
+               from_hi,
+               _mm256_cmpgt_epi32(indices, _mm256_set1_epi32(7))
+           );
+}
 
-    union pksav_gen3_pokemon_blocks_internal new_blocks_internal;
-    if(should_encrypt)
+__attribute__((target("avx2")))
+static void _pksav_gen3_crypt_pokemon_avx2(
+    struct pksav_gen3_pc_pokemon* p_pokemon_array,
+    size_t num_pokemon,
+    bool should_encrypt
+)
+{
+    assert(p_pokemon_array != NULL);
+
+    for(size_t pokemon_index = 0;
+        pokemon_index < num_pokemon;
+        ++pokemon_index)
     {
-        memcpy(
-            &new_blocks_internal.blocks[growth_index],
-            &p_gen3_pokemon->blocks.growth,
-            sizeof(struct pksav_gen3_pokemon_growth_block)
-        );
-        memcpy(
-            &new_blocks_internal.blocks[attacks_index],
-            &p_gen3_pokemon->blocks.attacks,
-            sizeof(struct pksav_gen3_pokemon_attacks_block)
-        );
-        memcpy(
-            &new_blocks_internal.blocks[effort_index],
-            &p_gen3_pokemon->blocks.effort,
-            sizeof(struct pksav_gen3_pokemon_effort_block)
-        );
-        memcpy(
-            &new_blocks_internal.blocks[misc_index],
-            &p_gen3_pokemon->blocks.misc,
-            sizeof(struct pksav_gen3_pokemon_misc_block)
-        );
+        struct pksav_gen3_pc_pokemon* p_gen3_pokemon = &p_pokemon_array[pokemon_index];
+
+        uint32_t* p_words32 =
+            ((union pksav_gen3_pokemon_blocks_internal*)&p_gen3_pokemon->blocks)->blocks32;
+
+        const __m256i security_key256 = _mm256_set1_epi32(
+                                            (int)(p_gen3_pokemon->ot_id.id ^
+                                                  p_gen3_pokemon->personality)
+                                        );
+        const uint8_t* p_word_order =
+            GEN3_BLOCK_WORD_ORDERS[should_encrypt ? 1 : 0][p_gen3_pokemon->personality % 24];
+
+        __m256i words_lo = _mm256_loadu_si256((const __m256i*)&p_words32[0]);
+        __m256i words_hi = _mm256_loadu_si256((const __m256i*)&p_words32[4]);
+
+        __m256i new_words_lo = _pksav_gen3_permute_words_avx2(words_lo, words_hi, &p_word_order[0]);
+        __m256i new_words_hi = _pksav_gen3_permute_words_avx2(words_lo, words_hi, &p_word_order[4]);
+
+        _mm256_storeu_si256((__m256i*)&p_words32[0], _mm256_xor_si256(new_words_lo, security_key256));
+        _mm256_storeu_si256((__m256i*)&p_words32[4], _mm256_xor_si256(new_words_hi, security_key256));
     }
-    else
+}
+
+#endif /* PKSAV_CPU_X86_DISPATCH */
+
+/*
+ * Dispatch
+ */
+
+const struct pksav_gen3_crypt_kernel pksav_gen3_crypt_kernels[] =
+{
+    {"scalar", _pksav_gen3_crypt_scalar_is_supported, _pksav_gen3_crypt_pokemon_scalar},
+#ifdef PKSAV_CPU_X86_DISPATCH
+    {"avx2",   pksav_cpu_has_avx2,                    _pksav_gen3_crypt_pokemon_avx2},
+#endif
+};
+
+const size_t pksav_gen3_num_crypt_kernels =
+    sizeof(pksav_gen3_crypt_kernels) / sizeof(pksav_gen3_crypt_kernels[0]);
+
+// The fastest kernel the current CPU supports, found on first use.
+static const void* _pksav_gen3_crypt_kernel = NULL;
+
+static inline const struct pksav_gen3_crypt_kernel* _pksav_gen3_get_crypt_kernel(void)
+{
+    return PKSAV_CPU_RESOLVE_KERNEL(
+               _pksav_gen3_crypt_kernel,
+               pksav_gen3_crypt_kernels,
+               pksav_gen3_num_crypt_kernels
+           );
+}
+
+void pksav_gen3_crypt_pokemon(
+    struct pksav_gen3_pc_pokemon* p_gen3_pokemon,
+    bool should_encrypt
+)
+{
+    assert(p_gen3_pokemon != NULL);
+
+    _pksav_gen3_get_crypt_kernel()->crypt_pokemon(p_gen3_pokemon, 1, should_encrypt);
+}
+
+enum pksav_error pksav_gen3_crypt_pokemon_array(
+    struct pksav_gen3_pc_pokemon* p_pokemon_array,
+    size_t num_pokemon,
+    bool should_encrypt
+)
+{
+    if(!p_pokemon_array)
     {
-        memcpy(
-            &new_blocks_internal.by_name.growth,
-            &p_gen3_pokemon_internal_blocks->blocks[growth_index],
-            sizeof(struct pksav_gen3_pokemon_growth_block)
-        );
-        memcpy(
-            &new_blocks_internal.by_name.attacks,
-            &p_gen3_pokemon_internal_blocks->blocks[attacks_index],
-            sizeof(struct pksav_gen3_pokemon_attacks_block)
-        );
-        memcpy(
-            &new_blocks_internal.by_name.effort,
-            &p_gen3_pokemon_internal_blocks->blocks[effort_index],
-            sizeof(struct pksav_gen3_pokemon_effort_block)
-        );
-        memcpy(
-            &new_blocks_internal.by_name.misc,
-            &p_gen3_pokemon_internal_blocks->blocks[misc_index],
-            sizeof(struct pksav_gen3_pokemon_misc_block)
-        );
+        return PKSAV_ERROR_NULL_POINTER;
     }
 
-    p_gen3_pokemon->blocks = new_blocks_internal.by_name;
+    _pksav_gen3_get_crypt_kernel()->crypt_pokemon(p_pokemon_array, num_pokemon, should_encrypt);
+
+    return PKSAV_ERROR_NONE;
 }
 
 void pksav_gen3_save_crypt_items(
@@ -13,8 +13,32 @@
 #include <pksav/gen3/save.h>
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
+/*
+ * An implementation of Pokémon encryption and decryption. Every kernel must
+ * give exactly the same result as the scalar kernel.
+ */
+struct pksav_gen3_crypt_kernel
+{
+    const char* p_name;
+
+    // Whether the current CPU can run this kernel.
+    bool (*is_supported)(void);
+
+    void (*crypt_pokemon)(
+        struct pksav_gen3_pc_pokemon* p_pokemon_array,
+        size_t num_pokemon,
+        bool should_encrypt
+    );
+};
+
+// All kernels compiled into this build, from slowest to fastest. The
+// first is always the scalar kernel.
+extern const struct pksav_gen3_crypt_kernel pksav_gen3_crypt_kernels[];
+extern const size_t pksav_gen3_num_crypt_kernels;
+
 void pksav_gen3_crypt_pokemon(
     struct pksav_gen3_pc_pokemon* p_gen3_pokemon,
     bool should_encrypt
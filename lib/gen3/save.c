@@ -10,6 +10,9 @@
 #include "save_internal.h"
 #include "shuffle.h"
 
+#include "util/async_writer.h"
+#include "util/batch.h"
+#include "util/bulk.h"
 #include "util/fs.h"
 
 #include <pksav/config.h>
@@ -20,6 +23,7 @@
 
 #include <pksav/math/endian.h>
 
+#include <stddef.h>
 #include <string.h>
 
 union pksav_gen3_save_slot* pksav_gen3_get_active_save_slot_ptr(
@@ -58,6 +62,114 @@ union pksav_gen3_save_slot* pksav_gen3_get_active_save_slot_ptr(
     return p_active_save_slot;
 }
 
+static bool _pksav_gen3_is_section_footer_valid(
+    const struct pksav_gen3_section_footer* p_section_footer
+)
+{
+    assert(p_section_footer != NULL);
+
+    return (p_section_footer->section_id <= (PKSAV_GEN3_NUM_SAVE_SECTIONS-1)) &&
+           (pksav_littleendian32(p_section_footer->validation) == PKSAV_GEN3_VALIDATION_MAGIC);
+}
+
+// Checks the next footer in a slot, where p_seen_sections holds a bit for
+// every section ID already found. A slot is only valid if all of its
+// footers are valid and it holds each section exactly once, since saving
+// writes back every section by its position.
+static bool _pksav_gen3_add_section_footer(
+    const struct pksav_gen3_section_footer* p_section_footer,
+    uint16_t* p_seen_sections
+)
+{
+    assert(p_section_footer != NULL);
+    assert(p_seen_sections != NULL);
+
+    bool is_footer_valid = _pksav_gen3_is_section_footer_valid(p_section_footer);
+    if(is_footer_valid)
+    {
+        const uint16_t section_bit = (uint16_t)(1 << p_section_footer->section_id);
+
+        is_footer_valid = !(*p_seen_sections & section_bit);
+        *p_seen_sections |= section_bit;
+    }
+
+    return is_footer_valid;
+}
+
+// Which game wrote the given section 0, or PKSAV_GEN3_SAVE_TYPE_NONE if its
+// security keys don't match for any game.
+static enum pksav_gen3_save_type _pksav_gen3_get_section0_save_type(
+    const struct pksav_gen3_save_section* p_section0
+)
+{
+    assert(p_section0 != NULL);
+
+    const uint32_t rs_game_code = 0;
+    const uint32_t frlg_game_code = 1;
+
+    /*
+     * For Ruby/Sapphire and FireRed/LeafGreen, check for validation by
+     * checking for a known game code and comparing the two security
+     * keys. For Emerald, there is no game code, so just compare the
+     * security keys. To avoid false positives, search in a specific
+     * order.
+     */
+    static const enum pksav_gen3_save_type save_types_to_search[3] =
+    {
+        PKSAV_GEN3_SAVE_TYPE_RS,
+        PKSAV_GEN3_SAVE_TYPE_FRLG,
+        PKSAV_GEN3_SAVE_TYPE_EMERALD
+    };
+    static const size_t num_save_types =
+        sizeof(save_types_to_search)/sizeof(save_types_to_search[0]);
+
+    for(size_t save_type_index = 0;
+        save_type_index < num_save_types;
+        ++save_type_index)
+    {
+        enum pksav_gen3_save_type save_type = save_types_to_search[save_type_index];
+
+        const size_t security_key1_offset =
+            PKSAV_GEN3_SAVE_SECTION0_OFFSETS[save_type-1][PKSAV_GEN3_SECURITY_KEY1];
+        const size_t security_key2_offset =
+            PKSAV_GEN3_SAVE_SECTION0_OFFSETS[save_type-1][PKSAV_GEN3_SECURITY_KEY2];
+
+        // Ignore endianness for the security keys since we're not actually
+        // using the value, just checking equality.
+        const uint32_t security_key1 = p_section0->data32[
+                                           security_key1_offset/4
+                                       ];
+        const uint32_t security_key2 = p_section0->data32[
+                                           security_key2_offset/4
+                                       ];
+
+        bool is_save_valid = (security_key1 == security_key2);
+        if(save_type != PKSAV_GEN3_SAVE_TYPE_EMERALD)
+        {
+            const size_t game_code_offset =
+                PKSAV_GEN3_SAVE_SECTION0_OFFSETS[save_type-1][PKSAV_GEN3_GAME_CODE];
+
+            const uint32_t game_code = pksav_littleendian32(
+                                           p_section0->data32[
+                                               game_code_offset/4
+                                           ]
+                                       );
+
+            const uint32_t expected_game_code = (save_type == PKSAV_GEN3_SAVE_TYPE_RS)
+                ? rs_game_code : frlg_game_code;
+
+            is_save_valid &= (game_code == expected_game_code);
+        }
+
+        if(is_save_valid)
+        {
+            return save_type;
+        }
+    }
+
+    return PKSAV_GEN3_SAVE_TYPE_NONE;
+}
+
 enum pksav_error pksav_gen3_get_buffer_save_type(
     const uint8_t* buffer,
     size_t buffer_len,
@@ -81,9 +193,16 @@ enum pksav_error pksav_gen3_get_buffer_save_type(
         // At this point, we know the buffer is large enough to be a save, so
         // now to validate the sections.
 
-        // Make sure the section IDs are valid before using them as array
-        // indices to avoid a crash.
+        // Make sure the section IDs are valid and unique before using them
+        // as array indices to avoid a crash. We stop at the first bad
+        // footer, so most invalid buffers are rejected after reading a
+        // single footer.
+        //
+        // Rather than unshuffling the whole slot, just remember where
+        // section 0 is, since that's the only section we need to read.
         bool is_save_valid = true;
+        uint16_t seen_sections = 0;
+        const struct pksav_gen3_save_section* p_section0 = NULL;
 
         for(size_t section_index = 0;
             (section_index < PKSAV_GEN3_NUM_SAVE_SECTIONS) && is_save_valid;
@@ -92,86 +211,19 @@ enum pksav_error pksav_gen3_get_buffer_save_type(
             const struct pksav_gen3_section_footer* p_section_footer =
                 &p_save_slot->sections_arr[section_index].footer;
 
-            if((p_section_footer->section_id > (PKSAV_GEN3_NUM_SAVE_SECTIONS-1)) ||
-               (pksav_littleendian32(p_section_footer->validation) != PKSAV_GEN3_VALIDATION_MAGIC))
+            if(!_pksav_gen3_add_section_footer(p_section_footer, &seen_sections))
             {
                 is_save_valid = false;
             }
+            else if(p_section_footer->section_id == 0)
+            {
+                p_section0 = &p_save_slot->sections_arr[section_index];
+            }
         }
 
-        if(is_save_valid)
+        if(is_save_valid && (p_section0 != NULL))
         {
-            union pksav_gen3_save_slot unshuffled_save_slots;
-            uint8_t section_nums[14] = {0}; // Unused
-            pksav_gen3_save_unshuffle_sections(
-                p_save_slot,
-                &unshuffled_save_slots,
-                section_nums
-            );
-
-            const uint32_t rs_game_code = 0;
-            const uint32_t frlg_game_code = 1;
-
-            /*
-             * For Ruby/Sapphire and FireRed/LeafGreen, check for validation by
-             * checking for a known game code and comparing the two security
-             * keys. For Emerald, there is no game code, so just compare the
-             * security keys. To avoid false positives, search in a specific
-             * order.
-             */
-            static const enum pksav_gen3_save_type save_types_to_search[3] =
-            {
-                PKSAV_GEN3_SAVE_TYPE_RS,
-                PKSAV_GEN3_SAVE_TYPE_FRLG,
-                PKSAV_GEN3_SAVE_TYPE_EMERALD
-            };
-            static const size_t num_save_types =
-                sizeof(save_types_to_search)/sizeof(save_types_to_search[0]);
-
-            is_save_valid = false;
-            for(size_t save_type_index = 0;
-                (save_type_index < num_save_types) && !is_save_valid;
-                ++save_type_index)
-            {
-                enum pksav_gen3_save_type save_type = save_types_to_search[save_type_index];
-
-                const size_t security_key1_offset =
-                    PKSAV_GEN3_SAVE_SECTION0_OFFSETS[save_type-1][PKSAV_GEN3_SECURITY_KEY1];
-                const size_t security_key2_offset =
-                    PKSAV_GEN3_SAVE_SECTION0_OFFSETS[save_type-1][PKSAV_GEN3_SECURITY_KEY2];
-
-                // Ignore endianness for the security keys since we're not actually
-                // using the value, just checking equality.
-                const uint32_t security_key1 = unshuffled_save_slots.section0.data32[
-                                                   security_key1_offset/4
-                                               ];
-                const uint32_t security_key2 = unshuffled_save_slots.section0.data32[
-                                                   security_key2_offset/4
-                                               ];
-
-                is_save_valid = (security_key1 == security_key2);
-                if(save_type != PKSAV_GEN3_SAVE_TYPE_EMERALD)
-                {
-                    const size_t game_code_offset =
-                        PKSAV_GEN3_SAVE_SECTION0_OFFSETS[save_type-1][PKSAV_GEN3_GAME_CODE];
-
-                    const uint32_t game_code = pksav_littleendian32(
-                                                   unshuffled_save_slots.section0.data32[
-                                                       game_code_offset/4
-                                                   ]
-                                               );
-
-                    const uint32_t expected_game_code = (save_type == PKSAV_GEN3_SAVE_TYPE_RS)
-                        ? rs_game_code : frlg_game_code;
-
-                    is_save_valid &= (game_code == expected_game_code);
-                }
-
-                if(is_save_valid)
-                {
-                    *p_save_type_out = save_type;
-                }
-            }
+            *p_save_type_out = _pksav_gen3_get_section0_save_type(p_section0);
         }
     } 
     else
@@ -194,24 +246,23 @@ enum pksav_error pksav_gen3_get_file_save_type(
 
     enum pksav_error error = PKSAV_ERROR_NONE;
 
-    uint8_t* p_file_buffer = NULL;
-    size_t buffer_len = 0;
-    error = pksav_fs_read_file_to_buffer(
+    struct pksav_fs_file_buffer file_buffer = {NULL, 0, false, false};
+    error = pksav_fs_map_file(
                 p_filepath,
-                &p_file_buffer,
-                &buffer_len
+                PKSAV_FS_MAP_READ_ONLY,
+                &file_buffer
             );
     if(!error)
     {
-        assert(p_file_buffer != NULL);
+        assert(file_buffer.p_buffer != NULL);
 
         enum pksav_gen3_save_type save_type = PKSAV_GEN3_SAVE_TYPE_NONE;
         error = pksav_gen3_get_buffer_save_type(
-                    p_file_buffer,
-                    buffer_len,
+                    file_buffer.p_buffer,
+                    file_buffer.buffer_len,
                     &save_type
                 );
-        free(p_file_buffer);
+        pksav_fs_unmap_file(&file_buffer);
 
         // Only return a result upon success.
         if(!error)
@@ -223,10 +274,382 @@ enum pksav_error pksav_gen3_get_file_save_type(
     return error;
 }
 
-static void _pksav_gen3_set_save_pointers(
+// Picks the active slot the same way pksav_gen3_get_active_save_slot_ptr
+// does, then reads only its footers, stopping at the first bad one, to find
+// where sections 0 and 1 are.
+static enum pksav_error _pksav_gen3_find_io_sections(
+    const struct pksav_io* p_io,
+    size_t* p_slot_offset_out,
+    size_t* p_section0_position_out,
+    size_t* p_section1_position_out,
+    bool* p_are_footers_valid_out
+)
+{
+    assert(p_io != NULL);
+    assert(p_io->read_at != NULL);
+    assert(p_io->get_size != NULL);
+    assert(p_slot_offset_out != NULL);
+    assert(p_section0_position_out != NULL);
+    assert(p_section1_position_out != NULL);
+    assert(p_are_footers_valid_out != NULL);
+
+    enum pksav_error error = PKSAV_ERROR_NONE;
+
+    static const size_t section_size = sizeof(struct pksav_gen3_save_section);
+    static const size_t footer_offset = offsetof(struct pksav_gen3_save_section, footer);
+
+    size_t io_size = 0;
+    error = p_io->get_size(p_io, &io_size);
+    if(!error && (io_size < PKSAV_GEN3_SAVE_SLOT_SIZE))
+    {
+        error = PKSAV_ERROR_INVALID_SAVE;
+    }
+
+    struct pksav_gen3_section_footer footer;
+    size_t slot_offset = 0;
+    if(!error)
+    {
+        error = p_io->read_at(
+                    p_io,
+                    footer_offset,
+                    (uint8_t*)&footer,
+                    sizeof(footer)
+                );
+    }
+    if(!error && (io_size >= (PKSAV_GEN3_SAVE_SLOT_SIZE*2)))
+    {
+        struct pksav_gen3_section_footer slot2_footer;
+        error = p_io->read_at(
+                    p_io,
+                    PKSAV_GEN3_SAVE_SLOT_SIZE + footer_offset,
+                    (uint8_t*)&slot2_footer,
+                    sizeof(slot2_footer)
+                );
+        if(!error && (pksav_littleendian32(footer.save_index) <=
+                      pksav_littleendian32(slot2_footer.save_index)))
+        {
+            footer = slot2_footer;
+            slot_offset = PKSAV_GEN3_SAVE_SLOT_SIZE;
+        }
+    }
+
+    bool are_footers_valid = true;
+    uint16_t seen_sections = 0;
+    size_t section0_position = PKSAV_GEN3_MISSING_SECTION;
+    size_t section1_position = PKSAV_GEN3_MISSING_SECTION;
+    for(size_t section_index = 0;
+        (section_index < PKSAV_GEN3_NUM_SAVE_SECTIONS) && are_footers_valid && !error;
+        ++section_index)
+    {
+        if(section_index > 0)
+        {
+            error = p_io->read_at(
+                        p_io,
+                        slot_offset + (section_size * section_index) + footer_offset,
+                        (uint8_t*)&footer,
+                        sizeof(footer)
+                    );
+        }
+        if(!error)
+        {
+            if(!_pksav_gen3_add_section_footer(&footer, &seen_sections))
+            {
+                are_footers_valid = false;
+            }
+            else if(footer.section_id == 0)
+            {
+                section0_position = section_index;
+            }
+            else if(footer.section_id == 1)
+            {
+                section1_position = section_index;
+            }
+        }
+    }
+
+    if(!error)
+    {
+        *p_slot_offset_out = slot_offset;
+        *p_section0_position_out = section0_position;
+        *p_section1_position_out = section1_position;
+        *p_are_footers_valid_out = are_footers_valid;
+    }
+
+    return error;
+}
+
+enum pksav_error pksav_gen3_get_io_save_type(
+    const struct pksav_io* p_io,
+    enum pksav_gen3_save_type* p_save_type_out
+)
+{
+    if(!p_io || !p_save_type_out || !p_io->read_at || !p_io->get_size)
+    {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    enum pksav_error error = PKSAV_ERROR_NONE;
+
+    size_t slot_offset = 0;
+    size_t section0_position = PKSAV_GEN3_MISSING_SECTION;
+    size_t section1_position = PKSAV_GEN3_MISSING_SECTION;
+    bool are_footers_valid = false;
+    error = _pksav_gen3_find_io_sections(
+                p_io,
+                &slot_offset,
+                &section0_position,
+                &section1_position,
+                &are_footers_valid
+            );
+
+    enum pksav_gen3_save_type save_type = PKSAV_GEN3_SAVE_TYPE_NONE;
+    if(!error && are_footers_valid && (section0_position != PKSAV_GEN3_MISSING_SECTION))
+    {
+        struct pksav_gen3_save_section section0;
+        error = p_io->read_at(
+                    p_io,
+                    slot_offset + (sizeof(section0) * section0_position),
+                    section0.data8,
+                    sizeof(section0.data8)
+                );
+        if(!error)
+        {
+            save_type = _pksav_gen3_get_section0_save_type(&section0);
+        }
+    }
+
+    // Only return a result upon success.
+    if(!error)
+    {
+        *p_save_type_out = save_type;
+    }
+
+    return error;
+}
+
+enum pksav_error pksav_gen3_peek_save_from_io(
+    const struct pksav_io* p_io,
+    struct pksav_gen3_save_peek* p_peek_out
+)
+{
+    if(!p_io || !p_peek_out || !p_io->read_at || !p_io->get_size)
+    {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    enum pksav_error error = PKSAV_ERROR_NONE;
+
+    static const size_t section_size = sizeof(struct pksav_gen3_save_section);
+
+    size_t slot_offset = 0;
+    size_t section0_position = PKSAV_GEN3_MISSING_SECTION;
+    size_t section1_position = PKSAV_GEN3_MISSING_SECTION;
+    bool are_footers_valid = false;
+    error = _pksav_gen3_find_io_sections(
+                p_io,
+                &slot_offset,
+                &section0_position,
+                &section1_position,
+                &are_footers_valid
+            );
+    if(!error && (!are_footers_valid ||
+                  (section0_position == PKSAV_GEN3_MISSING_SECTION) ||
+                  (section1_position == PKSAV_GEN3_MISSING_SECTION)))
+    {
+        error = PKSAV_ERROR_INVALID_SAVE;
+    }
+
+    // The security keys can be anywhere in section 0, so all of its data
+    // is read.
+    struct pksav_gen3_save_section section0;
+    enum pksav_gen3_save_type save_type = PKSAV_GEN3_SAVE_TYPE_NONE;
+    if(!error)
+    {
+        error = p_io->read_at(
+                    p_io,
+                    slot_offset + (section_size * section0_position),
+                    section0.data8,
+                    sizeof(section0.data8)
+                );
+    }
+    if(!error)
+    {
+        save_type = _pksav_gen3_get_section0_save_type(&section0);
+        if(save_type == PKSAV_GEN3_SAVE_TYPE_NONE)
+        {
+            error = PKSAV_ERROR_INVALID_SAVE;
+        }
+    }
+
+    struct pksav_gen3_pokemon_party party;
+    if(!error)
+    {
+        const size_t party_offset =
+            PKSAV_GEN3_SAVE_SECTION1_OFFSETS[save_type-1][PKSAV_GEN3_POKEMON_PARTY];
+
+        error = p_io->read_at(
+                    p_io,
+                    slot_offset + (section_size * section1_position) + party_offset,
+                    (uint8_t*)&party,
+                    sizeof(party)
+                );
+    }
+
+    if(!error)
+    {
+        const struct pksav_gen3_player_info_internal* p_player_info =
+            (const struct pksav_gen3_player_info_internal*)section0.data8;
+
+        memset(p_peek_out, 0, sizeof(*p_peek_out));
+        p_peek_out->save_type = save_type;
+        memcpy(
+            p_peek_out->trainer_name,
+            p_player_info->name,
+            sizeof(p_peek_out->trainer_name)
+        );
+        p_peek_out->trainer_id = p_player_info->id;
+        p_peek_out->time_played = p_player_info->time_played;
+
+        uint32_t party_count = pksav_littleendian32(party.count);
+        if(party_count > PKSAV_GEN3_PARTY_NUM_POKEMON)
+        {
+            party_count = PKSAV_GEN3_PARTY_NUM_POKEMON;
+        }
+        p_peek_out->party_count = (uint8_t)party_count;
+
+        // Only the party is decrypted, and only to get the species.
+        for(size_t party_index = 0; party_index < party_count; ++party_index)
+        {
+            struct pksav_gen3_pc_pokemon* p_pokemon = &party.party[party_index].pc_data;
+            pksav_gen3_crypt_pokemon(p_pokemon, false);
+
+            p_peek_out->party_species[party_index] = p_pokemon->blocks.growth.species;
+        }
+    }
+
+    return error;
+}
+
+enum pksav_error pksav_gen3_peek_save_from_file(
+    const char* p_filepath,
+    struct pksav_gen3_save_peek* p_peek_out
+)
+{
+    if(!p_filepath || !p_peek_out)
+    {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    struct pksav_io io;
+    enum pksav_error error = pksav_fs_open_io(
+                                 p_filepath,
+                                 false, // is_writable
+                                 &io
+                             );
+    if(!error)
+    {
+        error = pksav_gen3_peek_save_from_io(&io, p_peek_out);
+        pksav_fs_close_io(&io);
+    }
+
+    return error;
+}
+
+static uint8_t _pksav_gen3_get_bad_party_checksums(
+    const struct pksav_gen3_pokemon_party* p_party,
+    bool is_encrypted
+)
+{
+    assert(p_party != NULL);
+
+    uint8_t bad_checksums = 0;
+    for(size_t party_index = 0;
+        party_index < PKSAV_GEN3_PARTY_NUM_POKEMON;
+        ++party_index)
+    {
+        if(!pksav_gen3_is_pokemon_checksum_valid(
+                &p_party->party[party_index].pc_data,
+                is_encrypted
+            ))
+        {
+            bad_checksums |= (uint8_t)(1 << party_index);
+        }
+    }
+
+    return bad_checksums;
+}
+
+static uint8_t _pksav_gen3_get_bad_daycare_checksums(
+    const union pksav_gen3_daycare* p_daycare,
+    enum pksav_gen3_save_type save_type,
+    bool is_encrypted
+)
+{
+    assert(p_daycare != NULL);
+
+    uint8_t bad_checksums = 0;
+    for(size_t daycare_index = 0;
+        daycare_index < PKSAV_GEN3_DAYCARE_NUM_POKEMON;
+        ++daycare_index)
+    {
+        const struct pksav_gen3_pc_pokemon* p_pokemon =
+            (save_type == PKSAV_GEN3_SAVE_TYPE_RS)
+                ? &p_daycare->rs.pokemon[daycare_index]
+                : &p_daycare->emerald_frlg.pokemon[daycare_index].pokemon;
+
+        if(!pksav_gen3_is_pokemon_checksum_valid(p_pokemon, is_encrypted))
+        {
+            bad_checksums |= (uint8_t)(1 << daycare_index);
+        }
+    }
+
+    return bad_checksums;
+}
+
+static const union pksav_gen3_save_slot* _pksav_gen3_get_active_save_slot(
+    const struct pksav_gen3_save_internal* p_internal
+)
+{
+    assert(p_internal != NULL);
+
+    const union pksav_gen3_save_slot* p_save_slots =
+        (const union pksav_gen3_save_slot*)p_internal->p_raw_save;
+
+    return &p_save_slots[p_internal->is_save_from_first_slot ? 0 : 1];
+}
+
+// For PC boxes that haven't been consolidated, which are still encrypted in
+// the active slot.
+static uint32_t _pksav_gen3_get_bad_unloaded_box_checksums(
+    const struct pksav_gen3_save_internal* p_internal,
+    size_t box_index
+)
+{
+    assert(p_internal != NULL);
+    assert(box_index < PKSAV_GEN3_NUM_POKEMON_BOXES);
+
+    struct pksav_gen3_pokemon_box pokemon_box;
+    pksav_gen3_save_read_pc_bytes(
+        _pksav_gen3_get_active_save_slot(p_internal),
+        p_internal->section_positions,
+        offsetof(struct pksav_gen3_pokemon_pc, boxes) + (box_index * sizeof(pokemon_box)),
+        (uint8_t*)&pokemon_box,
+        sizeof(pokemon_box)
+    );
+
+    return pksav_gen3_get_bad_box_checksums(
+               &pokemon_box,
+               true // is_encrypted
+           );
+}
+
+// Allocations are checked before anything in the buffer is touched, so the
+// buffer is left as it was if this fails.
+static enum pksav_error _pksav_gen3_set_save_pointers(
     struct pksav_gen3_save* p_gen3_save,
     uint8_t* buffer,
     size_t buffer_len,
+    uint32_t load_flags,
     bool should_alloc_internal
 )
 {
@@ -250,30 +673,77 @@ static void _pksav_gen3_set_save_pointers(
     assert(p_save_slot != NULL);
 
     // Internal
+    const bool is_compact = (load_flags & PKSAV_GEN3_LOAD_COMPACT);
     if(should_alloc_internal)
     {
-        p_gen3_save->p_internal = calloc(sizeof(struct pksav_gen3_save_internal), 1);
+        struct pksav_gen3_save_internal* p_new_internal =
+            calloc(sizeof(struct pksav_gen3_save_internal), 1);
+        if(!p_new_internal)
+        {
+            return PKSAV_ERROR_OUT_OF_MEMORY;
+        }
+
+        if(!is_compact)
+        {
+            p_new_internal->p_consolidated_pokemon_pc =
+                calloc(sizeof(struct pksav_gen3_pokemon_pc), 1);
+            if(!p_new_internal->p_consolidated_pokemon_pc)
+            {
+                free(p_new_internal);
+                return PKSAV_ERROR_OUT_OF_MEMORY;
+            }
+        }
+
+        p_gen3_save->p_internal = p_new_internal;
     }
 
     struct pksav_gen3_save_internal* p_internal = p_gen3_save->p_internal;
     p_internal->p_raw_save = buffer;
     p_internal->save_len = buffer_len;
     p_internal->is_save_from_first_slot = ((uint8_t*)p_save_slot == buffer);
-
-    pksav_gen3_save_unshuffle_sections(
+    p_internal->load_flags = load_flags;
+
+    const bool should_verify_pokemon = (load_flags & PKSAV_GEN3_LOAD_VERIFY_POKEMON_CHECKSUMS);
+    struct pksav_gen3_pokemon_checksum_report* p_pokemon_checksum_report =
+        &p_internal->pokemon_checksum_report;
+
+    // Unshuffle the slot, consolidate and decrypt the PC, and check the
+    // section checksums in a single pass. Compact saves leave the PC in
+    // the slot until it's accessed.
+    p_internal->decrypted_pc_boxes = (load_flags & (PKSAV_GEN3_LOAD_LAZY_PC | PKSAV_GEN3_LOAD_COMPACT))
+                                   ? 0 : PKSAV_GEN3_ALL_PC_BOXES_MASK;
+    pksav_gen3_save_load_sections(
         p_save_slot,
-        &p_internal->unshuffled_save_slot,
-        p_internal->shuffled_section_nums
+        &p_internal->unshuffled_sections,
+        p_internal->p_consolidated_pokemon_pc,
+        p_internal->decrypted_pc_boxes,
+        p_internal->shuffled_section_nums,
+        p_internal->section_positions,
+        &p_internal->valid_section_checksums,
+        (should_verify_pokemon && !is_compact) ? p_pokemon_checksum_report->pc_boxes : NULL
     );
+    if(should_verify_pokemon && is_compact)
+    {
+        for(size_t box_index = 0;
+            box_index < PKSAV_GEN3_NUM_POKEMON_BOXES;
+            ++box_index)
+        {
+            p_pokemon_checksum_report->pc_boxes[box_index] =
+                _pksav_gen3_get_bad_unloaded_box_checksums(
+                    p_internal,
+                    box_index
+                );
+        }
+    }
 
     // Pointers to relevant sections
-    struct pksav_gen3_save_section* p_section0 = &p_internal->unshuffled_save_slot.section0;
+    struct pksav_gen3_save_section* p_section0 = &p_internal->unshuffled_sections.section0;
     struct pksav_gen3_player_info_internal* p_player_info_internal =
         (struct pksav_gen3_player_info_internal*)p_section0;
 
-    struct pksav_gen3_save_section* p_section1 = &p_internal->unshuffled_save_slot.section1;
-    struct pksav_gen3_save_section* p_section2 = &p_internal->unshuffled_save_slot.section2;
-    struct pksav_gen3_save_section* p_section4 = &p_internal->unshuffled_save_slot.section4;
+    struct pksav_gen3_save_section* p_section1 = &p_internal->unshuffled_sections.section1;
+    struct pksav_gen3_save_section* p_section2 = &p_internal->unshuffled_sections.section2;
+    struct pksav_gen3_save_section* p_section4 = &p_internal->unshuffled_sections.section4;
 
     // Security key, used in decryption
     p_internal->p_security_key = &p_section0->data32[
@@ -302,6 +772,13 @@ static void _pksav_gen3_set_save_pointers(
     p_pokemon_storage->p_party = (struct pksav_gen3_pokemon_party*)(
                                      &p_section1->data8[p_section1_offsets[PKSAV_GEN3_POKEMON_PARTY]]
                                  );
+    if(should_verify_pokemon)
+    {
+        p_pokemon_checksum_report->party = _pksav_gen3_get_bad_party_checksums(
+                                               p_pokemon_storage->p_party,
+                                               true // is_encrypted
+                                           );
+    }
     for(size_t party_index = 0;
         party_index < PKSAV_GEN3_PARTY_NUM_POKEMON;
         ++party_index)
@@ -312,16 +789,20 @@ static void _pksav_gen3_set_save_pointers(
         );
     }
 
-    pksav_gen3_save_load_pokemon_pc(
-        &p_internal->unshuffled_save_slot,
-        &p_internal->consolidated_pokemon_pc
-    );
-    p_pokemon_storage->p_pc = &p_internal->consolidated_pokemon_pc;
+    p_pokemon_storage->p_pc = p_internal->p_consolidated_pokemon_pc;
 
     // TODO: confirm crypting happens in daycare
     p_pokemon_storage->p_daycare = (union pksav_gen3_daycare*)(
                                        &p_section4->data8[p_section4_offsets[PKSAV_GEN3_DAYCARE]]
                                    );
+    if(should_verify_pokemon)
+    {
+        p_pokemon_checksum_report->daycare = _pksav_gen3_get_bad_daycare_checksums(
+                                                 p_pokemon_storage->p_daycare,
+                                                 p_gen3_save->save_type,
+                                                 true // is_encrypted
+                                             );
+    }
     for(size_t daycare_index = 0;
         daycare_index < PKSAV_GEN3_DAYCARE_NUM_POKEMON;
         ++daycare_index)
@@ -439,11 +920,14 @@ static void _pksav_gen3_set_save_pointers(
     {
         p_frlg_fields->p_rival_name = NULL;
     }
+
+    return PKSAV_ERROR_NONE;
 }
 
 static enum pksav_error _pksav_gen3_load_save_from_buffer(
     uint8_t* p_buffer,
     size_t buffer_len,
+    uint32_t load_flags,
     bool is_buffer_ours,
     struct pksav_gen3_save* p_gen3_save_out
 )
@@ -464,16 +948,23 @@ static enum pksav_error _pksav_gen3_load_save_from_buffer(
         if(save_type != PKSAV_GEN3_SAVE_TYPE_NONE)
         {
             p_gen3_save_out->save_type = save_type;
-            _pksav_gen3_set_save_pointers(
-                p_gen3_save_out,
-                p_buffer,
-                buffer_len,
-                true // should_alloc_internal
-            );
-
-            // Internal
-            struct pksav_gen3_save_internal* p_internal = p_gen3_save_out->p_internal;
-            p_internal->is_buffer_ours = is_buffer_ours;
+            error = _pksav_gen3_set_save_pointers(
+                        p_gen3_save_out,
+                        p_buffer,
+                        buffer_len,
+                        load_flags,
+                        true // should_alloc_internal
+                    );
+            if(!error)
+            {
+                // Internal
+                struct pksav_gen3_save_internal* p_internal = p_gen3_save_out->p_internal;
+                p_internal->is_buffer_ours = is_buffer_ours;
+            }
+            else
+            {
+                p_gen3_save_out->save_type = PKSAV_GEN3_SAVE_TYPE_NONE;
+            }
         }
         else
         {
@@ -489,6 +980,21 @@ enum pksav_error pksav_gen3_load_save_from_buffer(
     size_t buffer_len,
     struct pksav_gen3_save* p_gen3_save_out
 )
+{
+    return pksav_gen3_load_save_from_buffer_with_flags(
+               p_buffer,
+               buffer_len,
+               PKSAV_GEN3_LOAD_FLAGS_NONE,
+               p_gen3_save_out
+           );
+}
+
+enum pksav_error pksav_gen3_load_save_from_buffer_with_flags(
+    uint8_t* p_buffer,
+    size_t buffer_len,
+    uint32_t load_flags,
+    struct pksav_gen3_save* p_gen3_save_out
+)
 {
     if(!p_buffer || !p_gen3_save_out)
     {
@@ -498,6 +1004,7 @@ enum pksav_error pksav_gen3_load_save_from_buffer(
     return _pksav_gen3_load_save_from_buffer(
                p_buffer,
                buffer_len,
+               load_flags,
                false, // is_buffer_ours
                p_gen3_save_out
            );
@@ -508,38 +1015,803 @@ enum pksav_error pksav_gen3_load_save_from_file(
     struct pksav_gen3_save* p_gen3_save_out
 )
 {
-    if(!p_filepath || !p_gen3_save_out)
-    {
-        return PKSAV_ERROR_NULL_POINTER;
-    }
+    return pksav_gen3_load_save_from_file_with_flags(
+               p_filepath,
+               PKSAV_GEN3_LOAD_FLAGS_NONE,
+               p_gen3_save_out
+           );
+}
 
-    enum pksav_error error = PKSAV_ERROR_NONE;
+// Takes ownership of the given buffer, which is freed if loading fails.
+static enum pksav_error _pksav_gen3_load_save_from_file_buffer(
+    struct pksav_fs_file_buffer* p_file_buffer,
+    uint32_t load_flags,
+    struct pksav_gen3_save* p_gen3_save_out
+)
+{
+    assert(p_file_buffer != NULL);
+    assert(p_gen3_save_out != NULL);
+
+    enum pksav_error error = PKSAV_ERROR_NONE;
+
+    error = _pksav_gen3_load_save_from_buffer(
+                p_file_buffer->p_buffer,
+                p_file_buffer->buffer_len,
+                load_flags,
+                true, // is_buffer_ours
+                p_gen3_save_out
+            );
+    if(!error)
+    {
+        struct pksav_gen3_save_internal* p_internal = p_gen3_save_out->p_internal;
+        p_internal->file_buffer = *p_file_buffer;
+    }
+    else
+    {
+        // We made this buffer, so it's on us to free it if there's
+        // an error.
+        pksav_fs_unmap_file(p_file_buffer);
+    }
+
+    return error;
+}
+
+static enum pksav_error _pksav_gen3_load_save_from_file(
+    const char* p_filepath,
+    enum pksav_fs_map_mode map_mode,
+    uint32_t load_flags,
+    struct pksav_gen3_save* p_gen3_save_out
+)
+{
+    assert(p_filepath != NULL);
+    assert(p_gen3_save_out != NULL);
+
+    enum pksav_error error = PKSAV_ERROR_NONE;
+
+    struct pksav_fs_file_buffer file_buffer = {NULL, 0, false, false};
+    error = pksav_fs_map_file(
+                p_filepath,
+                map_mode,
+                &file_buffer
+            );
+    if(!error)
+    {
+        error = _pksav_gen3_load_save_from_file_buffer(
+                    &file_buffer,
+                    load_flags,
+                    p_gen3_save_out
+                );
+    }
+
+    return error;
+}
+
+enum pksav_error pksav_gen3_load_save_from_file_with_flags(
+    const char* p_filepath,
+    uint32_t load_flags,
+    struct pksav_gen3_save* p_gen3_save_out
+)
+{
+    if(!p_filepath || !p_gen3_save_out)
+    {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    // Map the file copy-on-write so edits never touch the file until
+    // it's explicitly saved.
+    return _pksav_gen3_load_save_from_file(
+               p_filepath,
+               PKSAV_FS_MAP_COPY_ON_WRITE,
+               load_flags,
+               p_gen3_save_out
+           );
+}
+
+enum pksav_error pksav_gen3_load_save_from_file_in_place(
+    const char* p_filepath,
+    uint32_t load_flags,
+    struct pksav_gen3_save* p_gen3_save_out
+)
+{
+    if(!p_filepath || !p_gen3_save_out)
+    {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    return _pksav_gen3_load_save_from_file(
+               p_filepath,
+               PKSAV_FS_MAP_SHARED,
+               load_flags,
+               p_gen3_save_out
+           );
+}
+
+enum pksav_error pksav_gen3_load_save_from_io(
+    const struct pksav_io* p_io,
+    uint32_t load_flags,
+    struct pksav_gen3_save* p_gen3_save_out
+)
+{
+    if(!p_io || !p_gen3_save_out)
+    {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    enum pksav_error error = PKSAV_ERROR_NONE;
+
+    struct pksav_fs_file_buffer file_buffer = {NULL, 0, false, false};
+    error = pksav_fs_read_io_to_buffer(
+                p_io,
+                &file_buffer
+            );
+    if(!error)
+    {
+        error = _pksav_gen3_load_save_from_file_buffer(
+                    &file_buffer,
+                    load_flags,
+                    p_gen3_save_out
+                );
+    }
+
+    return error;
+}
+
+struct pksav_gen3_bulk_load_context
+{
+    uint32_t load_flags;
+    void (*p_callback)(
+        size_t filepath_index,
+        enum pksav_error error,
+        struct pksav_gen3_save* p_gen3_save,
+        void* p_user_data
+    );
+    void* p_user_data;
+};
+
+static enum pksav_error _pksav_gen3_bulk_load_save(
+    struct pksav_fs_file_buffer* p_file_buffer,
+    void* p_context,
+    void* p_save_out
+)
+{
+    assert(p_file_buffer != NULL);
+    assert(p_context != NULL);
+    assert(p_save_out != NULL);
+
+    struct pksav_gen3_bulk_load_context* p_bulk_context = p_context;
+
+    return _pksav_gen3_load_save_from_file_buffer(
+               p_file_buffer,
+               p_bulk_context->load_flags,
+               p_save_out
+           );
+}
+
+static void _pksav_gen3_bulk_on_save_loaded(
+    size_t filepath_index,
+    enum pksav_error error,
+    void* p_save,
+    void* p_context
+)
+{
+    assert(p_context != NULL);
+
+    struct pksav_gen3_bulk_load_context* p_bulk_context = p_context;
+    p_bulk_context->p_callback(
+        filepath_index,
+        error,
+        p_save,
+        p_bulk_context->p_user_data
+    );
+}
+
+static void _pksav_gen3_bulk_free_save(
+    void* p_save
+)
+{
+    assert(p_save != NULL);
+
+    pksav_gen3_free_save(p_save);
+}
+
+enum pksav_error pksav_gen3_bulk_load_saves(
+    const char* const* pp_filepaths,
+    size_t num_filepaths,
+    uint32_t load_flags,
+    const struct pksav_bulk_load_options* p_options,
+    void (*p_callback)(
+        size_t filepath_index,
+        enum pksav_error error,
+        struct pksav_gen3_save* p_gen3_save,
+        void* p_user_data
+    ),
+    void* p_user_data
+)
+{
+    if(!pp_filepaths || !p_callback)
+    {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+    for(size_t filepath_index = 0; filepath_index < num_filepaths; ++filepath_index)
+    {
+        if(!pp_filepaths[filepath_index])
+        {
+            return PKSAV_ERROR_NULL_POINTER;
+        }
+    }
+
+    struct pksav_gen3_bulk_load_context context =
+    {
+        .load_flags = load_flags,
+        .p_callback = p_callback,
+        .p_user_data = p_user_data
+    };
+    struct pksav_bulk_loader loader =
+    {
+        .save_size = sizeof(struct pksav_gen3_save),
+        .load_save = _pksav_gen3_bulk_load_save,
+        .on_save_loaded = _pksav_gen3_bulk_on_save_loaded,
+        .free_save = _pksav_gen3_bulk_free_save,
+        .p_context = &context
+    };
+
+    return pksav_bulk_load_saves(
+               pp_filepaths,
+               num_filepaths,
+               p_options,
+               &loader
+           );
+}
+
+// Saves loaded with PKSAV_GEN3_LOAD_COMPACT only consolidate the PC when
+// all of it is asked for. Boxes that were already accessed are moved in,
+// and the rest are left encrypted.
+static enum pksav_error _pksav_gen3_consolidate_pokemon_pc(
+    struct pksav_gen3_save* p_gen3_save
+)
+{
+    assert(p_gen3_save != NULL);
+
+    struct pksav_gen3_save_internal* p_internal = p_gen3_save->p_internal;
+    if(p_internal->p_consolidated_pokemon_pc != NULL)
+    {
+        return PKSAV_ERROR_NONE;
+    }
+
+    struct pksav_gen3_pokemon_pc* p_pokemon_pc = malloc(sizeof(struct pksav_gen3_pokemon_pc));
+    if(!p_pokemon_pc)
+    {
+        return PKSAV_ERROR_OUT_OF_MEMORY;
+    }
+
+    pksav_gen3_save_read_pc_bytes(
+        _pksav_gen3_get_active_save_slot(p_internal),
+        p_internal->section_positions,
+        0,
+        (uint8_t*)p_pokemon_pc,
+        sizeof(struct pksav_gen3_pokemon_pc)
+    );
+    for(size_t box_index = 0;
+        box_index < PKSAV_GEN3_NUM_POKEMON_BOXES;
+        ++box_index)
+    {
+        if(p_internal->p_compact_pc_boxes[box_index] != NULL)
+        {
+            p_pokemon_pc->boxes[box_index] = *p_internal->p_compact_pc_boxes[box_index];
+
+            free(p_internal->p_compact_pc_boxes[box_index]);
+            p_internal->p_compact_pc_boxes[box_index] = NULL;
+        }
+    }
+
+    p_internal->p_consolidated_pokemon_pc = p_pokemon_pc;
+    p_gen3_save->pokemon_storage.p_pc = p_pokemon_pc;
+
+    return PKSAV_ERROR_NONE;
+}
+
+// Compact saves read a box out of the raw save into its own buffer the
+// first time it's accessed.
+static enum pksav_error _pksav_gen3_get_compact_pc_box(
+    struct pksav_gen3_save_internal* p_internal,
+    uint8_t box_num,
+    struct pksav_gen3_pokemon_box** pp_box_out
+)
+{
+    assert(p_internal != NULL);
+    assert(box_num < PKSAV_GEN3_NUM_POKEMON_BOXES);
+    assert(pp_box_out != NULL);
+
+    if(p_internal->p_compact_pc_boxes[box_num] == NULL)
+    {
+        struct pksav_gen3_pokemon_box* p_box = malloc(sizeof(struct pksav_gen3_pokemon_box));
+        if(!p_box)
+        {
+            return PKSAV_ERROR_OUT_OF_MEMORY;
+        }
+
+        pksav_gen3_save_read_pc_bytes(
+            _pksav_gen3_get_active_save_slot(p_internal),
+            p_internal->section_positions,
+            offsetof(struct pksav_gen3_pokemon_pc, boxes) + (box_num * sizeof(*p_box)),
+            (uint8_t*)p_box,
+            sizeof(*p_box)
+        );
+
+        p_internal->p_compact_pc_boxes[box_num] = p_box;
+    }
+
+    *pp_box_out = p_internal->p_compact_pc_boxes[box_num];
+
+    return PKSAV_ERROR_NONE;
+}
+
+enum pksav_error pksav_gen3_save_get_pc_box(
+    struct pksav_gen3_save* p_gen3_save,
+    uint8_t box_num,
+    struct pksav_gen3_pokemon_box** pp_box_out
+)
+{
+    if(!p_gen3_save || !pp_box_out)
+    {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+    if(box_num >= PKSAV_GEN3_NUM_POKEMON_BOXES)
+    {
+        return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
+
+    struct pksav_gen3_save_internal* p_internal = p_gen3_save->p_internal;
+    struct pksav_gen3_pokemon_box* p_box = NULL;
+
+    if(p_internal->p_consolidated_pokemon_pc != NULL)
+    {
+        p_box = &p_internal->p_consolidated_pokemon_pc->boxes[box_num];
+    }
+    else
+    {
+        enum pksav_error error = _pksav_gen3_get_compact_pc_box(
+                                     p_internal,
+                                     box_num,
+                                     &p_box
+                                 );
+        if(error)
+        {
+            return error;
+        }
+    }
+
+    if(!(p_internal->decrypted_pc_boxes & PKSAV_GEN3_PC_BOX_MASK(box_num)))
+    {
+        pksav_gen3_save_crypt_pokemon_box(
+            p_box,
+            false // should_encrypt
+        );
+        p_internal->decrypted_pc_boxes |= PKSAV_GEN3_PC_BOX_MASK(box_num);
+    }
+
+    *pp_box_out = p_box;
+
+    return PKSAV_ERROR_NONE;
+}
+
+enum pksav_error pksav_gen3_save_get_pc(
+    struct pksav_gen3_save* p_gen3_save,
+    struct pksav_gen3_pokemon_pc** pp_pc_out
+)
+{
+    if(!p_gen3_save || !pp_pc_out)
+    {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    enum pksav_error error = _pksav_gen3_consolidate_pokemon_pc(p_gen3_save);
+
+    struct pksav_gen3_pokemon_box* p_box = NULL;
+    for(uint8_t box_index = 0;
+        (box_index < PKSAV_GEN3_NUM_POKEMON_BOXES) && !error;
+        ++box_index)
+    {
+        error = pksav_gen3_save_get_pc_box(
+                    p_gen3_save,
+                    box_index,
+                    &p_box
+                );
+    }
+
+    if(!error)
+    {
+        *pp_pc_out = p_gen3_save->pokemon_storage.p_pc;
+    }
+
+    return error;
+}
+
+// Compares the staged slot against the slot it's replacing as the active
+// slot, which is left untouched until the next save. Both slots have their
+// sections in the same order. Sections whose checksums didn't match when
+// loaded are always considered modified.
+static uint16_t _pksav_gen3_get_modified_sections(
+    const struct pksav_gen3_save_internal* p_internal,
+    const union pksav_gen3_save_slot* p_active_save_slot,
+    const union pksav_gen3_save_slot* p_output_save_slot
+)
+{
+    assert(p_internal != NULL);
+    assert(p_active_save_slot != NULL);
+    assert(p_output_save_slot != NULL);
+
+    // With only one slot, there's nothing left to compare against.
+    if(p_active_save_slot == p_output_save_slot)
+    {
+        return PKSAV_GEN3_ALL_SECTIONS_MASK;
+    }
+
+    uint16_t modified_sections = (uint16_t)(~p_internal->valid_section_checksums &
+                                            PKSAV_GEN3_ALL_SECTIONS_MASK);
+
+    for(size_t section_index = 0;
+        section_index < PKSAV_GEN3_NUM_SAVE_SECTIONS;
+        ++section_index)
+    {
+        // The footer isn't compared, since its checksum is what we're
+        // deciding whether to recompute.
+        if(memcmp(
+               p_output_save_slot->sections_arr[section_index].data8,
+               p_active_save_slot->sections_arr[section_index].data8,
+               offsetof(struct pksav_gen3_save_section, footer)
+           ))
+        {
+            modified_sections |= PKSAV_GEN3_SECTION_MASK(
+                                     p_internal->shuffled_section_nums[section_index]
+                                 );
+        }
+    }
+
+    return modified_sections;
+}
+
+enum pksav_error pksav_gen3_save_get_pokemon_checksum_report(
+    const struct pksav_gen3_save* p_gen3_save,
+    struct pksav_gen3_pokemon_checksum_report* p_report_out
+)
+{
+    if(!p_gen3_save || !p_report_out)
+    {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    const struct pksav_gen3_save_internal* p_internal = p_gen3_save->p_internal;
+
+    if(p_internal->load_flags & PKSAV_GEN3_LOAD_VERIFY_POKEMON_CHECKSUMS)
+    {
+        *p_report_out = p_internal->pokemon_checksum_report;
+    }
+    else
+    {
+        const struct pksav_gen3_pokemon_storage* p_pokemon_storage =
+            &p_gen3_save->pokemon_storage;
+
+        p_report_out->party = _pksav_gen3_get_bad_party_checksums(
+                                  p_pokemon_storage->p_party,
+                                  false // is_encrypted
+                              );
+        for(size_t box_index = 0;
+            box_index < PKSAV_GEN3_NUM_POKEMON_BOXES;
+            ++box_index)
+        {
+            if(p_internal->p_consolidated_pokemon_pc != NULL)
+            {
+                p_report_out->pc_boxes[box_index] = pksav_gen3_get_bad_box_checksums(
+                    &p_internal->p_consolidated_pokemon_pc->boxes[box_index],
+                    !(p_internal->decrypted_pc_boxes & PKSAV_GEN3_PC_BOX_MASK(box_index))
+                );
+            }
+            else if(p_internal->p_compact_pc_boxes[box_index] != NULL)
+            {
+                p_report_out->pc_boxes[box_index] = pksav_gen3_get_bad_box_checksums(
+                    p_internal->p_compact_pc_boxes[box_index],
+                    false // is_encrypted
+                );
+            }
+            else
+            {
+                p_report_out->pc_boxes[box_index] = _pksav_gen3_get_bad_unloaded_box_checksums(
+                                                        p_internal,
+                                                        box_index
+                                                    );
+            }
+        }
+        p_report_out->daycare = _pksav_gen3_get_bad_daycare_checksums(
+                                    p_pokemon_storage->p_daycare,
+                                    p_gen3_save->save_type,
+                                    false // is_encrypted
+                                );
+    }
+
+    return PKSAV_ERROR_NONE;
+}
+
+// Maps a pointer into the unshuffled sections to the same field in a
+// shuffled slot.
+static void* _pksav_gen3_get_shuffled_ptr(
+    const struct pksav_gen3_save_internal* p_internal,
+    union pksav_gen3_save_slot* p_save_slot,
+    const void* p_unshuffled
+)
+{
+    assert(p_internal != NULL);
+    assert(p_save_slot != NULL);
+
+    size_t offset = (size_t)((const uint8_t*)p_unshuffled - p_internal->unshuffled_sections.data);
+    assert(offset < sizeof(p_internal->unshuffled_sections));
+
+    size_t section_id = offset / sizeof(struct pksav_gen3_save_section);
+    size_t offset_in_section = offset % sizeof(struct pksav_gen3_save_section);
+    assert(p_internal->section_positions[section_id] != PKSAV_GEN3_MISSING_SECTION);
+
+    return &p_save_slot->sections_arr[p_internal->section_positions[section_id]].data8[offset_in_section];
+}
+
+// Encrypts everything straight into the output slot of p_output_save,
+// which is laid out like the raw save and is usually the raw save itself.
+// It's then ready to be written out as-is. The decrypted state is left
+// alone.
+static void _pksav_gen3_save_write_output_slot(
+    struct pksav_gen3_save* p_gen3_save,
+    uint8_t* p_output_save,
+    size_t* p_output_slot_index_out
+)
+{
+    assert(p_gen3_save != NULL);
+    assert(p_output_save != NULL);
+    assert(p_output_slot_index_out != NULL);
+
+    struct pksav_gen3_save_internal* p_internal = p_gen3_save->p_internal;
+    const uint32_t security_key = *p_internal->p_security_key;
+
+    // Save into the less recent save slot if the save file is large enough
+    // for two slots. It keeps the active slot's section order.
+    const union pksav_gen3_save_slot* p_raw_sections = (const union pksav_gen3_save_slot*)(
+                                                            p_internal->p_raw_save
+                                                        );
+    union pksav_gen3_save_slot* p_output_sections = (union pksav_gen3_save_slot*)p_output_save;
+    size_t active_slot_index = p_internal->is_save_from_first_slot ? 0 : 1;
+    size_t output_slot_index = 0;
+    if(p_internal->save_len >= PKSAV_GEN3_SAVE_SLOT_SIZE*2)
+    {
+        output_slot_index = p_internal->is_save_from_first_slot ? 1 : 0;
+    }
+    *p_output_slot_index_out = output_slot_index;
+    const union pksav_gen3_save_slot* p_active_save_slot = &p_raw_sections[active_slot_index];
+    union pksav_gen3_save_slot* p_output_save_slot = &p_output_sections[output_slot_index];
+
+    pksav_gen3_save_stage_slot(
+        &p_internal->unshuffled_sections,
+        p_active_save_slot,
+        p_output_save_slot,
+        p_internal->shuffled_section_nums,
+        p_internal->section_positions,
+        (p_internal->p_consolidated_pokemon_pc == NULL) // should_copy_pc
+    );
+
+    // Item Storage
+    pksav_gen3_save_crypt_items(
+        _pksav_gen3_get_shuffled_ptr(p_internal, p_output_save_slot, p_gen3_save->item_storage.p_bag),
+        security_key,
+        p_gen3_save->save_type
+    );
+
+    // Pokémon Storage
+    struct pksav_gen3_pokemon_party* p_output_party =
+        _pksav_gen3_get_shuffled_ptr(p_internal, p_output_save_slot, p_gen3_save->pokemon_storage.p_party);
+    for(size_t party_index = 0;
+        party_index < PKSAV_GEN3_PARTY_NUM_POKEMON;
+        ++party_index)
+    {
+        pksav_gen3_crypt_pokemon(
+            &p_output_party->party[party_index].pc_data,
+            true // should_encrypt
+        );
+    }
+
+    if(p_internal->p_consolidated_pokemon_pc != NULL)
+    {
+        pksav_gen3_save_save_pokemon_pc(
+            p_internal->p_consolidated_pokemon_pc,
+            p_output_save_slot,
+            p_internal->shuffled_section_nums,
+            p_internal->decrypted_pc_boxes
+        );
+    }
+    else
+    {
+        // The rest of a compact save's PC was copied as-is.
+        for(size_t box_index = 0;
+            box_index < PKSAV_GEN3_NUM_POKEMON_BOXES;
+            ++box_index)
+        {
+            if(p_internal->p_compact_pc_boxes[box_index] != NULL)
+            {
+                pksav_gen3_save_save_pokemon_box(
+                    p_internal->p_compact_pc_boxes[box_index],
+                    box_index,
+                    true, // should_encrypt
+                    p_output_save_slot,
+                    p_internal->shuffled_section_nums
+                );
+            }
+        }
+    }
+
+    // TODO: confirm crypting happens in daycare
+    union pksav_gen3_daycare* p_output_daycare =
+        _pksav_gen3_get_shuffled_ptr(p_internal, p_output_save_slot, p_gen3_save->pokemon_storage.p_daycare);
+    for(size_t daycare_index = 0;
+        daycare_index < PKSAV_GEN3_DAYCARE_NUM_POKEMON;
+        ++daycare_index)
+    {
+        if(p_gen3_save->save_type == PKSAV_GEN3_SAVE_TYPE_RS)
+        {
+            pksav_gen3_crypt_pokemon(
+                &p_output_daycare->rs.pokemon[daycare_index],
+                true // should_encrypt
+            );
+        }
+        else
+        {
+            pksav_gen3_crypt_pokemon(
+                &p_output_daycare->emerald_frlg.pokemon[daycare_index].pokemon,
+                true // should_encrypt
+            );
+        }
+    }
+
+    // Trainer Info
+    uint32_t* p_output_money =
+        _pksav_gen3_get_shuffled_ptr(p_internal, p_output_save_slot, p_gen3_save->player_info.p_money);
+    *p_output_money ^= security_key;
+
+    // Misc Fields
+    uint16_t* p_output_casino_coins =
+        _pksav_gen3_get_shuffled_ptr(p_internal, p_output_save_slot, p_gen3_save->misc_fields.p_casino_coins);
+    *p_output_casino_coins ^= (security_key & 0xFFFF);
+
+    // Only sections that were modified need new checksums. The rest keep
+    // the active slot's.
+    uint16_t modified_sections = _pksav_gen3_get_modified_sections(
+                                     p_internal,
+                                     p_active_save_slot,
+                                     p_output_save_slot
+                                 );
+    pksav_gen3_set_section_checksums(
+        p_output_save_slot,
+        p_internal->shuffled_section_nums,
+        modified_sections
+    );
+
+    // Increment the save index of the new save index.
+    uint32_t save_index = pksav_littleendian32(
+                              p_active_save_slot->section0.footer.save_index
+                          );
+    ++save_index;
 
-    uint8_t* p_file_buffer = NULL;
-    size_t buffer_len = 0;
-    error = pksav_fs_read_file_to_buffer(
-                p_filepath,
-                &p_file_buffer,
-                &buffer_len
-            );
+    for(size_t section_index = 0;
+        section_index < PKSAV_GEN3_NUM_SAVE_SECTIONS;
+        ++section_index)
+    {
+        p_output_save_slot->sections_arr[section_index].footer.save_index =
+            pksav_littleendian32(save_index);
+    }
+}
 
-    if(!error)
+// Called once the raw save has been written out. Rather than reloading
+// from the new slot, only the bookkeeping that depends on it is updated.
+static void _pksav_gen3_save_finish_output_slot(
+    struct pksav_gen3_save* p_gen3_save,
+    size_t output_slot_index
+)
+{
+    assert(p_gen3_save != NULL);
+
+    struct pksav_gen3_save_internal* p_internal = p_gen3_save->p_internal;
+
+    // Every section in the new slot has a valid checksum.
+    p_internal->is_save_from_first_slot = (output_slot_index == 0);
+    p_internal->valid_section_checksums = PKSAV_GEN3_ALL_SECTIONS_MASK;
+
+    // Saving set the checksum of every decrypted PC Pokémon, and the rest
+    // of the saved Pokémon are unchanged from their decrypted form.
+    if(p_internal->load_flags & PKSAV_GEN3_LOAD_VERIFY_POKEMON_CHECKSUMS)
     {
-        error = _pksav_gen3_load_save_from_buffer(
-                    p_file_buffer,
-                    buffer_len,
-                    true, // is_buffer_ours
-                    p_gen3_save_out
-                );
-        if(error)
+        struct pksav_gen3_pokemon_checksum_report* p_report =
+            &p_internal->pokemon_checksum_report;
+
+        p_report->party = _pksav_gen3_get_bad_party_checksums(
+                              p_gen3_save->pokemon_storage.p_party,
+                              false // is_encrypted
+                          );
+        for(size_t box_index = 0;
+            box_index < PKSAV_GEN3_NUM_POKEMON_BOXES;
+            ++box_index)
         {
-            // We made this buffer, so it's on us to free it if there's
-            // an error.
-            free(p_file_buffer);
+            if(p_internal->decrypted_pc_boxes & PKSAV_GEN3_PC_BOX_MASK(box_index))
+            {
+                p_report->pc_boxes[box_index] = 0;
+            }
         }
+        p_report->daycare = _pksav_gen3_get_bad_daycare_checksums(
+                                p_gen3_save->pokemon_storage.p_daycare,
+                                p_gen3_save->save_type,
+                                false // is_encrypted
+                            );
     }
+}
 
-    return error;
+/*
+ * Saves loaded with pksav_gen3_load_save_from_file_in_place only change
+ * their file through pksav_gen3_save_commit. Everything else stages the new
+ * slot in a private copy of the save, leaving the mapping, and the loaded
+ * state that describes it, alone.
+ */
+static enum pksav_error _pksav_gen3_save_stage(
+    struct pksav_gen3_save* p_gen3_save,
+    uint8_t** pp_staged_save_out,
+    size_t* p_output_slot_index_out
+)
+{
+    assert(p_gen3_save != NULL);
+    assert(pp_staged_save_out != NULL);
+    assert(p_output_slot_index_out != NULL);
+
+    struct pksav_gen3_save_internal* p_internal = p_gen3_save->p_internal;
+
+    uint8_t* p_staged_save = p_internal->p_raw_save;
+    if(p_internal->file_buffer.is_shared)
+    {
+        p_staged_save = malloc(p_internal->save_len);
+        if(!p_staged_save)
+        {
+            return PKSAV_ERROR_OUT_OF_MEMORY;
+        }
+
+        memcpy(p_staged_save, p_internal->p_raw_save, p_internal->save_len);
+    }
+
+    _pksav_gen3_save_write_output_slot(
+        p_gen3_save,
+        p_staged_save,
+        p_output_slot_index_out
+    );
+    *pp_staged_save_out = p_staged_save;
+
+    return PKSAV_ERROR_NONE;
+}
+
+// Once a staged save has been written out, the loaded state moves to the
+// new slot, unless it was a private copy.
+static void _pksav_gen3_save_finish_staged(
+    struct pksav_gen3_save* p_gen3_save,
+    uint8_t* p_staged_save,
+    size_t output_slot_index,
+    bool was_written
+)
+{
+    assert(p_gen3_save != NULL);
+    assert(p_staged_save != NULL);
+
+    struct pksav_gen3_save_internal* p_internal = p_gen3_save->p_internal;
+    if(p_staged_save != p_internal->p_raw_save)
+    {
+        free(p_staged_save);
+    }
+    else if(was_written)
+    {
+        _pksav_gen3_save_finish_output_slot(
+            p_gen3_save,
+            output_slot_index
+        );
+    }
 }
 
 enum pksav_error pksav_gen3_save_save(
@@ -556,108 +1828,354 @@ enum pksav_error pksav_gen3_save_save(
 
     struct pksav_gen3_save_internal* p_internal = p_gen3_save->p_internal;
 
-    // Item Storage
-    pksav_gen3_save_crypt_items(
-        p_gen3_save->item_storage.p_bag,
-        *p_internal->p_security_key,
-        p_gen3_save->save_type
+    uint8_t* p_staged_save = NULL;
+    size_t output_slot_index = 0;
+    error = _pksav_gen3_save_stage(
+                p_gen3_save,
+                &p_staged_save,
+                &output_slot_index
+            );
+    if(error)
+    {
+        return error;
+    }
+
+    error = pksav_fs_write_buffer_to_file(
+                p_filepath,
+                p_staged_save,
+                p_internal->save_len
+            );
+
+    _pksav_gen3_save_finish_staged(
+        p_gen3_save,
+        p_staged_save,
+        output_slot_index,
+        !error // was_written
     );
 
-    // Pokémon Storage
-    for(size_t party_index = 0;
-        party_index < PKSAV_GEN3_PARTY_NUM_POKEMON;
-        ++party_index)
+    return error;
+}
+
+enum pksav_error pksav_gen3_save_save_to_buffer(
+    struct pksav_gen3_save* p_gen3_save,
+    uint8_t* p_buffer,
+    size_t buffer_len
+)
+{
+    if(!p_gen3_save || !p_buffer)
     {
-        pksav_gen3_crypt_pokemon(
-            &p_gen3_save->pokemon_storage.p_party->party[party_index].pc_data,
-            true // should_encrypt
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    struct pksav_gen3_save_internal* p_internal = p_gen3_save->p_internal;
+    if(buffer_len < p_internal->save_len)
+    {
+        return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
+
+    size_t output_slot_index = 0;
+
+    // Saves loaded in place are staged straight into the caller's buffer,
+    // with nothing written to the mapping.
+    if(p_internal->file_buffer.is_shared)
+    {
+        memcpy(p_buffer, p_internal->p_raw_save, p_internal->save_len);
+        _pksav_gen3_save_write_output_slot(
+            p_gen3_save,
+            p_buffer,
+            &output_slot_index
         );
+
+        return PKSAV_ERROR_NONE;
     }
 
-    pksav_gen3_save_save_pokemon_pc(
-        &p_internal->consolidated_pokemon_pc,
-        &p_internal->unshuffled_save_slot
+    _pksav_gen3_save_write_output_slot(
+        p_gen3_save,
+        p_internal->p_raw_save,
+        &output_slot_index
     );
 
-    // TODO: confirm crypting happens in daycare
-    for(size_t daycare_index = 0;
-        daycare_index < PKSAV_GEN3_DAYCARE_NUM_POKEMON;
-        ++daycare_index)
+    // If the save was loaded from this buffer, the new slot was already
+    // written in place.
+    if(p_buffer != p_internal->p_raw_save)
     {
-        if(p_gen3_save->save_type == PKSAV_GEN3_SAVE_TYPE_RS)
-        {
-            pksav_gen3_crypt_pokemon(
-                &p_gen3_save->pokemon_storage.p_daycare->rs.pokemon[daycare_index],
-                true // should_encrypt
+        memcpy(p_buffer, p_internal->p_raw_save, p_internal->save_len);
+    }
+
+    _pksav_gen3_save_finish_output_slot(
+        p_gen3_save,
+        output_slot_index
+    );
+
+    return PKSAV_ERROR_NONE;
+}
+
+enum pksav_error pksav_gen3_save_save_to_io(
+    struct pksav_gen3_save* p_gen3_save,
+    const struct pksav_io* p_io
+)
+{
+    if(!p_gen3_save || !p_io || !p_io->write_at)
+    {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    enum pksav_error error = PKSAV_ERROR_NONE;
+
+    struct pksav_gen3_save_internal* p_internal = p_gen3_save->p_internal;
+
+    uint8_t* p_staged_save = NULL;
+    size_t output_slot_index = 0;
+    error = _pksav_gen3_save_stage(
+                p_gen3_save,
+                &p_staged_save,
+                &output_slot_index
             );
-        }
-        else
-        {
-            pksav_gen3_crypt_pokemon(
-                &p_gen3_save->pokemon_storage.p_daycare->emerald_frlg.pokemon[daycare_index].pokemon,
-                true // should_encrypt
+    if(error)
+    {
+        return error;
+    }
+
+    error = p_io->write_at(
+                p_io,
+                0,
+                p_staged_save,
+                p_internal->save_len
             );
+
+    _pksav_gen3_save_finish_staged(
+        p_gen3_save,
+        p_staged_save,
+        output_slot_index,
+        !error // was_written
+    );
+
+    return error;
+}
+
+enum pksav_error pksav_gen3_save_save_changes(
+    const char* p_filepath,
+    struct pksav_gen3_save* p_gen3_save,
+    bool should_sync
+)
+{
+    if(!p_filepath || !p_gen3_save)
+    {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    struct pksav_io io;
+    enum pksav_error error = pksav_fs_open_io(
+                                 p_filepath,
+                                 true, // is_writable
+                                 &io
+                             );
+    if(!error)
+    {
+        error = pksav_gen3_save_save_changes_to_io(
+                    p_gen3_save,
+                    &io
+                );
+        if(!error && should_sync && io.sync)
+        {
+            error = io.sync(&io);
         }
+
+        pksav_fs_close_io(&io);
     }
 
-    // Trainer Info
-    *p_gen3_save->player_info.p_money ^= *p_internal->p_security_key;
+    return error;
+}
 
-    // Misc Fields
-    *p_gen3_save->misc_fields.p_casino_coins ^= (*p_internal->p_security_key & 0xFFFF);
+enum pksav_error pksav_gen3_save_save_changes_to_io(
+    struct pksav_gen3_save* p_gen3_save,
+    const struct pksav_io* p_io
+)
+{
+    if(!p_gen3_save || !p_io || !p_io->write_at || !p_io->get_size)
+    {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
 
-    // Save into the less recent save slot if the save file is large enough
-    // for two slots.
-    union pksav_gen3_save_slot* p_raw_sections = (union pksav_gen3_save_slot*)(
-                                                      p_internal->p_raw_save
-                                                  );
-    union pksav_gen3_save_slot* p_output_save_slot = NULL;
-    if(p_internal->save_len >= PKSAV_GEN3_SAVE_SLOT_SIZE*2)
+    enum pksav_error error = PKSAV_ERROR_NONE;
+
+    struct pksav_gen3_save_internal* p_internal = p_gen3_save->p_internal;
+
+    // Only the output slot is written, so the rest of the save must
+    // already be there.
+    size_t io_size = 0;
+    error = p_io->get_size(p_io, &io_size);
+    if(!error && (io_size < p_internal->save_len))
     {
-        p_output_save_slot = p_internal->is_save_from_first_slot ? &p_raw_sections[1]
-                                                                 : &p_raw_sections[0];
+        error = PKSAV_ERROR_PARAM_OUT_OF_RANGE;
     }
-    else
+
+    uint8_t* p_staged_save = NULL;
+    size_t output_slot_index = 0;
+    if(!error)
     {
-        p_output_save_slot = &p_raw_sections[0];
+        error = _pksav_gen3_save_stage(
+                    p_gen3_save,
+                    &p_staged_save,
+                    &output_slot_index
+                );
     }
 
+    if(!error)
+    {
+        const size_t output_slot_offset = output_slot_index * PKSAV_GEN3_SAVE_SLOT_SIZE;
+        assert((output_slot_offset + PKSAV_GEN3_SAVE_SLOT_SIZE) <= p_internal->save_len);
+
+        error = p_io->write_at(
+                    p_io,
+                    output_slot_offset,
+                    &p_staged_save[output_slot_offset],
+                    PKSAV_GEN3_SAVE_SLOT_SIZE
+                );
 
-    pksav_gen3_set_section_checksums(&p_internal->unshuffled_save_slot);
-    pksav_gen3_save_shuffle_sections(
-        &p_internal->unshuffled_save_slot,
-        p_output_save_slot,
-        p_internal->shuffled_section_nums
-    );
+        _pksav_gen3_save_finish_staged(
+            p_gen3_save,
+            p_staged_save,
+            output_slot_index,
+            !error // was_written
+        );
+    }
 
-    // Increment the save index of the new save index.
-    uint32_t save_index = pksav_littleendian32(
-                              p_output_save_slot->section0.footer.save_index
-                          );
-    ++save_index;
+    return error;
+}
 
-    for(size_t section_index = 0;
-        section_index < PKSAV_GEN3_NUM_SAVE_SECTIONS;
-        ++section_index)
+enum pksav_error pksav_gen3_save_save_async(
+    const char* p_filepath,
+    struct pksav_gen3_save* p_gen3_save,
+    struct pksav_async_writer* p_writer,
+    void (*p_callback)(
+        enum pksav_error error,
+        void* p_user_data
+    ),
+    void* p_user_data
+)
+{
+    if(!p_filepath || !p_gen3_save || !p_writer)
     {
-        p_output_save_slot->sections_arr[section_index].footer.save_index =
-            pksav_littleendian32(save_index);
+        return PKSAV_ERROR_NULL_POINTER;
     }
 
-    error = pksav_fs_write_buffer_to_file(
+    enum pksav_error error = PKSAV_ERROR_NONE;
+
+    struct pksav_gen3_save_internal* p_internal = p_gen3_save->p_internal;
+    size_t save_len = p_internal->save_len;
+    uint8_t* p_snapshot = malloc(save_len);
+    if(!p_snapshot)
+    {
+        return PKSAV_ERROR_OUT_OF_MEMORY;
+    }
+
+    error = pksav_gen3_save_save_to_buffer(
+                p_gen3_save,
+                p_snapshot,
+                save_len
+            );
+    if(error)
+    {
+        free(p_snapshot);
+        return error;
+    }
+
+    // The writer takes ownership of the snapshot.
+    return pksav_async_writer_submit(
+               p_writer,
+               p_filepath,
+               p_snapshot,
+               save_len,
+               p_callback,
+               p_user_data
+           );
+}
+
+enum pksav_error pksav_gen3_save_save_to_batch(
+    const char* p_filepath,
+    struct pksav_gen3_save* p_gen3_save,
+    struct pksav_save_batch* p_batch
+)
+{
+    if(!p_filepath || !p_gen3_save || !p_batch)
+    {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    enum pksav_error error = PKSAV_ERROR_NONE;
+
+    struct pksav_gen3_save_internal* p_internal = p_gen3_save->p_internal;
+
+    uint8_t* p_staged_save = NULL;
+    size_t output_slot_index = 0;
+    error = _pksav_gen3_save_stage(
+                p_gen3_save,
+                &p_staged_save,
+                &output_slot_index
+            );
+    if(error)
+    {
+        return error;
+    }
+
+    error = pksav_save_batch_add(
+                p_batch,
                 p_filepath,
-                p_internal->p_raw_save,
+                p_staged_save,
                 p_internal->save_len
             );
 
+    // The temporary file holds the new slot, so the next save goes to the
+    // other one, whether or not this batch is ever committed.
+    _pksav_gen3_save_finish_staged(
+        p_gen3_save,
+        p_staged_save,
+        output_slot_index,
+        !error // was_written
+    );
+
+    return error;
+}
+
+enum pksav_error pksav_gen3_save_commit(
+    struct pksav_gen3_save* p_gen3_save
+)
+{
+    if(!p_gen3_save)
+    {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    enum pksav_error error = PKSAV_ERROR_NONE;
+
+    struct pksav_gen3_save_internal* p_internal = p_gen3_save->p_internal;
+    if(!p_internal->file_buffer.is_shared)
+    {
+        return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
+
+    // The output slot is written straight into the mapping, so only its
+    // pages need to be flushed.
+    size_t output_slot_index = 0;
+    _pksav_gen3_save_write_output_slot(
+        p_gen3_save,
+        p_internal->p_raw_save,
+        &output_slot_index
+    );
+
+    assert(((output_slot_index + 1) * PKSAV_GEN3_SAVE_SLOT_SIZE) <= p_internal->save_len);
+    error = pksav_fs_sync_file_buffer(
+                &p_internal->file_buffer,
+                (output_slot_index * PKSAV_GEN3_SAVE_SLOT_SIZE),
+                PKSAV_GEN3_SAVE_SLOT_SIZE
+            );
+
     if(!error)
     {
-        // With everything saved to the new slot, reset the pointers.
-        _pksav_gen3_set_save_pointers(
+        _pksav_gen3_save_finish_output_slot(
             p_gen3_save,
-            p_internal->p_raw_save,
-            p_internal->save_len,
-            false // should_alloc_internal
+            output_slot_index
         );
     }
 
@@ -676,7 +2194,14 @@ enum pksav_error pksav_gen3_free_save(
     struct pksav_gen3_save_internal* p_internal = p_gen3_save->p_internal;
     if(p_internal->is_buffer_ours)
     {
-        free(p_internal->p_raw_save);
+        pksav_fs_unmap_file(&p_internal->file_buffer);
+    }
+    free(p_internal->p_consolidated_pokemon_pc);
+    for(size_t box_index = 0;
+        box_index < PKSAV_GEN3_NUM_POKEMON_BOXES;
+        ++box_index)
+    {
+        free(p_internal->p_compact_pc_boxes[box_index]);
     }
     free(p_internal);
 
@@ -9,6 +9,8 @@
 
 #include "sections_internal.h"
 
+#include "util/fs.h"
+
 #include <pksav/gen3/save.h>
 #include <pksav/gen3/time.h>
 #include <pksav/common/trainer_id.h>
@@ -20,6 +22,10 @@
 
 #define PKSAV_GEN3_NUM_SAVE_SECTIONS (14)
 
+// Bitmask of section IDs, used to track the state of individual sections.
+#define PKSAV_GEN3_SECTION_MASK(section_id) ((uint16_t)(1 << (section_id)))
+#define PKSAV_GEN3_ALL_SECTIONS_MASK        ((uint16_t)((1 << PKSAV_GEN3_NUM_SAVE_SECTIONS) - 1))
+
 /*!
  * This union allows the data to be parsed in multiple ways, which is useful for
  * unshuffling and decryption.
@@ -160,12 +166,64 @@ union pksav_gen3_save_slot
     };
 };
 
+/*
+ * The unshuffled sections that hold everything but the PC.
+ *
+ * The PC's sections are consolidated into a pksav_gen3_pokemon_pc instead,
+ * and nothing else in them needs to be kept decrypted, so only these
+ * sections are stored.
+ */
+
+#define PKSAV_GEN3_NUM_UNSHUFFLED_SECTIONS (5)
+
+union pksav_gen3_unshuffled_sections
+{
+    // Access individual bytes in the sections.
+    uint8_t data[sizeof(struct pksav_gen3_save_section)*PKSAV_GEN3_NUM_UNSHUFFLED_SECTIONS];
+    // Access sections as an array.
+    struct pksav_gen3_save_section sections_arr[PKSAV_GEN3_NUM_UNSHUFFLED_SECTIONS];
+    struct
+    {
+        // Section 0 (trainer info).
+        union
+        {
+            // Access the data as a normal section.
+            struct pksav_gen3_save_section section0;
+            // Access the data as a trainer info struct.
+            struct pksav_gen3_player_info_internal player_info;
+        };
+        // Section 1 (team/items).
+        struct pksav_gen3_save_section section1;
+        // Section 2.
+        struct pksav_gen3_save_section section2;
+        // Section 3.
+        struct pksav_gen3_save_section section3;
+        // Section 4 (rival info).
+        struct pksav_gen3_save_section section4;
+    };
+};
+
 #pragma pack(pop)
 
 #define PKSAV_GEN3_SAVE_SLOT_SIZE (0xE000)
 
+// The position of a section ID that doesn't appear in a slot.
+#define PKSAV_GEN3_MISSING_SECTION (0xFF)
+
 struct pksav_gen3_save_internal
 {
+    // This is packed, so keep it at the start of the struct to keep its
+    // word accesses aligned.
+    union pksav_gen3_unshuffled_sections unshuffled_sections;
+
+    // Allocated separately, since saves loaded with PKSAV_GEN3_LOAD_COMPACT
+    // don't consolidate the PC until pksav_gen3_save_get_pc is called.
+    struct pksav_gen3_pokemon_pc* p_consolidated_pokemon_pc;
+
+    // Until then, compact saves decrypt each box into its own buffer as
+    // it's accessed. Unaccessed boxes are NULL and stay in the raw save.
+    struct pksav_gen3_pokemon_box* p_compact_pc_boxes[PKSAV_GEN3_NUM_POKEMON_BOXES];
+
     uint8_t* p_raw_save;
 
     // There are multiple storage formats, so we can't just use our
@@ -173,15 +231,31 @@ struct pksav_gen3_save_internal
     size_t save_len;
 
     bool is_save_from_first_slot;
-    union pksav_gen3_save_slot unshuffled_save_slot;
     uint8_t shuffled_section_nums[PKSAV_GEN3_NUM_SAVE_SECTIONS];
 
-    struct pksav_gen3_pokemon_pc consolidated_pokemon_pc;
+    // Where each section ID is in the active slot, or
+    // PKSAV_GEN3_MISSING_SECTION.
+    uint8_t section_positions[PKSAV_GEN3_NUM_SAVE_SECTIONS];
+
+    // Which sections' checksums matched their footers when loaded.
+    uint16_t valid_section_checksums;
+
     uint32_t* p_security_key;
 
+    uint32_t load_flags;
+
+    // Which PC boxes are currently decrypted, in the consolidated PC or
+    // in their own buffers.
+    uint16_t decrypted_pc_boxes;
+
+    // Only filled if loaded with PKSAV_GEN3_LOAD_VERIFY_POKEMON_CHECKSUMS.
+    struct pksav_gen3_pokemon_checksum_report pokemon_checksum_report;
+
     struct pksav_gen3_pokedex_internal* p_pokedex_internal;
 
     bool is_buffer_ours;
+    // Only set if is_buffer_ours is true.
+    struct pksav_fs_file_buffer file_buffer;
 };
 
 // Each footer has a field that must equal this value to be considered valid.
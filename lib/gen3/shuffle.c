@@ -13,135 +13,471 @@
 #include <pksav/gen3/save.h>
 
 #include <assert.h>
+#include <stddef.h>
 #include <string.h>
 
-void pksav_gen3_save_unshuffle_sections(
+void pksav_gen3_save_crypt_pokemon_box(
+    struct pksav_gen3_pokemon_box* p_pokemon_box,
+    bool should_encrypt
+)
+{
+    assert(p_pokemon_box != NULL);
+
+    if(should_encrypt)
+    {
+        for(size_t pokemon_index = 0;
+            pokemon_index < PKSAV_GEN3_BOX_NUM_POKEMON;
+            ++pokemon_index)
+        {
+            pksav_gen3_set_pokemon_checksum(
+                &p_pokemon_box->entries[pokemon_index]
+            );
+        }
+    }
+
+    pksav_gen3_crypt_pokemon_array(
+        p_pokemon_box->entries,
+        PKSAV_GEN3_BOX_NUM_POKEMON,
+        should_encrypt
+    );
+}
+
+uint32_t pksav_gen3_get_bad_box_checksums(
+    const struct pksav_gen3_pokemon_box* p_pokemon_box,
+    bool is_encrypted
+)
+{
+    assert(p_pokemon_box != NULL);
+
+    uint32_t bad_checksums = 0;
+    for(size_t pokemon_index = 0;
+        pokemon_index < PKSAV_GEN3_BOX_NUM_POKEMON;
+        ++pokemon_index)
+    {
+        if(!pksav_gen3_is_pokemon_checksum_valid(
+                &p_pokemon_box->entries[pokemon_index],
+                is_encrypted
+            ))
+        {
+            bad_checksums |= ((uint32_t)1 << pokemon_index);
+        }
+    }
+
+    return bad_checksums;
+}
+
+// Offset of the first Pokémon within the consolidated PC, after current_box.
+#define PKSAV_GEN3_PC_POKEMON_OFFSET (4)
+
+// Where a PC section's data starts in the consolidated PC. Every PC section
+// but the last is full, so this doesn't need a table.
+static inline size_t _pksav_gen3_get_pc_section_offset(size_t section_id)
+{
+    assert(section_id >= PKSAV_GEN3_NUM_UNSHUFFLED_SECTIONS);
+    assert(section_id < PKSAV_GEN3_NUM_SAVE_SECTIONS);
+
+    return (section_id - PKSAV_GEN3_NUM_UNSHUFFLED_SECTIONS) * PKSAV_GEN3_SAVE_SECTION_SIZE_BYTES;
+}
+
+void pksav_gen3_save_load_sections(
     const union pksav_gen3_save_slot* save_slot_in,
-    union pksav_gen3_save_slot* save_slot_out,
-    uint8_t* section_nums_out
+    union pksav_gen3_unshuffled_sections* sections_out,
+    struct pksav_gen3_pokemon_pc* pokemon_pc_out,
+    uint16_t boxes_to_decrypt,
+    uint8_t* section_nums_out,
+    uint8_t* section_positions_out,
+    uint16_t* p_valid_section_checksums_out,
+    uint32_t* p_bad_pc_checksums_out
 )
 {
     assert(save_slot_in != NULL);
-    assert(save_slot_out != NULL);
+    assert(sections_out != NULL);
     assert(section_nums_out != NULL);
+    assert(section_positions_out != NULL);
+    assert(p_valid_section_checksums_out != NULL);
 
+    // Checking PC Pokémon needs the consolidated PC.
+    assert((pokemon_pc_out != NULL) || (p_bad_pc_checksums_out == NULL));
+
+    // Map each section ID to its position in the shuffled slot so the
+    // sections can be visited in logical order. This is what lets PC
+    // Pokémon be decrypted as soon as their bytes have been copied, since
+    // they can straddle section boundaries.
+    memset(
+        section_positions_out,
+        PKSAV_GEN3_MISSING_SECTION,
+        PKSAV_GEN3_NUM_SAVE_SECTIONS
+    );
     for(size_t section_index = 0;
         section_index < PKSAV_GEN3_NUM_SAVE_SECTIONS;
         ++section_index)
     {
         uint8_t section_id = save_slot_in->sections_arr[section_index].footer.section_id;
-        save_slot_out->sections_arr[section_id] = save_slot_in->sections_arr[section_index];
+        assert(section_id < PKSAV_GEN3_NUM_SAVE_SECTIONS);
+
+        section_positions_out[section_id] = (uint8_t)section_index;
 
         // Cache the original positions.
         section_nums_out[section_index] = section_id;
     }
+
+    uint8_t* p_pc_dst = (uint8_t*)pokemon_pc_out;
+    size_t pc_bytes_loaded = 0;
+    size_t pc_pokemon_index = 0;
+
+    uint16_t valid_section_checksums = 0;
+
+    if(p_bad_pc_checksums_out != NULL)
+    {
+        memset(
+            p_bad_pc_checksums_out,
+            0,
+            sizeof(uint32_t) * PKSAV_GEN3_NUM_POKEMON_BOXES
+        );
+    }
+
+    for(size_t section_id = 0;
+        section_id < PKSAV_GEN3_NUM_SAVE_SECTIONS;
+        ++section_id)
+    {
+        const struct pksav_gen3_save_section* p_section_in = NULL;
+        if(section_positions_out[section_id] != PKSAV_GEN3_MISSING_SECTION)
+        {
+            p_section_in = &save_slot_in->sections_arr[section_positions_out[section_id]];
+        }
+
+        const size_t section_size = pksav_gen3_section_sizes[section_id];
+
+        // Sections 5-13 hold the PC, so their data goes straight into the
+        // consolidated PC. Nothing else in them is needed, since saving
+        // takes the rest of each section from the slot it was loaded from.
+        const uint8_t* p_checksum_data = NULL;
+        if(section_id < PKSAV_GEN3_NUM_UNSHUFFLED_SECTIONS)
+        {
+            struct pksav_gen3_save_section* p_section_out =
+                &sections_out->sections_arr[section_id];
+
+            if(p_section_in != NULL)
+            {
+                *p_section_out = *p_section_in;
+                p_checksum_data = p_section_out->data8;
+            }
+        }
+        else if(pokemon_pc_out == NULL)
+        {
+            // The PC will be consolidated when it's accessed.
+            if(p_section_in != NULL)
+            {
+                p_checksum_data = p_section_in->data8;
+            }
+        }
+        else
+        {
+            if(p_section_in != NULL)
+            {
+                memcpy(p_pc_dst, p_section_in->data8, section_size);
+                p_checksum_data = p_pc_dst;
+            }
+            else
+            {
+                // A slot missing a section is corrupt, but don't leave
+                // garbage in the PC.
+                memset(p_pc_dst, 0, section_size);
+            }
+            p_pc_dst += section_size;
+        }
+
+        // The copy is still in cache, so verify it now rather than in a
+        // separate pass.
+        if(p_checksum_data != NULL)
+        {
+            uint16_t checksum = pksav_gen3_get_data_checksum(
+                                    (const uint32_t*)p_checksum_data,
+                                    (section_size / 4)
+                                );
+            if(checksum == p_section_in->footer.checksum)
+            {
+                valid_section_checksums |= PKSAV_GEN3_SECTION_MASK(section_id);
+            }
+        }
+
+        if((section_id >= PKSAV_GEN3_NUM_UNSHUFFLED_SECTIONS) && (pokemon_pc_out != NULL))
+        {
+            pc_bytes_loaded += section_size;
+
+            // Check and decrypt any Pokémon that are now fully loaded. Any
+            // boxes not specified here are left encrypted until they are
+            // accessed.
+            while((pc_pokemon_index < (PKSAV_GEN3_NUM_POKEMON_BOXES * PKSAV_GEN3_BOX_NUM_POKEMON)) &&
+                  ((PKSAV_GEN3_PC_POKEMON_OFFSET +
+                    ((pc_pokemon_index + 1) * sizeof(struct pksav_gen3_pc_pokemon))) <= pc_bytes_loaded))
+            {
+                size_t box_index = pc_pokemon_index / PKSAV_GEN3_BOX_NUM_POKEMON;
+                size_t entry_index = pc_pokemon_index % PKSAV_GEN3_BOX_NUM_POKEMON;
+                struct pksav_gen3_pc_pokemon* p_pc_pokemon =
+                    &pokemon_pc_out->boxes[box_index].entries[entry_index];
+
+                if((p_bad_pc_checksums_out != NULL) &&
+                   !pksav_gen3_is_pokemon_checksum_valid(
+                        p_pc_pokemon,
+                        true // is_encrypted
+                    ))
+                {
+                    p_bad_pc_checksums_out[box_index] |= ((uint32_t)1 << entry_index);
+                }
+
+                if(boxes_to_decrypt & PKSAV_GEN3_PC_BOX_MASK(box_index))
+                {
+                    pksav_gen3_crypt_pokemon(
+                        p_pc_pokemon,
+                        false // should_encrypt
+                    );
+                }
+
+                ++pc_pokemon_index;
+            }
+        }
+    }
+
+    *p_valid_section_checksums_out = valid_section_checksums;
 }
 
-void pksav_gen3_save_shuffle_sections(
+void pksav_gen3_save_read_pc_bytes(
     const union pksav_gen3_save_slot* save_slot_in,
-    union pksav_gen3_save_slot* save_slot_out,
-    const uint8_t* p_section_nums
+    const uint8_t* p_section_positions,
+    size_t pc_offset,
+    uint8_t* p_dst,
+    size_t num_bytes
 )
 {
     assert(save_slot_in != NULL);
+    assert(p_section_positions != NULL);
+    assert(p_dst != NULL);
+    assert((pc_offset + num_bytes) <= sizeof(struct pksav_gen3_pokemon_pc));
+
+    for(size_t section_id = PKSAV_GEN3_NUM_UNSHUFFLED_SECTIONS;
+        (section_id < PKSAV_GEN3_NUM_SAVE_SECTIONS) && (num_bytes > 0);
+        ++section_id)
+    {
+        const size_t section_offset = _pksav_gen3_get_pc_section_offset(section_id);
+        const size_t section_size = pksav_gen3_section_sizes[section_id];
+        if(pc_offset >= (section_offset + section_size))
+        {
+            continue;
+        }
+
+        size_t offset_in_section = pc_offset - section_offset;
+        size_t num_bytes_in_section = section_size - offset_in_section;
+        if(num_bytes_in_section > num_bytes)
+        {
+            num_bytes_in_section = num_bytes;
+        }
+
+        if(p_section_positions[section_id] != PKSAV_GEN3_MISSING_SECTION)
+        {
+            memcpy(
+                p_dst,
+                &save_slot_in->sections_arr[p_section_positions[section_id]].data8[offset_in_section],
+                num_bytes_in_section
+            );
+        }
+        else
+        {
+            memset(p_dst, 0, num_bytes_in_section);
+        }
+
+        p_dst += num_bytes_in_section;
+        pc_offset += num_bytes_in_section;
+        num_bytes -= num_bytes_in_section;
+    }
+}
+
+// Writes bytes at the given offset into the consolidated PC to every
+// position in the slot holding the sections they belong in.
+static void _pksav_gen3_write_pc_bytes(
+    union pksav_gen3_save_slot* save_slot_out,
+    const uint8_t* p_section_nums,
+    size_t pc_offset,
+    const uint8_t* p_src,
+    size_t num_bytes
+)
+{
     assert(save_slot_out != NULL);
     assert(p_section_nums != NULL);
+    assert(p_src != NULL);
 
     for(size_t section_index = 0;
         section_index < PKSAV_GEN3_NUM_SAVE_SECTIONS;
         ++section_index)
     {
-        assert(p_section_nums[section_index] < PKSAV_GEN3_NUM_SAVE_SECTIONS);
+        const size_t section_id = p_section_nums[section_index];
+        if(section_id < PKSAV_GEN3_NUM_UNSHUFFLED_SECTIONS)
+        {
+            continue;
+        }
 
-        save_slot_out->sections_arr[section_index] =
-            save_slot_in->sections_arr[p_section_nums[section_index]];
+        // Only write the overlap between this section and the given range.
+        const size_t section_offset = _pksav_gen3_get_pc_section_offset(section_id);
+        const size_t section_end = section_offset + pksav_gen3_section_sizes[section_id];
+        const size_t start = (pc_offset > section_offset) ? pc_offset : section_offset;
+        const size_t end = ((pc_offset + num_bytes) < section_end) ? (pc_offset + num_bytes)
+                                                                   : section_end;
+        if(start < end)
+        {
+            memcpy(
+                &save_slot_out->sections_arr[section_index].data8[start - section_offset],
+                &p_src[start - pc_offset],
+                end - start
+            );
+        }
     }
 }
 
-void pksav_gen3_save_load_pokemon_pc(
-    const union pksav_gen3_save_slot* gen3_save_slot,
-    struct pksav_gen3_pokemon_pc* pokemon_pc_out
+void pksav_gen3_save_stage_slot(
+    const union pksav_gen3_unshuffled_sections* sections_in,
+    const union pksav_gen3_save_slot* active_save_slot_in,
+    union pksav_gen3_save_slot* save_slot_out,
+    const uint8_t* p_section_nums,
+    const uint8_t* p_section_positions,
+    bool should_copy_pc
 )
 {
-    assert(gen3_save_slot != NULL);
-    assert(pokemon_pc_out != NULL);
-
-    memset(
-        pokemon_pc_out,
-        0,
-        sizeof(*pokemon_pc_out)
-    );
+    assert(sections_in != NULL);
+    assert(active_save_slot_in != NULL);
+    assert(save_slot_out != NULL);
+    assert(p_section_nums != NULL);
+    assert(p_section_positions != NULL);
 
-    // Copy data from sections into contiguous data structure.
-    uint8_t* p_dst = (uint8_t*)pokemon_pc_out;
-    for(size_t section_index = 5;
-        section_index <= 13;
+    for(size_t section_index = 0;
+        section_index < PKSAV_GEN3_NUM_SAVE_SECTIONS;
         ++section_index)
     {
-        memcpy(
-            p_dst,
-            gen3_save_slot->sections_arr[section_index].data8,
-            pksav_gen3_section_sizes[section_index]
-        );
+        const size_t section_id = p_section_nums[section_index];
+        assert(section_id < PKSAV_GEN3_NUM_SAVE_SECTIONS);
+        assert(p_section_positions[section_id] != PKSAV_GEN3_MISSING_SECTION);
+
+        const struct pksav_gen3_save_section* p_active_section =
+            &active_save_slot_in->sections_arr[p_section_positions[section_id]];
+        struct pksav_gen3_save_section* p_section_out =
+            &save_slot_out->sections_arr[section_index];
+
+        // If there's only one slot, the active section is already in place.
+        const bool is_in_place = (p_active_section == p_section_out);
+
+        if(section_id < PKSAV_GEN3_NUM_UNSHUFFLED_SECTIONS)
+        {
+            memcpy(
+                p_section_out,
+                &sections_in->sections_arr[section_id],
+                offsetof(struct pksav_gen3_save_section, footer)
+            );
+            if(!is_in_place)
+            {
+                p_section_out->footer = p_active_section->footer;
+            }
+        }
+        else if(!is_in_place)
+        {
+            // Unless it's copied here, the PC's part of the section is
+            // written separately.
+            size_t start = should_copy_pc ? 0 : pksav_gen3_section_sizes[section_id];
 
-        p_dst += pksav_gen3_section_sizes[section_index];
+            memcpy(
+                &p_section_out->data8[start],
+                &p_active_section->data8[start],
+                sizeof(*p_section_out) - start
+            );
+        }
     }
+}
 
-    // Decrypt Pokémon.
-    for(size_t box_index = 0;
-        box_index < PKSAV_GEN3_NUM_POKEMON_BOXES;
-        ++box_index)
+void pksav_gen3_save_save_pokemon_box(
+    struct pksav_gen3_pokemon_box* p_pokemon_box,
+    size_t box_index,
+    bool should_encrypt,
+    union pksav_gen3_save_slot* gen3_save_slot_out,
+    const uint8_t* p_section_nums
+)
+{
+    assert(p_pokemon_box != NULL);
+    assert(box_index < PKSAV_GEN3_NUM_POKEMON_BOXES);
+    assert(gen3_save_slot_out != NULL);
+    assert(p_section_nums != NULL);
+
+    const uint8_t* p_box_bytes = (const uint8_t*)p_pokemon_box;
+
+    // Boxes that were never decrypted are still in their on-disk form,
+    // so they're written as-is. Otherwise, set each Pokémon's checksum
+    // and encrypt a copy, leaving the decrypted box alone.
+    struct pksav_gen3_pokemon_box encrypted_box;
+    if(should_encrypt)
     {
         for(size_t pokemon_index = 0;
             pokemon_index < PKSAV_GEN3_BOX_NUM_POKEMON;
             ++pokemon_index)
         {
-            pksav_gen3_crypt_pokemon(
-                &pokemon_pc_out->boxes[box_index].entries[pokemon_index],
-                false
-            );
+            pksav_gen3_set_pokemon_checksum(&p_pokemon_box->entries[pokemon_index]);
         }
+        encrypted_box = *p_pokemon_box;
+
+        pksav_gen3_crypt_pokemon_array(
+            encrypted_box.entries,
+            PKSAV_GEN3_BOX_NUM_POKEMON,
+            true // should_encrypt
+        );
+        p_box_bytes = (const uint8_t*)&encrypted_box;
     }
+
+    _pksav_gen3_write_pc_bytes(
+        gen3_save_slot_out,
+        p_section_nums,
+        offsetof(struct pksav_gen3_pokemon_pc, boxes) + (box_index * sizeof(*p_pokemon_box)),
+        p_box_bytes,
+        sizeof(*p_pokemon_box)
+    );
 }
 
 void pksav_gen3_save_save_pokemon_pc(
     struct pksav_gen3_pokemon_pc* p_pokemon_pc,
-    union pksav_gen3_save_slot* gen3_save_slot_out
+    union pksav_gen3_save_slot* gen3_save_slot_out,
+    const uint8_t* p_section_nums,
+    uint16_t boxes_to_encrypt
 )
 {
     assert(p_pokemon_pc != NULL);
     assert(gen3_save_slot_out != NULL);
+    assert(p_section_nums != NULL);
+
+    const uint8_t* p_pc_bytes = (const uint8_t*)p_pokemon_pc;
+    const size_t boxes_offset = offsetof(struct pksav_gen3_pokemon_pc, boxes);
+    const size_t boxes_end = boxes_offset + sizeof(p_pokemon_pc->boxes);
+
+    _pksav_gen3_write_pc_bytes(
+        gen3_save_slot_out,
+        p_section_nums,
+        0,
+        p_pc_bytes,
+        boxes_offset
+    );
 
-    // Set Pokémon checksum and encrypt.
     for(size_t box_index = 0;
         box_index < PKSAV_GEN3_NUM_POKEMON_BOXES;
         ++box_index)
     {
-        for(uint8_t pokemon_index = 0;
-            pokemon_index < PKSAV_GEN3_BOX_NUM_POKEMON;
-            ++pokemon_index)
-        {
-            pksav_gen3_set_pokemon_checksum(
-                &p_pokemon_pc->boxes[box_index].entries[pokemon_index]
-            );
-            pksav_gen3_crypt_pokemon(
-                &p_pokemon_pc->boxes[box_index].entries[pokemon_index],
-                true
-            );
-        }
-    }
-
-    // Copy contiguous data structure back into sections.
-    uint8_t* p_src = (uint8_t*)p_pokemon_pc;
-    for(size_t section_index = 5;
-        section_index <= 13;
-        ++section_index)
-    {
-        memcpy(
-            gen3_save_slot_out->sections_arr[section_index].data8,
-            p_src,
-            pksav_gen3_section_sizes[section_index]
+        pksav_gen3_save_save_pokemon_box(
+            &p_pokemon_pc->boxes[box_index],
+            box_index,
+            (boxes_to_encrypt & PKSAV_GEN3_PC_BOX_MASK(box_index)),
+            gen3_save_slot_out,
+            p_section_nums
         );
-        p_src += pksav_gen3_section_sizes[section_index];
     }
+
+    _pksav_gen3_write_pc_bytes(
+        gen3_save_slot_out,
+        p_section_nums,
+        boxes_end,
+        &p_pc_bytes[boxes_end],
+        sizeof(*p_pokemon_pc) - boxes_end
+    );
 }
@@ -15,26 +15,89 @@
 #include <pksav/gen3/pokemon.h>
 #include <pksav/gen3/save.h>
 
-void pksav_gen3_save_unshuffle_sections(
+#include <stdbool.h>
+#include <stdint.h>
+
+// Bitmask of PC boxes, used to track which boxes are currently decrypted.
+#define PKSAV_GEN3_PC_BOX_MASK(box_index) ((uint16_t)(1 << (box_index)))
+#define PKSAV_GEN3_ALL_PC_BOXES_MASK      ((uint16_t)((1 << PKSAV_GEN3_NUM_POKEMON_BOXES) - 1))
+
+void pksav_gen3_save_crypt_pokemon_box(
+    struct pksav_gen3_pokemon_box* p_pokemon_box,
+    bool should_encrypt
+);
+
+/*
+ * Unshuffles sections 0-4 of the given slot, consolidates the PC, decrypts
+ * the given PC boxes, and checks each section's checksum, visiting each
+ * section once. If pokemon_pc_out is NULL, the PC is left in the slot. If
+ * p_bad_pc_checksums_out is non-NULL, each PC Pokémon's checksum is also
+ * checked, with one bitmap per box.
+ */
+void pksav_gen3_save_load_sections(
     const union pksav_gen3_save_slot* save_slot_in,
-    union pksav_gen3_save_slot* save_slot_out,
-    uint8_t* section_nums_out
+    union pksav_gen3_unshuffled_sections* sections_out,
+    struct pksav_gen3_pokemon_pc* pokemon_pc_out,
+    uint16_t boxes_to_decrypt,
+    uint8_t* section_nums_out,
+    uint8_t* section_positions_out,
+    uint16_t* p_valid_section_checksums_out,
+    uint32_t* p_bad_pc_checksums_out
 );
 
-void pksav_gen3_save_shuffle_sections(
+// Returns a bitmap of which Pokémon in the box have bad checksums.
+uint32_t pksav_gen3_get_bad_box_checksums(
+    const struct pksav_gen3_pokemon_box* p_pokemon_box,
+    bool is_encrypted
+);
+
+// Reads part of the consolidated PC straight out of a shuffled slot.
+void pksav_gen3_save_read_pc_bytes(
     const union pksav_gen3_save_slot* save_slot_in,
+    const uint8_t* p_section_positions,
+    size_t pc_offset,
+    uint8_t* p_dst,
+    size_t num_bytes
+);
+
+/*
+ * Writes everything but the PC into a shuffled slot, taking sections 0-4
+ * from the unshuffled sections and the rest of each section from the active
+ * slot. If should_copy_pc is true, the PC is also copied from the active
+ * slot rather than written with pksav_gen3_save_save_pokemon_pc.
+ */
+void pksav_gen3_save_stage_slot(
+    const union pksav_gen3_unshuffled_sections* sections_in,
+    const union pksav_gen3_save_slot* active_save_slot_in,
     union pksav_gen3_save_slot* save_slot_out,
-    const uint8_t* p_section_nums
+    const uint8_t* p_section_nums,
+    const uint8_t* p_section_positions,
+    bool should_copy_pc
 );
 
-void pksav_gen3_save_load_pokemon_pc(
-    const union pksav_gen3_save_slot* gen3_save_slot,
-    struct pksav_gen3_pokemon_pc* pokemon_pc_out
+/*
+ * Writes one PC box into the given shuffled slot, encrypting it on the way
+ * if should_encrypt is set. The box itself is left decrypted, other than
+ * having its Pokémon's checksums set.
+ */
+void pksav_gen3_save_save_pokemon_box(
+    struct pksav_gen3_pokemon_box* p_pokemon_box,
+    size_t box_index,
+    bool should_encrypt,
+    union pksav_gen3_save_slot* gen3_save_slot_out,
+    const uint8_t* p_section_nums
 );
 
+/*
+ * Writes the PC into sections 5-13 of the given shuffled slot, encrypting
+ * the given boxes on the way. The PC itself is left decrypted, other than
+ * having its Pokémon's checksums set.
+ */
 void pksav_gen3_save_save_pokemon_pc(
     struct pksav_gen3_pokemon_pc* p_pokemon_pc,
-    union pksav_gen3_save_slot* gen3_save_slot_out
+    union pksav_gen3_save_slot* gen3_save_slot_out,
+    const uint8_t* p_section_nums,
+    uint16_t boxes_to_encrypt
 );
 
 #endif /* PKSAV_GEN3_SHUFFLE_H */
@@ -5,12 +5,12 @@
  * or copy at http://opensource.org/licenses/MIT)
  */
 
+#include "util/text_batch.h"
 #include "util/text_common.h"
 
 #include <pksav/gen3/text.h>
 
-#include <assert.h>
-#include <string.h>
+#include <stdbool.h>
 
 #define PKSAV_GEN3_LAST_CHAR  0xF9 // Just control characters past here
 #define PKSAV_GEN3_TERMINATOR 0xFF
@@ -50,85 +50,214 @@ static const wchar_t PKSAV_GEN3_CHAR_MAP[] =
     0x006C,0x006D,0x006E,0x006F,0x0070,0x0071,0x0072,0x0073,0x0074,0x0075,0x0076,0x0077,0x0078,0x0079,0x007A,0x25B6,
     0x003A,0x00C4,0x00D6,0x00DC,0x00E4,0x00F6,0x00F6,0x2B06,0x2B07,0x2B05,'\0','\0','\0','\0','\n','\0'
 };
-static const size_t PKSAV_GEN3_CHAR_MAP_SIZE =
-    sizeof(PKSAV_GEN3_CHAR_MAP)/sizeof(PKSAV_GEN3_CHAR_MAP[0]);
 
-static enum pksav_error _pksav_gen3_import_widetext(
-    const uint8_t* p_input_buffer,
-    wchar_t* p_output_widetext,
-    size_t num_chars
-)
+// Generated from PKSAV_GEN3_CHAR_MAP by scripts/generate_char_tables.py.
+static const struct pksav_text_reverse_map_entry PKSAV_GEN3_REVERSE_CHAR_MAP[] =
 {
-    assert(p_input_buffer != NULL);
-    assert(p_output_widetext != NULL);
-
-    memset(p_output_widetext, 0, sizeof(wchar_t)*num_chars);
+    {0x000A,0xFE},{0x0020,0x00},{0x0021,0xAB},{0x0024,0xB7},{0x0025,0x5B},{0x0026,0x2D},{0x0028,0x5C},{0x0029,0x5D},
+    {0x002A,0x55},{0x002B,0x2E},{0x002C,0xB8},{0x002D,0xAE},{0x002E,0xAD},{0x002F,0x34},{0x0030,0xA1},{0x0031,0xA2},
+    {0x0032,0xA3},{0x0033,0xA4},{0x0034,0xA5},{0x0035,0xA6},{0x0036,0xA7},{0x0037,0xA8},{0x0038,0xA9},{0x0039,0xAA},
+    {0x003A,0xF0},{0x003C,0x53},{0x003D,0x35},{0x003E,0x54},{0x003F,0x2C},{0x0041,0xBB},{0x0042,0xBC},{0x0043,0xBD},
+    {0x0044,0xBE},{0x0045,0xBF},{0x0046,0xC0},{0x0047,0xC1},{0x0048,0xC2},{0x0049,0xC3},{0x004A,0xC4},{0x004B,0xC5},
+    {0x004C,0xC6},{0x004D,0xC7},{0x004E,0xC8},{0x004F,0xC9},{0x0050,0xCA},{0x0051,0xCB},{0x0052,0xCC},{0x0053,0xCD},
+    {0x0054,0xCE},{0x0055,0xCF},{0x0056,0xD0},{0x0057,0xD1},{0x0058,0xD2},{0x0059,0xD3},{0x005A,0xD4},{0x0061,0xD5},
+    {0x0062,0xD6},{0x0063,0xD7},{0x0064,0xD8},{0x0065,0xD9},{0x0066,0xDA},{0x0067,0xDB},{0x0068,0xDC},{0x0069,0xDD},
+    {0x006A,0xDE},{0x006B,0xDF},{0x006C,0xE0},{0x006D,0xE1},{0x006E,0xE2},{0x006F,0xE3},{0x0070,0xE4},{0x0071,0xE5},
+    {0x0072,0xE6},{0x0073,0xE7},{0x0074,0xE8},{0x0075,0xE9},{0x0076,0xEA},{0x0077,0xEB},{0x0078,0xEC},{0x0079,0xED},
+    {0x007A,0xEE},{0x007E,0x56},{0x00A1,0x52},{0x00AA,0x2B},{0x00BA,0x2A},{0x00BF,0x51},{0x00C0,0x01},{0x00C1,0x02},
+    {0x00C2,0x03},{0x00C4,0xF1},{0x00C7,0x04},{0x00C8,0x05},{0x00C9,0x06},{0x00CA,0x07},{0x00CB,0x08},{0x00CC,0x09},
+    {0x00CD,0x0B},{0x00CE,0x0C},{0x00D1,0x14},{0x00D2,0x0D},{0x00D3,0x0E},{0x00D4,0x0F},{0x00D6,0xF2},{0x00D7,0xB9},
+    {0x00D9,0x11},{0x00DA,0x12},{0x00DB,0x13},{0x00DC,0xF3},{0x00E0,0x16},{0x00E1,0x17},{0x00E4,0xF4},{0x00E7,0x19},
+    {0x00E8,0x1A},{0x00E9,0x1B},{0x00EA,0x1C},{0x00EB,0x1D},{0x00EC,0x1E},{0x00EE,0x20},{0x00EF,0x21},{0x00F1,0x29},
+    {0x00F2,0x22},{0x00F3,0x23},{0x00F4,0x24},{0x00F6,0xF5},{0x00F9,0x26},{0x00FA,0x27},{0x00FB,0x28},{0x0152,0x10},
+    {0x1E9E,0x15},{0x2018,0xB3},{0x2019,0xB4},{0x201C,0xB1},{0x201D,0xB2},{0x2026,0xB0},{0x25B6,0xEF},{0x2640,0xB6},
+    {0x2642,0xB5},{0x27A1,0x7C},{0x2B05,0x7B},{0x2B06,0x79},{0x2B07,0x7A},{0x3042,0x2F},{0x3043,0x30},{0x3045,0x31},
+    {0x3047,0x32},{0x3049,0x33},{0x304C,0x37},{0x304E,0x38},{0x3050,0x39},{0x3052,0x3A},{0x3053,0x0A},{0x3054,0x3B},
+    {0x3056,0x3C},{0x3058,0x3D},{0x305A,0x3E},{0x305C,0x3F},{0x305E,0x40},{0x3060,0x41},{0x3062,0x42},{0x3063,0x50},
+    {0x3065,0x43},{0x3067,0x44},{0x3069,0x45},{0x306D,0x18},{0x3070,0x46},{0x3071,0x4B},{0x3073,0x47},{0x3074,0x4C},
+    {0x3076,0x48},{0x3077,0x4D},{0x3079,0x49},{0x307A,0x4E},{0x307C,0x4A},{0x307D,0x4F},{0x307E,0x1F},{0x3087,0x36},
+    {0x30A1,0x7F},{0x30A3,0x80},{0x30A5,0x81},{0x30A7,0x82},{0x30A9,0x83},{0x30AC,0x87},{0x30AE,0x88},{0x30B0,0x89},
+    {0x30B2,0x8A},{0x30B4,0x8B},{0x30B6,0x8C},{0x30B8,0x8D},{0x30BA,0x8E},{0x30BB,0x5E},{0x30BC,0x8F},{0x30BD,0x5F},
+    {0x30BE,0x90},{0x30BF,0x60},{0x30C0,0x91},{0x30C1,0x61},{0x30C2,0x92},{0x30C3,0xA0},{0x30C4,0x62},{0x30C5,0x93},
+    {0x30C6,0x63},{0x30C7,0x94},{0x30C8,0x64},{0x30C9,0x95},{0x30CA,0x65},{0x30CB,0x66},{0x30CC,0x67},{0x30CE,0x69},
+    {0x30CF,0x6A},{0x30D0,0x96},{0x30D1,0x9B},{0x30D2,0x6B},{0x30D3,0x97},{0x30D4,0x9C},{0x30D5,0x6C},{0x30D6,0x98},
+    {0x30D7,0x9D},{0x30D8,0x6D},{0x30D9,0x99},{0x30DA,0x9E},{0x30DB,0x6E},{0x30DC,0x9A},{0x30DD,0x9F},{0x30DF,0x70},
+    {0x30E0,0x71},{0x30E1,0x72},{0x30E2,0x73},{0x30E3,0x84},{0x30E4,0x74},{0x30E5,0x85},{0x30E6,0x75},{0x30E7,0x86},
+    {0x30E8,0x76},{0x30E9,0x77},{0x30EA,0x78},{0x30F2,0x7D},{0x30F3,0x7E},{0x30FB,0xAF},
+};
+static const size_t PKSAV_GEN3_REVERSE_CHAR_MAP_SIZE =
+    sizeof(PKSAV_GEN3_REVERSE_CHAR_MAP)/sizeof(PKSAV_GEN3_REVERSE_CHAR_MAP[0]);
 
-    for(size_t char_index = 0; char_index < num_chars; ++char_index)
+// Generated from PKSAV_GEN3_CHAR_MAP by scripts/generate_char_tables.py.
+static const struct pksav_text_batch_table PKSAV_GEN3_TEXT_BATCH_TABLE =
+{
+    .utf8 =
+    {
+        {0x20},{0xC3,0x80},{0xC3,0x81},{0xC3,0x82},{0xC3,0x87},{0xC3,0x88},{0xC3,0x89},{0xC3,0x8A},
+        {0xC3,0x8B},{0xC3,0x8C},{0xE3,0x81,0x93},{0xC3,0x8D},{0xC3,0x8E},{0xC3,0x92},{0xC3,0x93},{0xC3,0x94},
+        {0xC5,0x92},{0xC3,0x99},{0xC3,0x9A},{0xC3,0x9B},{0xC3,0x91},{0xE1,0xBA,0x9E},{0xC3,0xA0},{0xC3,0xA1},
+        {0xE3,0x81,0xAD},{0xC3,0xA7},{0xC3,0xA8},{0xC3,0xA9},{0xC3,0xAA},{0xC3,0xAB},{0xC3,0xAC},{0xE3,0x81,0xBE},
+        {0xC3,0xAE},{0xC3,0xAF},{0xC3,0xB2},{0xC3,0xB3},{0xC3,0xB4},{0xC5,0x92},{0xC3,0xB9},{0xC3,0xBA},
+        {0xC3,0xBB},{0xC3,0xB1},{0xC2,0xBA},{0xC2,0xAA},{0x3F},{0x26},{0x2B},{0xE3,0x81,0x82},
+        {0xE3,0x81,0x83},{0xE3,0x81,0x85},{0xE3,0x81,0x87},{0xE3,0x81,0x89},{0x2F},{0x3D},{0xE3,0x82,0x87},{0xE3,0x81,0x8C},
+        {0xE3,0x81,0x8E},{0xE3,0x81,0x90},{0xE3,0x81,0x92},{0xE3,0x81,0x94},{0xE3,0x81,0x96},{0xE3,0x81,0x98},{0xE3,0x81,0x9A},{0xE3,0x81,0x9C},
+        {0xE3,0x81,0x9E},{0xE3,0x81,0xA0},{0xE3,0x81,0xA2},{0xE3,0x81,0xA5},{0xE3,0x81,0xA7},{0xE3,0x81,0xA9},{0xE3,0x81,0xB0},{0xE3,0x81,0xB3},
+        {0xE3,0x81,0xB6},{0xE3,0x81,0xB9},{0xE3,0x81,0xBC},{0xE3,0x81,0xB1},{0xE3,0x81,0xB4},{0xE3,0x81,0xB7},{0xE3,0x81,0xBA},{0xE3,0x81,0xBD},
+        {0xE3,0x81,0xA3},{0xC2,0xBF},{0xC2,0xA1},{0x3C},{0x3E},{0x2A},{0x7E},{0x3F},
+        {0x3F},{0x3F},{0xC3,0x8D},{0x25},{0x28},{0x29},{0xE3,0x82,0xBB},{0xE3,0x82,0xBD},
+        {0xE3,0x82,0xBF},{0xE3,0x83,0x81},{0xE3,0x83,0x84},{0xE3,0x83,0x86},{0xE3,0x83,0x88},{0xE3,0x83,0x8A},{0xE3,0x83,0x8B},{0xE3,0x83,0x8C},
+        {0xC3,0x82},{0xE3,0x83,0x8E},{0xE3,0x83,0x8F},{0xE3,0x83,0x92},{0xE3,0x83,0x95},{0xE3,0x83,0x98},{0xE3,0x83,0x9B},{0xC3,0x8D},
+        {0xE3,0x83,0x9F},{0xE3,0x83,0xA0},{0xE3,0x83,0xA1},{0xE3,0x83,0xA2},{0xE3,0x83,0xA4},{0xE3,0x83,0xA6},{0xE3,0x83,0xA8},{0xE3,0x83,0xA9},
+        {0xE3,0x83,0xAA},{0xE2,0xAC,0x86},{0xE2,0xAC,0x87},{0xE2,0xAC,0x85},{0xE2,0x9E,0xA1},{0xE3,0x83,0xB2},{0xE3,0x83,0xB3},{0xE3,0x82,0xA1},
+        {0xE3,0x82,0xA3},{0xE3,0x82,0xA5},{0xE3,0x82,0xA7},{0xE3,0x82,0xA9},{0xE3,0x83,0xA3},{0xE3,0x83,0xA5},{0xE3,0x83,0xA7},{0xE3,0x82,0xAC},
+        {0xE3,0x82,0xAE},{0xE3,0x82,0xB0},{0xE3,0x82,0xB2},{0xE3,0x82,0xB4},{0xE3,0x82,0xB6},{0xE3,0x82,0xB8},{0xE3,0x82,0xBA},{0xE3,0x82,0xBC},
+        {0xE3,0x82,0xBE},{0xE3,0x83,0x80},{0xE3,0x83,0x82},{0xE3,0x83,0x85},{0xE3,0x83,0x87},{0xE3,0x83,0x89},{0xE3,0x83,0x90},{0xE3,0x83,0x93},
+        {0xE3,0x83,0x96},{0xE3,0x83,0x99},{0xE3,0x83,0x9C},{0xE3,0x83,0x91},{0xE3,0x83,0x94},{0xE3,0x83,0x97},{0xE3,0x83,0x9A},{0xE3,0x83,0x9D},
+        {0xE3,0x83,0x83},{0x30},{0x31},{0x32},{0x33},{0x34},{0x35},{0x36},
+        {0x37},{0x38},{0x39},{0x21},{0x3F},{0x2E},{0x2D},{0xE3,0x83,0xBB},
+        {0xE2,0x80,0xA6},{0xE2,0x80,0x9C},{0xE2,0x80,0x9D},{0xE2,0x80,0x98},{0xE2,0x80,0x99},{0xE2,0x99,0x82},{0xE2,0x99,0x80},{0x24},
+        {0x2C},{0xC3,0x97},{0x2F},{0x41},{0x42},{0x43},{0x44},{0x45},
+        {0x46},{0x47},{0x48},{0x49},{0x4A},{0x4B},{0x4C},{0x4D},
+        {0x4E},{0x4F},{0x50},{0x51},{0x52},{0x53},{0x54},{0x55},
+        {0x56},{0x57},{0x58},{0x59},{0x5A},{0x61},{0x62},{0x63},
+        {0x64},{0x65},{0x66},{0x67},{0x68},{0x69},{0x6A},{0x6B},
+        {0x6C},{0x6D},{0x6E},{0x6F},{0x70},{0x71},{0x72},{0x73},
+        {0x74},{0x75},{0x76},{0x77},{0x78},{0x79},{0x7A},{0xE2,0x96,0xB6},
+        {0x3A},{0xC3,0x84},{0xC3,0x96},{0xC3,0x9C},{0xC3,0xA4},{0xC3,0xB6},{0xC3,0xB6},{0xE2,0xAC,0x86},
+        {0xE2,0xAC,0x87},{0xE2,0xAC,0x85},{0},{0},{0},{0},{0},{0},
+    },
+    .utf8_len =
     {
-        if(p_input_buffer[char_index] > PKSAV_GEN3_LAST_CHAR)
-        {
-            break;
-        }
-        else
-        {
-            p_output_widetext[char_index] = PKSAV_GEN3_CHAR_MAP[p_input_buffer[char_index]];
-        }
+        1,2,2,2,2,2,2,2,2,2,3,2,2,2,2,2,
+        2,2,2,2,2,3,2,2,3,2,2,2,2,2,2,3,
+        2,2,2,2,2,2,2,2,2,2,2,2,1,1,1,3,
+        3,3,3,3,1,1,3,3,3,3,3,3,3,3,3,3,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+        3,2,2,1,1,1,1,1,1,1,2,1,1,1,3,3,
+        3,3,3,3,3,3,3,3,2,3,3,3,3,3,3,2,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+        3,1,1,1,1,1,1,1,1,1,1,1,1,1,1,3,
+        3,3,3,3,3,3,3,1,1,2,1,1,1,1,1,1,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,3,
+        1,2,2,2,2,2,2,3,3,3,0,0,0,0,0,0,
+    },
+    .ascii =
+    {
+        0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+        0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+        0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x26,0x2B,0x00,
+        0x00,0x00,0x00,0x00,0x2F,0x3D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+        0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+        0x00,0x00,0x00,0x3C,0x3E,0x2A,0x7E,0x3F,0x3F,0x3F,0x00,0x25,0x28,0x29,0x00,0x00,
+        0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+        0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+        0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+        0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+        0x00,0x30,0x31,0x32,0x33,0x34,0x35,0x36,0x37,0x38,0x39,0x21,0x3F,0x2E,0x2D,0x00,
+        0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x2C,0x00,0x2F,0x41,0x42,0x43,0x44,0x45,
+        0x46,0x47,0x48,0x49,0x4A,0x4B,0x4C,0x4D,0x4E,0x4F,0x50,0x51,0x52,0x53,0x54,0x55,
+        0x56,0x57,0x58,0x59,0x5A,0x61,0x62,0x63,0x64,0x65,0x66,0x67,0x68,0x69,0x6A,0x6B,
+        0x6C,0x6D,0x6E,0x6F,0x70,0x71,0x72,0x73,0x74,0x75,0x76,0x77,0x78,0x79,0x7A,0x00,
+        0x3A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
     }
+};
 
-    return PKSAV_ERROR_NONE;
+static uint32_t _pksav_gen3_import_char(
+    uint16_t game_char
+)
+{
+    // Characters with no mapping are 0, which ends the string.
+    return (game_char > PKSAV_GEN3_LAST_CHAR) ? 0 : PKSAV_GEN3_CHAR_MAP[game_char];
 }
 
-static enum pksav_error _pksav_gen3_export_widetext(
-    const wchar_t* p_input_widetext,
-    uint8_t* p_output_buffer,
-    size_t num_chars
+static ssize_t _pksav_gen3_export_char(
+    uint32_t code_point
 )
 {
-    assert(p_input_widetext != NULL);
-    assert(p_output_buffer != NULL);
-
-    memset(p_output_buffer, PKSAV_GEN3_TERMINATOR, num_chars);
-
-    for(size_t char_index = 0; char_index < num_chars; ++char_index)
-    {
-        ssize_t map_index = wchar_map_index(
-                                PKSAV_GEN3_CHAR_MAP,
-                                PKSAV_GEN3_CHAR_MAP_SIZE,
-                                p_input_widetext[char_index]
-                            );
-        if(map_index != -1)
-        {
-            p_output_buffer[char_index] = (uint8_t)map_index;
-        }
-        else
-        {
-            break;
-        }
-    }
-
-    return PKSAV_ERROR_NONE;
+    return pksav_text_reverse_map_find(
+               PKSAV_GEN3_REVERSE_CHAR_MAP,
+               PKSAV_GEN3_REVERSE_CHAR_MAP_SIZE,
+               code_point
+           );
 }
 
+static const struct pksav_text_codec PKSAV_GEN3_TEXT_CODEC =
+{
+    .char_size = sizeof(uint8_t),
+    .terminator = PKSAV_GEN3_TERMINATOR,
+    .p_import_char = _pksav_gen3_import_char,
+    .p_export_char = _pksav_gen3_export_char
+};
+
 enum pksav_error pksav_gen3_import_text(
     const uint8_t* p_input_buffer,
     char* p_output_text,
     size_t num_chars
 )
 {
-    if(!p_input_buffer || !p_output_text)
+    return pksav_text_import(
+               &PKSAV_GEN3_TEXT_CODEC,
+               p_input_buffer,
+               p_output_text,
+               num_chars
+           );
+}
+
+enum pksav_error pksav_gen3_import_text_bounded(
+    const uint8_t* p_input_buffer,
+    size_t num_chars,
+    char* p_output_text,
+    size_t output_text_len,
+    size_t* p_num_bytes_out,
+    bool* p_is_truncated_out
+)
+{
+    return pksav_text_import_bounded(
+               &PKSAV_GEN3_TEXT_CODEC,
+               p_input_buffer,
+               num_chars,
+               p_output_text,
+               output_text_len,
+               p_num_bytes_out,
+               p_is_truncated_out
+           );
+}
+
+enum pksav_error pksav_gen3_import_text_batch(
+    const uint8_t* p_records,
+    size_t record_stride,
+    size_t num_records,
+    size_t num_chars,
+    char* p_output_arena,
+    size_t output_arena_len,
+    size_t* p_offsets_out
+)
+{
+    if(!p_records || !p_output_arena || !p_offsets_out)
     {
         return PKSAV_ERROR_NULL_POINTER;
     }
 
-    wchar_t* p_widetext = calloc(num_chars, sizeof(wchar_t));
-    _pksav_gen3_import_widetext(
-        p_input_buffer, p_widetext, num_chars
-    );
+    if(((num_records > 1) && (record_stride < num_chars)) ||
+       (output_arena_len < PKSAV_GEN3_TEXT_BATCH_ARENA_LEN(num_records, num_chars)))
+    {
+        return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
 
-    memset(p_output_text, 0, num_chars);
-    pksav_wcstombs(p_output_text, p_widetext, num_chars);
-    free(p_widetext);
+    pksav_text_batch_import(
+        &PKSAV_GEN3_TEXT_BATCH_TABLE,
+        p_records,
+        record_stride,
+        num_records,
+        num_chars,
+        p_output_arena,
+        output_arena_len,
+        p_offsets_out
+    );
 
     return PKSAV_ERROR_NONE;
 }
@@ -139,19 +268,28 @@ enum pksav_error pksav_gen3_export_text(
     size_t num_chars
 )
 {
-    if(!p_input_text || !p_output_buffer)
-    {
-        return PKSAV_ERROR_NULL_POINTER;
-    }
-
-    wchar_t* p_widetext = calloc(num_chars, sizeof(wchar_t));
-    pksav_mbstowcs(p_widetext, p_input_text, num_chars);
-
-    _pksav_gen3_export_widetext(
-        p_widetext, p_output_buffer, num_chars
-    );
-
-    free(p_widetext);
+    return pksav_text_export(
+               &PKSAV_GEN3_TEXT_CODEC,
+               p_input_text,
+               p_output_buffer,
+               num_chars
+           );
+}
 
-    return PKSAV_ERROR_NONE;
+enum pksav_error pksav_gen3_export_text_bounded(
+    const char* p_input_text,
+    uint8_t* p_output_buffer,
+    size_t num_chars,
+    size_t* p_num_chars_out,
+    bool* p_is_truncated_out
+)
+{
+    return pksav_text_export_bounded(
+               &PKSAV_GEN3_TEXT_CODEC,
+               p_input_text,
+               p_output_buffer,
+               num_chars,
+               p_num_chars_out,
+               p_is_truncated_out
+           );
 }
@@ -9,9 +9,7 @@
 
 #include <pksav/gen4/text.h>
 
-#include <assert.h>
-#include <string.h>
-#include <wchar.h>
+#include <stdbool.h>
 
 #define PKSAV_GEN4_TERMINATOR 0xFFFF
 
@@ -19,291 +17,744 @@
  * Character map for Generation IV
  *
  * Source: https://github.com/Chase-san/PokeLib/blob/master/lib/PokeText.cpp
+ *
+ * Characters 0x0000-0x01E4 are Japanese and Western, and 0x0400-0x0D53 are
+ * Korean. Each page holds 64 characters, and page 0 is empty, so the gap
+ * between them takes up no space.
+ *
+ * After editing a page, run scripts/generate_char_tables.py to repack the
+ * pages and regenerate PKSAV_GEN4_CHAR_PAGE_INDICES and the reverse map.
  */
-static const wchar_t PKSAV_GEN4_CHAR_MAP1[] = // 0x0000,
+static const uint16_t PKSAV_GEN4_CHAR_PAGES[][PKSAV_TEXT_PAGE_SIZE] =
 {
-    0x0000,0x3000,0x3041,0x3042,0x3043,0x3044,0x3045,0x3046,0x3047,0x3048,0x3049,0x304A,0x304B,0x304C,0x304D,0x304E,
-    0x304F,0x3050,0x3051,0x3052,0x3053,0x3054,0x3055,0x3056,0x3057,0x3058,0x3059,0x305A,0x305B,0x305C,0x305D,0x305E,
-    0x305F,0x3060,0x3061,0x3062,0x3063,0x3064,0x3065,0x3066,0x3067,0x3068,0x3069,0x306A,0x306B,0x306C,0x306D,0x306E,
-    0x306F,0x3070,0x3071,0x3072,0x3073,0x3074,0x3075,0x3076,0x3077,0x3078,0x3079,0x307A,0x307B,0x307C,0x307D,0x307E,
-    0x307F,0x3080,0x3081,0x3082,0x3083,0x3084,0x3085,0x3086,0x3087,0x3088,0x3089,0x308A,0x308B,0x308C,0x308D,0x308F,
-    0x3092,0x3093,0x30A1,0x30A2,0x30A3,0x30A4,0x30A5,0x30A6,0x30A7,0x30A8,0x30A9,0x30AA,0x30AB,0x30AC,0x30AD,0x30AE,
-    0x30AF,0x30B0,0x30B1,0x30B2,0x30B3,0x30B4,0x30B5,0x30B6,0x30B7,0x30B8,0x30B9,0x30BA,0x30BB,0x30BC,0x30BD,0x30BE,
-    0x30BF,0x30C0,0x30C1,0x30C2,0x30C3,0x30C4,0x30C5,0x30C6,0x30C7,0x30C8,0x30C9,0x30CA,0x30CB,0x30CC,0x30CD,0x30CE,
-    0x30CF,0x30D0,0x30D1,0x30D2,0x30D3,0x30D4,0x30D5,0x30D6,0x30D7,0x30D8,0x30D9,0x30DA,0x30DB,0x30DC,0x30DD,0x30DE,
-    0x30DF,0x30E0,0x30E1,0x30E2,0x30E3,0x30E4,0x30E5,0x30E6,0x30E7,0x30E8,0x30E9,0x30EA,0x30EB,0x30EC,0x30ED,0x30EF,
-    0x30F2,0x30F3,0xFF10,0xFF11,0xFF12,0xFF13,0xFF14,0xFF15,0xFF16,0xFF17,0xFF18,0xFF19,0xFF21,0xFF22,0xFF23,0xFF24,
-    0xFF25,0xFF26,0xFF27,0xFF28,0xFF29,0xFF2A,0xFF2B,0xFF2C,0xFF2D,0xFF2E,0xFF2F,0xFF30,0xFF31,0xFF32,0xFF33,0xFF34,
-    0xFF35,0xFF36,0xFF37,0xFF38,0xFF39,0xFF3A,0xFF41,0xFF42,0xFF43,0xFF44,0xFF45,0xFF46,0xFF47,0xFF48,0xFF49,0xFF4A,
-    0xFF4B,0xFF4C,0xFF4D,0xFF4E,0xFF4F,0xFF50,0xFF51,0xFF52,0xFF53,0xFF54,0xFF55,0xFF56,0xFF57,0xFF58,0xFF59,0xFF5A,
-    0x0000, // Missing ###
-    0xFF01,0xFF1F,0x3001,0x3002,0x22EF,0x30FB,0xFF0F,0x300C,0x300D,0x300E,0x300F,0xFF08,0xFF09,0x329A,0x329B,0xFF0B,
-    0xFF0D,0x2297,0x2298,0xFF1D,0xFF5A,0xFF1A,0xFF1B,0xFF0E,0xFF0C,0x2664,0x2667,0x2661,0x2662,0x2606,0x25CE,0x25CB,
-    0x25A1,0x25B3,0x25C7,0xFF20,0x266B,0xFF05,0x263C,0x2614,0x2630,0x2744,0x260B,0x2654,0x2655,0x260A,0x2934,0x2935,
-    0x263E,0x00A5,0x2648,0x2649,0x264A,0x264B,0x264C,0x264D,0x264E,0x264F,0x2190,0x2191,0x2193,0x2192,0x2023,0xFF06,
-    0x0030,0x0031,0x0032,0x0033,0x0034,0x0035,0x0036,0x0037,0x0038,0x0039,0x0041,0x0042,0x0043,0x0044,0x0045,0x0046,
-    0x0047,0x0048,0x0049,0x004A,0x004B,0x004C,0x004D,0x004E,0x004F,0x0050,0x0051,0x0052,0x0053,0x0054,0x0055,0x0056,
-    0x0057,0x0058,0x0059,0x005A,0x0061,0x0062,0x0063,0x0064,0x0065,0x0066,0x0067,0x0068,0x0069,0x006A,0x006B,0x006C,
-    0x006D,0x006E,0x006F,0x0070,0x0071,0x0072,0x0073,0x0074,0x0075,0x0076,0x0077,0x0078,0x0079,0x007A,0x00C0,0x00C1,
-    0x00C2,0x00C3,0x00C4,0x00C5,0x00C6,0x00C7,0x00C8,0x00C9,0x00CA,0x00CB,0x00CC,0x00CD,0x00CE,0x00CF,0x00D0,0x00D1,
-    0x00D2,0x00D3,0x00D4,0x00D5,0x00D6,0x00D7,0x00D8,0x00D9,0x00DA,0x00DB,0x00DC,0x00DD,0x00DE,0x00DF,0x00E0,0x00E1,
-    0x00E2,0x00E3,0x00E4,0x00E5,0x00E6,0x00E7,0x00E8,0x00E9,0x00EA,0x00EB,0x00EC,0x00ED,0x00EE,0x00EF,0x00F0,0x00F1,
-    0x00F2,0x00F3,0x00F4,0x00F5,0x00F6,0x00F7,0x00F8,0x00F9,0x00FA,0x00FB,0x00FC,0x00FD,0x00FE,0x00FF,0x0152,0x0153,
-    0x015E,0x015F,0x00AA,0x00BA,0x00B9,0x00B2,0x00B3,0x0024,0x00A1,0x00BF,0x0021,0x003F,0x002C,0x002E,0x2026,0x00B7,
-    0x002F,0x2018,0x2019,0x201C,0x201D,0x201E,0x300A,0x300B,0x0028,0x0029,0x2642,0x2640,0x002B,0x002D,0x002A,0x0023,
-    0x003D,0x0026,0x007E,0x003A,0x003B,0x2660,0x2663,0x2665,0x2666,0x2605,0x25C9,0x25CF,0x25A0,0x25B2,0x25C6,0x0040,
-    0x266A,0x0025,0x2600,0x2601,0x2602,0x2603,0x263A,0x265A,0x265B,0x2639,0x2197,0x2198,0x263D,0x0020,0x2074,0x20A7,
-    0x20A6,0x00B0,0x005F,0xFF3F,
+    { // Empty
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    },
+    { // 0x0000
+        0x0000,0x3000,0x3041,0x3042,0x3043,0x3044,0x3045,0x3046,0x3047,0x3048,0x3049,0x304A,0x304B,0x304C,0x304D,0x304E,
+        0x304F,0x3050,0x3051,0x3052,0x3053,0x3054,0x3055,0x3056,0x3057,0x3058,0x3059,0x305A,0x305B,0x305C,0x305D,0x305E,
+        0x305F,0x3060,0x3061,0x3062,0x3063,0x3064,0x3065,0x3066,0x3067,0x3068,0x3069,0x306A,0x306B,0x306C,0x306D,0x306E,
+        0x306F,0x3070,0x3071,0x3072,0x3073,0x3074,0x3075,0x3076,0x3077,0x3078,0x3079,0x307A,0x307B,0x307C,0x307D,0x307E,
+    },
+    { // 0x0040
+        0x307F,0x3080,0x3081,0x3082,0x3083,0x3084,0x3085,0x3086,0x3087,0x3088,0x3089,0x308A,0x308B,0x308C,0x308D,0x308F,
+        0x3092,0x3093,0x30A1,0x30A2,0x30A3,0x30A4,0x30A5,0x30A6,0x30A7,0x30A8,0x30A9,0x30AA,0x30AB,0x30AC,0x30AD,0x30AE,
+        0x30AF,0x30B0,0x30B1,0x30B2,0x30B3,0x30B4,0x30B5,0x30B6,0x30B7,0x30B8,0x30B9,0x30BA,0x30BB,0x30BC,0x30BD,0x30BE,
+        0x30BF,0x30C0,0x30C1,0x30C2,0x30C3,0x30C4,0x30C5,0x30C6,0x30C7,0x30C8,0x30C9,0x30CA,0x30CB,0x30CC,0x30CD,0x30CE,
+    },
+    { // 0x0080
+        0x30CF,0x30D0,0x30D1,0x30D2,0x30D3,0x30D4,0x30D5,0x30D6,0x30D7,0x30D8,0x30D9,0x30DA,0x30DB,0x30DC,0x30DD,0x30DE,
+        0x30DF,0x30E0,0x30E1,0x30E2,0x30E3,0x30E4,0x30E5,0x30E6,0x30E7,0x30E8,0x30E9,0x30EA,0x30EB,0x30EC,0x30ED,0x30EF,
+        0x30F2,0x30F3,0xFF10,0xFF11,0xFF12,0xFF13,0xFF14,0xFF15,0xFF16,0xFF17,0xFF18,0xFF19,0xFF21,0xFF22,0xFF23,0xFF24,
+        0xFF25,0xFF26,0xFF27,0xFF28,0xFF29,0xFF2A,0xFF2B,0xFF2C,0xFF2D,0xFF2E,0xFF2F,0xFF30,0xFF31,0xFF32,0xFF33,0xFF34,
+    },
+    { // 0x00C0
+        0xFF35,0xFF36,0xFF37,0xFF38,0xFF39,0xFF3A,0xFF41,0xFF42,0xFF43,0xFF44,0xFF45,0xFF46,0xFF47,0xFF48,0xFF49,0xFF4A,
+        0xFF4B,0xFF4C,0xFF4D,0xFF4E,0xFF4F,0xFF50,0xFF51,0xFF52,0xFF53,0xFF54,0xFF55,0xFF56,0xFF57,0xFF58,0xFF59,0xFF5A,
+        0x0000,0xFF01,0xFF1F,0x3001,0x3002,0x22EF,0x30FB,0xFF0F,0x300C,0x300D,0x300E,0x300F,0xFF08,0xFF09,0x329A,0x329B,
+        0xFF0B,0xFF0D,0x2297,0x2298,0xFF1D,0xFF5A,0xFF1A,0xFF1B,0xFF0E,0xFF0C,0x2664,0x2667,0x2661,0x2662,0x2606,0x25CE,
+    },
+    { // 0x0100
+        0x25CB,0x25A1,0x25B3,0x25C7,0xFF20,0x266B,0xFF05,0x263C,0x2614,0x2630,0x2744,0x260B,0x2654,0x2655,0x260A,0x2934,
+        0x2935,0x263E,0x00A5,0x2648,0x2649,0x264A,0x264B,0x264C,0x264D,0x264E,0x264F,0x2190,0x2191,0x2193,0x2192,0x2023,
+        0xFF06,0x0030,0x0031,0x0032,0x0033,0x0034,0x0035,0x0036,0x0037,0x0038,0x0039,0x0041,0x0042,0x0043,0x0044,0x0045,
+        0x0046,0x0047,0x0048,0x0049,0x004A,0x004B,0x004C,0x004D,0x004E,0x004F,0x0050,0x0051,0x0052,0x0053,0x0054,0x0055,
+    },
+    { // 0x0140
+        0x0056,0x0057,0x0058,0x0059,0x005A,0x0061,0x0062,0x0063,0x0064,0x0065,0x0066,0x0067,0x0068,0x0069,0x006A,0x006B,
+        0x006C,0x006D,0x006E,0x006F,0x0070,0x0071,0x0072,0x0073,0x0074,0x0075,0x0076,0x0077,0x0078,0x0079,0x007A,0x00C0,
+        0x00C1,0x00C2,0x00C3,0x00C4,0x00C5,0x00C6,0x00C7,0x00C8,0x00C9,0x00CA,0x00CB,0x00CC,0x00CD,0x00CE,0x00CF,0x00D0,
+        0x00D1,0x00D2,0x00D3,0x00D4,0x00D5,0x00D6,0x00D7,0x00D8,0x00D9,0x00DA,0x00DB,0x00DC,0x00DD,0x00DE,0x00DF,0x00E0,
+    },
+    { // 0x0180
+        0x00E1,0x00E2,0x00E3,0x00E4,0x00E5,0x00E6,0x00E7,0x00E8,0x00E9,0x00EA,0x00EB,0x00EC,0x00ED,0x00EE,0x00EF,0x00F0,
+        0x00F1,0x00F2,0x00F3,0x00F4,0x00F5,0x00F6,0x00F7,0x00F8,0x00F9,0x00FA,0x00FB,0x00FC,0x00FD,0x00FE,0x00FF,0x0152,
+        0x0153,0x015E,0x015F,0x00AA,0x00BA,0x00B9,0x00B2,0x00B3,0x0024,0x00A1,0x00BF,0x0021,0x003F,0x002C,0x002E,0x2026,
+        0x00B7,0x002F,0x2018,0x2019,0x201C,0x201D,0x201E,0x300A,0x300B,0x0028,0x0029,0x2642,0x2640,0x002B,0x002D,0x002A,
+    },
+    { // 0x01C0
+        0x0023,0x003D,0x0026,0x007E,0x003A,0x003B,0x2660,0x2663,0x2665,0x2666,0x2605,0x25C9,0x25CF,0x25A0,0x25B2,0x25C6,
+        0x0040,0x266A,0x0025,0x2600,0x2601,0x2602,0x2603,0x263A,0x265A,0x265B,0x2639,0x2197,0x2198,0x263D,0x0020,0x2074,
+        0x20A7,0x20A6,0x00B0,0x005F,0xFF3F,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    },
+    { // 0x0400
+        0xAC00,0xAC01,0xAC04,0xAC07,0xAC08,0xAC09,0xAC0A,0xAC10,0xAC11,0xAC12,0xAC13,0xAC14,0xAC15,0xAC16,0xAC17,0xAC19,
+        0xAC1A,0xAC1B,0xAC1C,0xAC1D,0xAC20,0xAC24,0xAC2C,0xAC2D,0xAC2F,0xAC30,0xAC31,0xAC38,0xAC39,0xAC3C,0xAC40,0xAC4B,
+        0xAC4D,0xAC54,0xAC58,0xAC5C,0xAC70,0xAC71,0xAC74,0xAC77,0xAC78,0xAC7A,0xAC80,0xAC81,0xAC83,0xAC84,0xAC85,0xAC86,
+        0xAC89,0xAC8A,0xAC8B,0xAC8C,0xAC90,0xAC94,0xAC9C,0xAC9D,0xAC9F,0xACA0,0xACA1,0xACA8,0xACA9,0xACAA,0xACAC,0xACAF,
+    },
+    { // 0x0440
+        0xACB0,0xACB8,0xACB9,0xACBB,0xACBC,0xACBD,0xACC1,0xACC4,0xACC8,0xACCC,0xACD5,0xACD7,0xACE0,0xACE1,0xACE4,0xACE7,
+        0xACE8,0xACEA,0xACEC,0xACEF,0xACF0,0xACF1,0xACF3,0xACF5,0xACF6,0xACFC,0xACFD,0xAD00,0xAD04,0xAD06,0xAD0C,0xAD0D,
+        0xAD0F,0xAD11,0xAD18,0xAD1C,0xAD20,0xAD29,0xAD2C,0xAD2D,0xAD34,0xAD35,0xAD38,0xAD3C,0xAD44,0xAD45,0xAD47,0xAD49,
+        0xAD50,0xAD54,0xAD58,0xAD61,0xAD63,0xAD6C,0xAD6D,0xAD70,0xAD73,0xAD74,0xAD75,0xAD76,0xAD7B,0xAD7C,0xAD7D,0xAD7F,
+    },
+    { // 0x0480
+        0xAD81,0xAD82,0xAD88,0xAD89,0xAD8C,0xAD90,0xAD9C,0xAD9D,0xADA4,0xADB7,0xADC0,0xADC1,0xADC4,0xADC8,0xADD0,0xADD1,
+        0xADD3,0xADDC,0xADE0,0xADE4,0xADF8,0xADF9,0xADFC,0xADFF,0xAE00,0xAE01,0xAE08,0xAE09,0xAE0B,0xAE0D,0xAE14,0xAE30,
+        0xAE31,0xAE34,0xAE37,0xAE38,0xAE3A,0xAE40,0xAE41,0xAE43,0xAE45,0xAE46,0xAE4A,0xAE4C,0xAE4D,0xAE4E,0xAE50,0xAE54,
+        0xAE56,0xAE5C,0xAE5D,0xAE5F,0xAE60,0xAE61,0xAE65,0xAE68,0xAE69,0xAE6C,0xAE70,0xAE78,0xAE79,0xAE7B,0xAE7C,0xAE7D,
+    },
+    { // 0x04C0
+        0xAE84,0xAE85,0xAE8C,0xAEBC,0xAEBD,0xAEBE,0xAEC0,0xAEC4,0xAECC,0xAECD,0xAECF,0xAED0,0xAED1,0xAED8,0xAED9,0xAEDC,
+        0xAEE8,0xAEEB,0xAEED,0xAEF4,0xAEF8,0xAEFC,0xAF07,0xAF08,0xAF0D,0xAF10,0xAF2C,0xAF2D,0xAF30,0xAF32,0xAF34,0xAF3C,
+        0xAF3D,0xAF3F,0xAF41,0xAF42,0xAF43,0xAF48,0xAF49,0xAF50,0xAF5C,0xAF5D,0xAF64,0xAF65,0xAF79,0xAF80,0xAF84,0xAF88,
+        0xAF90,0xAF91,0xAF95,0xAF9C,0xAFB8,0xAFB9,0xAFBC,0xAFC0,0xAFC7,0xAFC8,0xAFC9,0xAFCB,0xAFCD,0xAFCE,0xAFD4,0xAFDC,
+    },
+    { // 0x0500
+        0xAFE8,0xAFE9,0xAFF0,0xAFF1,0xAFF4,0xAFF8,0xB000,0xB001,0xB004,0xB00C,0xB010,0xB014,0xB01C,0xB01D,0xB028,0xB044,
+        0xB045,0xB048,0xB04A,0xB04C,0xB04E,0xB053,0xB054,0xB055,0xB057,0xB059,0xB05D,0xB07C,0xB07D,0xB080,0xB084,0xB08C,
+        0xB08D,0xB08F,0xB091,0xB098,0xB099,0xB09A,0xB09C,0xB09F,0xB0A0,0xB0A1,0xB0A2,0xB0A8,0xB0A9,0xB0AB,0xB0AC,0xB0AD,
+        0xB0AE,0xB0AF,0xB0B1,0xB0B3,0xB0B4,0xB0B5,0xB0B8,0xB0BC,0xB0C4,0xB0C5,0xB0C7,0xB0C8,0xB0C9,0xB0D0,0xB0D1,0xB0D4,
+    },
+    { // 0x0540
+        0xB0D8,0xB0E0,0xB0E5,0xB108,0xB109,0xB10B,0xB10C,0xB110,0xB112,0xB113,0xB118,0xB119,0xB11B,0xB11C,0xB11D,0xB123,
+        0xB124,0xB125,0xB128,0xB12C,0xB134,0xB135,0xB137,0xB138,0xB139,0xB140,0xB141,0xB144,0xB148,0xB150,0xB151,0xB154,
+        0xB155,0xB158,0xB15C,0xB160,0xB178,0xB179,0xB17C,0xB180,0xB182,0xB188,0xB189,0xB18B,0xB18D,0xB192,0xB193,0xB194,
+        0xB198,0xB19C,0xB1A8,0xB1CC,0xB1D0,0xB1D4,0xB1DC,0xB1DD,0xB1DF,0xB1E8,0xB1E9,0xB1EC,0xB1F0,0xB1F9,0xB1FB,0xB1FD,
+    },
+    { // 0x0580
+        0xB204,0xB205,0xB208,0xB20B,0xB20C,0xB214,0xB215,0xB217,0xB219,0xB220,0xB234,0xB23C,0xB258,0xB25C,0xB260,0xB268,
+        0xB269,0xB274,0xB275,0xB27C,0xB284,0xB285,0xB289,0xB290,0xB291,0xB294,0xB298,0xB299,0xB29A,0xB2A0,0xB2A1,0xB2A3,
+        0xB2A5,0xB2A6,0xB2AA,0xB2AC,0xB2B0,0xB2B4,0xB2C8,0xB2C9,0xB2CC,0xB2D0,0xB2D2,0xB2D8,0xB2D9,0xB2DB,0xB2DD,0xB2E2,
+        0xB2E4,0xB2E5,0xB2E6,0xB2E8,0xB2EB,0xB2EC,0xB2ED,0xB2EE,0xB2EF,0xB2F3,0xB2F4,0xB2F5,0xB2F7,0xB2F8,0xB2F9,0xB2FA,
+    },
+    { // 0x05C0
+        0xB2FB,0xB2FF,0xB300,0xB301,0xB304,0xB308,0xB310,0xB311,0xB313,0xB314,0xB315,0xB31C,0xB354,0xB355,0xB356,0xB358,
+        0xB35B,0xB35C,0xB35E,0xB35F,0xB364,0xB365,0xB367,0xB369,0xB36B,0xB36E,0xB370,0xB371,0xB374,0xB378,0xB380,0xB381,
+        0xB383,0xB384,0xB385,0xB38C,0xB390,0xB394,0xB3A0,0xB3A1,0xB3A8,0xB3AC,0xB3C4,0xB3C5,0xB3C8,0xB3CB,0xB3CC,0xB3CE,
+        0xB3D0,0xB3D4,0xB3D5,0xB3D7,0xB3D9,0xB3DB,0xB3DD,0xB3E0,0xB3E4,0xB3E8,0xB3FC,0xB410,0xB418,0xB41C,0xB420,0xB428,
+    },
+    { // 0x0600
+        0xB429,0xB42B,0xB434,0xB450,0xB451,0xB454,0xB458,0xB460,0xB461,0xB463,0xB465,0xB46C,0xB480,0xB488,0xB49D,0xB4A4,
+        0xB4A8,0xB4AC,0xB4B5,0xB4B7,0xB4B9,0xB4C0,0xB4C4,0xB4C8,0xB4D0,0xB4D5,0xB4DC,0xB4DD,0xB4E0,0xB4E3,0xB4E4,0xB4E6,
+        0xB4EC,0xB4ED,0xB4EF,0xB4F1,0xB4F8,0xB514,0xB515,0xB518,0xB51B,0xB51C,0xB524,0xB525,0xB527,0xB528,0xB529,0xB52A,
+        0xB530,0xB531,0xB534,0xB538,0xB540,0xB541,0xB543,0xB544,0xB545,0xB54B,0xB54C,0xB54D,0xB550,0xB554,0xB55C,0xB55D,
+    },
+    { // 0x0640
+        0xB55F,0xB560,0xB561,0xB5A0,0xB5A1,0xB5A4,0xB5A8,0xB5AA,0xB5AB,0xB5B0,0xB5B1,0xB5B3,0xB5B4,0xB5B5,0xB5BB,0xB5BC,
+        0xB5BD,0xB5C0,0xB5C4,0xB5CC,0xB5CD,0xB5CF,0xB5D0,0xB5D1,0xB5D8,0xB5EC,0xB610,0xB611,0xB614,0xB618,0xB625,0xB62C,
+        0xB634,0xB648,0xB664,0xB668,0xB69C,0xB69D,0xB6A0,0xB6A4,0xB6AB,0xB6AC,0xB6B1,0xB6D4,0xB6F0,0xB6F4,0xB6F8,0xB700,
+        0xB701,0xB705,0xB728,0xB729,0xB72C,0xB72F,0xB730,0xB738,0xB739,0xB73B,0xB744,0xB748,0xB74C,0xB754,0xB755,0xB760,
+    },
+    { // 0x0680
+        0xB764,0xB768,0xB770,0xB771,0xB773,0xB775,0xB77C,0xB77D,0xB780,0xB784,0xB78C,0xB78D,0xB78F,0xB790,0xB791,0xB792,
+        0xB796,0xB797,0xB798,0xB799,0xB79C,0xB7A0,0xB7A8,0xB7A9,0xB7AB,0xB7AC,0xB7AD,0xB7B4,0xB7B5,0xB7B8,0xB7C7,0xB7C9,
+        0xB7EC,0xB7ED,0xB7F0,0xB7F4,0xB7FC,0xB7FD,0xB7FF,0xB800,0xB801,0xB807,0xB808,0xB809,0xB80C,0xB810,0xB818,0xB819,
+        0xB81B,0xB81D,0xB824,0xB825,0xB828,0xB82C,0xB834,0xB835,0xB837,0xB838,0xB839,0xB840,0xB844,0xB851,0xB853,0xB85C,
+    },
+    { // 0x06C0
+        0xB85D,0xB860,0xB864,0xB86C,0xB86D,0xB86F,0xB871,0xB878,0xB87C,0xB88D,0xB8A8,0xB8B0,0xB8B4,0xB8B8,0xB8C0,0xB8C1,
+        0xB8C3,0xB8C5,0xB8CC,0xB8D0,0xB8D4,0xB8DD,0xB8DF,0xB8E1,0xB8E8,0xB8E9,0xB8EC,0xB8F0,0xB8F8,0xB8F9,0xB8FB,0xB8FD,
+        0xB904,0xB918,0xB920,0xB93C,0xB93D,0xB940,0xB944,0xB94C,0xB94F,0xB951,0xB958,0xB959,0xB95C,0xB960,0xB968,0xB969,
+        0xB96B,0xB96D,0xB974,0xB975,0xB978,0xB97C,0xB984,0xB985,0xB987,0xB989,0xB98A,0xB98D,0xB98E,0xB9AC,0xB9AD,0xB9B0,
+    },
+    { // 0x0700
+        0xB9B4,0xB9BC,0xB9BD,0xB9BF,0xB9C1,0xB9C8,0xB9C9,0xB9CC,0xB9CE,0xB9CF,0xB9D0,0xB9D1,0xB9D2,0xB9D8,0xB9D9,0xB9DB,
+        0xB9DD,0xB9DE,0xB9E1,0xB9E3,0xB9E4,0xB9E5,0xB9E8,0xB9EC,0xB9F4,0xB9F5,0xB9F7,0xB9F8,0xB9F9,0xB9FA,0xBA00,0xBA01,
+        0xBA08,0xBA15,0xBA38,0xBA39,0xBA3C,0xBA40,0xBA42,0xBA48,0xBA49,0xBA4B,0xBA4D,0xBA4E,0xBA53,0xBA54,0xBA55,0xBA58,
+        0xBA5C,0xBA64,0xBA65,0xBA67,0xBA68,0xBA69,0xBA70,0xBA71,0xBA74,0xBA78,0xBA83,0xBA84,0xBA85,0xBA87,0xBA8C,0xBAA8,
+    },
+    { // 0x0740
+        0xBAA9,0xBAAB,0xBAAC,0xBAB0,0xBAB2,0xBAB8,0xBAB9,0xBABB,0xBABD,0xBAC4,0xBAC8,0xBAD8,0xBAD9,0xBAFC,0xBB00,0xBB04,
+        0xBB0D,0xBB0F,0xBB11,0xBB18,0xBB1C,0xBB20,0xBB29,0xBB2B,0xBB34,0xBB35,0xBB36,0xBB38,0xBB3B,0xBB3C,0xBB3D,0xBB3E,
+        0xBB44,0xBB45,0xBB47,0xBB49,0xBB4D,0xBB4F,0xBB50,0xBB54,0xBB58,0xBB61,0xBB63,0xBB6C,0xBB88,0xBB8C,0xBB90,0xBBA4,
+        0xBBA8,0xBBAC,0xBBB4,0xBBB7,0xBBC0,0xBBC4,0xBBC8,0xBBD0,0xBBD3,0xBBF8,0xBBF9,0xBBFC,0xBBFF,0xBC00,0xBC02,0xBC08,
+    },
+    { // 0x0780
+        0xBC09,0xBC0B,0xBC0C,0xBC0D,0xBC0F,0xBC11,0xBC14,0xBC15,0xBC16,0xBC17,0xBC18,0xBC1B,0xBC1C,0xBC1D,0xBC1E,0xBC1F,
+        0xBC24,0xBC25,0xBC27,0xBC29,0xBC2D,0xBC30,0xBC31,0xBC34,0xBC38,0xBC40,0xBC41,0xBC43,0xBC44,0xBC45,0xBC49,0xBC4C,
+        0xBC4D,0xBC50,0xBC5D,0xBC84,0xBC85,0xBC88,0xBC8B,0xBC8C,0xBC8E,0xBC94,0xBC95,0xBC97,0xBC99,0xBC9A,0xBCA0,0xBCA1,
+        0xBCA4,0xBCA7,0xBCA8,0xBCB0,0xBCB1,0xBCB3,0xBCB4,0xBCB5,0xBCBC,0xBCBD,0xBCC0,0xBCC4,0xBCCD,0xBCCF,0xBCD0,0xBCD1,
+    },
+    { // 0x07C0
+        0xBCD5,0xBCD8,0xBCDC,0xBCF4,0xBCF5,0xBCF6,0xBCF8,0xBCFC,0xBD04,0xBD05,0xBD07,0xBD09,0xBD10,0xBD14,0xBD24,0xBD2C,
+        0xBD40,0xBD48,0xBD49,0xBD4C,0xBD50,0xBD58,0xBD59,0xBD64,0xBD68,0xBD80,0xBD81,0xBD84,0xBD87,0xBD88,0xBD89,0xBD8A,
+        0xBD90,0xBD91,0xBD93,0xBD95,0xBD99,0xBD9A,0xBD9C,0xBDA4,0xBDB0,0xBDB8,0xBDD4,0xBDD5,0xBDD8,0xBDDC,0xBDE9,0xBDF0,
+        0xBDF4,0xBDF8,0xBE00,0xBE03,0xBE05,0xBE0C,0xBE0D,0xBE10,0xBE14,0xBE1C,0xBE1D,0xBE1F,0xBE44,0xBE45,0xBE48,0xBE4C,
+    },
+    { // 0x0800
+        0xBE4E,0xBE54,0xBE55,0xBE57,0xBE59,0xBE5A,0xBE5B,0xBE60,0xBE61,0xBE64,0xBE68,0xBE6A,0xBE70,0xBE71,0xBE73,0xBE74,
+        0xBE75,0xBE7B,0xBE7C,0xBE7D,0xBE80,0xBE84,0xBE8C,0xBE8D,0xBE8F,0xBE90,0xBE91,0xBE98,0xBE99,0xBEA8,0xBED0,0xBED1,
+        0xBED4,0xBED7,0xBED8,0xBEE0,0xBEE3,0xBEE4,0xBEE5,0xBEEC,0xBF01,0xBF08,0xBF09,0xBF18,0xBF19,0xBF1B,0xBF1C,0xBF1D,
+        0xBF40,0xBF41,0xBF44,0xBF48,0xBF50,0xBF51,0xBF55,0xBF94,0xBFB0,0xBFC5,0xBFCC,0xBFCD,0xBFD0,0xBFD4,0xBFDC,0xBFDF,
+    },
+    { // 0x0840
+        0xBFE1,0xC03C,0xC051,0xC058,0xC05C,0xC060,0xC068,0xC069,0xC090,0xC091,0xC094,0xC098,0xC0A0,0xC0A1,0xC0A3,0xC0A5,
+        0xC0AC,0xC0AD,0xC0AF,0xC0B0,0xC0B3,0xC0B4,0xC0B5,0xC0B6,0xC0BC,0xC0BD,0xC0BF,0xC0C0,0xC0C1,0xC0C5,0xC0C8,0xC0C9,
+        0xC0CC,0xC0D0,0xC0D8,0xC0D9,0xC0DB,0xC0DC,0xC0DD,0xC0E4,0xC0E5,0xC0E8,0xC0EC,0xC0F4,0xC0F5,0xC0F7,0xC0F9,0xC100,
+        0xC104,0xC108,0xC110,0xC115,0xC11C,0xC11D,0xC11E,0xC11F,0xC120,0xC123,0xC124,0xC126,0xC127,0xC12C,0xC12D,0xC12F,
+    },
+    { // 0x0880
+        0xC130,0xC131,0xC136,0xC138,0xC139,0xC13C,0xC140,0xC148,0xC149,0xC14B,0xC14C,0xC14D,0xC154,0xC155,0xC158,0xC15C,
+        0xC164,0xC165,0xC167,0xC168,0xC169,0xC170,0xC174,0xC178,0xC185,0xC18C,0xC18D,0xC18E,0xC190,0xC194,0xC196,0xC19C,
+        0xC19D,0xC19F,0xC1A1,0xC1A5,0xC1A8,0xC1A9,0xC1AC,0xC1B0,0xC1BD,0xC1C4,0xC1C8,0xC1CC,0xC1D4,0xC1D7,0xC1D8,0xC1E0,
+        0xC1E4,0xC1E8,0xC1F0,0xC1F1,0xC1F3,0xC1FC,0xC1FD,0xC200,0xC204,0xC20C,0xC20D,0xC20F,0xC211,0xC218,0xC219,0xC21C,
+    },
+    { // 0x08C0
+        0xC21F,0xC220,0xC228,0xC229,0xC22B,0xC22D,0xC22F,0xC231,0xC232,0xC234,0xC248,0xC250,0xC251,0xC254,0xC258,0xC260,
+        0xC265,0xC26C,0xC26D,0xC270,0xC274,0xC27C,0xC27D,0xC27F,0xC281,0xC288,0xC289,0xC290,0xC298,0xC29B,0xC29D,0xC2A4,
+        0xC2A5,0xC2A8,0xC2AC,0xC2AD,0xC2B4,0xC2B5,0xC2B7,0xC2B9,0xC2DC,0xC2DD,0xC2E0,0xC2E3,0xC2E4,0xC2EB,0xC2EC,0xC2ED,
+        0xC2EF,0xC2F1,0xC2F6,0xC2F8,0xC2F9,0xC2FB,0xC2FC,0xC300,0xC308,0xC309,0xC30C,0xC30D,0xC313,0xC314,0xC315,0xC318,
+    },
+    { // 0x0900
+        0xC31C,0xC324,0xC325,0xC328,0xC329,0xC345,0xC368,0xC369,0xC36C,0xC370,0xC372,0xC378,0xC379,0xC37C,0xC37D,0xC384,
+        0xC388,0xC38C,0xC3C0,0xC3D8,0xC3D9,0xC3DC,0xC3DF,0xC3E0,0xC3E2,0xC3E8,0xC3E9,0xC3ED,0xC3F4,0xC3F5,0xC3F8,0xC408,
+        0xC410,0xC424,0xC42C,0xC430,0xC434,0xC43C,0xC43D,0xC448,0xC464,0xC465,0xC468,0xC46C,0xC474,0xC475,0xC479,0xC480,
+        0xC494,0xC49C,0xC4B8,0xC4BC,0xC4E9,0xC4F0,0xC4F1,0xC4F4,0xC4F8,0xC4FA,0xC4FF,0xC500,0xC501,0xC50C,0xC510,0xC514,
+    },
+    { // 0x0940
+        0xC51C,0xC528,0xC529,0xC52C,0xC530,0xC538,0xC539,0xC53B,0xC53D,0xC544,0xC545,0xC548,0xC549,0xC54A,0xC54C,0xC54D,
+        0xC54E,0xC553,0xC554,0xC555,0xC557,0xC558,0xC559,0xC55D,0xC55E,0xC560,0xC561,0xC564,0xC568,0xC570,0xC571,0xC573,
+        0xC574,0xC575,0xC57C,0xC57D,0xC580,0xC584,0xC587,0xC58C,0xC58D,0xC58F,0xC591,0xC595,0xC597,0xC598,0xC59C,0xC5A0,
+        0xC5A9,0xC5B4,0xC5B5,0xC5B8,0xC5B9,0xC5BB,0xC5BC,0xC5BD,0xC5BE,0xC5C4,0xC5C5,0xC5C6,0xC5C7,0xC5C8,0xC5C9,0xC5CA,
+    },
+    { // 0x0980
+        0xC5CC,0xC5CE,0xC5D0,0xC5D1,0xC5D4,0xC5D8,0xC5E0,0xC5E1,0xC5E3,0xC5E5,0xC5EC,0xC5ED,0xC5EE,0xC5F0,0xC5F4,0xC5F6,
+        0xC5F7,0xC5FC,0xC5FD,0xC5FE,0xC5FF,0xC600,0xC601,0xC605,0xC606,0xC607,0xC608,0xC60C,0xC610,0xC618,0xC619,0xC61B,
+        0xC61C,0xC624,0xC625,0xC628,0xC62C,0xC62D,0xC62E,0xC630,0xC633,0xC634,0xC635,0xC637,0xC639,0xC63B,0xC640,0xC641,
+        0xC644,0xC648,0xC650,0xC651,0xC653,0xC654,0xC655,0xC65C,0xC65D,0xC660,0xC66C,0xC66F,0xC671,0xC678,0xC679,0xC67C,
+    },
+    { // 0x09C0
+        0xC680,0xC688,0xC689,0xC68B,0xC68D,0xC694,0xC695,0xC698,0xC69C,0xC6A4,0xC6A5,0xC6A7,0xC6A9,0xC6B0,0xC6B1,0xC6B4,
+        0xC6B8,0xC6B9,0xC6BA,0xC6C0,0xC6C1,0xC6C3,0xC6C5,0xC6CC,0xC6CD,0xC6D0,0xC6D4,0xC6DC,0xC6DD,0xC6E0,0xC6E1,0xC6E8,
+        0xC6E9,0xC6EC,0xC6F0,0xC6F8,0xC6F9,0xC6FD,0xC704,0xC705,0xC708,0xC70C,0xC714,0xC715,0xC717,0xC719,0xC720,0xC721,
+        0xC724,0xC728,0xC730,0xC731,0xC733,0xC735,0xC737,0xC73C,0xC73D,0xC740,0xC744,0xC74A,0xC74C,0xC74D,0xC74F,0xC751,
+    },
+    { // 0x0A00
+        0xC752,0xC753,0xC754,0xC755,0xC756,0xC757,0xC758,0xC75C,0xC760,0xC768,0xC76B,0xC774,0xC775,0xC778,0xC77C,0xC77D,
+        0xC77E,0xC783,0xC784,0xC785,0xC787,0xC788,0xC789,0xC78A,0xC78E,0xC790,0xC791,0xC794,0xC796,0xC797,0xC798,0xC79A,
+        0xC7A0,0xC7A1,0xC7A3,0xC7A4,0xC7A5,0xC7A6,0xC7AC,0xC7AD,0xC7B0,0xC7B4,0xC7BC,0xC7BD,0xC7BF,0xC7C0,0xC7C1,0xC7C8,
+        0xC7C9,0xC7CC,0xC7CE,0xC7D0,0xC7D8,0xC7DD,0xC7E4,0xC7E8,0xC7EC,0xC800,0xC801,0xC804,0xC808,0xC80A,0xC810,0xC811,
+    },
+    { // 0x0A40
+        0xC813,0xC815,0xC816,0xC81C,0xC81D,0xC820,0xC824,0xC82C,0xC82D,0xC82F,0xC831,0xC838,0xC83C,0xC840,0xC848,0xC849,
+        0xC84C,0xC84D,0xC854,0xC870,0xC871,0xC874,0xC878,0xC87A,0xC880,0xC881,0xC883,0xC885,0xC886,0xC887,0xC88B,0xC88C,
+        0xC88D,0xC894,0xC89D,0xC89F,0xC8A1,0xC8A8,0xC8BC,0xC8BD,0xC8C4,0xC8C8,0xC8CC,0xC8D4,0xC8D5,0xC8D7,0xC8D9,0xC8E0,
+        0xC8E1,0xC8E4,0xC8F5,0xC8FC,0xC8FD,0xC900,0xC904,0xC905,0xC906,0xC90C,0xC90D,0xC90F,0xC911,0xC918,0xC92C,0xC934,
+    },
+    { // 0x0A80
+        0xC950,0xC951,0xC954,0xC958,0xC960,0xC961,0xC963,0xC96C,0xC970,0xC974,0xC97C,0xC988,0xC989,0xC98C,0xC990,0xC998,
+        0xC999,0xC99B,0xC99D,0xC9C0,0xC9C1,0xC9C4,0xC9C7,0xC9C8,0xC9CA,0xC9D0,0xC9D1,0xC9D3,0xC9D5,0xC9D6,0xC9D9,0xC9DA,
+        0xC9DC,0xC9DD,0xC9E0,0xC9E2,0xC9E4,0xC9E7,0xC9EC,0xC9ED,0xC9EF,0xC9F0,0xC9F1,0xC9F8,0xC9F9,0xC9FC,0xCA00,0xCA08,
+        0xCA09,0xCA0B,0xCA0C,0xCA0D,0xCA14,0xCA18,0xCA29,0xCA4C,0xCA4D,0xCA50,0xCA54,0xCA5C,0xCA5D,0xCA5F,0xCA60,0xCA61,
+    },
+    { // 0x0AC0
+        0xCA68,0xCA7D,0xCA84,0xCA98,0xCABC,0xCABD,0xCAC0,0xCAC4,0xCACC,0xCACD,0xCACF,0xCAD1,0xCAD3,0xCAD8,0xCAD9,0xCAE0,
+        0xCAEC,0xCAF4,0xCB08,0xCB10,0xCB14,0xCB18,0xCB20,0xCB21,0xCB41,0xCB48,0xCB49,0xCB4C,0xCB50,0xCB58,0xCB59,0xCB5D,
+        0xCB64,0xCB78,0xCB79,0xCB9C,0xCBB8,0xCBD4,0xCBE4,0xCBE7,0xCBE9,0xCC0C,0xCC0D,0xCC10,0xCC14,0xCC1C,0xCC1D,0xCC21,
+        0xCC22,0xCC27,0xCC28,0xCC29,0xCC2C,0xCC2E,0xCC30,0xCC38,0xCC39,0xCC3B,0xCC3C,0xCC3D,0xCC3E,0xCC44,0xCC45,0xCC48,
+    },
+    { // 0x0B00
+        0xCC4C,0xCC54,0xCC55,0xCC57,0xCC58,0xCC59,0xCC60,0xCC64,0xCC66,0xCC68,0xCC70,0xCC75,0xCC98,0xCC99,0xCC9C,0xCCA0,
+        0xCCA8,0xCCA9,0xCCAB,0xCCAC,0xCCAD,0xCCB4,0xCCB5,0xCCB8,0xCCBC,0xCCC4,0xCCC5,0xCCC7,0xCCC9,0xCCD0,0xCCD4,0xCCE4,
+        0xCCEC,0xCCF0,0xCD01,0xCD08,0xCD09,0xCD0C,0xCD10,0xCD18,0xCD19,0xCD1B,0xCD1D,0xCD24,0xCD28,0xCD2C,0xCD39,0xCD5C,
+        0xCD60,0xCD64,0xCD6C,0xCD6D,0xCD6F,0xCD71,0xCD78,0xCD88,0xCD94,0xCD95,0xCD98,0xCD9C,0xCDA4,0xCDA5,0xCDA7,0xCDA9,
+    },
+    { // 0x0B40
+        0xCDB0,0xCDC4,0xCDCC,0xCDD0,0xCDE8,0xCDEC,0xCDF0,0xCDF8,0xCDF9,0xCDFB,0xCDFD,0xCE04,0xCE08,0xCE0C,0xCE14,0xCE19,
+        0xCE20,0xCE21,0xCE24,0xCE28,0xCE30,0xCE31,0xCE33,0xCE35,0xCE58,0xCE59,0xCE5C,0xCE5F,0xCE60,0xCE61,0xCE68,0xCE69,
+        0xCE6B,0xCE6D,0xCE74,0xCE75,0xCE78,0xCE7C,0xCE84,0xCE85,0xCE87,0xCE89,0xCE90,0xCE91,0xCE94,0xCE98,0xCEA0,0xCEA1,
+        0xCEA3,0xCEA4,0xCEA5,0xCEAC,0xCEAD,0xCEC1,0xCEE4,0xCEE5,0xCEE8,0xCEEB,0xCEEC,0xCEF4,0xCEF5,0xCEF7,0xCEF8,0xCEF9,
+    },
+    { // 0x0B80
+        0xCF00,0xCF01,0xCF04,0xCF08,0xCF10,0xCF11,0xCF13,0xCF15,0xCF1C,0xCF20,0xCF24,0xCF2C,0xCF2D,0xCF2F,0xCF30,0xCF31,
+        0xCF38,0xCF54,0xCF55,0xCF58,0xCF5C,0xCF64,0xCF65,0xCF67,0xCF69,0xCF70,0xCF71,0xCF74,0xCF78,0xCF80,0xCF85,0xCF8C,
+        0xCFA1,0xCFA8,0xCFB0,0xCFC4,0xCFE0,0xCFE1,0xCFE4,0xCFE8,0xCFF0,0xCFF1,0xCFF3,0xCFF5,0xCFFC,0xD000,0xD004,0xD011,
+        0xD018,0xD02D,0xD034,0xD035,0xD038,0xD03C,0xD044,0xD045,0xD047,0xD049,0xD050,0xD054,0xD058,0xD060,0xD06C,0xD06D,
+    },
+    { // 0x0BC0
+        0xD070,0xD074,0xD07C,0xD07D,0xD081,0xD0A4,0xD0A5,0xD0A8,0xD0AC,0xD0B4,0xD0B5,0xD0B7,0xD0B9,0xD0C0,0xD0C1,0xD0C4,
+        0xD0C8,0xD0C9,0xD0D0,0xD0D1,0xD0D3,0xD0D4,0xD0D5,0xD0DC,0xD0DD,0xD0E0,0xD0E4,0xD0EC,0xD0ED,0xD0EF,0xD0F0,0xD0F1,
+        0xD0F8,0xD10D,0xD130,0xD131,0xD134,0xD138,0xD13A,0xD140,0xD141,0xD143,0xD144,0xD145,0xD14C,0xD14D,0xD150,0xD154,
+        0xD15C,0xD15D,0xD15F,0xD161,0xD168,0xD16C,0xD17C,0xD184,0xD188,0xD1A0,0xD1A1,0xD1A4,0xD1A8,0xD1B0,0xD1B1,0xD1B3,
+    },
+    { // 0x0C00
+        0xD1B5,0xD1BA,0xD1BC,0xD1C0,0xD1D8,0xD1F4,0xD1F8,0xD207,0xD209,0xD210,0xD22C,0xD22D,0xD230,0xD234,0xD23C,0xD23D,
+        0xD23F,0xD241,0xD248,0xD25C,0xD264,0xD280,0xD281,0xD284,0xD288,0xD290,0xD291,0xD295,0xD29C,0xD2A0,0xD2A4,0xD2AC,
+        0xD2B1,0xD2B8,0xD2B9,0xD2BC,0xD2BF,0xD2C0,0xD2C2,0xD2C8,0xD2C9,0xD2CB,0xD2D4,0xD2D8,0xD2DC,0xD2E4,0xD2E5,0xD2F0,
+        0xD2F1,0xD2F4,0xD2F8,0xD300,0xD301,0xD303,0xD305,0xD30C,0xD30D,0xD30E,0xD310,0xD314,0xD316,0xD31C,0xD31D,0xD31F,
+    },
+    { // 0x0C40
+        0xD320,0xD321,0xD325,0xD328,0xD329,0xD32C,0xD330,0xD338,0xD339,0xD33B,0xD33C,0xD33D,0xD344,0xD345,0xD37C,0xD37D,
+        0xD380,0xD384,0xD38C,0xD38D,0xD38F,0xD390,0xD391,0xD398,0xD399,0xD39C,0xD3A0,0xD3A8,0xD3A9,0xD3AB,0xD3AD,0xD3B4,
+        0xD3B8,0xD3BC,0xD3C4,0xD3C5,0xD3C8,0xD3C9,0xD3D0,0xD3D8,0xD3E1,0xD3E3,0xD3EC,0xD3ED,0xD3F0,0xD3F4,0xD3FC,0xD3FD,
+        0xD3FF,0xD401,0xD408,0xD41D,0xD440,0xD444,0xD45C,0xD460,0xD464,0xD46D,0xD46F,0xD478,0xD479,0xD47C,0xD47F,0xD480,
+    },
+    { // 0x0C80
+        0xD482,0xD488,0xD489,0xD48B,0xD48D,0xD494,0xD4A9,0xD4CC,0xD4D0,0xD4D4,0xD4DC,0xD4DF,0xD4E8,0xD4EC,0xD4F0,0xD4F8,
+        0xD4FB,0xD4FD,0xD504,0xD508,0xD50C,0xD514,0xD515,0xD517,0xD53C,0xD53D,0xD540,0xD544,0xD54C,0xD54D,0xD54F,0xD551,
+        0xD558,0xD559,0xD55C,0xD560,0xD565,0xD568,0xD569,0xD56B,0xD56D,0xD574,0xD575,0xD578,0xD57C,0xD584,0xD585,0xD587,
+        0xD588,0xD589,0xD590,0xD5A5,0xD5C8,0xD5C9,0xD5CC,0xD5D0,0xD5D2,0xD5D8,0xD5D9,0xD5DB,0xD5DD,0xD5E4,0xD5E5,0xD5E8,
+    },
+    { // 0x0CC0
+        0xD5EC,0xD5F4,0xD5F5,0xD5F7,0xD5F9,0xD600,0xD601,0xD604,0xD608,0xD610,0xD611,0xD613,0xD614,0xD615,0xD61C,0xD620,
+        0xD624,0xD62D,0xD638,0xD639,0xD63C,0xD640,0xD645,0xD648,0xD649,0xD64B,0xD64D,0xD651,0xD654,0xD655,0xD658,0xD65C,
+        0xD667,0xD669,0xD670,0xD671,0xD674,0xD683,0xD685,0xD68C,0xD68D,0xD690,0xD694,0xD69D,0xD69F,0xD6A1,0xD6A8,0xD6AC,
+        0xD6B0,0xD6B9,0xD6BB,0xD6C4,0xD6C5,0xD6C8,0xD6CC,0xD6D1,0xD6D4,0xD6D7,0xD6D9,0xD6E0,0xD6E4,0xD6E8,0xD6F0,0xD6F5,
+    },
+    { // 0x0D00
+        0xD6FC,0xD6FD,0xD700,0xD704,0xD711,0xD718,0xD719,0xD71C,0xD720,0xD728,0xD729,0xD72B,0xD72D,0xD734,0xD735,0xD738,
+        0xD73C,0xD744,0xD747,0xD749,0xD750,0xD751,0xD754,0xD756,0xD757,0xD758,0xD759,0xD760,0xD761,0xD763,0xD765,0xD769,
+        0xD76C,0xD770,0xD774,0xD77C,0xD77D,0xD781,0xD788,0xD789,0xD78C,0xD790,0xD798,0xD799,0xD79B,0xD79D,0x1100,0x1101,
+        0x1102,0x1103,0x1104,0x1105,0x1106,0x1107,0x1108,0x1109,0x110A,0x110B,0x110C,0x110D,0x110E,0x110F,0x1110,0x1111,
+    },
+    { // 0x0D40
+        0x1112,0x1161,0x1162,0x1163,0x1164,0x1165,0x1166,0x1167,0x1168,0x1169,0x116D,0x116E,0x1172,0x1173,0x1175,0xB894,
+        0xC330,0xC3BC,0xC4D4,0xCB2C,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    },
 };
-static const size_t PKSAV_GEN4_CHAR_MAP1_SIZE = sizeof(PKSAV_GEN4_CHAR_MAP1)/sizeof(wchar_t);
 
-static const wchar_t PKSAV_GEN4_CHAR_MAP2[] =
+static const uint8_t PKSAV_GEN4_CHAR_PAGE_INDICES[] =
 {
-    0xAC00,0xAC01,0xAC04,0xAC07,0xAC08,0xAC09,0xAC0A,0xAC10,0xAC11,0xAC12,0xAC13,0xAC14,0xAC15,0xAC16,0xAC17,0xAC19,
-    0xAC1A,0xAC1B,0xAC1C,0xAC1D,0xAC20,0xAC24,0xAC2C,0xAC2D,0xAC2F,0xAC30,0xAC31,0xAC38,0xAC39,0xAC3C,0xAC40,0xAC4B,
-    0xAC4D,0xAC54,0xAC58,0xAC5C,0xAC70,0xAC71,0xAC74,0xAC77,0xAC78,0xAC7A,0xAC80,0xAC81,0xAC83,0xAC84,0xAC85,0xAC86,
-    0xAC89,0xAC8A,0xAC8B,0xAC8C,0xAC90,0xAC94,0xAC9C,0xAC9D,0xAC9F,0xACA0,0xACA1,0xACA8,0xACA9,0xACAA,0xACAC,0xACAF,
-    0xACB0,0xACB8,0xACB9,0xACBB,0xACBC,0xACBD,0xACC1,0xACC4,0xACC8,0xACCC,0xACD5,0xACD7,0xACE0,0xACE1,0xACE4,0xACE7,
-    0xACE8,0xACEA,0xACEC,0xACEF,0xACF0,0xACF1,0xACF3,0xACF5,0xACF6,0xACFC,0xACFD,0xAD00,0xAD04,0xAD06,0xAD0C,0xAD0D,
-    0xAD0F,0xAD11,0xAD18,0xAD1C,0xAD20,0xAD29,0xAD2C,0xAD2D,0xAD34,0xAD35,0xAD38,0xAD3C,0xAD44,0xAD45,0xAD47,0xAD49,
-    0xAD50,0xAD54,0xAD58,0xAD61,0xAD63,0xAD6C,0xAD6D,0xAD70,0xAD73,0xAD74,0xAD75,0xAD76,0xAD7B,0xAD7C,0xAD7D,0xAD7F,
-    0xAD81,0xAD82,0xAD88,0xAD89,0xAD8C,0xAD90,0xAD9C,0xAD9D,0xADA4,0xADB7,0xADC0,0xADC1,0xADC4,0xADC8,0xADD0,0xADD1,
-    0xADD3,0xADDC,0xADE0,0xADE4,0xADF8,0xADF9,0xADFC,0xADFF,0xAE00,0xAE01,0xAE08,0xAE09,0xAE0B,0xAE0D,0xAE14,0xAE30,
-    0xAE31,0xAE34,0xAE37,0xAE38,0xAE3A,0xAE40,0xAE41,0xAE43,0xAE45,0xAE46,0xAE4A,0xAE4C,0xAE4D,0xAE4E,0xAE50,0xAE54,
-    0xAE56,0xAE5C,0xAE5D,0xAE5F,0xAE60,0xAE61,0xAE65,0xAE68,0xAE69,0xAE6C,0xAE70,0xAE78,0xAE79,0xAE7B,0xAE7C,0xAE7D,
-    0xAE84,0xAE85,0xAE8C,0xAEBC,0xAEBD,0xAEBE,0xAEC0,0xAEC4,0xAECC,0xAECD,0xAECF,0xAED0,0xAED1,0xAED8,0xAED9,0xAEDC,
-    0xAEE8,0xAEEB,0xAEED,0xAEF4,0xAEF8,0xAEFC,0xAF07,0xAF08,0xAF0D,0xAF10,0xAF2C,0xAF2D,0xAF30,0xAF32,0xAF34,0xAF3C,
-    0xAF3D,0xAF3F,0xAF41,0xAF42,0xAF43,0xAF48,0xAF49,0xAF50,0xAF5C,0xAF5D,0xAF64,0xAF65,0xAF79,0xAF80,0xAF84,0xAF88,
-    0xAF90,0xAF91,0xAF95,0xAF9C,0xAFB8,0xAFB9,0xAFBC,0xAFC0,0xAFC7,0xAFC8,0xAFC9,0xAFCB,0xAFCD,0xAFCE,0xAFD4,0xAFDC,
-    0xAFE8,0xAFE9,0xAFF0,0xAFF1,0xAFF4,0xAFF8,0xB000,0xB001,0xB004,0xB00C,0xB010,0xB014,0xB01C,0xB01D,0xB028,0xB044,
-    0xB045,0xB048,0xB04A,0xB04C,0xB04E,0xB053,0xB054,0xB055,0xB057,0xB059,0xB05D,0xB07C,0xB07D,0xB080,0xB084,0xB08C,
-    0xB08D,0xB08F,0xB091,0xB098,0xB099,0xB09A,0xB09C,0xB09F,0xB0A0,0xB0A1,0xB0A2,0xB0A8,0xB0A9,0xB0AB,0xB0AC,0xB0AD,
-    0xB0AE,0xB0AF,0xB0B1,0xB0B3,0xB0B4,0xB0B5,0xB0B8,0xB0BC,0xB0C4,0xB0C5,0xB0C7,0xB0C8,0xB0C9,0xB0D0,0xB0D1,0xB0D4,
-    0xB0D8,0xB0E0,0xB0E5,0xB108,0xB109,0xB10B,0xB10C,0xB110,0xB112,0xB113,0xB118,0xB119,0xB11B,0xB11C,0xB11D,0xB123,
-    0xB124,0xB125,0xB128,0xB12C,0xB134,0xB135,0xB137,0xB138,0xB139,0xB140,0xB141,0xB144,0xB148,0xB150,0xB151,0xB154,
-    0xB155,0xB158,0xB15C,0xB160,0xB178,0xB179,0xB17C,0xB180,0xB182,0xB188,0xB189,0xB18B,0xB18D,0xB192,0xB193,0xB194,
-    0xB198,0xB19C,0xB1A8,0xB1CC,0xB1D0,0xB1D4,0xB1DC,0xB1DD,0xB1DF,0xB1E8,0xB1E9,0xB1EC,0xB1F0,0xB1F9,0xB1FB,0xB1FD,
-    0xB204,0xB205,0xB208,0xB20B,0xB20C,0xB214,0xB215,0xB217,0xB219,0xB220,0xB234,0xB23C,0xB258,0xB25C,0xB260,0xB268,
-    0xB269,0xB274,0xB275,0xB27C,0xB284,0xB285,0xB289,0xB290,0xB291,0xB294,0xB298,0xB299,0xB29A,0xB2A0,0xB2A1,0xB2A3,
-    0xB2A5,0xB2A6,0xB2AA,0xB2AC,0xB2B0,0xB2B4,0xB2C8,0xB2C9,0xB2CC,0xB2D0,0xB2D2,0xB2D8,0xB2D9,0xB2DB,0xB2DD,0xB2E2,
-    0xB2E4,0xB2E5,0xB2E6,0xB2E8,0xB2EB,0xB2EC,0xB2ED,0xB2EE,0xB2EF,0xB2F3,0xB2F4,0xB2F5,0xB2F7,0xB2F8,0xB2F9,0xB2FA,
-    0xB2FB,0xB2FF,0xB300,0xB301,0xB304,0xB308,0xB310,0xB311,0xB313,0xB314,0xB315,0xB31C,0xB354,0xB355,0xB356,0xB358,
-    0xB35B,0xB35C,0xB35E,0xB35F,0xB364,0xB365,0xB367,0xB369,0xB36B,0xB36E,0xB370,0xB371,0xB374,0xB378,0xB380,0xB381,
-    0xB383,0xB384,0xB385,0xB38C,0xB390,0xB394,0xB3A0,0xB3A1,0xB3A8,0xB3AC,0xB3C4,0xB3C5,0xB3C8,0xB3CB,0xB3CC,0xB3CE,
-    0xB3D0,0xB3D4,0xB3D5,0xB3D7,0xB3D9,0xB3DB,0xB3DD,0xB3E0,0xB3E4,0xB3E8,0xB3FC,0xB410,0xB418,0xB41C,0xB420,0xB428,
-    0xB429,0xB42B,0xB434,0xB450,0xB451,0xB454,0xB458,0xB460,0xB461,0xB463,0xB465,0xB46C,0xB480,0xB488,0xB49D,0xB4A4,
-    0xB4A8,0xB4AC,0xB4B5,0xB4B7,0xB4B9,0xB4C0,0xB4C4,0xB4C8,0xB4D0,0xB4D5,0xB4DC,0xB4DD,0xB4E0,0xB4E3,0xB4E4,0xB4E6,
-    0xB4EC,0xB4ED,0xB4EF,0xB4F1,0xB4F8,0xB514,0xB515,0xB518,0xB51B,0xB51C,0xB524,0xB525,0xB527,0xB528,0xB529,0xB52A,
-    0xB530,0xB531,0xB534,0xB538,0xB540,0xB541,0xB543,0xB544,0xB545,0xB54B,0xB54C,0xB54D,0xB550,0xB554,0xB55C,0xB55D,
-    0xB55F,0xB560,0xB561,0xB5A0,0xB5A1,0xB5A4,0xB5A8,0xB5AA,0xB5AB,0xB5B0,0xB5B1,0xB5B3,0xB5B4,0xB5B5,0xB5BB,0xB5BC,
-    0xB5BD,0xB5C0,0xB5C4,0xB5CC,0xB5CD,0xB5CF,0xB5D0,0xB5D1,0xB5D8,0xB5EC,0xB610,0xB611,0xB614,0xB618,0xB625,0xB62C,
-    0xB634,0xB648,0xB664,0xB668,0xB69C,0xB69D,0xB6A0,0xB6A4,0xB6AB,0xB6AC,0xB6B1,0xB6D4,0xB6F0,0xB6F4,0xB6F8,0xB700,
-    0xB701,0xB705,0xB728,0xB729,0xB72C,0xB72F,0xB730,0xB738,0xB739,0xB73B,0xB744,0xB748,0xB74C,0xB754,0xB755,0xB760,
-    0xB764,0xB768,0xB770,0xB771,0xB773,0xB775,0xB77C,0xB77D,0xB780,0xB784,0xB78C,0xB78D,0xB78F,0xB790,0xB791,0xB792,
-    0xB796,0xB797,0xB798,0xB799,0xB79C,0xB7A0,0xB7A8,0xB7A9,0xB7AB,0xB7AC,0xB7AD,0xB7B4,0xB7B5,0xB7B8,0xB7C7,0xB7C9,
-    0xB7EC,0xB7ED,0xB7F0,0xB7F4,0xB7FC,0xB7FD,0xB7FF,0xB800,0xB801,0xB807,0xB808,0xB809,0xB80C,0xB810,0xB818,0xB819,
-    0xB81B,0xB81D,0xB824,0xB825,0xB828,0xB82C,0xB834,0xB835,0xB837,0xB838,0xB839,0xB840,0xB844,0xB851,0xB853,0xB85C,
-    0xB85D,0xB860,0xB864,0xB86C,0xB86D,0xB86F,0xB871,0xB878,0xB87C,0xB88D,0xB8A8,0xB8B0,0xB8B4,0xB8B8,0xB8C0,0xB8C1,
-    0xB8C3,0xB8C5,0xB8CC,0xB8D0,0xB8D4,0xB8DD,0xB8DF,0xB8E1,0xB8E8,0xB8E9,0xB8EC,0xB8F0,0xB8F8,0xB8F9,0xB8FB,0xB8FD,
-    0xB904,0xB918,0xB920,0xB93C,0xB93D,0xB940,0xB944,0xB94C,0xB94F,0xB951,0xB958,0xB959,0xB95C,0xB960,0xB968,0xB969,
-    0xB96B,0xB96D,0xB974,0xB975,0xB978,0xB97C,0xB984,0xB985,0xB987,0xB989,0xB98A,0xB98D,0xB98E,0xB9AC,0xB9AD,0xB9B0,
-    0xB9B4,0xB9BC,0xB9BD,0xB9BF,0xB9C1,0xB9C8,0xB9C9,0xB9CC,0xB9CE,0xB9CF,0xB9D0,0xB9D1,0xB9D2,0xB9D8,0xB9D9,0xB9DB,
-    0xB9DD,0xB9DE,0xB9E1,0xB9E3,0xB9E4,0xB9E5,0xB9E8,0xB9EC,0xB9F4,0xB9F5,0xB9F7,0xB9F8,0xB9F9,0xB9FA,0xBA00,0xBA01,
-    0xBA08,0xBA15,0xBA38,0xBA39,0xBA3C,0xBA40,0xBA42,0xBA48,0xBA49,0xBA4B,0xBA4D,0xBA4E,0xBA53,0xBA54,0xBA55,0xBA58,
-    0xBA5C,0xBA64,0xBA65,0xBA67,0xBA68,0xBA69,0xBA70,0xBA71,0xBA74,0xBA78,0xBA83,0xBA84,0xBA85,0xBA87,0xBA8C,0xBAA8,
-    0xBAA9,0xBAAB,0xBAAC,0xBAB0,0xBAB2,0xBAB8,0xBAB9,0xBABB,0xBABD,0xBAC4,0xBAC8,0xBAD8,0xBAD9,0xBAFC,0xBB00,0xBB04,
-    0xBB0D,0xBB0F,0xBB11,0xBB18,0xBB1C,0xBB20,0xBB29,0xBB2B,0xBB34,0xBB35,0xBB36,0xBB38,0xBB3B,0xBB3C,0xBB3D,0xBB3E,
-    0xBB44,0xBB45,0xBB47,0xBB49,0xBB4D,0xBB4F,0xBB50,0xBB54,0xBB58,0xBB61,0xBB63,0xBB6C,0xBB88,0xBB8C,0xBB90,0xBBA4,
-    0xBBA8,0xBBAC,0xBBB4,0xBBB7,0xBBC0,0xBBC4,0xBBC8,0xBBD0,0xBBD3,0xBBF8,0xBBF9,0xBBFC,0xBBFF,0xBC00,0xBC02,0xBC08,
-    0xBC09,0xBC0B,0xBC0C,0xBC0D,0xBC0F,0xBC11,0xBC14,0xBC15,0xBC16,0xBC17,0xBC18,0xBC1B,0xBC1C,0xBC1D,0xBC1E,0xBC1F,
-    0xBC24,0xBC25,0xBC27,0xBC29,0xBC2D,0xBC30,0xBC31,0xBC34,0xBC38,0xBC40,0xBC41,0xBC43,0xBC44,0xBC45,0xBC49,0xBC4C,
-    0xBC4D,0xBC50,0xBC5D,0xBC84,0xBC85,0xBC88,0xBC8B,0xBC8C,0xBC8E,0xBC94,0xBC95,0xBC97,0xBC99,0xBC9A,0xBCA0,0xBCA1,
-    0xBCA4,0xBCA7,0xBCA8,0xBCB0,0xBCB1,0xBCB3,0xBCB4,0xBCB5,0xBCBC,0xBCBD,0xBCC0,0xBCC4,0xBCCD,0xBCCF,0xBCD0,0xBCD1,
-    0xBCD5,0xBCD8,0xBCDC,0xBCF4,0xBCF5,0xBCF6,0xBCF8,0xBCFC,0xBD04,0xBD05,0xBD07,0xBD09,0xBD10,0xBD14,0xBD24,0xBD2C,
-    0xBD40,0xBD48,0xBD49,0xBD4C,0xBD50,0xBD58,0xBD59,0xBD64,0xBD68,0xBD80,0xBD81,0xBD84,0xBD87,0xBD88,0xBD89,0xBD8A,
-    0xBD90,0xBD91,0xBD93,0xBD95,0xBD99,0xBD9A,0xBD9C,0xBDA4,0xBDB0,0xBDB8,0xBDD4,0xBDD5,0xBDD8,0xBDDC,0xBDE9,0xBDF0,
-    0xBDF4,0xBDF8,0xBE00,0xBE03,0xBE05,0xBE0C,0xBE0D,0xBE10,0xBE14,0xBE1C,0xBE1D,0xBE1F,0xBE44,0xBE45,0xBE48,0xBE4C,
-    0xBE4E,0xBE54,0xBE55,0xBE57,0xBE59,0xBE5A,0xBE5B,0xBE60,0xBE61,0xBE64,0xBE68,0xBE6A,0xBE70,0xBE71,0xBE73,0xBE74,
-    0xBE75,0xBE7B,0xBE7C,0xBE7D,0xBE80,0xBE84,0xBE8C,0xBE8D,0xBE8F,0xBE90,0xBE91,0xBE98,0xBE99,0xBEA8,0xBED0,0xBED1,
-    0xBED4,0xBED7,0xBED8,0xBEE0,0xBEE3,0xBEE4,0xBEE5,0xBEEC,0xBF01,0xBF08,0xBF09,0xBF18,0xBF19,0xBF1B,0xBF1C,0xBF1D,
-    0xBF40,0xBF41,0xBF44,0xBF48,0xBF50,0xBF51,0xBF55,0xBF94,0xBFB0,0xBFC5,0xBFCC,0xBFCD,0xBFD0,0xBFD4,0xBFDC,0xBFDF,
-    0xBFE1,0xC03C,0xC051,0xC058,0xC05C,0xC060,0xC068,0xC069,0xC090,0xC091,0xC094,0xC098,0xC0A0,0xC0A1,0xC0A3,0xC0A5,
-    0xC0AC,0xC0AD,0xC0AF,0xC0B0,0xC0B3,0xC0B4,0xC0B5,0xC0B6,0xC0BC,0xC0BD,0xC0BF,0xC0C0,0xC0C1,0xC0C5,0xC0C8,0xC0C9,
-    0xC0CC,0xC0D0,0xC0D8,0xC0D9,0xC0DB,0xC0DC,0xC0DD,0xC0E4,0xC0E5,0xC0E8,0xC0EC,0xC0F4,0xC0F5,0xC0F7,0xC0F9,0xC100,
-    0xC104,0xC108,0xC110,0xC115,0xC11C,0xC11D,0xC11E,0xC11F,0xC120,0xC123,0xC124,0xC126,0xC127,0xC12C,0xC12D,0xC12F,
-    0xC130,0xC131,0xC136,0xC138,0xC139,0xC13C,0xC140,0xC148,0xC149,0xC14B,0xC14C,0xC14D,0xC154,0xC155,0xC158,0xC15C,
-    0xC164,0xC165,0xC167,0xC168,0xC169,0xC170,0xC174,0xC178,0xC185,0xC18C,0xC18D,0xC18E,0xC190,0xC194,0xC196,0xC19C,
-    0xC19D,0xC19F,0xC1A1,0xC1A5,0xC1A8,0xC1A9,0xC1AC,0xC1B0,0xC1BD,0xC1C4,0xC1C8,0xC1CC,0xC1D4,0xC1D7,0xC1D8,0xC1E0,
-    0xC1E4,0xC1E8,0xC1F0,0xC1F1,0xC1F3,0xC1FC,0xC1FD,0xC200,0xC204,0xC20C,0xC20D,0xC20F,0xC211,0xC218,0xC219,0xC21C,
-    0xC21F,0xC220,0xC228,0xC229,0xC22B,0xC22D,0xC22F,0xC231,0xC232,0xC234,0xC248,0xC250,0xC251,0xC254,0xC258,0xC260,
-    0xC265,0xC26C,0xC26D,0xC270,0xC274,0xC27C,0xC27D,0xC27F,0xC281,0xC288,0xC289,0xC290,0xC298,0xC29B,0xC29D,0xC2A4,
-    0xC2A5,0xC2A8,0xC2AC,0xC2AD,0xC2B4,0xC2B5,0xC2B7,0xC2B9,0xC2DC,0xC2DD,0xC2E0,0xC2E3,0xC2E4,0xC2EB,0xC2EC,0xC2ED,
-    0xC2EF,0xC2F1,0xC2F6,0xC2F8,0xC2F9,0xC2FB,0xC2FC,0xC300,0xC308,0xC309,0xC30C,0xC30D,0xC313,0xC314,0xC315,0xC318,
-    0xC31C,0xC324,0xC325,0xC328,0xC329,0xC345,0xC368,0xC369,0xC36C,0xC370,0xC372,0xC378,0xC379,0xC37C,0xC37D,0xC384,
-    0xC388,0xC38C,0xC3C0,0xC3D8,0xC3D9,0xC3DC,0xC3DF,0xC3E0,0xC3E2,0xC3E8,0xC3E9,0xC3ED,0xC3F4,0xC3F5,0xC3F8,0xC408,
-    0xC410,0xC424,0xC42C,0xC430,0xC434,0xC43C,0xC43D,0xC448,0xC464,0xC465,0xC468,0xC46C,0xC474,0xC475,0xC479,0xC480,
-    0xC494,0xC49C,0xC4B8,0xC4BC,0xC4E9,0xC4F0,0xC4F1,0xC4F4,0xC4F8,0xC4FA,0xC4FF,0xC500,0xC501,0xC50C,0xC510,0xC514,
-    0xC51C,0xC528,0xC529,0xC52C,0xC530,0xC538,0xC539,0xC53B,0xC53D,0xC544,0xC545,0xC548,0xC549,0xC54A,0xC54C,0xC54D,
-    0xC54E,0xC553,0xC554,0xC555,0xC557,0xC558,0xC559,0xC55D,0xC55E,0xC560,0xC561,0xC564,0xC568,0xC570,0xC571,0xC573,
-    0xC574,0xC575,0xC57C,0xC57D,0xC580,0xC584,0xC587,0xC58C,0xC58D,0xC58F,0xC591,0xC595,0xC597,0xC598,0xC59C,0xC5A0,
-    0xC5A9,0xC5B4,0xC5B5,0xC5B8,0xC5B9,0xC5BB,0xC5BC,0xC5BD,0xC5BE,0xC5C4,0xC5C5,0xC5C6,0xC5C7,0xC5C8,0xC5C9,0xC5CA,
-    0xC5CC,0xC5CE,0xC5D0,0xC5D1,0xC5D4,0xC5D8,0xC5E0,0xC5E1,0xC5E3,0xC5E5,0xC5EC,0xC5ED,0xC5EE,0xC5F0,0xC5F4,0xC5F6,
-    0xC5F7,0xC5FC,0xC5FD,0xC5FE,0xC5FF,0xC600,0xC601,0xC605,0xC606,0xC607,0xC608,0xC60C,0xC610,0xC618,0xC619,0xC61B,
-    0xC61C,0xC624,0xC625,0xC628,0xC62C,0xC62D,0xC62E,0xC630,0xC633,0xC634,0xC635,0xC637,0xC639,0xC63B,0xC640,0xC641,
-    0xC644,0xC648,0xC650,0xC651,0xC653,0xC654,0xC655,0xC65C,0xC65D,0xC660,0xC66C,0xC66F,0xC671,0xC678,0xC679,0xC67C,
-    0xC680,0xC688,0xC689,0xC68B,0xC68D,0xC694,0xC695,0xC698,0xC69C,0xC6A4,0xC6A5,0xC6A7,0xC6A9,0xC6B0,0xC6B1,0xC6B4,
-    0xC6B8,0xC6B9,0xC6BA,0xC6C0,0xC6C1,0xC6C3,0xC6C5,0xC6CC,0xC6CD,0xC6D0,0xC6D4,0xC6DC,0xC6DD,0xC6E0,0xC6E1,0xC6E8,
-    0xC6E9,0xC6EC,0xC6F0,0xC6F8,0xC6F9,0xC6FD,0xC704,0xC705,0xC708,0xC70C,0xC714,0xC715,0xC717,0xC719,0xC720,0xC721,
-    0xC724,0xC728,0xC730,0xC731,0xC733,0xC735,0xC737,0xC73C,0xC73D,0xC740,0xC744,0xC74A,0xC74C,0xC74D,0xC74F,0xC751,
-    0xC752,0xC753,0xC754,0xC755,0xC756,0xC757,0xC758,0xC75C,0xC760,0xC768,0xC76B,0xC774,0xC775,0xC778,0xC77C,0xC77D,
-    0xC77E,0xC783,0xC784,0xC785,0xC787,0xC788,0xC789,0xC78A,0xC78E,0xC790,0xC791,0xC794,0xC796,0xC797,0xC798,0xC79A,
-    0xC7A0,0xC7A1,0xC7A3,0xC7A4,0xC7A5,0xC7A6,0xC7AC,0xC7AD,0xC7B0,0xC7B4,0xC7BC,0xC7BD,0xC7BF,0xC7C0,0xC7C1,0xC7C8,
-    0xC7C9,0xC7CC,0xC7CE,0xC7D0,0xC7D8,0xC7DD,0xC7E4,0xC7E8,0xC7EC,0xC800,0xC801,0xC804,0xC808,0xC80A,0xC810,0xC811,
-    0xC813,0xC815,0xC816,0xC81C,0xC81D,0xC820,0xC824,0xC82C,0xC82D,0xC82F,0xC831,0xC838,0xC83C,0xC840,0xC848,0xC849,
-    0xC84C,0xC84D,0xC854,0xC870,0xC871,0xC874,0xC878,0xC87A,0xC880,0xC881,0xC883,0xC885,0xC886,0xC887,0xC88B,0xC88C,
-    0xC88D,0xC894,0xC89D,0xC89F,0xC8A1,0xC8A8,0xC8BC,0xC8BD,0xC8C4,0xC8C8,0xC8CC,0xC8D4,0xC8D5,0xC8D7,0xC8D9,0xC8E0,
-    0xC8E1,0xC8E4,0xC8F5,0xC8FC,0xC8FD,0xC900,0xC904,0xC905,0xC906,0xC90C,0xC90D,0xC90F,0xC911,0xC918,0xC92C,0xC934,
-    0xC950,0xC951,0xC954,0xC958,0xC960,0xC961,0xC963,0xC96C,0xC970,0xC974,0xC97C,0xC988,0xC989,0xC98C,0xC990,0xC998,
-    0xC999,0xC99B,0xC99D,0xC9C0,0xC9C1,0xC9C4,0xC9C7,0xC9C8,0xC9CA,0xC9D0,0xC9D1,0xC9D3,0xC9D5,0xC9D6,0xC9D9,0xC9DA,
-    0xC9DC,0xC9DD,0xC9E0,0xC9E2,0xC9E4,0xC9E7,0xC9EC,0xC9ED,0xC9EF,0xC9F0,0xC9F1,0xC9F8,0xC9F9,0xC9FC,0xCA00,0xCA08,
-    0xCA09,0xCA0B,0xCA0C,0xCA0D,0xCA14,0xCA18,0xCA29,0xCA4C,0xCA4D,0xCA50,0xCA54,0xCA5C,0xCA5D,0xCA5F,0xCA60,0xCA61,
-    0xCA68,0xCA7D,0xCA84,0xCA98,0xCABC,0xCABD,0xCAC0,0xCAC4,0xCACC,0xCACD,0xCACF,0xCAD1,0xCAD3,0xCAD8,0xCAD9,0xCAE0,
-    0xCAEC,0xCAF4,0xCB08,0xCB10,0xCB14,0xCB18,0xCB20,0xCB21,0xCB41,0xCB48,0xCB49,0xCB4C,0xCB50,0xCB58,0xCB59,0xCB5D,
-    0xCB64,0xCB78,0xCB79,0xCB9C,0xCBB8,0xCBD4,0xCBE4,0xCBE7,0xCBE9,0xCC0C,0xCC0D,0xCC10,0xCC14,0xCC1C,0xCC1D,0xCC21,
-    0xCC22,0xCC27,0xCC28,0xCC29,0xCC2C,0xCC2E,0xCC30,0xCC38,0xCC39,0xCC3B,0xCC3C,0xCC3D,0xCC3E,0xCC44,0xCC45,0xCC48,
-    0xCC4C,0xCC54,0xCC55,0xCC57,0xCC58,0xCC59,0xCC60,0xCC64,0xCC66,0xCC68,0xCC70,0xCC75,0xCC98,0xCC99,0xCC9C,0xCCA0,
-    0xCCA8,0xCCA9,0xCCAB,0xCCAC,0xCCAD,0xCCB4,0xCCB5,0xCCB8,0xCCBC,0xCCC4,0xCCC5,0xCCC7,0xCCC9,0xCCD0,0xCCD4,0xCCE4,
-    0xCCEC,0xCCF0,0xCD01,0xCD08,0xCD09,0xCD0C,0xCD10,0xCD18,0xCD19,0xCD1B,0xCD1D,0xCD24,0xCD28,0xCD2C,0xCD39,0xCD5C,
-    0xCD60,0xCD64,0xCD6C,0xCD6D,0xCD6F,0xCD71,0xCD78,0xCD88,0xCD94,0xCD95,0xCD98,0xCD9C,0xCDA4,0xCDA5,0xCDA7,0xCDA9,
-    0xCDB0,0xCDC4,0xCDCC,0xCDD0,0xCDE8,0xCDEC,0xCDF0,0xCDF8,0xCDF9,0xCDFB,0xCDFD,0xCE04,0xCE08,0xCE0C,0xCE14,0xCE19,
-    0xCE20,0xCE21,0xCE24,0xCE28,0xCE30,0xCE31,0xCE33,0xCE35,0xCE58,0xCE59,0xCE5C,0xCE5F,0xCE60,0xCE61,0xCE68,0xCE69,
-    0xCE6B,0xCE6D,0xCE74,0xCE75,0xCE78,0xCE7C,0xCE84,0xCE85,0xCE87,0xCE89,0xCE90,0xCE91,0xCE94,0xCE98,0xCEA0,0xCEA1,
-    0xCEA3,0xCEA4,0xCEA5,0xCEAC,0xCEAD,0xCEC1,0xCEE4,0xCEE5,0xCEE8,0xCEEB,0xCEEC,0xCEF4,0xCEF5,0xCEF7,0xCEF8,0xCEF9,
-    0xCF00,0xCF01,0xCF04,0xCF08,0xCF10,0xCF11,0xCF13,0xCF15,0xCF1C,0xCF20,0xCF24,0xCF2C,0xCF2D,0xCF2F,0xCF30,0xCF31,
-    0xCF38,0xCF54,0xCF55,0xCF58,0xCF5C,0xCF64,0xCF65,0xCF67,0xCF69,0xCF70,0xCF71,0xCF74,0xCF78,0xCF80,0xCF85,0xCF8C,
-    0xCFA1,0xCFA8,0xCFB0,0xCFC4,0xCFE0,0xCFE1,0xCFE4,0xCFE8,0xCFF0,0xCFF1,0xCFF3,0xCFF5,0xCFFC,0xD000,0xD004,0xD011,
-    0xD018,0xD02D,0xD034,0xD035,0xD038,0xD03C,0xD044,0xD045,0xD047,0xD049,0xD050,0xD054,0xD058,0xD060,0xD06C,0xD06D,
-    0xD070,0xD074,0xD07C,0xD07D,0xD081,0xD0A4,0xD0A5,0xD0A8,0xD0AC,0xD0B4,0xD0B5,0xD0B7,0xD0B9,0xD0C0,0xD0C1,0xD0C4,
-    0xD0C8,0xD0C9,0xD0D0,0xD0D1,0xD0D3,0xD0D4,0xD0D5,0xD0DC,0xD0DD,0xD0E0,0xD0E4,0xD0EC,0xD0ED,0xD0EF,0xD0F0,0xD0F1,
-    0xD0F8,0xD10D,0xD130,0xD131,0xD134,0xD138,0xD13A,0xD140,0xD141,0xD143,0xD144,0xD145,0xD14C,0xD14D,0xD150,0xD154,
-    0xD15C,0xD15D,0xD15F,0xD161,0xD168,0xD16C,0xD17C,0xD184,0xD188,0xD1A0,0xD1A1,0xD1A4,0xD1A8,0xD1B0,0xD1B1,0xD1B3,
-    0xD1B5,0xD1BA,0xD1BC,0xD1C0,0xD1D8,0xD1F4,0xD1F8,0xD207,0xD209,0xD210,0xD22C,0xD22D,0xD230,0xD234,0xD23C,0xD23D,
-    0xD23F,0xD241,0xD248,0xD25C,0xD264,0xD280,0xD281,0xD284,0xD288,0xD290,0xD291,0xD295,0xD29C,0xD2A0,0xD2A4,0xD2AC,
-    0xD2B1,0xD2B8,0xD2B9,0xD2BC,0xD2BF,0xD2C0,0xD2C2,0xD2C8,0xD2C9,0xD2CB,0xD2D4,0xD2D8,0xD2DC,0xD2E4,0xD2E5,0xD2F0,
-    0xD2F1,0xD2F4,0xD2F8,0xD300,0xD301,0xD303,0xD305,0xD30C,0xD30D,0xD30E,0xD310,0xD314,0xD316,0xD31C,0xD31D,0xD31F,
-    0xD320,0xD321,0xD325,0xD328,0xD329,0xD32C,0xD330,0xD338,0xD339,0xD33B,0xD33C,0xD33D,0xD344,0xD345,0xD37C,0xD37D,
-    0xD380,0xD384,0xD38C,0xD38D,0xD38F,0xD390,0xD391,0xD398,0xD399,0xD39C,0xD3A0,0xD3A8,0xD3A9,0xD3AB,0xD3AD,0xD3B4,
-    0xD3B8,0xD3BC,0xD3C4,0xD3C5,0xD3C8,0xD3C9,0xD3D0,0xD3D8,0xD3E1,0xD3E3,0xD3EC,0xD3ED,0xD3F0,0xD3F4,0xD3FC,0xD3FD,
-    0xD3FF,0xD401,0xD408,0xD41D,0xD440,0xD444,0xD45C,0xD460,0xD464,0xD46D,0xD46F,0xD478,0xD479,0xD47C,0xD47F,0xD480,
-    0xD482,0xD488,0xD489,0xD48B,0xD48D,0xD494,0xD4A9,0xD4CC,0xD4D0,0xD4D4,0xD4DC,0xD4DF,0xD4E8,0xD4EC,0xD4F0,0xD4F8,
-    0xD4FB,0xD4FD,0xD504,0xD508,0xD50C,0xD514,0xD515,0xD517,0xD53C,0xD53D,0xD540,0xD544,0xD54C,0xD54D,0xD54F,0xD551,
-    0xD558,0xD559,0xD55C,0xD560,0xD565,0xD568,0xD569,0xD56B,0xD56D,0xD574,0xD575,0xD578,0xD57C,0xD584,0xD585,0xD587,
-    0xD588,0xD589,0xD590,0xD5A5,0xD5C8,0xD5C9,0xD5CC,0xD5D0,0xD5D2,0xD5D8,0xD5D9,0xD5DB,0xD5DD,0xD5E4,0xD5E5,0xD5E8,
-    0xD5EC,0xD5F4,0xD5F5,0xD5F7,0xD5F9,0xD600,0xD601,0xD604,0xD608,0xD610,0xD611,0xD613,0xD614,0xD615,0xD61C,0xD620,
-    0xD624,0xD62D,0xD638,0xD639,0xD63C,0xD640,0xD645,0xD648,0xD649,0xD64B,0xD64D,0xD651,0xD654,0xD655,0xD658,0xD65C,
-    0xD667,0xD669,0xD670,0xD671,0xD674,0xD683,0xD685,0xD68C,0xD68D,0xD690,0xD694,0xD69D,0xD69F,0xD6A1,0xD6A8,0xD6AC,
-    0xD6B0,0xD6B9,0xD6BB,0xD6C4,0xD6C5,0xD6C8,0xD6CC,0xD6D1,0xD6D4,0xD6D7,0xD6D9,0xD6E0,0xD6E4,0xD6E8,0xD6F0,0xD6F5,
-    0xD6FC,0xD6FD,0xD700,0xD704,0xD711,0xD718,0xD719,0xD71C,0xD720,0xD728,0xD729,0xD72B,0xD72D,0xD734,0xD735,0xD738,
-    0xD73C,0xD744,0xD747,0xD749,0xD750,0xD751,0xD754,0xD756,0xD757,0xD758,0xD759,0xD760,0xD761,0xD763,0xD765,0xD769,
-    0xD76C,0xD770,0xD774,0xD77C,0xD77D,0xD781,0xD788,0xD789,0xD78C,0xD790,0xD798,0xD799,0xD79B,0xD79D,0x1100,0x1101,
-    0x1102,0x1103,0x1104,0x1105,0x1106,0x1107,0x1108,0x1109,0x110A,0x110B,0x110C,0x110D,0x110E,0x110F,0x1110,0x1111,
-    0x1112,0x1161,0x1162,0x1163,0x1164,0x1165,0x1166,0x1167,0x1168,0x1169,0x116D,0x116E,0x1172,0x1173,0x1175,0xB894,
-    0xC330,0xC3BC,0xC4D4,0xCB2C,
+    1,2,3,4,5,6,7,8,0,0,0,0,0,0,0,0,
+    9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,
+    25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,
+    41,42,43,44,45,46,
 };
-static const size_t PKSAV_GEN4_CHAR_MAP2_SIZE = sizeof(PKSAV_GEN4_CHAR_MAP2)/sizeof(wchar_t);
 
-static enum pksav_error _pksav_gen4_import_widetext(
-    const uint16_t* p_input_buffer,
-    wchar_t* p_output_widetext,
-    size_t num_chars
-)
+static const struct pksav_text_page_table PKSAV_GEN4_CHAR_MAP =
 {
-    assert(p_input_buffer != NULL);
-    assert(p_output_widetext != NULL);
-
-    memset(p_output_widetext, 0, sizeof(wchar_t)*num_chars);
+    .p_pages = PKSAV_GEN4_CHAR_PAGES,
+    .p_page_indices = PKSAV_GEN4_CHAR_PAGE_INDICES,
+    .num_page_indices = sizeof(PKSAV_GEN4_CHAR_PAGE_INDICES)
+};
 
-    for(size_t char_index = 0; char_index < num_chars; ++char_index)
-    {
-        if(p_input_buffer[char_index] < 0x400)
-        {
-            p_output_widetext[char_index] = PKSAV_GEN4_CHAR_MAP1[p_input_buffer[char_index]];
-        }
-        else if(p_input_buffer[char_index] <= PKSAV_GEN4_CHAR_MAP2_SIZE)
-        {
-            p_output_widetext[char_index] = PKSAV_GEN4_CHAR_MAP2[p_input_buffer[char_index]];
-        }
-        else
-        {
-            break;
-        }
-    }
+// Generated from PKSAV_GEN4_CHAR_MAP by scripts/generate_char_tables.py.
+static const struct pksav_text_reverse_map_entry PKSAV_GEN4_REVERSE_CHAR_MAP[] =
+{
+    {0x0020,0x01DE},{0x0021,0x01AB},{0x0023,0x01C0},{0x0024,0x01A8},{0x0025,0x01D2},{0x0026,0x01C2},{0x0028,0x01B9},{0x0029,0x01BA},
+    {0x002A,0x01BF},{0x002B,0x01BD},{0x002C,0x01AD},{0x002D,0x01BE},{0x002E,0x01AE},{0x002F,0x01B1},{0x0030,0x0121},{0x0031,0x0122},
+    {0x0032,0x0123},{0x0033,0x0124},{0x0034,0x0125},{0x0035,0x0126},{0x0036,0x0127},{0x0037,0x0128},{0x0038,0x0129},{0x0039,0x012A},
+    {0x003A,0x01C4},{0x003B,0x01C5},{0x003D,0x01C1},{0x003F,0x01AC},{0x0040,0x01D0},{0x0041,0x012B},{0x0042,0x012C},{0x0043,0x012D},
+    {0x0044,0x012E},{0x0045,0x012F},{0x0046,0x0130},{0x0047,0x0131},{0x0048,0x0132},{0x0049,0x0133},{0x004A,0x0134},{0x004B,0x0135},
+    {0x004C,0x0136},{0x004D,0x0137},{0x004E,0x0138},{0x004F,0x0139},{0x0050,0x013A},{0x0051,0x013B},{0x0052,0x013C},{0x0053,0x013D},
+    {0x0054,0x013E},{0x0055,0x013F},{0x0056,0x0140},{0x0057,0x0141},{0x0058,0x0142},{0x0059,0x0143},{0x005A,0x0144},{0x005F,0x01E3},
+    {0x0061,0x0145},{0x0062,0x0146},{0x0063,0x0147},{0x0064,0x0148},{0x0065,0x0149},{0x0066,0x014A},{0x0067,0x014B},{0x0068,0x014C},
+    {0x0069,0x014D},{0x006A,0x014E},{0x006B,0x014F},{0x006C,0x0150},{0x006D,0x0151},{0x006E,0x0152},{0x006F,0x0153},{0x0070,0x0154},
+    {0x0071,0x0155},{0x0072,0x0156},{0x0073,0x0157},{0x0074,0x0158},{0x0075,0x0159},{0x0076,0x015A},{0x0077,0x015B},{0x0078,0x015C},
+    {0x0079,0x015D},{0x007A,0x015E},{0x007E,0x01C3},{0x00A1,0x01A9},{0x00A5,0x0112},{0x00AA,0x01A3},{0x00B0,0x01E2},{0x00B2,0x01A6},
+    {0x00B3,0x01A7},{0x00B7,0x01B0},{0x00B9,0x01A5},{0x00BA,0x01A4},{0x00BF,0x01AA},{0x00C0,0x015F},{0x00C1,0x0160},{0x00C2,0x0161},
+    {0x00C3,0x0162},{0x00C4,0x0163},{0x00C5,0x0164},{0x00C6,0x0165},{0x00C7,0x0166},{0x00C8,0x0167},{0x00C9,0x0168},{0x00CA,0x0169},
+    {0x00CB,0x016A},{0x00CC,0x016B},{0x00CD,0x016C},{0x00CE,0x016D},{0x00CF,0x016E},{0x00D0,0x016F},{0x00D1,0x0170},{0x00D2,0x0171},
+    {0x00D3,0x0172},{0x00D4,0x0173},{0x00D5,0x0174},{0x00D6,0x0175},{0x00D7,0x0176},{0x00D8,0x0177},{0x00D9,0x0178},{0x00DA,0x0179},
+    {0x00DB,0x017A},{0x00DC,0x017B},{0x00DD,0x017C},{0x00DE,0x017D},{0x00DF,0x017E},{0x00E0,0x017F},{0x00E1,0x0180},{0x00E2,0x0181},
+    {0x00E3,0x0182},{0x00E4,0x0183},{0x00E5,0x0184},{0x00E6,0x0185},{0x00E7,0x0186},{0x00E8,0x0187},{0x00E9,0x0188},{0x00EA,0x0189},
+    {0x00EB,0x018A},{0x00EC,0x018B},{0x00ED,0x018C},{0x00EE,0x018D},{0x00EF,0x018E},{0x00F0,0x018F},{0x00F1,0x0190},{0x00F2,0x0191},
+    {0x00F3,0x0192},{0x00F4,0x0193},{0x00F5,0x0194},{0x00F6,0x0195},{0x00F7,0x0196},{0x00F8,0x0197},{0x00F9,0x0198},{0x00FA,0x0199},
+    {0x00FB,0x019A},{0x00FC,0x019B},{0x00FD,0x019C},{0x00FE,0x019D},{0x00FF,0x019E},{0x0152,0x019F},{0x0153,0x01A0},{0x015E,0x01A1},
+    {0x015F,0x01A2},{0x1100,0x0D2E},{0x1101,0x0D2F},{0x1102,0x0D30},{0x1103,0x0D31},{0x1104,0x0D32},{0x1105,0x0D33},{0x1106,0x0D34},
+    {0x1107,0x0D35},{0x1108,0x0D36},{0x1109,0x0D37},{0x110A,0x0D38},{0x110B,0x0D39},{0x110C,0x0D3A},{0x110D,0x0D3B},{0x110E,0x0D3C},
+    {0x110F,0x0D3D},{0x1110,0x0D3E},{0x1111,0x0D3F},{0x1112,0x0D40},{0x1161,0x0D41},{0x1162,0x0D42},{0x1163,0x0D43},{0x1164,0x0D44},
+    {0x1165,0x0D45},{0x1166,0x0D46},{0x1167,0x0D47},{0x1168,0x0D48},{0x1169,0x0D49},{0x116D,0x0D4A},{0x116E,0x0D4B},{0x1172,0x0D4C},
+    {0x1173,0x0D4D},{0x1175,0x0D4E},{0x2018,0x01B2},{0x2019,0x01B3},{0x201C,0x01B4},{0x201D,0x01B5},{0x201E,0x01B6},{0x2023,0x011F},
+    {0x2026,0x01AF},{0x2074,0x01DF},{0x20A6,0x01E1},{0x20A7,0x01E0},{0x2190,0x011B},{0x2191,0x011C},{0x2192,0x011E},{0x2193,0x011D},
+    {0x2197,0x01DB},{0x2198,0x01DC},{0x2297,0x00F2},{0x2298,0x00F3},{0x22EF,0x00E5},{0x25A0,0x01CD},{0x25A1,0x0101},{0x25B2,0x01CE},
+    {0x25B3,0x0102},{0x25C6,0x01CF},{0x25C7,0x0103},{0x25C9,0x01CB},{0x25CB,0x0100},{0x25CE,0x00FF},{0x25CF,0x01CC},{0x2600,0x01D3},
+    {0x2601,0x01D4},{0x2602,0x01D5},{0x2603,0x01D6},{0x2605,0x01CA},{0x2606,0x00FE},{0x260A,0x010E},{0x260B,0x010B},{0x2614,0x0108},
+    {0x2630,0x0109},{0x2639,0x01DA},{0x263A,0x01D7},{0x263C,0x0107},{0x263D,0x01DD},{0x263E,0x0111},{0x2640,0x01BC},{0x2642,0x01BB},
+    {0x2648,0x0113},{0x2649,0x0114},{0x264A,0x0115},{0x264B,0x0116},{0x264C,0x0117},{0x264D,0x0118},{0x264E,0x0119},{0x264F,0x011A},
+    {0x2654,0x010C},{0x2655,0x010D},{0x265A,0x01D8},{0x265B,0x01D9},{0x2660,0x01C6},{0x2661,0x00FC},{0x2662,0x00FD},{0x2663,0x01C7},
+    {0x2664,0x00FA},{0x2665,0x01C8},{0x2666,0x01C9},{0x2667,0x00FB},{0x266A,0x01D1},{0x266B,0x0105},{0x2744,0x010A},{0x2934,0x010F},
+    {0x2935,0x0110},{0x3000,0x0001},{0x3001,0x00E3},{0x3002,0x00E4},{0x300A,0x01B7},{0x300B,0x01B8},{0x300C,0x00E8},{0x300D,0x00E9},
+    {0x300E,0x00EA},{0x300F,0x00EB},{0x3041,0x0002},{0x3042,0x0003},{0x3043,0x0004},{0x3044,0x0005},{0x3045,0x0006},{0x3046,0x0007},
+    {0x3047,0x0008},{0x3048,0x0009},{0x3049,0x000A},{0x304A,0x000B},{0x304B,0x000C},{0x304C,0x000D},{0x304D,0x000E},{0x304E,0x000F},
+    {0x304F,0x0010},{0x3050,0x0011},{0x3051,0x0012},{0x3052,0x0013},{0x3053,0x0014},{0x3054,0x0015},{0x3055,0x0016},{0x3056,0x0017},
+    {0x3057,0x0018},{0x3058,0x0019},{0x3059,0x001A},{0x305A,0x001B},{0x305B,0x001C},{0x305C,0x001D},{0x305D,0x001E},{0x305E,0x001F},
+    {0x305F,0x0020},{0x3060,0x0021},{0x3061,0x0022},{0x3062,0x0023},{0x3063,0x0024},{0x3064,0x0025},{0x3065,0x0026},{0x3066,0x0027},
+    {0x3067,0x0028},{0x3068,0x0029},{0x3069,0x002A},{0x306A,0x002B},{0x306B,0x002C},{0x306C,0x002D},{0x306D,0x002E},{0x306E,0x002F},
+    {0x306F,0x0030},{0x3070,0x0031},{0x3071,0x0032},{0x3072,0x0033},{0x3073,0x0034},{0x3074,0x0035},{0x3075,0x0036},{0x3076,0x0037},
+    {0x3077,0x0038},{0x3078,0x0039},{0x3079,0x003A},{0x307A,0x003B},{0x307B,0x003C},{0x307C,0x003D},{0x307D,0x003E},{0x307E,0x003F},
+    {0x307F,0x0040},{0x3080,0x0041},{0x3081,0x0042},{0x3082,0x0043},{0x3083,0x0044},{0x3084,0x0045},{0x3085,0x0046},{0x3086,0x0047},
+    {0x3087,0x0048},{0x3088,0x0049},{0x3089,0x004A},{0x308A,0x004B},{0x308B,0x004C},{0x308C,0x004D},{0x308D,0x004E},{0x308F,0x004F},
+    {0x3092,0x0050},{0x3093,0x0051},{0x30A1,0x0052},{0x30A2,0x0053},{0x30A3,0x0054},{0x30A4,0x0055},{0x30A5,0x0056},{0x30A6,0x0057},
+    {0x30A7,0x0058},{0x30A8,0x0059},{0x30A9,0x005A},{0x30AA,0x005B},{0x30AB,0x005C},{0x30AC,0x005D},{0x30AD,0x005E},{0x30AE,0x005F},
+    {0x30AF,0x0060},{0x30B0,0x0061},{0x30B1,0x0062},{0x30B2,0x0063},{0x30B3,0x0064},{0x30B4,0x0065},{0x30B5,0x0066},{0x30B6,0x0067},
+    {0x30B7,0x0068},{0x30B8,0x0069},{0x30B9,0x006A},{0x30BA,0x006B},{0x30BB,0x006C},{0x30BC,0x006D},{0x30BD,0x006E},{0x30BE,0x006F},
+    {0x30BF,0x0070},{0x30C0,0x0071},{0x30C1,0x0072},{0x30C2,0x0073},{0x30C3,0x0074},{0x30C4,0x0075},{0x30C5,0x0076},{0x30C6,0x0077},
+    {0x30C7,0x0078},{0x30C8,0x0079},{0x30C9,0x007A},{0x30CA,0x007B},{0x30CB,0x007C},{0x30CC,0x007D},{0x30CD,0x007E},{0x30CE,0x007F},
+    {0x30CF,0x0080},{0x30D0,0x0081},{0x30D1,0x0082},{0x30D2,0x0083},{0x30D3,0x0084},{0x30D4,0x0085},{0x30D5,0x0086},{0x30D6,0x0087},
+    {0x30D7,0x0088},{0x30D8,0x0089},{0x30D9,0x008A},{0x30DA,0x008B},{0x30DB,0x008C},{0x30DC,0x008D},{0x30DD,0x008E},{0x30DE,0x008F},
+    {0x30DF,0x0090},{0x30E0,0x0091},{0x30E1,0x0092},{0x30E2,0x0093},{0x30E3,0x0094},{0x30E4,0x0095},{0x30E5,0x0096},{0x30E6,0x0097},
+    {0x30E7,0x0098},{0x30E8,0x0099},{0x30E9,0x009A},{0x30EA,0x009B},{0x30EB,0x009C},{0x30EC,0x009D},{0x30ED,0x009E},{0x30EF,0x009F},
+    {0x30F2,0x00A0},{0x30F3,0x00A1},{0x30FB,0x00E6},{0x329A,0x00EE},{0x329B,0x00EF},{0xAC00,0x0400},{0xAC01,0x0401},{0xAC04,0x0402},
+    {0xAC07,0x0403},{0xAC08,0x0404},{0xAC09,0x0405},{0xAC0A,0x0406},{0xAC10,0x0407},{0xAC11,0x0408},{0xAC12,0x0409},{0xAC13,0x040A},
+    {0xAC14,0x040B},{0xAC15,0x040C},{0xAC16,0x040D},{0xAC17,0x040E},{0xAC19,0x040F},{0xAC1A,0x0410},{0xAC1B,0x0411},{0xAC1C,0x0412},
+    {0xAC1D,0x0413},{0xAC20,0x0414},{0xAC24,0x0415},{0xAC2C,0x0416},{0xAC2D,0x0417},{0xAC2F,0x0418},{0xAC30,0x0419},{0xAC31,0x041A},
+    {0xAC38,0x041B},{0xAC39,0x041C},{0xAC3C,0x041D},{0xAC40,0x041E},{0xAC4B,0x041F},{0xAC4D,0x0420},{0xAC54,0x0421},{0xAC58,0x0422},
+    {0xAC5C,0x0423},{0xAC70,0x0424},{0xAC71,0x0425},{0xAC74,0x0426},{0xAC77,0x0427},{0xAC78,0x0428},{0xAC7A,0x0429},{0xAC80,0x042A},
+    {0xAC81,0x042B},{0xAC83,0x042C},{0xAC84,0x042D},{0xAC85,0x042E},{0xAC86,0x042F},{0xAC89,0x0430},{0xAC8A,0x0431},{0xAC8B,0x0432},
+    {0xAC8C,0x0433},{0xAC90,0x0434},{0xAC94,0x0435},{0xAC9C,0x0436},{0xAC9D,0x0437},{0xAC9F,0x0438},{0xACA0,0x0439},{0xACA1,0x043A},
+    {0xACA8,0x043B},{0xACA9,0x043C},{0xACAA,0x043D},{0xACAC,0x043E},{0xACAF,0x043F},{0xACB0,0x0440},{0xACB8,0x0441},{0xACB9,0x0442},
+    {0xACBB,0x0443},{0xACBC,0x0444},{0xACBD,0x0445},{0xACC1,0x0446},{0xACC4,0x0447},{0xACC8,0x0448},{0xACCC,0x0449},{0xACD5,0x044A},
+    {0xACD7,0x044B},{0xACE0,0x044C},{0xACE1,0x044D},{0xACE4,0x044E},{0xACE7,0x044F},{0xACE8,0x0450},{0xACEA,0x0451},{0xACEC,0x0452},
+    {0xACEF,0x0453},{0xACF0,0x0454},{0xACF1,0x0455},{0xACF3,0x0456},{0xACF5,0x0457},{0xACF6,0x0458},{0xACFC,0x0459},{0xACFD,0x045A},
+    {0xAD00,0x045B},{0xAD04,0x045C},{0xAD06,0x045D},{0xAD0C,0x045E},{0xAD0D,0x045F},{0xAD0F,0x0460},{0xAD11,0x0461},{0xAD18,0x0462},
+    {0xAD1C,0x0463},{0xAD20,0x0464},{0xAD29,0x0465},{0xAD2C,0x0466},{0xAD2D,0x0467},{0xAD34,0x0468},{0xAD35,0x0469},{0xAD38,0x046A},
+    {0xAD3C,0x046B},{0xAD44,0x046C},{0xAD45,0x046D},{0xAD47,0x046E},{0xAD49,0x046F},{0xAD50,0x0470},{0xAD54,0x0471},{0xAD58,0x0472},
+    {0xAD61,0x0473},{0xAD63,0x0474},{0xAD6C,0x0475},{0xAD6D,0x0476},{0xAD70,0x0477},{0xAD73,0x0478},{0xAD74,0x0479},{0xAD75,0x047A},
+    {0xAD76,0x047B},{0xAD7B,0x047C},{0xAD7C,0x047D},{0xAD7D,0x047E},{0xAD7F,0x047F},{0xAD81,0x0480},{0xAD82,0x0481},{0xAD88,0x0482},
+    {0xAD89,0x0483},{0xAD8C,0x0484},{0xAD90,0x0485},{0xAD9C,0x0486},{0xAD9D,0x0487},{0xADA4,0x0488},{0xADB7,0x0489},{0xADC0,0x048A},
+    {0xADC1,0x048B},{0xADC4,0x048C},{0xADC8,0x048D},{0xADD0,0x048E},{0xADD1,0x048F},{0xADD3,0x0490},{0xADDC,0x0491},{0xADE0,0x0492},
+    {0xADE4,0x0493},{0xADF8,0x0494},{0xADF9,0x0495},{0xADFC,0x0496},{0xADFF,0x0497},{0xAE00,0x0498},{0xAE01,0x0499},{0xAE08,0x049A},
+    {0xAE09,0x049B},{0xAE0B,0x049C},{0xAE0D,0x049D},{0xAE14,0x049E},{0xAE30,0x049F},{0xAE31,0x04A0},{0xAE34,0x04A1},{0xAE37,0x04A2},
+    {0xAE38,0x04A3},{0xAE3A,0x04A4},{0xAE40,0x04A5},{0xAE41,0x04A6},{0xAE43,0x04A7},{0xAE45,0x04A8},{0xAE46,0x04A9},{0xAE4A,0x04AA},
+    {0xAE4C,0x04AB},{0xAE4D,0x04AC},{0xAE4E,0x04AD},{0xAE50,0x04AE},{0xAE54,0x04AF},{0xAE56,0x04B0},{0xAE5C,0x04B1},{0xAE5D,0x04B2},
+    {0xAE5F,0x04B3},{0xAE60,0x04B4},{0xAE61,0x04B5},{0xAE65,0x04B6},{0xAE68,0x04B7},{0xAE69,0x04B8},{0xAE6C,0x04B9},{0xAE70,0x04BA},
+    {0xAE78,0x04BB},{0xAE79,0x04BC},{0xAE7B,0x04BD},{0xAE7C,0x04BE},{0xAE7D,0x04BF},{0xAE84,0x04C0},{0xAE85,0x04C1},{0xAE8C,0x04C2},
+    {0xAEBC,0x04C3},{0xAEBD,0x04C4},{0xAEBE,0x04C5},{0xAEC0,0x04C6},{0xAEC4,0x04C7},{0xAECC,0x04C8},{0xAECD,0x04C9},{0xAECF,0x04CA},
+    {0xAED0,0x04CB},{0xAED1,0x04CC},{0xAED8,0x04CD},{0xAED9,0x04CE},{0xAEDC,0x04CF},{0xAEE8,0x04D0},{0xAEEB,0x04D1},{0xAEED,0x04D2},
+    {0xAEF4,0x04D3},{0xAEF8,0x04D4},{0xAEFC,0x04D5},{0xAF07,0x04D6},{0xAF08,0x04D7},{0xAF0D,0x04D8},{0xAF10,0x04D9},{0xAF2C,0x04DA},
+    {0xAF2D,0x04DB},{0xAF30,0x04DC},{0xAF32,0x04DD},{0xAF34,0x04DE},{0xAF3C,0x04DF},{0xAF3D,0x04E0},{0xAF3F,0x04E1},{0xAF41,0x04E2},
+    {0xAF42,0x04E3},{0xAF43,0x04E4},{0xAF48,0x04E5},{0xAF49,0x04E6},{0xAF50,0x04E7},{0xAF5C,0x04E8},{0xAF5D,0x04E9},{0xAF64,0x04EA},
+    {0xAF65,0x04EB},{0xAF79,0x04EC},{0xAF80,0x04ED},{0xAF84,0x04EE},{0xAF88,0x04EF},{0xAF90,0x04F0},{0xAF91,0x04F1},{0xAF95,0x04F2},
+    {0xAF9C,0x04F3},{0xAFB8,0x04F4},{0xAFB9,0x04F5},{0xAFBC,0x04F6},{0xAFC0,0x04F7},{0xAFC7,0x04F8},{0xAFC8,0x04F9},{0xAFC9,0x04FA},
+    {0xAFCB,0x04FB},{0xAFCD,0x04FC},{0xAFCE,0x04FD},{0xAFD4,0x04FE},{0xAFDC,0x04FF},{0xAFE8,0x0500},{0xAFE9,0x0501},{0xAFF0,0x0502},
+    {0xAFF1,0x0503},{0xAFF4,0x0504},{0xAFF8,0x0505},{0xB000,0x0506},{0xB001,0x0507},{0xB004,0x0508},{0xB00C,0x0509},{0xB010,0x050A},
+    {0xB014,0x050B},{0xB01C,0x050C},{0xB01D,0x050D},{0xB028,0x050E},{0xB044,0x050F},{0xB045,0x0510},{0xB048,0x0511},{0xB04A,0x0512},
+    {0xB04C,0x0513},{0xB04E,0x0514},{0xB053,0x0515},{0xB054,0x0516},{0xB055,0x0517},{0xB057,0x0518},{0xB059,0x0519},{0xB05D,0x051A},
+    {0xB07C,0x051B},{0xB07D,0x051C},{0xB080,0x051D},{0xB084,0x051E},{0xB08C,0x051F},{0xB08D,0x0520},{0xB08F,0x0521},{0xB091,0x0522},
+    {0xB098,0x0523},{0xB099,0x0524},{0xB09A,0x0525},{0xB09C,0x0526},{0xB09F,0x0527},{0xB0A0,0x0528},{0xB0A1,0x0529},{0xB0A2,0x052A},
+    {0xB0A8,0x052B},{0xB0A9,0x052C},{0xB0AB,0x052D},{0xB0AC,0x052E},{0xB0AD,0x052F},{0xB0AE,0x0530},{0xB0AF,0x0531},{0xB0B1,0x0532},
+    {0xB0B3,0x0533},{0xB0B4,0x0534},{0xB0B5,0x0535},{0xB0B8,0x0536},{0xB0BC,0x0537},{0xB0C4,0x0538},{0xB0C5,0x0539},{0xB0C7,0x053A},
+    {0xB0C8,0x053B},{0xB0C9,0x053C},{0xB0D0,0x053D},{0xB0D1,0x053E},{0xB0D4,0x053F},{0xB0D8,0x0540},{0xB0E0,0x0541},{0xB0E5,0x0542},
+    {0xB108,0x0543},{0xB109,0x0544},{0xB10B,0x0545},{0xB10C,0x0546},{0xB110,0x0547},{0xB112,0x0548},{0xB113,0x0549},{0xB118,0x054A},
+    {0xB119,0x054B},{0xB11B,0x054C},{0xB11C,0x054D},{0xB11D,0x054E},{0xB123,0x054F},{0xB124,0x0550},{0xB125,0x0551},{0xB128,0x0552},
+    {0xB12C,0x0553},{0xB134,0x0554},{0xB135,0x0555},{0xB137,0x0556},{0xB138,0x0557},{0xB139,0x0558},{0xB140,0x0559},{0xB141,0x055A},
+    {0xB144,0x055B},{0xB148,0x055C},{0xB150,0x055D},{0xB151,0x055E},{0xB154,0x055F},{0xB155,0x0560},{0xB158,0x0561},{0xB15C,0x0562},
+    {0xB160,0x0563},{0xB178,0x0564},{0xB179,0x0565},{0xB17C,0x0566},{0xB180,0x0567},{0xB182,0x0568},{0xB188,0x0569},{0xB189,0x056A},
+    {0xB18B,0x056B},{0xB18D,0x056C},{0xB192,0x056D},{0xB193,0x056E},{0xB194,0x056F},{0xB198,0x0570},{0xB19C,0x0571},{0xB1A8,0x0572},
+    {0xB1CC,0x0573},{0xB1D0,0x0574},{0xB1D4,0x0575},{0xB1DC,0x0576},{0xB1DD,0x0577},{0xB1DF,0x0578},{0xB1E8,0x0579},{0xB1E9,0x057A},
+    {0xB1EC,0x057B},{0xB1F0,0x057C},{0xB1F9,0x057D},{0xB1FB,0x057E},{0xB1FD,0x057F},{0xB204,0x0580},{0xB205,0x0581},{0xB208,0x0582},
+    {0xB20B,0x0583},{0xB20C,0x0584},{0xB214,0x0585},{0xB215,0x0586},{0xB217,0x0587},{0xB219,0x0588},{0xB220,0x0589},{0xB234,0x058A},
+    {0xB23C,0x058B},{0xB258,0x058C},{0xB25C,0x058D},{0xB260,0x058E},{0xB268,0x058F},{0xB269,0x0590},{0xB274,0x0591},{0xB275,0x0592},
+    {0xB27C,0x0593},{0xB284,0x0594},{0xB285,0x0595},{0xB289,0x0596},{0xB290,0x0597},{0xB291,0x0598},{0xB294,0x0599},{0xB298,0x059A},
+    {0xB299,0x059B},{0xB29A,0x059C},{0xB2A0,0x059D},{0xB2A1,0x059E},{0xB2A3,0x059F},{0xB2A5,0x05A0},{0xB2A6,0x05A1},{0xB2AA,0x05A2},
+    {0xB2AC,0x05A3},{0xB2B0,0x05A4},{0xB2B4,0x05A5},{0xB2C8,0x05A6},{0xB2C9,0x05A7},{0xB2CC,0x05A8},{0xB2D0,0x05A9},{0xB2D2,0x05AA},
+    {0xB2D8,0x05AB},{0xB2D9,0x05AC},{0xB2DB,0x05AD},{0xB2DD,0x05AE},{0xB2E2,0x05AF},{0xB2E4,0x05B0},{0xB2E5,0x05B1},{0xB2E6,0x05B2},
+    {0xB2E8,0x05B3},{0xB2EB,0x05B4},{0xB2EC,0x05B5},{0xB2ED,0x05B6},{0xB2EE,0x05B7},{0xB2EF,0x05B8},{0xB2F3,0x05B9},{0xB2F4,0x05BA},
+    {0xB2F5,0x05BB},{0xB2F7,0x05BC},{0xB2F8,0x05BD},{0xB2F9,0x05BE},{0xB2FA,0x05BF},{0xB2FB,0x05C0},{0xB2FF,0x05C1},{0xB300,0x05C2},
+    {0xB301,0x05C3},{0xB304,0x05C4},{0xB308,0x05C5},{0xB310,0x05C6},{0xB311,0x05C7},{0xB313,0x05C8},{0xB314,0x05C9},{0xB315,0x05CA},
+    {0xB31C,0x05CB},{0xB354,0x05CC},{0xB355,0x05CD},{0xB356,0x05CE},{0xB358,0x05CF},{0xB35B,0x05D0},{0xB35C,0x05D1},{0xB35E,0x05D2},
+    {0xB35F,0x05D3},{0xB364,0x05D4},{0xB365,0x05D5},{0xB367,0x05D6},{0xB369,0x05D7},{0xB36B,0x05D8},{0xB36E,0x05D9},{0xB370,0x05DA},
+    {0xB371,0x05DB},{0xB374,0x05DC},{0xB378,0x05DD},{0xB380,0x05DE},{0xB381,0x05DF},{0xB383,0x05E0},{0xB384,0x05E1},{0xB385,0x05E2},
+    {0xB38C,0x05E3},{0xB390,0x05E4},{0xB394,0x05E5},{0xB3A0,0x05E6},{0xB3A1,0x05E7},{0xB3A8,0x05E8},{0xB3AC,0x05E9},{0xB3C4,0x05EA},
+    {0xB3C5,0x05EB},{0xB3C8,0x05EC},{0xB3CB,0x05ED},{0xB3CC,0x05EE},{0xB3CE,0x05EF},{0xB3D0,0x05F0},{0xB3D4,0x05F1},{0xB3D5,0x05F2},
+    {0xB3D7,0x05F3},{0xB3D9,0x05F4},{0xB3DB,0x05F5},{0xB3DD,0x05F6},{0xB3E0,0x05F7},{0xB3E4,0x05F8},{0xB3E8,0x05F9},{0xB3FC,0x05FA},
+    {0xB410,0x05FB},{0xB418,0x05FC},{0xB41C,0x05FD},{0xB420,0x05FE},{0xB428,0x05FF},{0xB429,0x0600},{0xB42B,0x0601},{0xB434,0x0602},
+    {0xB450,0x0603},{0xB451,0x0604},{0xB454,0x0605},{0xB458,0x0606},{0xB460,0x0607},{0xB461,0x0608},{0xB463,0x0609},{0xB465,0x060A},
+    {0xB46C,0x060B},{0xB480,0x060C},{0xB488,0x060D},{0xB49D,0x060E},{0xB4A4,0x060F},{0xB4A8,0x0610},{0xB4AC,0x0611},{0xB4B5,0x0612},
+    {0xB4B7,0x0613},{0xB4B9,0x0614},{0xB4C0,0x0615},{0xB4C4,0x0616},{0xB4C8,0x0617},{0xB4D0,0x0618},{0xB4D5,0x0619},{0xB4DC,0x061A},
+    {0xB4DD,0x061B},{0xB4E0,0x061C},{0xB4E3,0x061D},{0xB4E4,0x061E},{0xB4E6,0x061F},{0xB4EC,0x0620},{0xB4ED,0x0621},{0xB4EF,0x0622},
+    {0xB4F1,0x0623},{0xB4F8,0x0624},{0xB514,0x0625},{0xB515,0x0626},{0xB518,0x0627},{0xB51B,0x0628},{0xB51C,0x0629},{0xB524,0x062A},
+    {0xB525,0x062B},{0xB527,0x062C},{0xB528,0x062D},{0xB529,0x062E},{0xB52A,0x062F},{0xB530,0x0630},{0xB531,0x0631},{0xB534,0x0632},
+    {0xB538,0x0633},{0xB540,0x0634},{0xB541,0x0635},{0xB543,0x0636},{0xB544,0x0637},{0xB545,0x0638},{0xB54B,0x0639},{0xB54C,0x063A},
+    {0xB54D,0x063B},{0xB550,0x063C},{0xB554,0x063D},{0xB55C,0x063E},{0xB55D,0x063F},{0xB55F,0x0640},{0xB560,0x0641},{0xB561,0x0642},
+    {0xB5A0,0x0643},{0xB5A1,0x0644},{0xB5A4,0x0645},{0xB5A8,0x0646},{0xB5AA,0x0647},{0xB5AB,0x0648},{0xB5B0,0x0649},{0xB5B1,0x064A},
+    {0xB5B3,0x064B},{0xB5B4,0x064C},{0xB5B5,0x064D},{0xB5BB,0x064E},{0xB5BC,0x064F},{0xB5BD,0x0650},{0xB5C0,0x0651},{0xB5C4,0x0652},
+    {0xB5CC,0x0653},{0xB5CD,0x0654},{0xB5CF,0x0655},{0xB5D0,0x0656},{0xB5D1,0x0657},{0xB5D8,0x0658},{0xB5EC,0x0659},{0xB610,0x065A},
+    {0xB611,0x065B},{0xB614,0x065C},{0xB618,0x065D},{0xB625,0x065E},{0xB62C,0x065F},{0xB634,0x0660},{0xB648,0x0661},{0xB664,0x0662},
+    {0xB668,0x0663},{0xB69C,0x0664},{0xB69D,0x0665},{0xB6A0,0x0666},{0xB6A4,0x0667},{0xB6AB,0x0668},{0xB6AC,0x0669},{0xB6B1,0x066A},
+    {0xB6D4,0x066B},{0xB6F0,0x066C},{0xB6F4,0x066D},{0xB6F8,0x066E},{0xB700,0x066F},{0xB701,0x0670},{0xB705,0x0671},{0xB728,0x0672},
+    {0xB729,0x0673},{0xB72C,0x0674},{0xB72F,0x0675},{0xB730,0x0676},{0xB738,0x0677},{0xB739,0x0678},{0xB73B,0x0679},{0xB744,0x067A},
+    {0xB748,0x067B},{0xB74C,0x067C},{0xB754,0x067D},{0xB755,0x067E},{0xB760,0x067F},{0xB764,0x0680},{0xB768,0x0681},{0xB770,0x0682},
+    {0xB771,0x0683},{0xB773,0x0684},{0xB775,0x0685},{0xB77C,0x0686},{0xB77D,0x0687},{0xB780,0x0688},{0xB784,0x0689},{0xB78C,0x068A},
+    {0xB78D,0x068B},{0xB78F,0x068C},{0xB790,0x068D},{0xB791,0x068E},{0xB792,0x068F},{0xB796,0x0690},{0xB797,0x0691},{0xB798,0x0692},
+    {0xB799,0x0693},{0xB79C,0x0694},{0xB7A0,0x0695},{0xB7A8,0x0696},{0xB7A9,0x0697},{0xB7AB,0x0698},{0xB7AC,0x0699},{0xB7AD,0x069A},
+    {0xB7B4,0x069B},{0xB7B5,0x069C},{0xB7B8,0x069D},{0xB7C7,0x069E},{0xB7C9,0x069F},{0xB7EC,0x06A0},{0xB7ED,0x06A1},{0xB7F0,0x06A2},
+    {0xB7F4,0x06A3},{0xB7FC,0x06A4},{0xB7FD,0x06A5},{0xB7FF,0x06A6},{0xB800,0x06A7},{0xB801,0x06A8},{0xB807,0x06A9},{0xB808,0x06AA},
+    {0xB809,0x06AB},{0xB80C,0x06AC},{0xB810,0x06AD},{0xB818,0x06AE},{0xB819,0x06AF},{0xB81B,0x06B0},{0xB81D,0x06B1},{0xB824,0x06B2},
+    {0xB825,0x06B3},{0xB828,0x06B4},{0xB82C,0x06B5},{0xB834,0x06B6},{0xB835,0x06B7},{0xB837,0x06B8},{0xB838,0x06B9},{0xB839,0x06BA},
+    {0xB840,0x06BB},{0xB844,0x06BC},{0xB851,0x06BD},{0xB853,0x06BE},{0xB85C,0x06BF},{0xB85D,0x06C0},{0xB860,0x06C1},{0xB864,0x06C2},
+    {0xB86C,0x06C3},{0xB86D,0x06C4},{0xB86F,0x06C5},{0xB871,0x06C6},{0xB878,0x06C7},{0xB87C,0x06C8},{0xB88D,0x06C9},{0xB894,0x0D4F},
+    {0xB8A8,0x06CA},{0xB8B0,0x06CB},{0xB8B4,0x06CC},{0xB8B8,0x06CD},{0xB8C0,0x06CE},{0xB8C1,0x06CF},{0xB8C3,0x06D0},{0xB8C5,0x06D1},
+    {0xB8CC,0x06D2},{0xB8D0,0x06D3},{0xB8D4,0x06D4},{0xB8DD,0x06D5},{0xB8DF,0x06D6},{0xB8E1,0x06D7},{0xB8E8,0x06D8},{0xB8E9,0x06D9},
+    {0xB8EC,0x06DA},{0xB8F0,0x06DB},{0xB8F8,0x06DC},{0xB8F9,0x06DD},{0xB8FB,0x06DE},{0xB8FD,0x06DF},{0xB904,0x06E0},{0xB918,0x06E1},
+    {0xB920,0x06E2},{0xB93C,0x06E3},{0xB93D,0x06E4},{0xB940,0x06E5},{0xB944,0x06E6},{0xB94C,0x06E7},{0xB94F,0x06E8},{0xB951,0x06E9},
+    {0xB958,0x06EA},{0xB959,0x06EB},{0xB95C,0x06EC},{0xB960,0x06ED},{0xB968,0x06EE},{0xB969,0x06EF},{0xB96B,0x06F0},{0xB96D,0x06F1},
+    {0xB974,0x06F2},{0xB975,0x06F3},{0xB978,0x06F4},{0xB97C,0x06F5},{0xB984,0x06F6},{0xB985,0x06F7},{0xB987,0x06F8},{0xB989,0x06F9},
+    {0xB98A,0x06FA},{0xB98D,0x06FB},{0xB98E,0x06FC},{0xB9AC,0x06FD},{0xB9AD,0x06FE},{0xB9B0,0x06FF},{0xB9B4,0x0700},{0xB9BC,0x0701},
+    {0xB9BD,0x0702},{0xB9BF,0x0703},{0xB9C1,0x0704},{0xB9C8,0x0705},{0xB9C9,0x0706},{0xB9CC,0x0707},{0xB9CE,0x0708},{0xB9CF,0x0709},
+    {0xB9D0,0x070A},{0xB9D1,0x070B},{0xB9D2,0x070C},{0xB9D8,0x070D},{0xB9D9,0x070E},{0xB9DB,0x070F},{0xB9DD,0x0710},{0xB9DE,0x0711},
+    {0xB9E1,0x0712},{0xB9E3,0x0713},{0xB9E4,0x0714},{0xB9E5,0x0715},{0xB9E8,0x0716},{0xB9EC,0x0717},{0xB9F4,0x0718},{0xB9F5,0x0719},
+    {0xB9F7,0x071A},{0xB9F8,0x071B},{0xB9F9,0x071C},{0xB9FA,0x071D},{0xBA00,0x071E},{0xBA01,0x071F},{0xBA08,0x0720},{0xBA15,0x0721},
+    {0xBA38,0x0722},{0xBA39,0x0723},{0xBA3C,0x0724},{0xBA40,0x0725},{0xBA42,0x0726},{0xBA48,0x0727},{0xBA49,0x0728},{0xBA4B,0x0729},
+    {0xBA4D,0x072A},{0xBA4E,0x072B},{0xBA53,0x072C},{0xBA54,0x072D},{0xBA55,0x072E},{0xBA58,0x072F},{0xBA5C,0x0730},{0xBA64,0x0731},
+    {0xBA65,0x0732},{0xBA67,0x0733},{0xBA68,0x0734},{0xBA69,0x0735},{0xBA70,0x0736},{0xBA71,0x0737},{0xBA74,0x0738},{0xBA78,0x0739},
+    {0xBA83,0x073A},{0xBA84,0x073B},{0xBA85,0x073C},{0xBA87,0x073D},{0xBA8C,0x073E},{0xBAA8,0x073F},{0xBAA9,0x0740},{0xBAAB,0x0741},
+    {0xBAAC,0x0742},{0xBAB0,0x0743},{0xBAB2,0x0744},{0xBAB8,0x0745},{0xBAB9,0x0746},{0xBABB,0x0747},{0xBABD,0x0748},{0xBAC4,0x0749},
+    {0xBAC8,0x074A},{0xBAD8,0x074B},{0xBAD9,0x074C},{0xBAFC,0x074D},{0xBB00,0x074E},{0xBB04,0x074F},{0xBB0D,0x0750},{0xBB0F,0x0751},
+    {0xBB11,0x0752},{0xBB18,0x0753},{0xBB1C,0x0754},{0xBB20,0x0755},{0xBB29,0x0756},{0xBB2B,0x0757},{0xBB34,0x0758},{0xBB35,0x0759},
+    {0xBB36,0x075A},{0xBB38,0x075B},{0xBB3B,0x075C},{0xBB3C,0x075D},{0xBB3D,0x075E},{0xBB3E,0x075F},{0xBB44,0x0760},{0xBB45,0x0761},
+    {0xBB47,0x0762},{0xBB49,0x0763},{0xBB4D,0x0764},{0xBB4F,0x0765},{0xBB50,0x0766},{0xBB54,0x0767},{0xBB58,0x0768},{0xBB61,0x0769},
+    {0xBB63,0x076A},{0xBB6C,0x076B},{0xBB88,0x076C},{0xBB8C,0x076D},{0xBB90,0x076E},{0xBBA4,0x076F},{0xBBA8,0x0770},{0xBBAC,0x0771},
+    {0xBBB4,0x0772},{0xBBB7,0x0773},{0xBBC0,0x0774},{0xBBC4,0x0775},{0xBBC8,0x0776},{0xBBD0,0x0777},{0xBBD3,0x0778},{0xBBF8,0x0779},
+    {0xBBF9,0x077A},{0xBBFC,0x077B},{0xBBFF,0x077C},{0xBC00,0x077D},{0xBC02,0x077E},{0xBC08,0x077F},{0xBC09,0x0780},{0xBC0B,0x0781},
+    {0xBC0C,0x0782},{0xBC0D,0x0783},{0xBC0F,0x0784},{0xBC11,0x0785},{0xBC14,0x0786},{0xBC15,0x0787},{0xBC16,0x0788},{0xBC17,0x0789},
+    {0xBC18,0x078A},{0xBC1B,0x078B},{0xBC1C,0x078C},{0xBC1D,0x078D},{0xBC1E,0x078E},{0xBC1F,0x078F},{0xBC24,0x0790},{0xBC25,0x0791},
+    {0xBC27,0x0792},{0xBC29,0x0793},{0xBC2D,0x0794},{0xBC30,0x0795},{0xBC31,0x0796},{0xBC34,0x0797},{0xBC38,0x0798},{0xBC40,0x0799},
+    {0xBC41,0x079A},{0xBC43,0x079B},{0xBC44,0x079C},{0xBC45,0x079D},{0xBC49,0x079E},{0xBC4C,0x079F},{0xBC4D,0x07A0},{0xBC50,0x07A1},
+    {0xBC5D,0x07A2},{0xBC84,0x07A3},{0xBC85,0x07A4},{0xBC88,0x07A5},{0xBC8B,0x07A6},{0xBC8C,0x07A7},{0xBC8E,0x07A8},{0xBC94,0x07A9},
+    {0xBC95,0x07AA},{0xBC97,0x07AB},{0xBC99,0x07AC},{0xBC9A,0x07AD},{0xBCA0,0x07AE},{0xBCA1,0x07AF},{0xBCA4,0x07B0},{0xBCA7,0x07B1},
+    {0xBCA8,0x07B2},{0xBCB0,0x07B3},{0xBCB1,0x07B4},{0xBCB3,0x07B5},{0xBCB4,0x07B6},{0xBCB5,0x07B7},{0xBCBC,0x07B8},{0xBCBD,0x07B9},
+    {0xBCC0,0x07BA},{0xBCC4,0x07BB},{0xBCCD,0x07BC},{0xBCCF,0x07BD},{0xBCD0,0x07BE},{0xBCD1,0x07BF},{0xBCD5,0x07C0},{0xBCD8,0x07C1},
+    {0xBCDC,0x07C2},{0xBCF4,0x07C3},{0xBCF5,0x07C4},{0xBCF6,0x07C5},{0xBCF8,0x07C6},{0xBCFC,0x07C7},{0xBD04,0x07C8},{0xBD05,0x07C9},
+    {0xBD07,0x07CA},{0xBD09,0x07CB},{0xBD10,0x07CC},{0xBD14,0x07CD},{0xBD24,0x07CE},{0xBD2C,0x07CF},{0xBD40,0x07D0},{0xBD48,0x07D1},
+    {0xBD49,0x07D2},{0xBD4C,0x07D3},{0xBD50,0x07D4},{0xBD58,0x07D5},{0xBD59,0x07D6},{0xBD64,0x07D7},{0xBD68,0x07D8},{0xBD80,0x07D9},
+    {0xBD81,0x07DA},{0xBD84,0x07DB},{0xBD87,0x07DC},{0xBD88,0x07DD},{0xBD89,0x07DE},{0xBD8A,0x07DF},{0xBD90,0x07E0},{0xBD91,0x07E1},
+    {0xBD93,0x07E2},{0xBD95,0x07E3},{0xBD99,0x07E4},{0xBD9A,0x07E5},{0xBD9C,0x07E6},{0xBDA4,0x07E7},{0xBDB0,0x07E8},{0xBDB8,0x07E9},
+    {0xBDD4,0x07EA},{0xBDD5,0x07EB},{0xBDD8,0x07EC},{0xBDDC,0x07ED},{0xBDE9,0x07EE},{0xBDF0,0x07EF},{0xBDF4,0x07F0},{0xBDF8,0x07F1},
+    {0xBE00,0x07F2},{0xBE03,0x07F3},{0xBE05,0x07F4},{0xBE0C,0x07F5},{0xBE0D,0x07F6},{0xBE10,0x07F7},{0xBE14,0x07F8},{0xBE1C,0x07F9},
+    {0xBE1D,0x07FA},{0xBE1F,0x07FB},{0xBE44,0x07FC},{0xBE45,0x07FD},{0xBE48,0x07FE},{0xBE4C,0x07FF},{0xBE4E,0x0800},{0xBE54,0x0801},
+    {0xBE55,0x0802},{0xBE57,0x0803},{0xBE59,0x0804},{0xBE5A,0x0805},{0xBE5B,0x0806},{0xBE60,0x0807},{0xBE61,0x0808},{0xBE64,0x0809},
+    {0xBE68,0x080A},{0xBE6A,0x080B},{0xBE70,0x080C},{0xBE71,0x080D},{0xBE73,0x080E},{0xBE74,0x080F},{0xBE75,0x0810},{0xBE7B,0x0811},
+    {0xBE7C,0x0812},{0xBE7D,0x0813},{0xBE80,0x0814},{0xBE84,0x0815},{0xBE8C,0x0816},{0xBE8D,0x0817},{0xBE8F,0x0818},{0xBE90,0x0819},
+    {0xBE91,0x081A},{0xBE98,0x081B},{0xBE99,0x081C},{0xBEA8,0x081D},{0xBED0,0x081E},{0xBED1,0x081F},{0xBED4,0x0820},{0xBED7,0x0821},
+    {0xBED8,0x0822},{0xBEE0,0x0823},{0xBEE3,0x0824},{0xBEE4,0x0825},{0xBEE5,0x0826},{0xBEEC,0x0827},{0xBF01,0x0828},{0xBF08,0x0829},
+    {0xBF09,0x082A},{0xBF18,0x082B},{0xBF19,0x082C},{0xBF1B,0x082D},{0xBF1C,0x082E},{0xBF1D,0x082F},{0xBF40,0x0830},{0xBF41,0x0831},
+    {0xBF44,0x0832},{0xBF48,0x0833},{0xBF50,0x0834},{0xBF51,0x0835},{0xBF55,0x0836},{0xBF94,0x0837},{0xBFB0,0x0838},{0xBFC5,0x0839},
+    {0xBFCC,0x083A},{0xBFCD,0x083B},{0xBFD0,0x083C},{0xBFD4,0x083D},{0xBFDC,0x083E},{0xBFDF,0x083F},{0xBFE1,0x0840},{0xC03C,0x0841},
+    {0xC051,0x0842},{0xC058,0x0843},{0xC05C,0x0844},{0xC060,0x0845},{0xC068,0x0846},{0xC069,0x0847},{0xC090,0x0848},{0xC091,0x0849},
+    {0xC094,0x084A},{0xC098,0x084B},{0xC0A0,0x084C},{0xC0A1,0x084D},{0xC0A3,0x084E},{0xC0A5,0x084F},{0xC0AC,0x0850},{0xC0AD,0x0851},
+    {0xC0AF,0x0852},{0xC0B0,0x0853},{0xC0B3,0x0854},{0xC0B4,0x0855},{0xC0B5,0x0856},{0xC0B6,0x0857},{0xC0BC,0x0858},{0xC0BD,0x0859},
+    {0xC0BF,0x085A},{0xC0C0,0x085B},{0xC0C1,0x085C},{0xC0C5,0x085D},{0xC0C8,0x085E},{0xC0C9,0x085F},{0xC0CC,0x0860},{0xC0D0,0x0861},
+    {0xC0D8,0x0862},{0xC0D9,0x0863},{0xC0DB,0x0864},{0xC0DC,0x0865},{0xC0DD,0x0866},{0xC0E4,0x0867},{0xC0E5,0x0868},{0xC0E8,0x0869},
+    {0xC0EC,0x086A},{0xC0F4,0x086B},{0xC0F5,0x086C},{0xC0F7,0x086D},{0xC0F9,0x086E},{0xC100,0x086F},{0xC104,0x0870},{0xC108,0x0871},
+    {0xC110,0x0872},{0xC115,0x0873},{0xC11C,0x0874},{0xC11D,0x0875},{0xC11E,0x0876},{0xC11F,0x0877},{0xC120,0x0878},{0xC123,0x0879},
+    {0xC124,0x087A},{0xC126,0x087B},{0xC127,0x087C},{0xC12C,0x087D},{0xC12D,0x087E},{0xC12F,0x087F},{0xC130,0x0880},{0xC131,0x0881},
+    {0xC136,0x0882},{0xC138,0x0883},{0xC139,0x0884},{0xC13C,0x0885},{0xC140,0x0886},{0xC148,0x0887},{0xC149,0x0888},{0xC14B,0x0889},
+    {0xC14C,0x088A},{0xC14D,0x088B},{0xC154,0x088C},{0xC155,0x088D},{0xC158,0x088E},{0xC15C,0x088F},{0xC164,0x0890},{0xC165,0x0891},
+    {0xC167,0x0892},{0xC168,0x0893},{0xC169,0x0894},{0xC170,0x0895},{0xC174,0x0896},{0xC178,0x0897},{0xC185,0x0898},{0xC18C,0x0899},
+    {0xC18D,0x089A},{0xC18E,0x089B},{0xC190,0x089C},{0xC194,0x089D},{0xC196,0x089E},{0xC19C,0x089F},{0xC19D,0x08A0},{0xC19F,0x08A1},
+    {0xC1A1,0x08A2},{0xC1A5,0x08A3},{0xC1A8,0x08A4},{0xC1A9,0x08A5},{0xC1AC,0x08A6},{0xC1B0,0x08A7},{0xC1BD,0x08A8},{0xC1C4,0x08A9},
+    {0xC1C8,0x08AA},{0xC1CC,0x08AB},{0xC1D4,0x08AC},{0xC1D7,0x08AD},{0xC1D8,0x08AE},{0xC1E0,0x08AF},{0xC1E4,0x08B0},{0xC1E8,0x08B1},
+    {0xC1F0,0x08B2},{0xC1F1,0x08B3},{0xC1F3,0x08B4},{0xC1FC,0x08B5},{0xC1FD,0x08B6},{0xC200,0x08B7},{0xC204,0x08B8},{0xC20C,0x08B9},
+    {0xC20D,0x08BA},{0xC20F,0x08BB},{0xC211,0x08BC},{0xC218,0x08BD},{0xC219,0x08BE},{0xC21C,0x08BF},{0xC21F,0x08C0},{0xC220,0x08C1},
+    {0xC228,0x08C2},{0xC229,0x08C3},{0xC22B,0x08C4},{0xC22D,0x08C5},{0xC22F,0x08C6},{0xC231,0x08C7},{0xC232,0x08C8},{0xC234,0x08C9},
+    {0xC248,0x08CA},{0xC250,0x08CB},{0xC251,0x08CC},{0xC254,0x08CD},{0xC258,0x08CE},{0xC260,0x08CF},{0xC265,0x08D0},{0xC26C,0x08D1},
+    {0xC26D,0x08D2},{0xC270,0x08D3},{0xC274,0x08D4},{0xC27C,0x08D5},{0xC27D,0x08D6},{0xC27F,0x08D7},{0xC281,0x08D8},{0xC288,0x08D9},
+    {0xC289,0x08DA},{0xC290,0x08DB},{0xC298,0x08DC},{0xC29B,0x08DD},{0xC29D,0x08DE},{0xC2A4,0x08DF},{0xC2A5,0x08E0},{0xC2A8,0x08E1},
+    {0xC2AC,0x08E2},{0xC2AD,0x08E3},{0xC2B4,0x08E4},{0xC2B5,0x08E5},{0xC2B7,0x08E6},{0xC2B9,0x08E7},{0xC2DC,0x08E8},{0xC2DD,0x08E9},
+    {0xC2E0,0x08EA},{0xC2E3,0x08EB},{0xC2E4,0x08EC},{0xC2EB,0x08ED},{0xC2EC,0x08EE},{0xC2ED,0x08EF},{0xC2EF,0x08F0},{0xC2F1,0x08F1},
+    {0xC2F6,0x08F2},{0xC2F8,0x08F3},{0xC2F9,0x08F4},{0xC2FB,0x08F5},{0xC2FC,0x08F6},{0xC300,0x08F7},{0xC308,0x08F8},{0xC309,0x08F9},
+    {0xC30C,0x08FA},{0xC30D,0x08FB},{0xC313,0x08FC},{0xC314,0x08FD},{0xC315,0x08FE},{0xC318,0x08FF},{0xC31C,0x0900},{0xC324,0x0901},
+    {0xC325,0x0902},{0xC328,0x0903},{0xC329,0x0904},{0xC330,0x0D50},{0xC345,0x0905},{0xC368,0x0906},{0xC369,0x0907},{0xC36C,0x0908},
+    {0xC370,0x0909},{0xC372,0x090A},{0xC378,0x090B},{0xC379,0x090C},{0xC37C,0x090D},{0xC37D,0x090E},{0xC384,0x090F},{0xC388,0x0910},
+    {0xC38C,0x0911},{0xC3BC,0x0D51},{0xC3C0,0x0912},{0xC3D8,0x0913},{0xC3D9,0x0914},{0xC3DC,0x0915},{0xC3DF,0x0916},{0xC3E0,0x0917},
+    {0xC3E2,0x0918},{0xC3E8,0x0919},{0xC3E9,0x091A},{0xC3ED,0x091B},{0xC3F4,0x091C},{0xC3F5,0x091D},{0xC3F8,0x091E},{0xC408,0x091F},
+    {0xC410,0x0920},{0xC424,0x0921},{0xC42C,0x0922},{0xC430,0x0923},{0xC434,0x0924},{0xC43C,0x0925},{0xC43D,0x0926},{0xC448,0x0927},
+    {0xC464,0x0928},{0xC465,0x0929},{0xC468,0x092A},{0xC46C,0x092B},{0xC474,0x092C},{0xC475,0x092D},{0xC479,0x092E},{0xC480,0x092F},
+    {0xC494,0x0930},{0xC49C,0x0931},{0xC4B8,0x0932},{0xC4BC,0x0933},{0xC4D4,0x0D52},{0xC4E9,0x0934},{0xC4F0,0x0935},{0xC4F1,0x0936},
+    {0xC4F4,0x0937},{0xC4F8,0x0938},{0xC4FA,0x0939},{0xC4FF,0x093A},{0xC500,0x093B},{0xC501,0x093C},{0xC50C,0x093D},{0xC510,0x093E},
+    {0xC514,0x093F},{0xC51C,0x0940},{0xC528,0x0941},{0xC529,0x0942},{0xC52C,0x0943},{0xC530,0x0944},{0xC538,0x0945},{0xC539,0x0946},
+    {0xC53B,0x0947},{0xC53D,0x0948},{0xC544,0x0949},{0xC545,0x094A},{0xC548,0x094B},{0xC549,0x094C},{0xC54A,0x094D},{0xC54C,0x094E},
+    {0xC54D,0x094F},{0xC54E,0x0950},{0xC553,0x0951},{0xC554,0x0952},{0xC555,0x0953},{0xC557,0x0954},{0xC558,0x0955},{0xC559,0x0956},
+    {0xC55D,0x0957},{0xC55E,0x0958},{0xC560,0x0959},{0xC561,0x095A},{0xC564,0x095B},{0xC568,0x095C},{0xC570,0x095D},{0xC571,0x095E},
+    {0xC573,0x095F},{0xC574,0x0960},{0xC575,0x0961},{0xC57C,0x0962},{0xC57D,0x0963},{0xC580,0x0964},{0xC584,0x0965},{0xC587,0x0966},
+    {0xC58C,0x0967},{0xC58D,0x0968},{0xC58F,0x0969},{0xC591,0x096A},{0xC595,0x096B},{0xC597,0x096C},{0xC598,0x096D},{0xC59C,0x096E},
+    {0xC5A0,0x096F},{0xC5A9,0x0970},{0xC5B4,0x0971},{0xC5B5,0x0972},{0xC5B8,0x0973},{0xC5B9,0x0974},{0xC5BB,0x0975},{0xC5BC,0x0976},
+    {0xC5BD,0x0977},{0xC5BE,0x0978},{0xC5C4,0x0979},{0xC5C5,0x097A},{0xC5C6,0x097B},{0xC5C7,0x097C},{0xC5C8,0x097D},{0xC5C9,0x097E},
+    {0xC5CA,0x097F},{0xC5CC,0x0980},{0xC5CE,0x0981},{0xC5D0,0x0982},{0xC5D1,0x0983},{0xC5D4,0x0984},{0xC5D8,0x0985},{0xC5E0,0x0986},
+    {0xC5E1,0x0987},{0xC5E3,0x0988},{0xC5E5,0x0989},{0xC5EC,0x098A},{0xC5ED,0x098B},{0xC5EE,0x098C},{0xC5F0,0x098D},{0xC5F4,0x098E},
+    {0xC5F6,0x098F},{0xC5F7,0x0990},{0xC5FC,0x0991},{0xC5FD,0x0992},{0xC5FE,0x0993},{0xC5FF,0x0994},{0xC600,0x0995},{0xC601,0x0996},
+    {0xC605,0x0997},{0xC606,0x0998},{0xC607,0x0999},{0xC608,0x099A},{0xC60C,0x099B},{0xC610,0x099C},{0xC618,0x099D},{0xC619,0x099E},
+    {0xC61B,0x099F},{0xC61C,0x09A0},{0xC624,0x09A1},{0xC625,0x09A2},{0xC628,0x09A3},{0xC62C,0x09A4},{0xC62D,0x09A5},{0xC62E,0x09A6},
+    {0xC630,0x09A7},{0xC633,0x09A8},{0xC634,0x09A9},{0xC635,0x09AA},{0xC637,0x09AB},{0xC639,0x09AC},{0xC63B,0x09AD},{0xC640,0x09AE},
+    {0xC641,0x09AF},{0xC644,0x09B0},{0xC648,0x09B1},{0xC650,0x09B2},{0xC651,0x09B3},{0xC653,0x09B4},{0xC654,0x09B5},{0xC655,0x09B6},
+    {0xC65C,0x09B7},{0xC65D,0x09B8},{0xC660,0x09B9},{0xC66C,0x09BA},{0xC66F,0x09BB},{0xC671,0x09BC},{0xC678,0x09BD},{0xC679,0x09BE},
+    {0xC67C,0x09BF},{0xC680,0x09C0},{0xC688,0x09C1},{0xC689,0x09C2},{0xC68B,0x09C3},{0xC68D,0x09C4},{0xC694,0x09C5},{0xC695,0x09C6},
+    {0xC698,0x09C7},{0xC69C,0x09C8},{0xC6A4,0x09C9},{0xC6A5,0x09CA},{0xC6A7,0x09CB},{0xC6A9,0x09CC},{0xC6B0,0x09CD},{0xC6B1,0x09CE},
+    {0xC6B4,0x09CF},{0xC6B8,0x09D0},{0xC6B9,0x09D1},{0xC6BA,0x09D2},{0xC6C0,0x09D3},{0xC6C1,0x09D4},{0xC6C3,0x09D5},{0xC6C5,0x09D6},
+    {0xC6CC,0x09D7},{0xC6CD,0x09D8},{0xC6D0,0x09D9},{0xC6D4,0x09DA},{0xC6DC,0x09DB},{0xC6DD,0x09DC},{0xC6E0,0x09DD},{0xC6E1,0x09DE},
+    {0xC6E8,0x09DF},{0xC6E9,0x09E0},{0xC6EC,0x09E1},{0xC6F0,0x09E2},{0xC6F8,0x09E3},{0xC6F9,0x09E4},{0xC6FD,0x09E5},{0xC704,0x09E6},
+    {0xC705,0x09E7},{0xC708,0x09E8},{0xC70C,0x09E9},{0xC714,0x09EA},{0xC715,0x09EB},{0xC717,0x09EC},{0xC719,0x09ED},{0xC720,0x09EE},
+    {0xC721,0x09EF},{0xC724,0x09F0},{0xC728,0x09F1},{0xC730,0x09F2},{0xC731,0x09F3},{0xC733,0x09F4},{0xC735,0x09F5},{0xC737,0x09F6},
+    {0xC73C,0x09F7},{0xC73D,0x09F8},{0xC740,0x09F9},{0xC744,0x09FA},{0xC74A,0x09FB},{0xC74C,0x09FC},{0xC74D,0x09FD},{0xC74F,0x09FE},
+    {0xC751,0x09FF},{0xC752,0x0A00},{0xC753,0x0A01},{0xC754,0x0A02},{0xC755,0x0A03},{0xC756,0x0A04},{0xC757,0x0A05},{0xC758,0x0A06},
+    {0xC75C,0x0A07},{0xC760,0x0A08},{0xC768,0x0A09},{0xC76B,0x0A0A},{0xC774,0x0A0B},{0xC775,0x0A0C},{0xC778,0x0A0D},{0xC77C,0x0A0E},
+    {0xC77D,0x0A0F},{0xC77E,0x0A10},{0xC783,0x0A11},{0xC784,0x0A12},{0xC785,0x0A13},{0xC787,0x0A14},{0xC788,0x0A15},{0xC789,0x0A16},
+    {0xC78A,0x0A17},{0xC78E,0x0A18},{0xC790,0x0A19},{0xC791,0x0A1A},{0xC794,0x0A1B},{0xC796,0x0A1C},{0xC797,0x0A1D},{0xC798,0x0A1E},
+    {0xC79A,0x0A1F},{0xC7A0,0x0A20},{0xC7A1,0x0A21},{0xC7A3,0x0A22},{0xC7A4,0x0A23},{0xC7A5,0x0A24},{0xC7A6,0x0A25},{0xC7AC,0x0A26},
+    {0xC7AD,0x0A27},{0xC7B0,0x0A28},{0xC7B4,0x0A29},{0xC7BC,0x0A2A},{0xC7BD,0x0A2B},{0xC7BF,0x0A2C},{0xC7C0,0x0A2D},{0xC7C1,0x0A2E},
+    {0xC7C8,0x0A2F},{0xC7C9,0x0A30},{0xC7CC,0x0A31},{0xC7CE,0x0A32},{0xC7D0,0x0A33},{0xC7D8,0x0A34},{0xC7DD,0x0A35},{0xC7E4,0x0A36},
+    {0xC7E8,0x0A37},{0xC7EC,0x0A38},{0xC800,0x0A39},{0xC801,0x0A3A},{0xC804,0x0A3B},{0xC808,0x0A3C},{0xC80A,0x0A3D},{0xC810,0x0A3E},
+    {0xC811,0x0A3F},{0xC813,0x0A40},{0xC815,0x0A41},{0xC816,0x0A42},{0xC81C,0x0A43},{0xC81D,0x0A44},{0xC820,0x0A45},{0xC824,0x0A46},
+    {0xC82C,0x0A47},{0xC82D,0x0A48},{0xC82F,0x0A49},{0xC831,0x0A4A},{0xC838,0x0A4B},{0xC83C,0x0A4C},{0xC840,0x0A4D},{0xC848,0x0A4E},
+    {0xC849,0x0A4F},{0xC84C,0x0A50},{0xC84D,0x0A51},{0xC854,0x0A52},{0xC870,0x0A53},{0xC871,0x0A54},{0xC874,0x0A55},{0xC878,0x0A56},
+    {0xC87A,0x0A57},{0xC880,0x0A58},{0xC881,0x0A59},{0xC883,0x0A5A},{0xC885,0x0A5B},{0xC886,0x0A5C},{0xC887,0x0A5D},{0xC88B,0x0A5E},
+    {0xC88C,0x0A5F},{0xC88D,0x0A60},{0xC894,0x0A61},{0xC89D,0x0A62},{0xC89F,0x0A63},{0xC8A1,0x0A64},{0xC8A8,0x0A65},{0xC8BC,0x0A66},
+    {0xC8BD,0x0A67},{0xC8C4,0x0A68},{0xC8C8,0x0A69},{0xC8CC,0x0A6A},{0xC8D4,0x0A6B},{0xC8D5,0x0A6C},{0xC8D7,0x0A6D},{0xC8D9,0x0A6E},
+    {0xC8E0,0x0A6F},{0xC8E1,0x0A70},{0xC8E4,0x0A71},{0xC8F5,0x0A72},{0xC8FC,0x0A73},{0xC8FD,0x0A74},{0xC900,0x0A75},{0xC904,0x0A76},
+    {0xC905,0x0A77},{0xC906,0x0A78},{0xC90C,0x0A79},{0xC90D,0x0A7A},{0xC90F,0x0A7B},{0xC911,0x0A7C},{0xC918,0x0A7D},{0xC92C,0x0A7E},
+    {0xC934,0x0A7F},{0xC950,0x0A80},{0xC951,0x0A81},{0xC954,0x0A82},{0xC958,0x0A83},{0xC960,0x0A84},{0xC961,0x0A85},{0xC963,0x0A86},
+    {0xC96C,0x0A87},{0xC970,0x0A88},{0xC974,0x0A89},{0xC97C,0x0A8A},{0xC988,0x0A8B},{0xC989,0x0A8C},{0xC98C,0x0A8D},{0xC990,0x0A8E},
+    {0xC998,0x0A8F},{0xC999,0x0A90},{0xC99B,0x0A91},{0xC99D,0x0A92},{0xC9C0,0x0A93},{0xC9C1,0x0A94},{0xC9C4,0x0A95},{0xC9C7,0x0A96},
+    {0xC9C8,0x0A97},{0xC9CA,0x0A98},{0xC9D0,0x0A99},{0xC9D1,0x0A9A},{0xC9D3,0x0A9B},{0xC9D5,0x0A9C},{0xC9D6,0x0A9D},{0xC9D9,0x0A9E},
+    {0xC9DA,0x0A9F},{0xC9DC,0x0AA0},{0xC9DD,0x0AA1},{0xC9E0,0x0AA2},{0xC9E2,0x0AA3},{0xC9E4,0x0AA4},{0xC9E7,0x0AA5},{0xC9EC,0x0AA6},
+    {0xC9ED,0x0AA7},{0xC9EF,0x0AA8},{0xC9F0,0x0AA9},{0xC9F1,0x0AAA},{0xC9F8,0x0AAB},{0xC9F9,0x0AAC},{0xC9FC,0x0AAD},{0xCA00,0x0AAE},
+    {0xCA08,0x0AAF},{0xCA09,0x0AB0},{0xCA0B,0x0AB1},{0xCA0C,0x0AB2},{0xCA0D,0x0AB3},{0xCA14,0x0AB4},{0xCA18,0x0AB5},{0xCA29,0x0AB6},
+    {0xCA4C,0x0AB7},{0xCA4D,0x0AB8},{0xCA50,0x0AB9},{0xCA54,0x0ABA},{0xCA5C,0x0ABB},{0xCA5D,0x0ABC},{0xCA5F,0x0ABD},{0xCA60,0x0ABE},
+    {0xCA61,0x0ABF},{0xCA68,0x0AC0},{0xCA7D,0x0AC1},{0xCA84,0x0AC2},{0xCA98,0x0AC3},{0xCABC,0x0AC4},{0xCABD,0x0AC5},{0xCAC0,0x0AC6},
+    {0xCAC4,0x0AC7},{0xCACC,0x0AC8},{0xCACD,0x0AC9},{0xCACF,0x0ACA},{0xCAD1,0x0ACB},{0xCAD3,0x0ACC},{0xCAD8,0x0ACD},{0xCAD9,0x0ACE},
+    {0xCAE0,0x0ACF},{0xCAEC,0x0AD0},{0xCAF4,0x0AD1},{0xCB08,0x0AD2},{0xCB10,0x0AD3},{0xCB14,0x0AD4},{0xCB18,0x0AD5},{0xCB20,0x0AD6},
+    {0xCB21,0x0AD7},{0xCB2C,0x0D53},{0xCB41,0x0AD8},{0xCB48,0x0AD9},{0xCB49,0x0ADA},{0xCB4C,0x0ADB},{0xCB50,0x0ADC},{0xCB58,0x0ADD},
+    {0xCB59,0x0ADE},{0xCB5D,0x0ADF},{0xCB64,0x0AE0},{0xCB78,0x0AE1},{0xCB79,0x0AE2},{0xCB9C,0x0AE3},{0xCBB8,0x0AE4},{0xCBD4,0x0AE5},
+    {0xCBE4,0x0AE6},{0xCBE7,0x0AE7},{0xCBE9,0x0AE8},{0xCC0C,0x0AE9},{0xCC0D,0x0AEA},{0xCC10,0x0AEB},{0xCC14,0x0AEC},{0xCC1C,0x0AED},
+    {0xCC1D,0x0AEE},{0xCC21,0x0AEF},{0xCC22,0x0AF0},{0xCC27,0x0AF1},{0xCC28,0x0AF2},{0xCC29,0x0AF3},{0xCC2C,0x0AF4},{0xCC2E,0x0AF5},
+    {0xCC30,0x0AF6},{0xCC38,0x0AF7},{0xCC39,0x0AF8},{0xCC3B,0x0AF9},{0xCC3C,0x0AFA},{0xCC3D,0x0AFB},{0xCC3E,0x0AFC},{0xCC44,0x0AFD},
+    {0xCC45,0x0AFE},{0xCC48,0x0AFF},{0xCC4C,0x0B00},{0xCC54,0x0B01},{0xCC55,0x0B02},{0xCC57,0x0B03},{0xCC58,0x0B04},{0xCC59,0x0B05},
+    {0xCC60,0x0B06},{0xCC64,0x0B07},{0xCC66,0x0B08},{0xCC68,0x0B09},{0xCC70,0x0B0A},{0xCC75,0x0B0B},{0xCC98,0x0B0C},{0xCC99,0x0B0D},
+    {0xCC9C,0x0B0E},{0xCCA0,0x0B0F},{0xCCA8,0x0B10},{0xCCA9,0x0B11},{0xCCAB,0x0B12},{0xCCAC,0x0B13},{0xCCAD,0x0B14},{0xCCB4,0x0B15},
+    {0xCCB5,0x0B16},{0xCCB8,0x0B17},{0xCCBC,0x0B18},{0xCCC4,0x0B19},{0xCCC5,0x0B1A},{0xCCC7,0x0B1B},{0xCCC9,0x0B1C},{0xCCD0,0x0B1D},
+    {0xCCD4,0x0B1E},{0xCCE4,0x0B1F},{0xCCEC,0x0B20},{0xCCF0,0x0B21},{0xCD01,0x0B22},{0xCD08,0x0B23},{0xCD09,0x0B24},{0xCD0C,0x0B25},
+    {0xCD10,0x0B26},{0xCD18,0x0B27},{0xCD19,0x0B28},{0xCD1B,0x0B29},{0xCD1D,0x0B2A},{0xCD24,0x0B2B},{0xCD28,0x0B2C},{0xCD2C,0x0B2D},
+    {0xCD39,0x0B2E},{0xCD5C,0x0B2F},{0xCD60,0x0B30},{0xCD64,0x0B31},{0xCD6C,0x0B32},{0xCD6D,0x0B33},{0xCD6F,0x0B34},{0xCD71,0x0B35},
+    {0xCD78,0x0B36},{0xCD88,0x0B37},{0xCD94,0x0B38},{0xCD95,0x0B39},{0xCD98,0x0B3A},{0xCD9C,0x0B3B},{0xCDA4,0x0B3C},{0xCDA5,0x0B3D},
+    {0xCDA7,0x0B3E},{0xCDA9,0x0B3F},{0xCDB0,0x0B40},{0xCDC4,0x0B41},{0xCDCC,0x0B42},{0xCDD0,0x0B43},{0xCDE8,0x0B44},{0xCDEC,0x0B45},
+    {0xCDF0,0x0B46},{0xCDF8,0x0B47},{0xCDF9,0x0B48},{0xCDFB,0x0B49},{0xCDFD,0x0B4A},{0xCE04,0x0B4B},{0xCE08,0x0B4C},{0xCE0C,0x0B4D},
+    {0xCE14,0x0B4E},{0xCE19,0x0B4F},{0xCE20,0x0B50},{0xCE21,0x0B51},{0xCE24,0x0B52},{0xCE28,0x0B53},{0xCE30,0x0B54},{0xCE31,0x0B55},
+    {0xCE33,0x0B56},{0xCE35,0x0B57},{0xCE58,0x0B58},{0xCE59,0x0B59},{0xCE5C,0x0B5A},{0xCE5F,0x0B5B},{0xCE60,0x0B5C},{0xCE61,0x0B5D},
+    {0xCE68,0x0B5E},{0xCE69,0x0B5F},{0xCE6B,0x0B60},{0xCE6D,0x0B61},{0xCE74,0x0B62},{0xCE75,0x0B63},{0xCE78,0x0B64},{0xCE7C,0x0B65},
+    {0xCE84,0x0B66},{0xCE85,0x0B67},{0xCE87,0x0B68},{0xCE89,0x0B69},{0xCE90,0x0B6A},{0xCE91,0x0B6B},{0xCE94,0x0B6C},{0xCE98,0x0B6D},
+    {0xCEA0,0x0B6E},{0xCEA1,0x0B6F},{0xCEA3,0x0B70},{0xCEA4,0x0B71},{0xCEA5,0x0B72},{0xCEAC,0x0B73},{0xCEAD,0x0B74},{0xCEC1,0x0B75},
+    {0xCEE4,0x0B76},{0xCEE5,0x0B77},{0xCEE8,0x0B78},{0xCEEB,0x0B79},{0xCEEC,0x0B7A},{0xCEF4,0x0B7B},{0xCEF5,0x0B7C},{0xCEF7,0x0B7D},
+    {0xCEF8,0x0B7E},{0xCEF9,0x0B7F},{0xCF00,0x0B80},{0xCF01,0x0B81},{0xCF04,0x0B82},{0xCF08,0x0B83},{0xCF10,0x0B84},{0xCF11,0x0B85},
+    {0xCF13,0x0B86},{0xCF15,0x0B87},{0xCF1C,0x0B88},{0xCF20,0x0B89},{0xCF24,0x0B8A},{0xCF2C,0x0B8B},{0xCF2D,0x0B8C},{0xCF2F,0x0B8D},
+    {0xCF30,0x0B8E},{0xCF31,0x0B8F},{0xCF38,0x0B90},{0xCF54,0x0B91},{0xCF55,0x0B92},{0xCF58,0x0B93},{0xCF5C,0x0B94},{0xCF64,0x0B95},
+    {0xCF65,0x0B96},{0xCF67,0x0B97},{0xCF69,0x0B98},{0xCF70,0x0B99},{0xCF71,0x0B9A},{0xCF74,0x0B9B},{0xCF78,0x0B9C},{0xCF80,0x0B9D},
+    {0xCF85,0x0B9E},{0xCF8C,0x0B9F},{0xCFA1,0x0BA0},{0xCFA8,0x0BA1},{0xCFB0,0x0BA2},{0xCFC4,0x0BA3},{0xCFE0,0x0BA4},{0xCFE1,0x0BA5},
+    {0xCFE4,0x0BA6},{0xCFE8,0x0BA7},{0xCFF0,0x0BA8},{0xCFF1,0x0BA9},{0xCFF3,0x0BAA},{0xCFF5,0x0BAB},{0xCFFC,0x0BAC},{0xD000,0x0BAD},
+    {0xD004,0x0BAE},{0xD011,0x0BAF},{0xD018,0x0BB0},{0xD02D,0x0BB1},{0xD034,0x0BB2},{0xD035,0x0BB3},{0xD038,0x0BB4},{0xD03C,0x0BB5},
+    {0xD044,0x0BB6},{0xD045,0x0BB7},{0xD047,0x0BB8},{0xD049,0x0BB9},{0xD050,0x0BBA},{0xD054,0x0BBB},{0xD058,0x0BBC},{0xD060,0x0BBD},
+    {0xD06C,0x0BBE},{0xD06D,0x0BBF},{0xD070,0x0BC0},{0xD074,0x0BC1},{0xD07C,0x0BC2},{0xD07D,0x0BC3},{0xD081,0x0BC4},{0xD0A4,0x0BC5},
+    {0xD0A5,0x0BC6},{0xD0A8,0x0BC7},{0xD0AC,0x0BC8},{0xD0B4,0x0BC9},{0xD0B5,0x0BCA},{0xD0B7,0x0BCB},{0xD0B9,0x0BCC},{0xD0C0,0x0BCD},
+    {0xD0C1,0x0BCE},{0xD0C4,0x0BCF},{0xD0C8,0x0BD0},{0xD0C9,0x0BD1},{0xD0D0,0x0BD2},{0xD0D1,0x0BD3},{0xD0D3,0x0BD4},{0xD0D4,0x0BD5},
+    {0xD0D5,0x0BD6},{0xD0DC,0x0BD7},{0xD0DD,0x0BD8},{0xD0E0,0x0BD9},{0xD0E4,0x0BDA},{0xD0EC,0x0BDB},{0xD0ED,0x0BDC},{0xD0EF,0x0BDD},
+    {0xD0F0,0x0BDE},{0xD0F1,0x0BDF},{0xD0F8,0x0BE0},{0xD10D,0x0BE1},{0xD130,0x0BE2},{0xD131,0x0BE3},{0xD134,0x0BE4},{0xD138,0x0BE5},
+    {0xD13A,0x0BE6},{0xD140,0x0BE7},{0xD141,0x0BE8},{0xD143,0x0BE9},{0xD144,0x0BEA},{0xD145,0x0BEB},{0xD14C,0x0BEC},{0xD14D,0x0BED},
+    {0xD150,0x0BEE},{0xD154,0x0BEF},{0xD15C,0x0BF0},{0xD15D,0x0BF1},{0xD15F,0x0BF2},{0xD161,0x0BF3},{0xD168,0x0BF4},{0xD16C,0x0BF5},
+    {0xD17C,0x0BF6},{0xD184,0x0BF7},{0xD188,0x0BF8},{0xD1A0,0x0BF9},{0xD1A1,0x0BFA},{0xD1A4,0x0BFB},{0xD1A8,0x0BFC},{0xD1B0,0x0BFD},
+    {0xD1B1,0x0BFE},{0xD1B3,0x0BFF},{0xD1B5,0x0C00},{0xD1BA,0x0C01},{0xD1BC,0x0C02},{0xD1C0,0x0C03},{0xD1D8,0x0C04},{0xD1F4,0x0C05},
+    {0xD1F8,0x0C06},{0xD207,0x0C07},{0xD209,0x0C08},{0xD210,0x0C09},{0xD22C,0x0C0A},{0xD22D,0x0C0B},{0xD230,0x0C0C},{0xD234,0x0C0D},
+    {0xD23C,0x0C0E},{0xD23D,0x0C0F},{0xD23F,0x0C10},{0xD241,0x0C11},{0xD248,0x0C12},{0xD25C,0x0C13},{0xD264,0x0C14},{0xD280,0x0C15},
+    {0xD281,0x0C16},{0xD284,0x0C17},{0xD288,0x0C18},{0xD290,0x0C19},{0xD291,0x0C1A},{0xD295,0x0C1B},{0xD29C,0x0C1C},{0xD2A0,0x0C1D},
+    {0xD2A4,0x0C1E},{0xD2AC,0x0C1F},{0xD2B1,0x0C20},{0xD2B8,0x0C21},{0xD2B9,0x0C22},{0xD2BC,0x0C23},{0xD2BF,0x0C24},{0xD2C0,0x0C25},
+    {0xD2C2,0x0C26},{0xD2C8,0x0C27},{0xD2C9,0x0C28},{0xD2CB,0x0C29},{0xD2D4,0x0C2A},{0xD2D8,0x0C2B},{0xD2DC,0x0C2C},{0xD2E4,0x0C2D},
+    {0xD2E5,0x0C2E},{0xD2F0,0x0C2F},{0xD2F1,0x0C30},{0xD2F4,0x0C31},{0xD2F8,0x0C32},{0xD300,0x0C33},{0xD301,0x0C34},{0xD303,0x0C35},
+    {0xD305,0x0C36},{0xD30C,0x0C37},{0xD30D,0x0C38},{0xD30E,0x0C39},{0xD310,0x0C3A},{0xD314,0x0C3B},{0xD316,0x0C3C},{0xD31C,0x0C3D},
+    {0xD31D,0x0C3E},{0xD31F,0x0C3F},{0xD320,0x0C40},{0xD321,0x0C41},{0xD325,0x0C42},{0xD328,0x0C43},{0xD329,0x0C44},{0xD32C,0x0C45},
+    {0xD330,0x0C46},{0xD338,0x0C47},{0xD339,0x0C48},{0xD33B,0x0C49},{0xD33C,0x0C4A},{0xD33D,0x0C4B},{0xD344,0x0C4C},{0xD345,0x0C4D},
+    {0xD37C,0x0C4E},{0xD37D,0x0C4F},{0xD380,0x0C50},{0xD384,0x0C51},{0xD38C,0x0C52},{0xD38D,0x0C53},{0xD38F,0x0C54},{0xD390,0x0C55},
+    {0xD391,0x0C56},{0xD398,0x0C57},{0xD399,0x0C58},{0xD39C,0x0C59},{0xD3A0,0x0C5A},{0xD3A8,0x0C5B},{0xD3A9,0x0C5C},{0xD3AB,0x0C5D},
+    {0xD3AD,0x0C5E},{0xD3B4,0x0C5F},{0xD3B8,0x0C60},{0xD3BC,0x0C61},{0xD3C4,0x0C62},{0xD3C5,0x0C63},{0xD3C8,0x0C64},{0xD3C9,0x0C65},
+    {0xD3D0,0x0C66},{0xD3D8,0x0C67},{0xD3E1,0x0C68},{0xD3E3,0x0C69},{0xD3EC,0x0C6A},{0xD3ED,0x0C6B},{0xD3F0,0x0C6C},{0xD3F4,0x0C6D},
+    {0xD3FC,0x0C6E},{0xD3FD,0x0C6F},{0xD3FF,0x0C70},{0xD401,0x0C71},{0xD408,0x0C72},{0xD41D,0x0C73},{0xD440,0x0C74},{0xD444,0x0C75},
+    {0xD45C,0x0C76},{0xD460,0x0C77},{0xD464,0x0C78},{0xD46D,0x0C79},{0xD46F,0x0C7A},{0xD478,0x0C7B},{0xD479,0x0C7C},{0xD47C,0x0C7D},
+    {0xD47F,0x0C7E},{0xD480,0x0C7F},{0xD482,0x0C80},{0xD488,0x0C81},{0xD489,0x0C82},{0xD48B,0x0C83},{0xD48D,0x0C84},{0xD494,0x0C85},
+    {0xD4A9,0x0C86},{0xD4CC,0x0C87},{0xD4D0,0x0C88},{0xD4D4,0x0C89},{0xD4DC,0x0C8A},{0xD4DF,0x0C8B},{0xD4E8,0x0C8C},{0xD4EC,0x0C8D},
+    {0xD4F0,0x0C8E},{0xD4F8,0x0C8F},{0xD4FB,0x0C90},{0xD4FD,0x0C91},{0xD504,0x0C92},{0xD508,0x0C93},{0xD50C,0x0C94},{0xD514,0x0C95},
+    {0xD515,0x0C96},{0xD517,0x0C97},{0xD53C,0x0C98},{0xD53D,0x0C99},{0xD540,0x0C9A},{0xD544,0x0C9B},{0xD54C,0x0C9C},{0xD54D,0x0C9D},
+    {0xD54F,0x0C9E},{0xD551,0x0C9F},{0xD558,0x0CA0},{0xD559,0x0CA1},{0xD55C,0x0CA2},{0xD560,0x0CA3},{0xD565,0x0CA4},{0xD568,0x0CA5},
+    {0xD569,0x0CA6},{0xD56B,0x0CA7},{0xD56D,0x0CA8},{0xD574,0x0CA9},{0xD575,0x0CAA},{0xD578,0x0CAB},{0xD57C,0x0CAC},{0xD584,0x0CAD},
+    {0xD585,0x0CAE},{0xD587,0x0CAF},{0xD588,0x0CB0},{0xD589,0x0CB1},{0xD590,0x0CB2},{0xD5A5,0x0CB3},{0xD5C8,0x0CB4},{0xD5C9,0x0CB5},
+    {0xD5CC,0x0CB6},{0xD5D0,0x0CB7},{0xD5D2,0x0CB8},{0xD5D8,0x0CB9},{0xD5D9,0x0CBA},{0xD5DB,0x0CBB},{0xD5DD,0x0CBC},{0xD5E4,0x0CBD},
+    {0xD5E5,0x0CBE},{0xD5E8,0x0CBF},{0xD5EC,0x0CC0},{0xD5F4,0x0CC1},{0xD5F5,0x0CC2},{0xD5F7,0x0CC3},{0xD5F9,0x0CC4},{0xD600,0x0CC5},
+    {0xD601,0x0CC6},{0xD604,0x0CC7},{0xD608,0x0CC8},{0xD610,0x0CC9},{0xD611,0x0CCA},{0xD613,0x0CCB},{0xD614,0x0CCC},{0xD615,0x0CCD},
+    {0xD61C,0x0CCE},{0xD620,0x0CCF},{0xD624,0x0CD0},{0xD62D,0x0CD1},{0xD638,0x0CD2},{0xD639,0x0CD3},{0xD63C,0x0CD4},{0xD640,0x0CD5},
+    {0xD645,0x0CD6},{0xD648,0x0CD7},{0xD649,0x0CD8},{0xD64B,0x0CD9},{0xD64D,0x0CDA},{0xD651,0x0CDB},{0xD654,0x0CDC},{0xD655,0x0CDD},
+    {0xD658,0x0CDE},{0xD65C,0x0CDF},{0xD667,0x0CE0},{0xD669,0x0CE1},{0xD670,0x0CE2},{0xD671,0x0CE3},{0xD674,0x0CE4},{0xD683,0x0CE5},
+    {0xD685,0x0CE6},{0xD68C,0x0CE7},{0xD68D,0x0CE8},{0xD690,0x0CE9},{0xD694,0x0CEA},{0xD69D,0x0CEB},{0xD69F,0x0CEC},{0xD6A1,0x0CED},
+    {0xD6A8,0x0CEE},{0xD6AC,0x0CEF},{0xD6B0,0x0CF0},{0xD6B9,0x0CF1},{0xD6BB,0x0CF2},{0xD6C4,0x0CF3},{0xD6C5,0x0CF4},{0xD6C8,0x0CF5},
+    {0xD6CC,0x0CF6},{0xD6D1,0x0CF7},{0xD6D4,0x0CF8},{0xD6D7,0x0CF9},{0xD6D9,0x0CFA},{0xD6E0,0x0CFB},{0xD6E4,0x0CFC},{0xD6E8,0x0CFD},
+    {0xD6F0,0x0CFE},{0xD6F5,0x0CFF},{0xD6FC,0x0D00},{0xD6FD,0x0D01},{0xD700,0x0D02},{0xD704,0x0D03},{0xD711,0x0D04},{0xD718,0x0D05},
+    {0xD719,0x0D06},{0xD71C,0x0D07},{0xD720,0x0D08},{0xD728,0x0D09},{0xD729,0x0D0A},{0xD72B,0x0D0B},{0xD72D,0x0D0C},{0xD734,0x0D0D},
+    {0xD735,0x0D0E},{0xD738,0x0D0F},{0xD73C,0x0D10},{0xD744,0x0D11},{0xD747,0x0D12},{0xD749,0x0D13},{0xD750,0x0D14},{0xD751,0x0D15},
+    {0xD754,0x0D16},{0xD756,0x0D17},{0xD757,0x0D18},{0xD758,0x0D19},{0xD759,0x0D1A},{0xD760,0x0D1B},{0xD761,0x0D1C},{0xD763,0x0D1D},
+    {0xD765,0x0D1E},{0xD769,0x0D1F},{0xD76C,0x0D20},{0xD770,0x0D21},{0xD774,0x0D22},{0xD77C,0x0D23},{0xD77D,0x0D24},{0xD781,0x0D25},
+    {0xD788,0x0D26},{0xD789,0x0D27},{0xD78C,0x0D28},{0xD790,0x0D29},{0xD798,0x0D2A},{0xD799,0x0D2B},{0xD79B,0x0D2C},{0xD79D,0x0D2D},
+    {0xFF01,0x00E1},{0xFF05,0x0106},{0xFF06,0x0120},{0xFF08,0x00EC},{0xFF09,0x00ED},{0xFF0B,0x00F0},{0xFF0C,0x00F9},{0xFF0D,0x00F1},
+    {0xFF0E,0x00F8},{0xFF0F,0x00E7},{0xFF10,0x00A2},{0xFF11,0x00A3},{0xFF12,0x00A4},{0xFF13,0x00A5},{0xFF14,0x00A6},{0xFF15,0x00A7},
+    {0xFF16,0x00A8},{0xFF17,0x00A9},{0xFF18,0x00AA},{0xFF19,0x00AB},{0xFF1A,0x00F6},{0xFF1B,0x00F7},{0xFF1D,0x00F4},{0xFF1F,0x00E2},
+    {0xFF20,0x0104},{0xFF21,0x00AC},{0xFF22,0x00AD},{0xFF23,0x00AE},{0xFF24,0x00AF},{0xFF25,0x00B0},{0xFF26,0x00B1},{0xFF27,0x00B2},
+    {0xFF28,0x00B3},{0xFF29,0x00B4},{0xFF2A,0x00B5},{0xFF2B,0x00B6},{0xFF2C,0x00B7},{0xFF2D,0x00B8},{0xFF2E,0x00B9},{0xFF2F,0x00BA},
+    {0xFF30,0x00BB},{0xFF31,0x00BC},{0xFF32,0x00BD},{0xFF33,0x00BE},{0xFF34,0x00BF},{0xFF35,0x00C0},{0xFF36,0x00C1},{0xFF37,0x00C2},
+    {0xFF38,0x00C3},{0xFF39,0x00C4},{0xFF3A,0x00C5},{0xFF3F,0x01E4},{0xFF41,0x00C6},{0xFF42,0x00C7},{0xFF43,0x00C8},{0xFF44,0x00C9},
+    {0xFF45,0x00CA},{0xFF46,0x00CB},{0xFF47,0x00CC},{0xFF48,0x00CD},{0xFF49,0x00CE},{0xFF4A,0x00CF},{0xFF4B,0x00D0},{0xFF4C,0x00D1},
+    {0xFF4D,0x00D2},{0xFF4E,0x00D3},{0xFF4F,0x00D4},{0xFF50,0x00D5},{0xFF51,0x00D6},{0xFF52,0x00D7},{0xFF53,0x00D8},{0xFF54,0x00D9},
+    {0xFF55,0x00DA},{0xFF56,0x00DB},{0xFF57,0x00DC},{0xFF58,0x00DD},{0xFF59,0x00DE},{0xFF5A,0x00DF},
+};
+static const size_t PKSAV_GEN4_REVERSE_CHAR_MAP_SIZE =
+    sizeof(PKSAV_GEN4_REVERSE_CHAR_MAP)/sizeof(PKSAV_GEN4_REVERSE_CHAR_MAP[0]);
 
-    return PKSAV_ERROR_NONE;
+static uint32_t _pksav_gen4_import_char(
+    uint16_t game_char
+)
+{
+    // Characters with no mapping, including the terminator, are 0, which
+    // ends the string.
+    return pksav_text_page_table_find(
+               &PKSAV_GEN4_CHAR_MAP,
+               game_char
+           );
 }
 
-static enum pksav_error _pksav_gen4_export_widetext(
-    const wchar_t* p_input_widetext,
-    uint16_t* p_output_buffer,
-    size_t num_chars
+static ssize_t _pksav_gen4_export_char(
+    uint32_t code_point
 )
 {
-    assert(p_input_widetext != NULL);
-    assert(p_output_buffer != NULL);
-
-    memset(p_output_buffer, 0xFF, sizeof(uint16_t)*num_chars);
-
-    for(size_t char_index = 0; char_index < num_chars; ++char_index)
-    {
-        ssize_t index = wchar_map_index(
-                            PKSAV_GEN4_CHAR_MAP1,
-                            PKSAV_GEN4_CHAR_MAP1_SIZE,
-                            p_input_widetext[char_index]
-                        );
-        if(index == -1)
-        {
-            index = wchar_map_index(
-                        PKSAV_GEN4_CHAR_MAP2,
-                        PKSAV_GEN4_CHAR_MAP2_SIZE,
-                        p_input_widetext[char_index]
-                    );
-            if(index == -1)
-            {
-                break;
-            }
-            else
-            {
-                p_output_buffer[char_index] = (uint16_t)index;
-            }
-        } else {
-            p_output_buffer[char_index] = (uint16_t)index;
-        }
-    }
-
-    return PKSAV_ERROR_NONE;
+    return pksav_text_reverse_map_find(
+               PKSAV_GEN4_REVERSE_CHAR_MAP,
+               PKSAV_GEN4_REVERSE_CHAR_MAP_SIZE,
+               code_point
+           );
 }
 
+static const struct pksav_text_codec PKSAV_GEN4_TEXT_CODEC =
+{
+    .char_size = sizeof(uint16_t),
+    .terminator = PKSAV_GEN4_TERMINATOR,
+    .p_import_char = _pksav_gen4_import_char,
+    .p_export_char = _pksav_gen4_export_char
+};
+
 enum pksav_error pksav_gen4_import_text(
     const uint16_t* p_input_buffer,
     char* p_output_text,
     size_t num_chars
 )
 {
-    if(!p_input_buffer || !p_output_text)
-    {
-        return PKSAV_ERROR_NULL_POINTER;
-    }
-
-    wchar_t* p_widetext = calloc(num_chars, sizeof(wchar_t));
-    _pksav_gen4_import_widetext(
-        p_input_buffer, p_widetext, num_chars
-    );
-
-    memset(p_output_text, 0, num_chars);
-    pksav_wcstombs(p_output_text, p_widetext, num_chars);
-    free(p_widetext);
+    return pksav_text_import(
+               &PKSAV_GEN4_TEXT_CODEC,
+               p_input_buffer,
+               p_output_text,
+               num_chars
+           );
+}
 
-    return PKSAV_ERROR_NONE;
+enum pksav_error pksav_gen4_import_text_bounded(
+    const uint16_t* p_input_buffer,
+    size_t num_chars,
+    char* p_output_text,
+    size_t output_text_len,
+    size_t* p_num_bytes_out,
+    bool* p_is_truncated_out
+)
+{
+    return pksav_text_import_bounded(
+               &PKSAV_GEN4_TEXT_CODEC,
+               p_input_buffer,
+               num_chars,
+               p_output_text,
+               output_text_len,
+               p_num_bytes_out,
+               p_is_truncated_out
+           );
 }
 
 enum pksav_error pksav_gen4_export_text(
@@ -312,19 +763,28 @@ enum pksav_error pksav_gen4_export_text(
     size_t num_chars
 )
 {
-    if(!p_input_text || !p_output_buffer)
-    {
-        return PKSAV_ERROR_NULL_POINTER;
-    }
-
-    wchar_t* p_widetext = calloc(num_chars, sizeof(wchar_t));
-    pksav_mbstowcs(p_widetext, p_input_text, num_chars);
-
-    _pksav_gen4_export_widetext(
-        p_widetext, p_output_buffer, num_chars
-    );
-
-    free(p_widetext);
+    return pksav_text_export(
+               &PKSAV_GEN4_TEXT_CODEC,
+               p_input_text,
+               p_output_buffer,
+               num_chars
+           );
+}
 
-    return PKSAV_ERROR_NONE;
+enum pksav_error pksav_gen4_export_text_bounded(
+    const char* p_input_text,
+    uint16_t* p_output_buffer,
+    size_t num_chars,
+    size_t* p_num_chars_out,
+    bool* p_is_truncated_out
+)
+{
+    return pksav_text_export_bounded(
+               &PKSAV_GEN4_TEXT_CODEC,
+               p_input_text,
+               p_output_buffer,
+               num_chars,
+               p_num_chars_out,
+               p_is_truncated_out
+           );
 }
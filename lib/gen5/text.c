@@ -22,6 +22,25 @@ enum pksav_error pksav_gen5_import_text(
            );
 }
 
+enum pksav_error pksav_gen5_import_text_bounded(
+    const uint16_t* p_input_buffer,
+    size_t num_chars,
+    char* p_output_text,
+    size_t output_text_len,
+    size_t* p_num_bytes_out,
+    bool* p_is_truncated_out
+)
+{
+    return pksav_xds_import_text_bounded(
+               p_input_buffer,
+               num_chars,
+               p_output_text,
+               output_text_len,
+               p_num_bytes_out,
+               p_is_truncated_out
+           );
+}
+
 enum pksav_error pksav_gen5_export_text(
     const char* p_input_text,
     uint16_t* p_output_buffer,
@@ -34,3 +53,20 @@ enum pksav_error pksav_gen5_export_text(
                num_chars
            );
 }
+
+enum pksav_error pksav_gen5_export_text_bounded(
+    const char* p_input_text,
+    uint16_t* p_output_buffer,
+    size_t num_chars,
+    size_t* p_num_chars_out,
+    bool* p_is_truncated_out
+)
+{
+    return pksav_xds_export_text_bounded(
+               p_input_text,
+               p_output_buffer,
+               num_chars,
+               p_num_chars_out,
+               p_is_truncated_out
+           );
+}
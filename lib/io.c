@@ -0,0 +1,388 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include <pksav/io.h>
+
+#include <assert.h>
+#include <errno.h>
+#include <limits.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#    include <unistd.h>
+#endif
+
+#if defined(_POSIX_VERSION)
+#    define PKSAV_IO_HAVE_PREAD
+#    include <sys/stat.h>
+#endif
+
+/*
+ * File descriptor
+ */
+
+#ifdef PKSAV_IO_HAVE_PREAD
+
+static enum pksav_error _pksav_io_fd_read_at(
+    const struct pksav_io* p_io,
+    size_t offset,
+    uint8_t* p_buffer_out,
+    size_t num_bytes
+)
+{
+    assert(p_io != NULL);
+    assert(p_buffer_out != NULL);
+
+    size_t num_read = 0;
+    while(num_read < num_bytes)
+    {
+        ssize_t read_output = pread(
+                                  p_io->builtin_state.fd,
+                                  &p_buffer_out[num_read],
+                                  num_bytes - num_read,
+                                  (off_t)(offset + num_read)
+                              );
+        if(read_output > 0)
+        {
+            num_read += (size_t)read_output;
+        }
+        else if((read_output < 0) && (errno == EINTR))
+        {
+            continue;
+        }
+        else
+        {
+            // Either an error or the end of the file.
+            return PKSAV_ERROR_FILE_IO;
+        }
+    }
+
+    return PKSAV_ERROR_NONE;
+}
+
+static enum pksav_error _pksav_io_fd_write_at(
+    const struct pksav_io* p_io,
+    size_t offset,
+    const uint8_t* p_buffer,
+    size_t num_bytes
+)
+{
+    assert(p_io != NULL);
+    assert(p_buffer != NULL);
+
+    size_t num_written = 0;
+    while(num_written < num_bytes)
+    {
+        ssize_t write_output = pwrite(
+                                   p_io->builtin_state.fd,
+                                   &p_buffer[num_written],
+                                   num_bytes - num_written,
+                                   (off_t)(offset + num_written)
+                               );
+        if(write_output > 0)
+        {
+            num_written += (size_t)write_output;
+        }
+        else if((write_output < 0) && (errno == EINTR))
+        {
+            continue;
+        }
+        else
+        {
+            return PKSAV_ERROR_FILE_IO;
+        }
+    }
+
+    return PKSAV_ERROR_NONE;
+}
+
+static enum pksav_error _pksav_io_fd_get_size(
+    const struct pksav_io* p_io,
+    size_t* p_size_out
+)
+{
+    assert(p_io != NULL);
+    assert(p_size_out != NULL);
+
+    struct stat file_stat;
+    if(fstat(p_io->builtin_state.fd, &file_stat) ||
+       (file_stat.st_size < 0) ||
+       ((uintmax_t)file_stat.st_size > SIZE_MAX))
+    {
+        return PKSAV_ERROR_FILE_IO;
+    }
+
+    *p_size_out = (size_t)file_stat.st_size;
+
+    return PKSAV_ERROR_NONE;
+}
+
+static enum pksav_error _pksav_io_fd_sync(
+    const struct pksav_io* p_io
+)
+{
+    assert(p_io != NULL);
+
+    // Only the data needs to reach storage, not metadata like the
+    // modification time.
+#if defined(_POSIX_SYNCHRONIZED_IO) && (_POSIX_SYNCHRONIZED_IO > 0)
+    int sync_output = fdatasync(p_io->builtin_state.fd);
+#else
+    int sync_output = fsync(p_io->builtin_state.fd);
+#endif
+
+    return sync_output ? PKSAV_ERROR_FILE_IO : PKSAV_ERROR_NONE;
+}
+
+#endif /* PKSAV_IO_HAVE_PREAD */
+
+enum pksav_error pksav_io_init_fd(
+    int fd,
+    struct pksav_io* p_io_out
+)
+{
+    if(!p_io_out)
+    {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+    if(fd < 0)
+    {
+        return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
+
+#ifdef PKSAV_IO_HAVE_PREAD
+    memset(p_io_out, 0, sizeof(*p_io_out));
+    p_io_out->read_at = _pksav_io_fd_read_at;
+    p_io_out->write_at = _pksav_io_fd_write_at;
+    p_io_out->get_size = _pksav_io_fd_get_size;
+    p_io_out->sync = _pksav_io_fd_sync;
+    p_io_out->builtin_state.fd = fd;
+
+    return PKSAV_ERROR_NONE;
+#else
+    return PKSAV_ERROR_FILE_IO;
+#endif
+}
+
+/*
+ * FILE*
+ */
+
+static bool _pksav_io_file_seek(
+    FILE* p_file,
+    size_t offset
+)
+{
+    assert(p_file != NULL);
+
+    return (offset <= (size_t)LONG_MAX) &&
+           !fseek(p_file, (long)offset, SEEK_SET);
+}
+
+static enum pksav_error _pksav_io_file_read_at(
+    const struct pksav_io* p_io,
+    size_t offset,
+    uint8_t* p_buffer_out,
+    size_t num_bytes
+)
+{
+    assert(p_io != NULL);
+    assert(p_buffer_out != NULL);
+
+    FILE* p_file = p_io->p_context;
+    if(!_pksav_io_file_seek(p_file, offset) ||
+       (fread(p_buffer_out, 1, num_bytes, p_file) != num_bytes))
+    {
+        return PKSAV_ERROR_FILE_IO;
+    }
+
+    return PKSAV_ERROR_NONE;
+}
+
+static enum pksav_error _pksav_io_file_write_at(
+    const struct pksav_io* p_io,
+    size_t offset,
+    const uint8_t* p_buffer,
+    size_t num_bytes
+)
+{
+    assert(p_io != NULL);
+    assert(p_buffer != NULL);
+
+    FILE* p_file = p_io->p_context;
+    if(!_pksav_io_file_seek(p_file, offset) ||
+       (fwrite(p_buffer, 1, num_bytes, p_file) != num_bytes) ||
+       fflush(p_file))
+    {
+        return PKSAV_ERROR_FILE_IO;
+    }
+
+    return PKSAV_ERROR_NONE;
+}
+
+static enum pksav_error _pksav_io_file_get_size(
+    const struct pksav_io* p_io,
+    size_t* p_size_out
+)
+{
+    assert(p_io != NULL);
+    assert(p_size_out != NULL);
+
+    FILE* p_file = p_io->p_context;
+    if(fseek(p_file, 0, SEEK_END))
+    {
+        return PKSAV_ERROR_FILE_IO;
+    }
+
+    long int ftell_output = ftell(p_file);
+    if(ftell_output < 0)
+    {
+        return PKSAV_ERROR_FILE_IO;
+    }
+
+    *p_size_out = (size_t)ftell_output;
+
+    return PKSAV_ERROR_NONE;
+}
+
+static enum pksav_error _pksav_io_file_sync(
+    const struct pksav_io* p_io
+)
+{
+    assert(p_io != NULL);
+
+    FILE* p_file = p_io->p_context;
+    if(fflush(p_file))
+    {
+        return PKSAV_ERROR_FILE_IO;
+    }
+
+#ifdef PKSAV_IO_HAVE_PREAD
+    if(fsync(fileno(p_file)))
+    {
+        return PKSAV_ERROR_FILE_IO;
+    }
+#endif
+
+    return PKSAV_ERROR_NONE;
+}
+
+enum pksav_error pksav_io_init_file(
+    FILE* p_file,
+    struct pksav_io* p_io_out
+)
+{
+    if(!p_file || !p_io_out)
+    {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    memset(p_io_out, 0, sizeof(*p_io_out));
+    p_io_out->read_at = _pksav_io_file_read_at;
+    p_io_out->write_at = _pksav_io_file_write_at;
+    p_io_out->get_size = _pksav_io_file_get_size;
+    p_io_out->sync = _pksav_io_file_sync;
+    p_io_out->p_context = p_file;
+
+    return PKSAV_ERROR_NONE;
+}
+
+/*
+ * Memory
+ */
+
+static bool _pksav_io_memory_is_range_valid(
+    const struct pksav_io* p_io,
+    size_t offset,
+    size_t num_bytes
+)
+{
+    assert(p_io != NULL);
+
+    size_t buffer_len = p_io->builtin_state.buffer_len;
+
+    return (offset <= buffer_len) && (num_bytes <= (buffer_len - offset));
+}
+
+static enum pksav_error _pksav_io_memory_read_at(
+    const struct pksav_io* p_io,
+    size_t offset,
+    uint8_t* p_buffer_out,
+    size_t num_bytes
+)
+{
+    assert(p_io != NULL);
+    assert(p_buffer_out != NULL);
+
+    if(!_pksav_io_memory_is_range_valid(p_io, offset, num_bytes))
+    {
+        return PKSAV_ERROR_FILE_IO;
+    }
+
+    const uint8_t* p_buffer = p_io->p_context;
+    memcpy(p_buffer_out, &p_buffer[offset], num_bytes);
+
+    return PKSAV_ERROR_NONE;
+}
+
+static enum pksav_error _pksav_io_memory_write_at(
+    const struct pksav_io* p_io,
+    size_t offset,
+    const uint8_t* p_buffer,
+    size_t num_bytes
+)
+{
+    assert(p_io != NULL);
+    assert(p_buffer != NULL);
+
+    if(!_pksav_io_memory_is_range_valid(p_io, offset, num_bytes))
+    {
+        return PKSAV_ERROR_FILE_IO;
+    }
+
+    // The source may be part of the same buffer.
+    uint8_t* p_memory = p_io->p_context;
+    memmove(&p_memory[offset], p_buffer, num_bytes);
+
+    return PKSAV_ERROR_NONE;
+}
+
+static enum pksav_error _pksav_io_memory_get_size(
+    const struct pksav_io* p_io,
+    size_t* p_size_out
+)
+{
+    assert(p_io != NULL);
+    assert(p_size_out != NULL);
+
+    *p_size_out = p_io->builtin_state.buffer_len;
+
+    return PKSAV_ERROR_NONE;
+}
+
+enum pksav_error pksav_io_init_memory(
+    uint8_t* p_buffer,
+    size_t buffer_len,
+    struct pksav_io* p_io_out
+)
+{
+    if(!p_buffer || !p_io_out)
+    {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    memset(p_io_out, 0, sizeof(*p_io_out));
+    p_io_out->read_at = _pksav_io_memory_read_at;
+    p_io_out->write_at = _pksav_io_memory_write_at;
+    p_io_out->get_size = _pksav_io_memory_get_size;
+    p_io_out->p_context = p_buffer;
+    p_io_out->builtin_state.buffer_len = buffer_len;
+
+    return PKSAV_ERROR_NONE;
+}
@@ -0,0 +1,453 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "async_writer.h"
+#include "fs.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <string.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#    include <unistd.h>
+#endif
+
+#if defined(_POSIX_THREADS) && (_POSIX_THREADS > 0)
+#    define PKSAV_ASYNC_HAVE_THREADS
+#    include <pthread.h>
+#endif
+
+struct pksav_async_callback
+{
+    void (*p_callback)(
+        enum pksav_error error,
+        void* p_user_data
+    );
+    void* p_user_data;
+
+    struct pksav_async_callback* p_next;
+};
+
+struct pksav_async_job
+{
+    char* p_filepath;
+    uint8_t* p_buffer;
+    size_t buffer_len;
+
+    // Every write coalesced into this one, oldest first.
+    struct pksav_async_callback* p_callbacks;
+    struct pksav_async_callback* p_last_callback;
+
+    bool is_started;
+    struct pksav_async_job* p_next;
+};
+
+struct pksav_async_writer_internal
+{
+#ifdef PKSAV_ASYNC_HAVE_THREADS
+    pthread_mutex_t mutex;
+    // Signaled when a job may have become startable, or on shutdown.
+    pthread_cond_t job_cond;
+    // Signaled when a job finishes.
+    pthread_cond_t finished_cond;
+
+    pthread_t* p_threads;
+    size_t num_threads;
+    bool should_stop;
+#endif
+
+    // Both queued and started jobs, in the order they were submitted.
+    struct pksav_async_job* p_jobs;
+    size_t num_pending;
+};
+
+static void _pksav_async_job_run(
+    struct pksav_async_job* p_job
+)
+{
+    assert(p_job != NULL);
+
+    enum pksav_error error = pksav_fs_write_buffer_to_file(
+                                 p_job->p_filepath,
+                                 p_job->p_buffer,
+                                 p_job->buffer_len
+                             );
+
+    struct pksav_async_callback* p_callback = p_job->p_callbacks;
+    while(p_callback)
+    {
+        struct pksav_async_callback* p_next = p_callback->p_next;
+        if(p_callback->p_callback)
+        {
+            p_callback->p_callback(error, p_callback->p_user_data);
+        }
+        free(p_callback);
+
+        p_callback = p_next;
+    }
+    p_job->p_callbacks = NULL;
+    p_job->p_last_callback = NULL;
+}
+
+static void _pksav_async_job_free(
+    struct pksav_async_job* p_job
+)
+{
+    assert(p_job != NULL);
+
+    free(p_job->p_filepath);
+    free(p_job->p_buffer);
+    free(p_job);
+}
+
+#ifdef PKSAV_ASYNC_HAVE_THREADS
+
+// Only one write to a given file can be in progress at a time, so later
+// writes can't finish first.
+static struct pksav_async_job* _pksav_async_writer_find_startable_job(
+    struct pksav_async_writer_internal* p_internal
+)
+{
+    assert(p_internal != NULL);
+
+    for(struct pksav_async_job* p_job = p_internal->p_jobs;
+        p_job != NULL;
+        p_job = p_job->p_next)
+    {
+        if(p_job->is_started)
+        {
+            continue;
+        }
+
+        bool is_file_busy = false;
+        for(struct pksav_async_job* p_other_job = p_internal->p_jobs;
+            (p_other_job != p_job) && !is_file_busy;
+            p_other_job = p_other_job->p_next)
+        {
+            is_file_busy = p_other_job->is_started &&
+                           !strcmp(p_other_job->p_filepath, p_job->p_filepath);
+        }
+        if(!is_file_busy)
+        {
+            return p_job;
+        }
+    }
+
+    return NULL;
+}
+
+static void _pksav_async_writer_remove_job(
+    struct pksav_async_writer_internal* p_internal,
+    struct pksav_async_job* p_job
+)
+{
+    assert(p_internal != NULL);
+    assert(p_job != NULL);
+
+    struct pksav_async_job** pp_job = &p_internal->p_jobs;
+    while(*pp_job != p_job)
+    {
+        pp_job = &(*pp_job)->p_next;
+    }
+    *pp_job = p_job->p_next;
+}
+
+static void* _pksav_async_writer_thread(
+    void* p_arg
+)
+{
+    assert(p_arg != NULL);
+
+    struct pksav_async_writer_internal* p_internal = p_arg;
+
+    pthread_mutex_lock(&p_internal->mutex);
+    while(!p_internal->should_stop || p_internal->p_jobs)
+    {
+        struct pksav_async_job* p_job = _pksav_async_writer_find_startable_job(p_internal);
+        if(!p_job)
+        {
+            pthread_cond_wait(&p_internal->job_cond, &p_internal->mutex);
+            continue;
+        }
+
+        // Once a job is started, nothing else changes its buffer or
+        // callbacks, so they're safe to use without the lock.
+        p_job->is_started = true;
+        pthread_mutex_unlock(&p_internal->mutex);
+
+        _pksav_async_job_run(p_job);
+
+        pthread_mutex_lock(&p_internal->mutex);
+        _pksav_async_writer_remove_job(p_internal, p_job);
+        _pksav_async_job_free(p_job);
+        --p_internal->num_pending;
+
+        // A job for the same file may be startable now.
+        pthread_cond_broadcast(&p_internal->job_cond);
+        pthread_cond_broadcast(&p_internal->finished_cond);
+    }
+    pthread_mutex_unlock(&p_internal->mutex);
+
+    return NULL;
+}
+
+#endif /* PKSAV_ASYNC_HAVE_THREADS */
+
+enum pksav_error pksav_async_writer_init(
+    size_t num_threads,
+    struct pksav_async_writer* p_writer_out
+)
+{
+    if(!p_writer_out)
+    {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    p_writer_out->p_internal = NULL;
+
+    struct pksav_async_writer_internal* p_internal = calloc(
+                                                         1,
+                                                         sizeof(struct pksav_async_writer_internal)
+                                                     );
+    if(!p_internal)
+    {
+        return PKSAV_ERROR_OUT_OF_MEMORY;
+    }
+
+#ifdef PKSAV_ASYNC_HAVE_THREADS
+    if(num_threads == 0)
+    {
+        num_threads = PKSAV_ASYNC_DEFAULT_NUM_THREADS;
+    }
+
+    // These only fail if the system is out of resources, so nothing is
+    // set up.
+    bool is_mutex_init = !pthread_mutex_init(&p_internal->mutex, NULL);
+    bool is_job_cond_init = !pthread_cond_init(&p_internal->job_cond, NULL);
+    bool is_finished_cond_init = !pthread_cond_init(&p_internal->finished_cond, NULL);
+    if(!is_mutex_init || !is_job_cond_init || !is_finished_cond_init)
+    {
+        if(is_finished_cond_init)
+        {
+            pthread_cond_destroy(&p_internal->finished_cond);
+        }
+        if(is_job_cond_init)
+        {
+            pthread_cond_destroy(&p_internal->job_cond);
+        }
+        if(is_mutex_init)
+        {
+            pthread_mutex_destroy(&p_internal->mutex);
+        }
+        free(p_internal);
+
+        return PKSAV_ERROR_OUT_OF_MEMORY;
+    }
+
+    // If no threads can be created, saves are written as they're
+    // submitted, like on platforms without threads.
+    p_internal->p_threads = calloc(num_threads, sizeof(pthread_t));
+    for(size_t thread_index = 0;
+        p_internal->p_threads && (thread_index < num_threads);
+        ++thread_index)
+    {
+        if(pthread_create(
+               &p_internal->p_threads[thread_index],
+               NULL,
+               _pksav_async_writer_thread,
+               p_internal
+           ))
+        {
+            break;
+        }
+        ++p_internal->num_threads;
+    }
+#else
+    (void)num_threads;
+#endif
+
+    p_writer_out->p_internal = p_internal;
+
+    return PKSAV_ERROR_NONE;
+}
+
+enum pksav_error pksav_async_writer_submit(
+    struct pksav_async_writer* p_writer,
+    const char* p_filepath,
+    uint8_t* p_buffer,
+    size_t buffer_len,
+    void (*p_callback)(
+        enum pksav_error error,
+        void* p_user_data
+    ),
+    void* p_user_data
+)
+{
+    assert(p_writer != NULL);
+    assert(p_filepath != NULL);
+    assert(p_buffer != NULL);
+
+    struct pksav_async_writer_internal* p_internal = p_writer->p_internal;
+
+    size_t filepath_len = strlen(p_filepath);
+    struct pksav_async_job* p_job = calloc(1, sizeof(struct pksav_async_job));
+    struct pksav_async_callback* p_job_callback = calloc(1, sizeof(struct pksav_async_callback));
+    char* p_filepath_copy = malloc(filepath_len + 1);
+    if(!p_job || !p_job_callback || !p_filepath_copy)
+    {
+        free(p_job);
+        free(p_job_callback);
+        free(p_filepath_copy);
+        free(p_buffer);
+
+        return PKSAV_ERROR_OUT_OF_MEMORY;
+    }
+
+    memcpy(p_filepath_copy, p_filepath, filepath_len + 1);
+    p_job_callback->p_callback = p_callback;
+    p_job_callback->p_user_data = p_user_data;
+
+    p_job->p_filepath = p_filepath_copy;
+    p_job->p_buffer = p_buffer;
+    p_job->buffer_len = buffer_len;
+    p_job->p_callbacks = p_job_callback;
+    p_job->p_last_callback = p_job_callback;
+
+#ifdef PKSAV_ASYNC_HAVE_THREADS
+    if(p_internal->num_threads > 0)
+    {
+        pthread_mutex_lock(&p_internal->mutex);
+
+        // If a write to this file is still queued, this one replaces it.
+        struct pksav_async_job** pp_last_job = &p_internal->p_jobs;
+        struct pksav_async_job* p_queued_job = NULL;
+        for(; *pp_last_job != NULL; pp_last_job = &(*pp_last_job)->p_next)
+        {
+            if(!(*pp_last_job)->is_started &&
+               !strcmp((*pp_last_job)->p_filepath, p_filepath))
+            {
+                p_queued_job = *pp_last_job;
+            }
+        }
+
+        if(p_queued_job)
+        {
+            free(p_queued_job->p_buffer);
+            p_queued_job->p_buffer = p_buffer;
+            p_queued_job->buffer_len = buffer_len;
+            p_queued_job->p_last_callback->p_next = p_job_callback;
+            p_queued_job->p_last_callback = p_job_callback;
+
+            p_job->p_buffer = NULL;
+            _pksav_async_job_free(p_job);
+        }
+        else
+        {
+            *pp_last_job = p_job;
+            ++p_internal->num_pending;
+            pthread_cond_signal(&p_internal->job_cond);
+        }
+
+        pthread_mutex_unlock(&p_internal->mutex);
+
+        return PKSAV_ERROR_NONE;
+    }
+#endif
+
+    _pksav_async_job_run(p_job);
+    _pksav_async_job_free(p_job);
+
+    return PKSAV_ERROR_NONE;
+}
+
+enum pksav_error pksav_async_writer_get_num_pending(
+    struct pksav_async_writer* p_writer,
+    size_t* p_num_pending_out
+)
+{
+    if(!p_writer || !p_num_pending_out)
+    {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    struct pksav_async_writer_internal* p_internal = p_writer->p_internal;
+
+#ifdef PKSAV_ASYNC_HAVE_THREADS
+    pthread_mutex_lock(&p_internal->mutex);
+    *p_num_pending_out = p_internal->num_pending;
+    pthread_mutex_unlock(&p_internal->mutex);
+#else
+    *p_num_pending_out = p_internal->num_pending;
+#endif
+
+    return PKSAV_ERROR_NONE;
+}
+
+enum pksav_error pksav_async_writer_wait(
+    struct pksav_async_writer* p_writer
+)
+{
+    if(!p_writer)
+    {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+#ifdef PKSAV_ASYNC_HAVE_THREADS
+    struct pksav_async_writer_internal* p_internal = p_writer->p_internal;
+
+    pthread_mutex_lock(&p_internal->mutex);
+    while(p_internal->num_pending > 0)
+    {
+        pthread_cond_wait(&p_internal->finished_cond, &p_internal->mutex);
+    }
+    pthread_mutex_unlock(&p_internal->mutex);
+#endif
+
+    return PKSAV_ERROR_NONE;
+}
+
+enum pksav_error pksav_async_writer_free(
+    struct pksav_async_writer* p_writer
+)
+{
+    if(!p_writer)
+    {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    // Nothing was set up if pksav_async_writer_init failed.
+    struct pksav_async_writer_internal* p_internal = p_writer->p_internal;
+    if(!p_internal)
+    {
+        return PKSAV_ERROR_NONE;
+    }
+
+#ifdef PKSAV_ASYNC_HAVE_THREADS
+    // The threads finish everything queued before they exit.
+    pthread_mutex_lock(&p_internal->mutex);
+    p_internal->should_stop = true;
+    pthread_cond_broadcast(&p_internal->job_cond);
+    pthread_mutex_unlock(&p_internal->mutex);
+
+    for(size_t thread_index = 0;
+        thread_index < p_internal->num_threads;
+        ++thread_index)
+    {
+        pthread_join(p_internal->p_threads[thread_index], NULL);
+    }
+
+    free(p_internal->p_threads);
+    pthread_cond_destroy(&p_internal->finished_cond);
+    pthread_cond_destroy(&p_internal->job_cond);
+    pthread_mutex_destroy(&p_internal->mutex);
+#endif
+
+    free(p_internal);
+    p_writer->p_internal = NULL;
+
+    return PKSAV_ERROR_NONE;
+}
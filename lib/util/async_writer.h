@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef PKSAV_UTIL_ASYNC_WRITER_H
+#define PKSAV_UTIL_ASYNC_WRITER_H
+
+#include <pksav/async.h>
+#include <pksav/error.h>
+
+#include <stdint.h>
+#include <stdlib.h>
+
+/*
+ * Queues p_buffer to be written to the given file, taking ownership of
+ * it either way. If this fails, the callback is never called. Otherwise,
+ * it's called once the write finishes, from whichever thread wrote it.
+ */
+enum pksav_error pksav_async_writer_submit(
+    struct pksav_async_writer* p_writer,
+    const char* p_filepath,
+    uint8_t* p_buffer,
+    size_t buffer_len,
+    void (*p_callback)(
+        enum pksav_error error,
+        void* p_user_data
+    ),
+    void* p_user_data
+);
+
+#endif /* PKSAV_UTIL_ASYNC_WRITER_H */
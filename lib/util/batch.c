@@ -0,0 +1,520 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+// For sync_file_range
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#    define _GNU_SOURCE
+#endif
+
+#include "batch.h"
+
+#include <assert.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#    include <unistd.h>
+#endif
+
+#if defined(_POSIX_VERSION)
+#    define PKSAV_BATCH_HAVE_POSIX
+#    include <fcntl.h>
+#    include <sys/stat.h>
+#endif
+
+// How many names to try before giving up on creating a temporary file.
+#define PKSAV_BATCH_MAX_TMP_ATTEMPTS 100
+
+struct pksav_save_batch_entry
+{
+    char* p_filepath;
+    char* p_tmp_filepath;
+};
+
+struct pksav_save_batch_internal
+{
+    struct pksav_save_batch_entry* p_entries;
+    size_t num_entries;
+    size_t entries_capacity;
+
+    // Makes temporary filenames unique within the batch.
+    unsigned long tmp_counter;
+};
+
+static char* _pksav_batch_strdup(
+    const char* p_string
+)
+{
+    assert(p_string != NULL);
+
+    size_t string_len = strlen(p_string);
+    char* p_copy = malloc(string_len + 1);
+    if(p_copy)
+    {
+        memcpy(p_copy, p_string, string_len + 1);
+    }
+
+    return p_copy;
+}
+
+static void _pksav_batch_discard_entries(
+    struct pksav_save_batch_internal* p_internal
+)
+{
+    assert(p_internal != NULL);
+
+    for(size_t entry_index = 0;
+        entry_index < p_internal->num_entries;
+        ++entry_index)
+    {
+        struct pksav_save_batch_entry* p_entry = &p_internal->p_entries[entry_index];
+
+        remove(p_entry->p_tmp_filepath);
+        free(p_entry->p_tmp_filepath);
+        free(p_entry->p_filepath);
+    }
+
+    p_internal->num_entries = 0;
+}
+
+#ifdef PKSAV_BATCH_HAVE_POSIX
+
+/*
+ * The temporary file is created with the same permissions as a new file
+ * from fopen would have, or those of the file it's replacing.
+ */
+static enum pksav_error _pksav_batch_write_tmp_file(
+    struct pksav_save_batch_internal* p_internal,
+    const char* p_filepath,
+    const uint8_t* p_buffer,
+    size_t buffer_len,
+    char** pp_tmp_filepath_out
+)
+{
+    assert(p_internal != NULL);
+    assert(p_filepath != NULL);
+    assert(p_buffer != NULL);
+    assert(pp_tmp_filepath_out != NULL);
+
+    size_t tmp_filepath_len = strlen(p_filepath) + 64;
+    char* p_tmp_filepath = malloc(tmp_filepath_len);
+    if(!p_tmp_filepath)
+    {
+        return PKSAV_ERROR_OUT_OF_MEMORY;
+    }
+
+    int fd = -1;
+    for(size_t attempt = 0;
+        (fd < 0) && (attempt < PKSAV_BATCH_MAX_TMP_ATTEMPTS);
+        ++attempt)
+    {
+        snprintf(
+            p_tmp_filepath, tmp_filepath_len,
+            "%s.pksav-%ld-%lu",
+            p_filepath, (long)getpid(), p_internal->tmp_counter++
+        );
+
+        fd = open(p_tmp_filepath, O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0666);
+        if((fd < 0) && (errno != EEXIST))
+        {
+            break;
+        }
+    }
+    if(fd < 0)
+    {
+        free(p_tmp_filepath);
+        return PKSAV_ERROR_FILE_IO;
+    }
+
+    enum pksav_error error = PKSAV_ERROR_NONE;
+
+    struct stat file_stat;
+    if(!stat(p_filepath, &file_stat) && fchmod(fd, file_stat.st_mode & 07777))
+    {
+        error = PKSAV_ERROR_FILE_IO;
+    }
+
+    size_t num_written = 0;
+    while(!error && (num_written < buffer_len))
+    {
+        ssize_t write_output = write(fd, &p_buffer[num_written], buffer_len - num_written);
+        if(write_output > 0)
+        {
+            num_written += (size_t)write_output;
+        }
+        else if((write_output < 0) && (errno == EINTR))
+        {
+            continue;
+        }
+        else
+        {
+            error = PKSAV_ERROR_FILE_IO;
+        }
+    }
+
+#ifdef __linux__
+    // Start writing back now, so by the time the batch is committed,
+    // most of it is already on disk.
+    if(!error)
+    {
+        sync_file_range(fd, 0, 0, SYNC_FILE_RANGE_WRITE);
+    }
+#endif
+
+    if(close(fd))
+    {
+        error = PKSAV_ERROR_FILE_IO;
+    }
+
+    if(error)
+    {
+        unlink(p_tmp_filepath);
+        free(p_tmp_filepath);
+    }
+    else
+    {
+        *pp_tmp_filepath_out = p_tmp_filepath;
+    }
+
+    return error;
+}
+
+static enum pksav_error _pksav_batch_sync_path(
+    const char* p_path,
+    int open_flags
+)
+{
+    assert(p_path != NULL);
+
+    int fd = open(p_path, open_flags | O_CLOEXEC);
+    if(fd < 0)
+    {
+        return PKSAV_ERROR_FILE_IO;
+    }
+
+#if defined(_POSIX_SYNCHRONIZED_IO) && (_POSIX_SYNCHRONIZED_IO > 0)
+    int sync_output = fdatasync(fd);
+#else
+    int sync_output = fsync(fd);
+#endif
+
+    if(close(fd) || sync_output)
+    {
+        return PKSAV_ERROR_FILE_IO;
+    }
+
+    return PKSAV_ERROR_NONE;
+}
+
+// A rename is only durable once the directory containing it is synced.
+static enum pksav_error _pksav_batch_sync_directories(
+    const struct pksav_save_batch_internal* p_internal
+)
+{
+    assert(p_internal != NULL);
+
+    enum pksav_error error = PKSAV_ERROR_NONE;
+
+    char** pp_synced_dirs = calloc(p_internal->num_entries, sizeof(char*));
+    if(!pp_synced_dirs)
+    {
+        return PKSAV_ERROR_OUT_OF_MEMORY;
+    }
+    size_t num_synced_dirs = 0;
+
+    for(size_t entry_index = 0;
+        entry_index < p_internal->num_entries;
+        ++entry_index)
+    {
+        char* p_dir = _pksav_batch_strdup(p_internal->p_entries[entry_index].p_filepath);
+        if(!p_dir)
+        {
+            error = PKSAV_ERROR_OUT_OF_MEMORY;
+            continue;
+        }
+
+        char* p_last_separator = strrchr(p_dir, '/');
+        if(p_last_separator == p_dir)
+        {
+            p_dir[1] = '\0';
+        }
+        else if(p_last_separator)
+        {
+            *p_last_separator = '\0';
+        }
+        else
+        {
+            strcpy(p_dir, ".");
+        }
+
+        bool is_dir_synced = false;
+        for(size_t dir_index = 0;
+            (dir_index < num_synced_dirs) && !is_dir_synced;
+            ++dir_index)
+        {
+            is_dir_synced = !strcmp(pp_synced_dirs[dir_index], p_dir);
+        }
+
+        if(is_dir_synced)
+        {
+            free(p_dir);
+        }
+        else
+        {
+            if(_pksav_batch_sync_path(p_dir, O_RDONLY))
+            {
+                error = PKSAV_ERROR_FILE_IO;
+            }
+            pp_synced_dirs[num_synced_dirs++] = p_dir;
+        }
+    }
+
+    for(size_t dir_index = 0; dir_index < num_synced_dirs; ++dir_index)
+    {
+        free(pp_synced_dirs[dir_index]);
+    }
+    free(pp_synced_dirs);
+
+    return error;
+}
+
+#else
+
+// Without POSIX, there's no way to sync a file or a directory, so this
+// only guarantees the destination is never partially written.
+static enum pksav_error _pksav_batch_write_tmp_file(
+    struct pksav_save_batch_internal* p_internal,
+    const char* p_filepath,
+    const uint8_t* p_buffer,
+    size_t buffer_len,
+    char** pp_tmp_filepath_out
+)
+{
+    assert(p_internal != NULL);
+    assert(p_filepath != NULL);
+    assert(p_buffer != NULL);
+    assert(pp_tmp_filepath_out != NULL);
+
+    size_t tmp_filepath_len = strlen(p_filepath) + 64;
+    char* p_tmp_filepath = malloc(tmp_filepath_len);
+    if(!p_tmp_filepath)
+    {
+        return PKSAV_ERROR_OUT_OF_MEMORY;
+    }
+
+    snprintf(
+        p_tmp_filepath, tmp_filepath_len,
+        "%s.pksav-%lu",
+        p_filepath, p_internal->tmp_counter++
+    );
+
+    enum pksav_error error = PKSAV_ERROR_NONE;
+
+    FILE* p_file = fopen(p_tmp_filepath, "wb");
+    if(!p_file)
+    {
+        free(p_tmp_filepath);
+        return PKSAV_ERROR_FILE_IO;
+    }
+
+    if(fwrite(p_buffer, 1, buffer_len, p_file) != buffer_len)
+    {
+        error = PKSAV_ERROR_FILE_IO;
+    }
+    if(fclose(p_file))
+    {
+        error = PKSAV_ERROR_FILE_IO;
+    }
+
+    if(error)
+    {
+        remove(p_tmp_filepath);
+        free(p_tmp_filepath);
+    }
+    else
+    {
+        *pp_tmp_filepath_out = p_tmp_filepath;
+    }
+
+    return error;
+}
+
+#endif /* PKSAV_BATCH_HAVE_POSIX */
+
+enum pksav_error pksav_save_batch_init(
+    struct pksav_save_batch* p_batch_out
+)
+{
+    if(!p_batch_out)
+    {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    p_batch_out->p_internal = calloc(1, sizeof(struct pksav_save_batch_internal));
+    if(!p_batch_out->p_internal)
+    {
+        return PKSAV_ERROR_OUT_OF_MEMORY;
+    }
+
+    return PKSAV_ERROR_NONE;
+}
+
+enum pksav_error pksav_save_batch_add(
+    struct pksav_save_batch* p_batch,
+    const char* p_filepath,
+    const uint8_t* p_buffer,
+    size_t buffer_len
+)
+{
+    if(!p_batch || !p_batch->p_internal || !p_filepath || !p_buffer)
+    {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    struct pksav_save_batch_internal* p_internal = p_batch->p_internal;
+
+    if(p_internal->num_entries == p_internal->entries_capacity)
+    {
+        size_t new_capacity = (p_internal->entries_capacity > 0)
+                            ? (p_internal->entries_capacity * 2) : 16;
+        struct pksav_save_batch_entry* p_new_entries = realloc(
+                                                           p_internal->p_entries,
+                                                           new_capacity * sizeof(struct pksav_save_batch_entry)
+                                                       );
+        if(!p_new_entries)
+        {
+            return PKSAV_ERROR_OUT_OF_MEMORY;
+        }
+
+        p_internal->p_entries = p_new_entries;
+        p_internal->entries_capacity = new_capacity;
+    }
+
+    char* p_filepath_copy = _pksav_batch_strdup(p_filepath);
+    if(!p_filepath_copy)
+    {
+        return PKSAV_ERROR_OUT_OF_MEMORY;
+    }
+
+    char* p_tmp_filepath = NULL;
+    enum pksav_error error = _pksav_batch_write_tmp_file(
+                                 p_internal,
+                                 p_filepath,
+                                 p_buffer,
+                                 buffer_len,
+                                 &p_tmp_filepath
+                             );
+    if(error)
+    {
+        free(p_filepath_copy);
+        return error;
+    }
+
+    struct pksav_save_batch_entry* p_entry = &p_internal->p_entries[p_internal->num_entries++];
+    p_entry->p_filepath = p_filepath_copy;
+    p_entry->p_tmp_filepath = p_tmp_filepath;
+
+    return PKSAV_ERROR_NONE;
+}
+
+enum pksav_error pksav_save_batch_commit(
+    struct pksav_save_batch* p_batch
+)
+{
+    if(!p_batch || !p_batch->p_internal)
+    {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    struct pksav_save_batch_internal* p_internal = p_batch->p_internal;
+
+    enum pksav_error error = PKSAV_ERROR_NONE;
+
+#ifdef PKSAV_BATCH_HAVE_POSIX
+    // Everything has to be on disk before anything is moved into place.
+    for(size_t entry_index = 0;
+        entry_index < p_internal->num_entries;
+        ++entry_index)
+    {
+        error = _pksav_batch_sync_path(
+                    p_internal->p_entries[entry_index].p_tmp_filepath,
+                    O_RDONLY
+                );
+        if(error)
+        {
+            return error;
+        }
+    }
+#endif
+
+    // Entries are moved into place in the order they were added, so if a
+    // destination was added more than once, the last one wins.
+    for(size_t entry_index = 0;
+        entry_index < p_internal->num_entries;
+        ++entry_index)
+    {
+        struct pksav_save_batch_entry* p_entry = &p_internal->p_entries[entry_index];
+
+#ifndef PKSAV_BATCH_HAVE_POSIX
+        // Some platforms can't rename over an existing file.
+        remove(p_entry->p_filepath);
+#endif
+        if(rename(p_entry->p_tmp_filepath, p_entry->p_filepath))
+        {
+            error = PKSAV_ERROR_FILE_IO;
+            remove(p_entry->p_tmp_filepath);
+        }
+    }
+
+#ifdef PKSAV_BATCH_HAVE_POSIX
+    // A failed rename is the more important error to report.
+    enum pksav_error sync_error = _pksav_batch_sync_directories(p_internal);
+    if(sync_error && !error)
+    {
+        error = sync_error;
+    }
+#endif
+
+    // Every temporary file has either been moved or removed.
+    for(size_t entry_index = 0;
+        entry_index < p_internal->num_entries;
+        ++entry_index)
+    {
+        free(p_internal->p_entries[entry_index].p_tmp_filepath);
+        free(p_internal->p_entries[entry_index].p_filepath);
+    }
+    p_internal->num_entries = 0;
+
+    return error;
+}
+
+enum pksav_error pksav_save_batch_free(
+    struct pksav_save_batch* p_batch
+)
+{
+    if(!p_batch)
+    {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    // Nothing was set up if pksav_save_batch_init failed.
+    struct pksav_save_batch_internal* p_internal = p_batch->p_internal;
+    if(!p_internal)
+    {
+        return PKSAV_ERROR_NONE;
+    }
+
+    _pksav_batch_discard_entries(p_internal);
+    free(p_internal->p_entries);
+    free(p_internal);
+
+    p_batch->p_internal = NULL;
+
+    return PKSAV_ERROR_NONE;
+}
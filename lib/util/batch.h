@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef PKSAV_UTIL_BATCH_H
+#define PKSAV_UTIL_BATCH_H
+
+#include <pksav/batch.h>
+#include <pksav/error.h>
+
+#include <stdint.h>
+#include <stdlib.h>
+
+/*
+ * Writes the buffer to a new temporary file next to p_filepath, to be
+ * moved into place when the batch is committed.
+ */
+enum pksav_error pksav_save_batch_add(
+    struct pksav_save_batch* p_batch,
+    const char* p_filepath,
+    const uint8_t* p_buffer,
+    size_t buffer_len
+);
+
+#endif /* PKSAV_UTIL_BATCH_H */
@@ -0,0 +1,907 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "bulk.h"
+
+#include <assert.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#    include <unistd.h>
+#endif
+
+#if defined(_POSIX_THREADS) && (_POSIX_THREADS > 0)
+#    define PKSAV_BULK_HAVE_THREADS
+#    include <pthread.h>
+#endif
+
+#if defined(__linux__) && defined(__has_include)
+#    if __has_include(<linux/io_uring.h>)
+#        include <linux/io_uring.h>
+#        include <sys/syscall.h>
+#        if defined(IO_URING_OP_SUPPORTED) && defined(__NR_io_uring_setup)
+#            define PKSAV_BULK_HAVE_IO_URING
+#            include <fcntl.h>
+#            include <sys/mman.h>
+#            include <sys/stat.h>
+#        endif
+#    endif
+#endif
+
+// Nothing this large can be a save from any supported generation, and
+// reading it would only tie up memory.
+#define PKSAV_BULK_MAX_FILE_SIZE (1024 * 1024)
+
+static enum pksav_error _pksav_bulk_read_file(
+    const char* p_filepath,
+    struct pksav_fs_file_buffer* p_file_buffer_out
+)
+{
+    assert(p_filepath != NULL);
+    assert(p_file_buffer_out != NULL);
+
+    uint8_t* p_buffer = NULL;
+    size_t buffer_len = 0;
+    enum pksav_error error = pksav_fs_read_file_to_buffer_with_max_len(
+                                 p_filepath,
+                                 PKSAV_BULK_MAX_FILE_SIZE,
+                                 &p_buffer,
+                                 &buffer_len
+                             );
+    if(!error)
+    {
+        p_file_buffer_out->p_buffer = p_buffer;
+        p_file_buffer_out->buffer_len = buffer_len;
+        p_file_buffer_out->is_mapped = false;
+        p_file_buffer_out->is_shared = false;
+    }
+    else if(error == PKSAV_ERROR_PARAM_OUT_OF_RANGE)
+    {
+        error = PKSAV_ERROR_INVALID_SAVE;
+    }
+
+    return error;
+}
+
+// Takes ownership of the file buffer, if there is one.
+static enum pksav_error _pksav_bulk_load_save(
+    const struct pksav_bulk_loader* p_loader,
+    enum pksav_error read_error,
+    struct pksav_fs_file_buffer* p_file_buffer,
+    void* p_save_out
+)
+{
+    assert(p_loader != NULL);
+    assert(p_file_buffer != NULL);
+    assert(p_save_out != NULL);
+
+    if(read_error)
+    {
+        return read_error;
+    }
+
+    return p_loader->load_save(
+               p_file_buffer,
+               p_loader->p_context,
+               p_save_out
+           );
+}
+
+static void _pksav_bulk_report_save(
+    const struct pksav_bulk_loader* p_loader,
+    size_t filepath_index,
+    enum pksav_error error,
+    void* p_save
+)
+{
+    assert(p_loader != NULL);
+    assert(p_save != NULL);
+
+    p_loader->on_save_loaded(
+        filepath_index,
+        error,
+        error ? NULL : p_save,
+        p_loader->p_context
+    );
+    if(!error)
+    {
+        p_loader->free_save(p_save);
+    }
+}
+
+/*
+ * Serial
+ */
+
+static void _pksav_bulk_load_saves_serial(
+    const char* const* pp_filepaths,
+    size_t first_index,
+    size_t num_filepaths,
+    const struct pksav_bulk_loader* p_loader
+)
+{
+    assert(pp_filepaths != NULL);
+    assert(p_loader != NULL);
+
+    void* p_save = malloc(p_loader->save_size);
+
+    for(size_t filepath_index = first_index;
+        filepath_index < num_filepaths;
+        ++filepath_index)
+    {
+        // Without a save to load into, every file fails.
+        enum pksav_error error = PKSAV_ERROR_OUT_OF_MEMORY;
+        struct pksav_fs_file_buffer file_buffer = {NULL, 0, false, false};
+
+        if(p_save)
+        {
+            error = _pksav_bulk_read_file(
+                        pp_filepaths[filepath_index],
+                        &file_buffer
+                    );
+            error = _pksav_bulk_load_save(
+                        p_loader,
+                        error,
+                        &file_buffer,
+                        p_save
+                    );
+        }
+
+        _pksav_bulk_report_save(
+            p_loader,
+            filepath_index,
+            error,
+            p_save
+        );
+    }
+
+    free(p_save);
+}
+
+/*
+ * Threads
+ */
+
+#ifdef PKSAV_BULK_HAVE_THREADS
+
+struct pksav_bulk_thread_state
+{
+    const char* const* pp_filepaths;
+    size_t num_filepaths;
+    const struct pksav_bulk_loader* p_loader;
+
+    // Guards both next_index and the loader's callback.
+    pthread_mutex_t mutex;
+    size_t next_index;
+};
+
+static void* _pksav_bulk_thread(
+    void* p_arg
+)
+{
+    assert(p_arg != NULL);
+
+    struct pksav_bulk_thread_state* p_state = p_arg;
+    const struct pksav_bulk_loader* p_loader = p_state->p_loader;
+
+    void* p_save = malloc(p_loader->save_size);
+
+    pthread_mutex_lock(&p_state->mutex);
+    while(p_state->next_index < p_state->num_filepaths)
+    {
+        size_t filepath_index = p_state->next_index++;
+        pthread_mutex_unlock(&p_state->mutex);
+
+        // Without a save to load into, every file fails.
+        enum pksav_error error = PKSAV_ERROR_OUT_OF_MEMORY;
+        struct pksav_fs_file_buffer file_buffer = {NULL, 0, false, false};
+
+        // Reading and parsing happen outside the lock, so only the
+        // callbacks are serialized.
+        if(p_save)
+        {
+            error = _pksav_bulk_read_file(
+                        p_state->pp_filepaths[filepath_index],
+                        &file_buffer
+                    );
+            error = _pksav_bulk_load_save(
+                        p_loader,
+                        error,
+                        &file_buffer,
+                        p_save
+                    );
+        }
+
+        pthread_mutex_lock(&p_state->mutex);
+        p_loader->on_save_loaded(
+            filepath_index,
+            error,
+            error ? NULL : p_save,
+            p_loader->p_context
+        );
+        if(!error)
+        {
+            p_loader->free_save(p_save);
+        }
+    }
+    pthread_mutex_unlock(&p_state->mutex);
+
+    free(p_save);
+
+    return NULL;
+}
+
+static void _pksav_bulk_load_saves_threads(
+    const char* const* pp_filepaths,
+    size_t first_index,
+    size_t num_filepaths,
+    size_t num_threads,
+    const struct pksav_bulk_loader* p_loader
+)
+{
+    assert(pp_filepaths != NULL);
+    assert(p_loader != NULL);
+    assert(num_threads > 0);
+
+    struct pksav_bulk_thread_state state =
+    {
+        .pp_filepaths = pp_filepaths,
+        .num_filepaths = num_filepaths,
+        .p_loader = p_loader,
+        .next_index = first_index
+    };
+    if(pthread_mutex_init(&state.mutex, NULL))
+    {
+        _pksav_bulk_load_saves_serial(
+            pp_filepaths,
+            first_index,
+            num_filepaths,
+            p_loader
+        );
+        return;
+    }
+
+    // The calling thread works too, so everything still gets loaded if
+    // no threads can be created.
+    pthread_t* p_threads = calloc(num_threads - 1, sizeof(pthread_t));
+    size_t num_threads_created = 0;
+    if(p_threads)
+    {
+        for(size_t thread_index = 0;
+            thread_index < (num_threads - 1);
+            ++thread_index)
+        {
+            if(pthread_create(
+                   &p_threads[num_threads_created],
+                   NULL,
+                   _pksav_bulk_thread,
+                   &state
+               ))
+            {
+                break;
+            }
+            ++num_threads_created;
+        }
+    }
+
+    _pksav_bulk_thread(&state);
+
+    for(size_t thread_index = 0;
+        thread_index < num_threads_created;
+        ++thread_index)
+    {
+        pthread_join(p_threads[thread_index], NULL);
+    }
+
+    free(p_threads);
+    pthread_mutex_destroy(&state.mutex);
+}
+
+#endif /* PKSAV_BULK_HAVE_THREADS */
+
+/*
+ * io_uring
+ */
+
+#ifdef PKSAV_BULK_HAVE_IO_URING
+
+// There's no liburing dependency, so the ring is set up by hand.
+struct pksav_bulk_ring
+{
+    int ring_fd;
+
+    void* p_sq_mapping;
+    size_t sq_mapping_size;
+    uint32_t* p_sq_head;
+    uint32_t* p_sq_tail;
+    uint32_t sq_mask;
+    uint32_t* p_sq_array;
+    struct io_uring_sqe* p_sqes;
+    size_t sqes_size;
+
+    void* p_cq_mapping;
+    size_t cq_mapping_size;
+    uint32_t* p_cq_head;
+    uint32_t* p_cq_tail;
+    uint32_t cq_mask;
+    struct io_uring_cqe* p_cqes;
+
+    uint32_t num_entries;
+};
+
+// A file in flight. Until the open completes, fd is -1.
+struct pksav_bulk_ring_file
+{
+    size_t filepath_index;
+    int fd;
+    struct pksav_fs_file_buffer file_buffer;
+    size_t num_read;
+};
+
+static bool _pksav_bulk_ring_supports_ops(
+    int ring_fd
+)
+{
+    const size_t num_probe_ops = 256;
+
+    struct io_uring_probe* p_probe = calloc(
+                                         1,
+                                         sizeof(struct io_uring_probe) +
+                                         (num_probe_ops * sizeof(struct io_uring_probe_op))
+                                     );
+    if(!p_probe)
+    {
+        return false;
+    }
+
+    bool supports_ops = false;
+    if(!syscall(
+           __NR_io_uring_register,
+           ring_fd,
+           IORING_REGISTER_PROBE,
+           p_probe,
+           num_probe_ops
+       ))
+    {
+        supports_ops = (p_probe->last_op >= IORING_OP_OPENAT) &&
+                       (p_probe->last_op >= IORING_OP_READ) &&
+                       (p_probe->ops[IORING_OP_OPENAT].flags & IO_URING_OP_SUPPORTED) &&
+                       (p_probe->ops[IORING_OP_READ].flags & IO_URING_OP_SUPPORTED);
+    }
+
+    free(p_probe);
+
+    return supports_ops;
+}
+
+static void _pksav_bulk_ring_exit(
+    struct pksav_bulk_ring* p_ring
+)
+{
+    assert(p_ring != NULL);
+
+    if(p_ring->p_sqes)
+    {
+        munmap(p_ring->p_sqes, p_ring->sqes_size);
+    }
+    if(p_ring->p_cq_mapping && (p_ring->p_cq_mapping != p_ring->p_sq_mapping))
+    {
+        munmap(p_ring->p_cq_mapping, p_ring->cq_mapping_size);
+    }
+    if(p_ring->p_sq_mapping)
+    {
+        munmap(p_ring->p_sq_mapping, p_ring->sq_mapping_size);
+    }
+    close(p_ring->ring_fd);
+
+    memset(p_ring, 0, sizeof(*p_ring));
+    p_ring->ring_fd = -1;
+}
+
+static bool _pksav_bulk_ring_init(
+    uint32_t num_entries,
+    struct pksav_bulk_ring* p_ring_out
+)
+{
+    assert(p_ring_out != NULL);
+
+    memset(p_ring_out, 0, sizeof(*p_ring_out));
+
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+#ifdef IORING_SETUP_CLAMP
+    params.flags = IORING_SETUP_CLAMP;
+#endif
+
+    // This fails if the kernel is too old or io_uring is disabled, such
+    // as by a seccomp filter.
+    int ring_fd = (int)syscall(__NR_io_uring_setup, num_entries, &params);
+    if(ring_fd < 0)
+    {
+        return false;
+    }
+    p_ring_out->ring_fd = ring_fd;
+
+    if(!(params.features & IORING_FEAT_SINGLE_MMAP) ||
+       !_pksav_bulk_ring_supports_ops(ring_fd))
+    {
+        _pksav_bulk_ring_exit(p_ring_out);
+        return false;
+    }
+
+    // Both rings share one mapping, which needs to be big enough for
+    // either.
+    p_ring_out->sq_mapping_size = params.sq_off.array +
+                                  (params.sq_entries * sizeof(uint32_t));
+    p_ring_out->cq_mapping_size = params.cq_off.cqes +
+                                  (params.cq_entries * sizeof(struct io_uring_cqe));
+    if(p_ring_out->cq_mapping_size > p_ring_out->sq_mapping_size)
+    {
+        p_ring_out->sq_mapping_size = p_ring_out->cq_mapping_size;
+    }
+    p_ring_out->cq_mapping_size = p_ring_out->sq_mapping_size;
+
+    void* p_mapping = mmap(
+                          NULL,
+                          p_ring_out->sq_mapping_size,
+                          PROT_READ | PROT_WRITE,
+                          MAP_SHARED | MAP_POPULATE,
+                          ring_fd,
+                          IORING_OFF_SQ_RING
+                      );
+    if(p_mapping == MAP_FAILED)
+    {
+        _pksav_bulk_ring_exit(p_ring_out);
+        return false;
+    }
+    p_ring_out->p_sq_mapping = p_mapping;
+    p_ring_out->p_cq_mapping = p_mapping;
+
+    p_ring_out->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+    void* p_sqes = mmap(
+                       NULL,
+                       p_ring_out->sqes_size,
+                       PROT_READ | PROT_WRITE,
+                       MAP_SHARED | MAP_POPULATE,
+                       ring_fd,
+                       IORING_OFF_SQES
+                   );
+    if(p_sqes == MAP_FAILED)
+    {
+        _pksav_bulk_ring_exit(p_ring_out);
+        return false;
+    }
+    p_ring_out->p_sqes = p_sqes;
+
+    uint8_t* p_ring_bytes = p_mapping;
+    p_ring_out->p_sq_head = (uint32_t*)&p_ring_bytes[params.sq_off.head];
+    p_ring_out->p_sq_tail = (uint32_t*)&p_ring_bytes[params.sq_off.tail];
+    p_ring_out->sq_mask = *(uint32_t*)&p_ring_bytes[params.sq_off.ring_mask];
+    p_ring_out->p_sq_array = (uint32_t*)&p_ring_bytes[params.sq_off.array];
+    p_ring_out->p_cq_head = (uint32_t*)&p_ring_bytes[params.cq_off.head];
+    p_ring_out->p_cq_tail = (uint32_t*)&p_ring_bytes[params.cq_off.tail];
+    p_ring_out->cq_mask = *(uint32_t*)&p_ring_bytes[params.cq_off.ring_mask];
+    p_ring_out->p_cqes = (struct io_uring_cqe*)&p_ring_bytes[params.cq_off.cqes];
+    p_ring_out->num_entries = params.sq_entries;
+
+    return true;
+}
+
+// Files are only submitted when there's a free slot for them, so the
+// submission queue can never be full. The entry isn't visible to the
+// kernel until it's filled in and passed to _pksav_bulk_ring_commit_sqe.
+static struct io_uring_sqe* _pksav_bulk_ring_get_sqe(
+    struct pksav_bulk_ring* p_ring
+)
+{
+    assert(p_ring != NULL);
+
+    uint32_t tail = *p_ring->p_sq_tail;
+    uint32_t index = tail & p_ring->sq_mask;
+
+    struct io_uring_sqe* p_sqe = &p_ring->p_sqes[index];
+    memset(p_sqe, 0, sizeof(*p_sqe));
+    p_ring->p_sq_array[index] = index;
+
+    return p_sqe;
+}
+
+static void _pksav_bulk_ring_commit_sqe(
+    struct pksav_bulk_ring* p_ring
+)
+{
+    assert(p_ring != NULL);
+
+    // The release store publishes the filled-in entry along with the tail.
+    uint32_t tail = *p_ring->p_sq_tail;
+    __atomic_store_n(p_ring->p_sq_tail, tail + 1, __ATOMIC_RELEASE);
+}
+
+static void _pksav_bulk_ring_submit_open(
+    struct pksav_bulk_ring* p_ring,
+    const char* p_filepath,
+    size_t slot_index
+)
+{
+    assert(p_ring != NULL);
+    assert(p_filepath != NULL);
+
+    struct io_uring_sqe* p_sqe = _pksav_bulk_ring_get_sqe(p_ring);
+    p_sqe->opcode = IORING_OP_OPENAT;
+    p_sqe->fd = AT_FDCWD;
+    p_sqe->addr = (uint64_t)(uintptr_t)p_filepath;
+    p_sqe->open_flags = O_RDONLY | O_CLOEXEC;
+    p_sqe->user_data = slot_index;
+
+    _pksav_bulk_ring_commit_sqe(p_ring);
+}
+
+static void _pksav_bulk_ring_submit_read(
+    struct pksav_bulk_ring* p_ring,
+    const struct pksav_bulk_ring_file* p_ring_file,
+    size_t slot_index
+)
+{
+    assert(p_ring != NULL);
+    assert(p_ring_file != NULL);
+
+    struct io_uring_sqe* p_sqe = _pksav_bulk_ring_get_sqe(p_ring);
+    p_sqe->opcode = IORING_OP_READ;
+    p_sqe->fd = p_ring_file->fd;
+    p_sqe->addr = (uint64_t)(uintptr_t)&p_ring_file->file_buffer.p_buffer[p_ring_file->num_read];
+    p_sqe->len = (uint32_t)(p_ring_file->file_buffer.buffer_len - p_ring_file->num_read);
+    p_sqe->off = p_ring_file->num_read;
+    p_sqe->user_data = slot_index;
+
+    _pksav_bulk_ring_commit_sqe(p_ring);
+}
+
+// Submits everything queued and waits for at least one completion.
+static bool _pksav_bulk_ring_enter(
+    struct pksav_bulk_ring* p_ring
+)
+{
+    assert(p_ring != NULL);
+
+    for(;;)
+    {
+        uint32_t num_to_submit = *p_ring->p_sq_tail -
+                                 __atomic_load_n(p_ring->p_sq_head, __ATOMIC_ACQUIRE);
+
+        long enter_output = syscall(
+                                __NR_io_uring_enter,
+                                p_ring->ring_fd,
+                                num_to_submit,
+                                1, // min_complete
+                                IORING_ENTER_GETEVENTS,
+                                NULL,
+                                0
+                            );
+        if(enter_output >= 0)
+        {
+            return true;
+        }
+        else if((errno != EINTR) && (errno != EAGAIN) && (errno != EBUSY))
+        {
+            return false;
+        }
+    }
+}
+
+// Returns true if the file is ready to be parsed.
+static bool _pksav_bulk_ring_handle_completion(
+    struct pksav_bulk_ring* p_ring,
+    struct pksav_bulk_ring_file* p_ring_file,
+    size_t slot_index,
+    int32_t result,
+    enum pksav_error* p_error_out
+)
+{
+    assert(p_ring != NULL);
+    assert(p_ring_file != NULL);
+    assert(p_error_out != NULL);
+
+    if(p_ring_file->fd < 0)
+    {
+        if(result < 0)
+        {
+            *p_error_out = PKSAV_ERROR_FILE_IO;
+            return true;
+        }
+        p_ring_file->fd = result;
+
+        // The inode is cached once the file is open, so this doesn't
+        // wait on the device.
+        struct stat file_stat;
+        if(fstat(p_ring_file->fd, &file_stat) || (file_stat.st_size < 0))
+        {
+            *p_error_out = PKSAV_ERROR_FILE_IO;
+            return true;
+        }
+        if(file_stat.st_size > PKSAV_BULK_MAX_FILE_SIZE)
+        {
+            *p_error_out = PKSAV_ERROR_INVALID_SAVE;
+            return true;
+        }
+
+        size_t file_size = (size_t)file_stat.st_size;
+        p_ring_file->file_buffer.p_buffer = malloc((file_size > 0) ? file_size : 1);
+        p_ring_file->file_buffer.buffer_len = file_size;
+        p_ring_file->num_read = 0;
+        if(!p_ring_file->file_buffer.p_buffer)
+        {
+            *p_error_out = PKSAV_ERROR_OUT_OF_MEMORY;
+            return true;
+        }
+    }
+    else if((result == -EINTR) || (result == -EAGAIN))
+    {
+        // Nothing was read, so just try again.
+    }
+    else if(result < 0)
+    {
+        *p_error_out = PKSAV_ERROR_FILE_IO;
+        return true;
+    }
+    else if(result == 0)
+    {
+        // The file was truncated since it was opened.
+        p_ring_file->file_buffer.buffer_len = p_ring_file->num_read;
+    }
+    else
+    {
+        p_ring_file->num_read += (size_t)result;
+    }
+
+    if(p_ring_file->num_read >= p_ring_file->file_buffer.buffer_len)
+    {
+        *p_error_out = PKSAV_ERROR_NONE;
+        return true;
+    }
+
+    _pksav_bulk_ring_submit_read(p_ring, p_ring_file, slot_index);
+
+    return false;
+}
+
+/*
+ * Returns how many files were started. If the ring breaks partway
+ * through, files already in flight are reported as failures, and the
+ * caller is left to load the rest some other way.
+ */
+static size_t _pksav_bulk_load_saves_io_uring(
+    struct pksav_bulk_ring* p_ring,
+    const char* const* pp_filepaths,
+    size_t num_filepaths,
+    const struct pksav_bulk_loader* p_loader
+)
+{
+    assert(p_ring != NULL);
+    assert(pp_filepaths != NULL);
+    assert(p_loader != NULL);
+
+    size_t num_slots = p_ring->num_entries;
+    if(num_slots > num_filepaths)
+    {
+        num_slots = num_filepaths;
+    }
+
+    struct pksav_bulk_ring_file* p_ring_files = calloc(
+                                                    num_slots,
+                                                    sizeof(struct pksav_bulk_ring_file)
+                                                );
+    size_t* p_free_slots = calloc(num_slots, sizeof(size_t));
+    void* p_save = malloc(p_loader->save_size);
+    if(!p_ring_files || !p_free_slots || !p_save)
+    {
+        free(p_ring_files);
+        free(p_free_slots);
+        free(p_save);
+        return 0;
+    }
+
+    size_t num_free_slots = num_slots;
+    for(size_t slot_index = 0; slot_index < num_slots; ++slot_index)
+    {
+        p_free_slots[slot_index] = num_slots - slot_index - 1;
+    }
+
+    size_t next_index = 0;
+    bool is_ring_broken = false;
+    while(!is_ring_broken && ((next_index < num_filepaths) || (num_free_slots < num_slots)))
+    {
+        while((num_free_slots > 0) && (next_index < num_filepaths))
+        {
+            size_t slot_index = p_free_slots[--num_free_slots];
+
+            struct pksav_bulk_ring_file* p_ring_file = &p_ring_files[slot_index];
+            memset(p_ring_file, 0, sizeof(*p_ring_file));
+            p_ring_file->filepath_index = next_index;
+            p_ring_file->fd = -1;
+
+            _pksav_bulk_ring_submit_open(
+                p_ring,
+                pp_filepaths[next_index],
+                slot_index
+            );
+            ++next_index;
+        }
+
+        if(!_pksav_bulk_ring_enter(p_ring))
+        {
+            is_ring_broken = true;
+            break;
+        }
+
+        uint32_t cq_head = *p_ring->p_cq_head;
+        uint32_t cq_tail = __atomic_load_n(p_ring->p_cq_tail, __ATOMIC_ACQUIRE);
+        for(; cq_head != cq_tail; ++cq_head)
+        {
+            const struct io_uring_cqe* p_cqe = &p_ring->p_cqes[cq_head & p_ring->cq_mask];
+            size_t slot_index = (size_t)p_cqe->user_data;
+            struct pksav_bulk_ring_file* p_ring_file = &p_ring_files[slot_index];
+
+            enum pksav_error error = PKSAV_ERROR_NONE;
+            if(!_pksav_bulk_ring_handle_completion(
+                    p_ring,
+                    p_ring_file,
+                    slot_index,
+                    p_cqe->res,
+                    &error
+                ))
+            {
+                continue;
+            }
+
+            if(p_ring_file->fd >= 0)
+            {
+                close(p_ring_file->fd);
+            }
+            if(error && p_ring_file->file_buffer.p_buffer)
+            {
+                free(p_ring_file->file_buffer.p_buffer);
+            }
+
+            error = _pksav_bulk_load_save(
+                        p_loader,
+                        error,
+                        &p_ring_file->file_buffer,
+                        p_save
+                    );
+            _pksav_bulk_report_save(
+                p_loader,
+                p_ring_file->filepath_index,
+                error,
+                p_save
+            );
+
+            p_free_slots[num_free_slots++] = slot_index;
+        }
+        __atomic_store_n(p_ring->p_cq_head, cq_head, __ATOMIC_RELEASE);
+    }
+
+    if(is_ring_broken)
+    {
+        // The kernel may still write to the buffers of files in flight,
+        // so they're deliberately leaked rather than freed.
+        bool* p_is_slot_free = calloc(num_slots, sizeof(bool));
+        for(size_t free_index = 0;
+            p_is_slot_free && (free_index < num_free_slots);
+            ++free_index)
+        {
+            p_is_slot_free[p_free_slots[free_index]] = true;
+        }
+        for(size_t slot_index = 0;
+            p_is_slot_free && (slot_index < num_slots);
+            ++slot_index)
+        {
+            if(!p_is_slot_free[slot_index])
+            {
+                _pksav_bulk_report_save(
+                    p_loader,
+                    p_ring_files[slot_index].filepath_index,
+                    PKSAV_ERROR_FILE_IO,
+                    p_save
+                );
+            }
+        }
+        free(p_is_slot_free);
+    }
+
+    free(p_ring_files);
+    free(p_free_slots);
+    free(p_save);
+
+    return next_index;
+}
+
+#endif /* PKSAV_BULK_HAVE_IO_URING */
+
+enum pksav_error pksav_bulk_load_saves(
+    const char* const* pp_filepaths,
+    size_t num_filepaths,
+    const struct pksav_bulk_load_options* p_options,
+    const struct pksav_bulk_loader* p_loader
+)
+{
+    assert(pp_filepaths != NULL);
+    assert(p_loader != NULL);
+
+    size_t queue_depth = PKSAV_BULK_DEFAULT_QUEUE_DEPTH;
+    enum pksav_bulk_backend backend = PKSAV_BULK_BACKEND_AUTO;
+    if(p_options)
+    {
+        if(p_options->queue_depth > 0)
+        {
+            queue_depth = p_options->queue_depth;
+        }
+        backend = p_options->backend;
+    }
+    if(queue_depth > num_filepaths)
+    {
+        queue_depth = num_filepaths;
+    }
+
+    size_t first_index = 0;
+
+    if((backend == PKSAV_BULK_BACKEND_AUTO) || (backend == PKSAV_BULK_BACKEND_IO_URING))
+    {
+#ifdef PKSAV_BULK_HAVE_IO_URING
+        struct pksav_bulk_ring ring;
+        uint32_t num_entries = (queue_depth > UINT16_MAX) ? UINT16_MAX : (uint32_t)queue_depth;
+        if((num_entries > 0) && _pksav_bulk_ring_init(num_entries, &ring))
+        {
+            first_index = _pksav_bulk_load_saves_io_uring(
+                              &ring,
+                              pp_filepaths,
+                              num_filepaths,
+                              p_loader
+                          );
+            _pksav_bulk_ring_exit(&ring);
+            backend = PKSAV_BULK_BACKEND_AUTO;
+        }
+        else
+#endif
+        if(backend == PKSAV_BULK_BACKEND_IO_URING)
+        {
+            // Nothing to do is never an error.
+            return (num_filepaths > 0) ? PKSAV_ERROR_FILE_IO : PKSAV_ERROR_NONE;
+        }
+    }
+
+    if(first_index >= num_filepaths)
+    {
+        return PKSAV_ERROR_NONE;
+    }
+
+#ifdef PKSAV_BULK_HAVE_THREADS
+    if((backend == PKSAV_BULK_BACKEND_AUTO) || (backend == PKSAV_BULK_BACKEND_THREADS))
+    {
+        _pksav_bulk_load_saves_threads(
+            pp_filepaths,
+            first_index,
+            num_filepaths,
+            queue_depth,
+            p_loader
+        );
+        return PKSAV_ERROR_NONE;
+    }
+#endif
+
+    // Without threads, PKSAV_BULK_BACKEND_THREADS falls back to this too.
+    _pksav_bulk_load_saves_serial(
+        pp_filepaths,
+        first_index,
+        num_filepaths,
+        p_loader
+    );
+
+    return PKSAV_ERROR_NONE;
+}
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef PKSAV_UTIL_BULK_H
+#define PKSAV_UTIL_BULK_H
+
+#include "fs.h"
+
+#include <pksav/bulk.h>
+#include <pksav/error.h>
+
+#include <stdlib.h>
+
+/*
+ * What a generation needs to plug into the bulk loader. Each file is read
+ * into a malloc'd buffer and handed to load_save, which takes ownership of
+ * it and frees it if loading fails. on_save_loaded is then called with
+ * the result, never concurrently with itself, and the save is freed once
+ * it returns.
+ */
+struct pksav_bulk_loader
+{
+    size_t save_size;
+
+    enum pksav_error (*load_save)(
+        struct pksav_fs_file_buffer* p_file_buffer,
+        void* p_context,
+        void* p_save_out
+    );
+
+    // p_save is NULL if error is set.
+    void (*on_save_loaded)(
+        size_t filepath_index,
+        enum pksav_error error,
+        void* p_save,
+        void* p_context
+    );
+
+    void (*free_save)(
+        void* p_save
+    );
+
+    void* p_context;
+};
+
+/*
+ * Loads every file, reporting each one through p_loader. Errors with
+ * individual files are only reported there, so this only fails if the
+ * requested backend isn't available.
+ */
+enum pksav_error pksav_bulk_load_saves(
+    const char* const* pp_filepaths,
+    size_t num_filepaths,
+    const struct pksav_bulk_load_options* p_options,
+    const struct pksav_bulk_loader* p_loader
+);
+
+#endif /* PKSAV_UTIL_BULK_H */
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef PKSAV_UTIL_CPU_H
+#define PKSAV_UTIL_CPU_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#    include <intrin.h>
+#endif
+
+/*
+ * x86 kernels are compiled with per-function target attributes and chosen
+ * at runtime, so the rest of the library doesn't need to be built for a
+ * newer CPU. This needs GCC or Clang.
+ */
+#if (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || defined(__i386__))
+
+#define PKSAV_CPU_X86_DISPATCH
+
+static inline bool pksav_cpu_has_sse2(void)
+{
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("sse2");
+}
+
+static inline bool pksav_cpu_has_ssse3(void)
+{
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("ssse3");
+}
+
+static inline bool pksav_cpu_has_avx2(void)
+{
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+}
+
+#endif
+
+/*
+ * Kernel dispatch
+ *
+ * Each dispatched function caches a pointer to the fastest entry of its
+ * kernel table the current CPU supports. The cache starts out NULL and is
+ * filled in on first use. It's loaded and stored atomically, so threads
+ * that resolve it at the same time don't race; they all store the same
+ * entry.
+ */
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#    define PKSAV_CPU_LOAD_CACHED_KERNEL(pp_cached_kernel) \
+        ((const void*)_InterlockedCompareExchangePointer( \
+            (void* volatile*)(pp_cached_kernel), NULL, NULL))
+#    define PKSAV_CPU_STORE_CACHED_KERNEL(pp_cached_kernel, p_kernel) \
+        ((void)_InterlockedExchangePointer( \
+            (void* volatile*)(pp_cached_kernel), (void*)(p_kernel)))
+#else
+#    define PKSAV_CPU_LOAD_CACHED_KERNEL(pp_cached_kernel) \
+        __atomic_load_n((pp_cached_kernel), __ATOMIC_RELAXED)
+#    define PKSAV_CPU_STORE_CACHED_KERNEL(pp_cached_kernel, p_kernel) \
+        __atomic_store_n((pp_cached_kernel), (p_kernel), __ATOMIC_RELAXED)
+#endif
+
+/*
+ * Returns the last kernel in the table the current CPU supports, resolving
+ * and caching it on the first call. Kernel tables go from slowest to
+ * fastest, and the first entry must always be supported.
+ *
+ * Use PKSAV_CPU_RESOLVE_KERNEL rather than calling this directly.
+ */
+static inline const void* pksav_cpu_resolve_kernel(
+    const void** pp_cached_kernel,
+    const void* p_kernels,
+    size_t kernel_size,
+    size_t num_kernels,
+    size_t is_supported_offset
+)
+{
+    const void* p_kernel = PKSAV_CPU_LOAD_CACHED_KERNEL(pp_cached_kernel);
+    if(p_kernel == NULL)
+    {
+        size_t kernel_index = num_kernels - 1;
+        for(; kernel_index > 0; --kernel_index)
+        {
+            bool (*is_supported)(void) = NULL;
+            memcpy(
+                &is_supported,
+                (const char*)p_kernels + (kernel_index * kernel_size) + is_supported_offset,
+                sizeof(is_supported)
+            );
+            if(is_supported())
+            {
+                break;
+            }
+        }
+
+        p_kernel = (const char*)p_kernels + (kernel_index * kernel_size);
+        PKSAV_CPU_STORE_CACHED_KERNEL(pp_cached_kernel, p_kernel);
+    }
+
+    return p_kernel;
+}
+
+/*
+ * Works with any table of structs with a bool (*is_supported)(void) member.
+ * cached_kernel must be a static const void*, initialized to NULL.
+ */
+#define PKSAV_CPU_RESOLVE_KERNEL(cached_kernel, kernels, num_kernels) \
+    pksav_cpu_resolve_kernel( \
+        &(cached_kernel), \
+        (kernels), \
+        sizeof((kernels)[0]), \
+        (num_kernels), \
+        (size_t)((const char*)&(kernels)[0].is_supported - (const char*)&(kernels)[0]) \
+    )
+
+#endif /* PKSAV_UTIL_CPU_H */
@@ -8,9 +8,28 @@
 #include "fs.h"
 
 #include <assert.h>
+#include <errno.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <string.h>
 
+#if defined(__unix__) || defined(__APPLE__)
+#    include <unistd.h>
+#endif
+
+#if defined(_POSIX_MAPPED_FILES) && (_POSIX_MAPPED_FILES > 0)
+#    define PKSAV_FS_HAVE_MMAP
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#endif
+
+#if defined(_POSIX_VERSION)
+#    define PKSAV_FS_HAVE_DIRENT
+#    include <dirent.h>
+#    include <sys/stat.h>
+#endif
+
 enum pksav_error pksav_fs_filesize(
     const char* filepath,
     size_t* filesize_out
@@ -65,6 +84,21 @@ enum pksav_error pksav_fs_read_file_to_buffer(
     uint8_t** buffer_ptr,
     size_t* buffer_len_out
 )
+{
+    return pksav_fs_read_file_to_buffer_with_max_len(
+               filepath,
+               SIZE_MAX,
+               buffer_ptr,
+               buffer_len_out
+           );
+}
+
+enum pksav_error pksav_fs_read_file_to_buffer_with_max_len(
+    const char* filepath,
+    size_t max_len,
+    uint8_t** buffer_ptr,
+    size_t* buffer_len_out
+)
 {
     assert(filepath != NULL);
     assert(buffer_ptr != NULL);
@@ -72,54 +106,589 @@ enum pksav_error pksav_fs_read_file_to_buffer(
 
     enum pksav_error error = PKSAV_ERROR_NONE;
 
-    size_t filesize = 0;
+    FILE* input_file = fopen(filepath, "rb");
+    if(!input_file)
+    {
+        return PKSAV_ERROR_FILE_IO;
+    }
+
+    long int ftell_output = -1;
+    if(!fseek(input_file, 0, SEEK_END))
+    {
+        ftell_output = ftell(input_file);
+    }
+
+    if((ftell_output >= 0) && ((unsigned long)ftell_output > max_len))
+    {
+        error = PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
+    else if((ftell_output >= 0) && !fseek(input_file, 0, SEEK_SET))
+    {
+        size_t filesize = (size_t)ftell_output;
+
+        // Every byte is about to be overwritten, so there's no need to
+        // zero the buffer. Always allocate at least one byte so an empty
+        // file still gives a valid pointer.
+        uint8_t* file_contents = malloc((filesize > 0) ? filesize : 1);
+        if(file_contents)
+        {
+            size_t num_read = fread(file_contents, 1, filesize, input_file);
+            if(num_read == filesize)
+            {
+                *buffer_ptr = file_contents;
+                *buffer_len_out = filesize;
+            }
+            else
+            {
+                error = PKSAV_ERROR_FILE_IO;
+                free(file_contents);
+            }
+        }
+        else
+        {
+            error = PKSAV_ERROR_OUT_OF_MEMORY;
+        }
+    }
+    else
+    {
+        error = PKSAV_ERROR_FILE_IO;
+    }
+
+    if(fclose(input_file) && !error)
+    {
+        // The buffer is complete, but treat this like any other I/O
+        // failure.
+        error = PKSAV_ERROR_FILE_IO;
+        free(*buffer_ptr);
+        *buffer_ptr = NULL;
+    }
+
+    return error;
+}
+
+#ifdef PKSAV_FS_HAVE_MMAP
+
+static enum pksav_error _pksav_fs_read_fd_to_buffer(
+    int fd,
+    size_t filesize,
+    uint8_t** buffer_ptr
+)
+{
+    assert(fd >= 0);
+    assert(buffer_ptr != NULL);
+
+    uint8_t* file_contents = malloc((filesize > 0) ? filesize : 1);
+    if(!file_contents)
+    {
+        return PKSAV_ERROR_OUT_OF_MEMORY;
+    }
+
+    size_t num_read = 0;
+    while(num_read < filesize)
+    {
+        ssize_t read_output = read(fd, &file_contents[num_read], filesize - num_read);
+        if(read_output > 0)
+        {
+            num_read += (size_t)read_output;
+        }
+        else if((read_output < 0) && (errno == EINTR))
+        {
+            continue;
+        }
+        else
+        {
+            free(file_contents);
+            return PKSAV_ERROR_FILE_IO;
+        }
+    }
+
+    *buffer_ptr = file_contents;
+
+    return PKSAV_ERROR_NONE;
+}
+
+enum pksav_error pksav_fs_map_file(
+    const char* filepath,
+    enum pksav_fs_map_mode map_mode,
+    struct pksav_fs_file_buffer* p_file_buffer_out
+)
+{
+    assert(filepath != NULL);
+    assert(p_file_buffer_out != NULL);
+
+    enum pksav_error error = PKSAV_ERROR_NONE;
+
+    bool is_shared = (map_mode == PKSAV_FS_MAP_SHARED);
+
+    int fd = open(filepath, is_shared ? O_RDWR : O_RDONLY);
+    if(fd < 0)
+    {
+        return PKSAV_ERROR_FILE_IO;
+    }
+
+    struct stat file_stat;
+    if(!fstat(fd, &file_stat) &&
+       S_ISREG(file_stat.st_mode) &&
+       ((uintmax_t)file_stat.st_size <= SIZE_MAX))
+    {
+        size_t filesize = (size_t)file_stat.st_size;
+        void* p_mapping = MAP_FAILED;
+
+        // mmap rejects empty mappings, so those go through the fallback.
+        if(filesize > 0)
+        {
+            int prot = PROT_READ;
+            if(map_mode != PKSAV_FS_MAP_READ_ONLY)
+            {
+                prot |= PROT_WRITE;
+            }
+
+            p_mapping = mmap(
+                            NULL,
+                            filesize,
+                            prot,
+                            is_shared ? MAP_SHARED : MAP_PRIVATE,
+                            fd,
+                            0
+                        );
+        }
+
+        if(p_mapping != MAP_FAILED)
+        {
+            p_file_buffer_out->p_buffer = p_mapping;
+            p_file_buffer_out->buffer_len = filesize;
+            p_file_buffer_out->is_mapped = true;
+            p_file_buffer_out->is_shared = is_shared;
+        }
+        else if(is_shared)
+        {
+            // A copy of the file can't stand in for a shared mapping.
+            error = PKSAV_ERROR_FILE_IO;
+        }
+        else
+        {
+            // Some filesystems can't be mapped, so just read the file.
+            uint8_t* p_buffer = NULL;
+            error = _pksav_fs_read_fd_to_buffer(fd, filesize, &p_buffer);
+            if(!error)
+            {
+                p_file_buffer_out->p_buffer = p_buffer;
+                p_file_buffer_out->buffer_len = filesize;
+                p_file_buffer_out->is_mapped = false;
+                p_file_buffer_out->is_shared = false;
+            }
+        }
+    }
+    else
+    {
+        error = PKSAV_ERROR_FILE_IO;
+    }
+
+    // The mapping stays valid after the descriptor is closed.
+    close(fd);
+
+    return error;
+}
+
+#else
+
+enum pksav_error pksav_fs_map_file(
+    const char* filepath,
+    enum pksav_fs_map_mode map_mode,
+    struct pksav_fs_file_buffer* p_file_buffer_out
+)
+{
+    assert(filepath != NULL);
+    assert(p_file_buffer_out != NULL);
+
+    // A copy of the file can't stand in for a shared mapping.
+    if(map_mode == PKSAV_FS_MAP_SHARED)
+    {
+        return PKSAV_ERROR_FILE_IO;
+    }
+
+    enum pksav_error error = PKSAV_ERROR_NONE;
+
+    uint8_t* p_buffer = NULL;
+    size_t buffer_len = 0;
+    error = pksav_fs_read_file_to_buffer(
+                filepath,
+                &p_buffer,
+                &buffer_len
+            );
+    if(!error)
+    {
+        p_file_buffer_out->p_buffer = p_buffer;
+        p_file_buffer_out->buffer_len = buffer_len;
+        p_file_buffer_out->is_mapped = false;
+        p_file_buffer_out->is_shared = false;
+    }
+
+    return error;
+}
+
+#endif /* PKSAV_FS_HAVE_MMAP */
+
+void pksav_fs_unmap_file(
+    struct pksav_fs_file_buffer* p_file_buffer
+)
+{
+    assert(p_file_buffer != NULL);
+
+#ifdef PKSAV_FS_HAVE_MMAP
+    if(p_file_buffer->is_mapped)
+    {
+        munmap(p_file_buffer->p_buffer, p_file_buffer->buffer_len);
+    }
+    else
+#endif
+    {
+        free(p_file_buffer->p_buffer);
+    }
+
+    memset(p_file_buffer, 0, sizeof(*p_file_buffer));
+}
+
+enum pksav_error pksav_fs_read_io_to_buffer(
+    const struct pksav_io* p_io,
+    struct pksav_fs_file_buffer* p_file_buffer_out
+)
+{
+    assert(p_io != NULL);
+    assert(p_file_buffer_out != NULL);
 
-    error = pksav_fs_filesize(filepath, &filesize);
+    if(!p_io->read_at || !p_io->get_size)
+    {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    enum pksav_error error = PKSAV_ERROR_NONE;
+
+    size_t buffer_len = 0;
+    error = p_io->get_size(p_io, &buffer_len);
     if(!error)
     {
-        FILE* input_file = fopen(filepath, "rb");
-        if(input_file)
+        // Every byte is about to be overwritten, so there's no need to
+        // zero the buffer.
+        uint8_t* p_buffer = malloc((buffer_len > 0) ? buffer_len : 1);
+        if(p_buffer)
         {
-            void* file_contents = calloc(filesize, 1);
-            if(file_contents)
+            error = p_io->read_at(p_io, 0, p_buffer, buffer_len);
+            if(!error)
             {
-                size_t num_read = fread(file_contents, 1, filesize, input_file);
-                if(num_read == filesize)
-                {
-                    *buffer_ptr = file_contents;
-                    *buffer_len_out = filesize;
-                }
-                else
+                p_file_buffer_out->p_buffer = p_buffer;
+                p_file_buffer_out->buffer_len = buffer_len;
+                p_file_buffer_out->is_mapped = false;
+                p_file_buffer_out->is_shared = false;
+            }
+            else
+            {
+                free(p_buffer);
+            }
+        }
+        else
+        {
+            error = PKSAV_ERROR_OUT_OF_MEMORY;
+        }
+    }
+
+    return error;
+}
+
+#ifdef PKSAV_FS_HAVE_MMAP
+
+enum pksav_error pksav_fs_open_io(
+    const char* filepath,
+    bool is_writable,
+    struct pksav_io* p_io_out
+)
+{
+    assert(filepath != NULL);
+    assert(p_io_out != NULL);
+
+    enum pksav_error error = PKSAV_ERROR_NONE;
+
+    int fd = open(filepath, is_writable ? O_RDWR : O_RDONLY);
+    if(fd >= 0)
+    {
+        error = pksav_io_init_fd(fd, p_io_out);
+        if(error)
+        {
+            close(fd);
+        }
+    }
+    else
+    {
+        error = PKSAV_ERROR_FILE_IO;
+    }
+
+    return error;
+}
+
+void pksav_fs_close_io(
+    struct pksav_io* p_io
+)
+{
+    assert(p_io != NULL);
+
+    close(p_io->builtin_state.fd);
+    memset(p_io, 0, sizeof(*p_io));
+}
+
+#else
+
+enum pksav_error pksav_fs_open_io(
+    const char* filepath,
+    bool is_writable,
+    struct pksav_io* p_io_out
+)
+{
+    assert(filepath != NULL);
+    assert(p_io_out != NULL);
+
+    enum pksav_error error = PKSAV_ERROR_NONE;
+
+    // "r+b" opens an existing file without truncating it.
+    FILE* p_file = fopen(filepath, is_writable ? "r+b" : "rb");
+    if(p_file)
+    {
+        // Every read seeks first, so buffering would only read bytes
+        // that are thrown away.
+        setvbuf(p_file, NULL, _IONBF, 0);
+
+        error = pksav_io_init_file(p_file, p_io_out);
+        if(error)
+        {
+            fclose(p_file);
+        }
+    }
+    else
+    {
+        error = PKSAV_ERROR_FILE_IO;
+    }
+
+    return error;
+}
+
+void pksav_fs_close_io(
+    struct pksav_io* p_io
+)
+{
+    assert(p_io != NULL);
+
+    fclose(p_io->p_context);
+    memset(p_io, 0, sizeof(*p_io));
+}
+
+#endif /* PKSAV_FS_HAVE_MMAP */
+
+// Changed bytes closer together than this are written in one write, since
+// each write costs more than a few extra bytes.
+#define PKSAV_FS_CHANGE_MERGE_GAP (64)
+#define PKSAV_FS_CHANGE_CHUNK_SIZE (4096)
+
+enum pksav_error pksav_fs_write_changes_to_io(
+    const struct pksav_io* p_io,
+    const uint8_t* buffer,
+    size_t buffer_len
+)
+{
+    assert(p_io != NULL);
+    assert(buffer != NULL);
+
+    if(!p_io->read_at || !p_io->write_at || !p_io->get_size)
+    {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    enum pksav_error error = PKSAV_ERROR_NONE;
+
+    size_t io_size = 0;
+    error = p_io->get_size(p_io, &io_size);
+
+    const size_t compare_len = (io_size < buffer_len) ? io_size : buffer_len;
+
+    // The range of changed bytes waiting to be written, if run_end > 0.
+    size_t run_start = 0;
+    size_t run_end = 0;
+
+    uint8_t chunk[PKSAV_FS_CHANGE_CHUNK_SIZE];
+    for(size_t chunk_start = 0;
+        (chunk_start < compare_len) && !error;
+        chunk_start += sizeof(chunk))
+    {
+        size_t chunk_len = compare_len - chunk_start;
+        if(chunk_len > sizeof(chunk))
+        {
+            chunk_len = sizeof(chunk);
+        }
+
+        error = p_io->read_at(p_io, chunk_start, chunk, chunk_len);
+        if(error || !memcmp(chunk, &buffer[chunk_start], chunk_len))
+        {
+            continue;
+        }
+
+        for(size_t chunk_index = 0;
+            (chunk_index < chunk_len) && !error;
+            ++chunk_index)
+        {
+            if(chunk[chunk_index] != buffer[chunk_start + chunk_index])
+            {
+                const size_t offset = chunk_start + chunk_index;
+                if((run_end > 0) && ((offset - run_end) > PKSAV_FS_CHANGE_MERGE_GAP))
                 {
-                    error = PKSAV_ERROR_FILE_IO;
+                    error = p_io->write_at(
+                                p_io,
+                                run_start,
+                                &buffer[run_start],
+                                run_end - run_start
+                            );
+                    run_end = 0;
                 }
-
-                if(fclose(input_file))
+                if(run_end == 0)
                 {
-                    // Even if error was already set to this, the result
-                    // is the same.
-                    error = PKSAV_ERROR_FILE_IO;
+                    run_start = offset;
                 }
+                run_end = offset + 1;
             }
-            else
-            {
-                // TODO: internal error instead?
-                error = PKSAV_ERROR_FILE_IO;
+        }
+    }
 
-                // This is already an error state, but try and close if
-                // possible.
-                fclose(input_file);
-            }
+    // Everything past the end of the existing data is new.
+    if(!error && (buffer_len > compare_len))
+    {
+        if((run_end > 0) && ((compare_len - run_end) > PKSAV_FS_CHANGE_MERGE_GAP))
+        {
+            error = p_io->write_at(
+                        p_io,
+                        run_start,
+                        &buffer[run_start],
+                        run_end - run_start
+                    );
+            run_end = 0;
+        }
+        if(run_end == 0)
+        {
+            run_start = compare_len;
+        }
+        run_end = buffer_len;
+    }
+
+    if(!error && (run_end > 0))
+    {
+        error = p_io->write_at(
+                    p_io,
+                    run_start,
+                    &buffer[run_start],
+                    run_end - run_start
+                );
+    }
+
+    return error;
+}
+
+enum pksav_error pksav_fs_sync_file_buffer(
+    const struct pksav_fs_file_buffer* p_file_buffer,
+    size_t offset,
+    size_t len
+)
+{
+    assert(p_file_buffer != NULL);
+    assert((offset + len) <= p_file_buffer->buffer_len);
+
+    enum pksav_error error = PKSAV_ERROR_NONE;
+
+#ifdef PKSAV_FS_HAVE_MMAP
+    if(p_file_buffer->is_shared)
+    {
+        // msync needs a page-aligned address, so start at the page the
+        // range starts in. The kernel skips any pages that aren't dirty.
+        size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+        size_t aligned_offset = offset - (offset % page_size);
+
+        if(msync(
+               &p_file_buffer->p_buffer[aligned_offset],
+               len + (offset - aligned_offset),
+               MS_SYNC
+           ))
+        {
+            error = PKSAV_ERROR_FILE_IO;
+        }
+    }
+    else
+#endif
+    {
+        (void)offset;
+        (void)len;
+
+        error = PKSAV_ERROR_FILE_IO;
+    }
+
+    return error;
+}
+
+#ifdef PKSAV_FS_HAVE_MMAP
+
+/*
+ * The buffer being written may be a private mapping of the same file. Any
+ * page that hasn't been written to is still backed by the file, so
+ * truncating the file before writing would pull those pages out from under
+ * the buffer. Instead, overwrite the file in place and only trim it at the
+ * end.
+ */
+enum pksav_error pksav_fs_write_buffer_to_file(
+    const char* filepath,
+    const uint8_t* buffer,
+    size_t buffer_len
+)
+{
+    assert(filepath != NULL);
+    assert(buffer != NULL);
+    assert(buffer_len > 0);
+
+    enum pksav_error error = PKSAV_ERROR_NONE;
+
+    int fd = open(filepath, O_WRONLY | O_CREAT, 0666);
+    if(fd < 0)
+    {
+        return PKSAV_ERROR_FILE_IO;
+    }
+
+    size_t num_written = 0;
+    while(num_written < buffer_len)
+    {
+        ssize_t write_output = write(fd, &buffer[num_written], buffer_len - num_written);
+        if(write_output > 0)
+        {
+            num_written += (size_t)write_output;
+        }
+        else if((write_output < 0) && (errno == EINTR))
+        {
+            continue;
         }
         else
         {
             error = PKSAV_ERROR_FILE_IO;
+            break;
         }
     }
 
+    if(!error && ftruncate(fd, (off_t)buffer_len))
+    {
+        error = PKSAV_ERROR_FILE_IO;
+    }
+
+    if(close(fd))
+    {
+        error = PKSAV_ERROR_FILE_IO;
+    }
+
     return error;
 }
 
+#else
+
 enum pksav_error pksav_fs_write_buffer_to_file(
     const char* filepath,
     const uint8_t* buffer,
@@ -164,3 +733,129 @@ enum pksav_error pksav_fs_write_buffer_to_file(
 
     return error;
 }
+
+#endif /* PKSAV_FS_HAVE_MMAP */
+
+#ifdef PKSAV_FS_HAVE_DIRENT
+
+enum pksav_error pksav_fs_list_directory(
+    const char* dirpath,
+    char*** ppp_filepaths_out,
+    size_t* p_num_filepaths_out
+)
+{
+    assert(dirpath != NULL);
+    assert(ppp_filepaths_out != NULL);
+    assert(p_num_filepaths_out != NULL);
+
+    DIR* p_dir = opendir(dirpath);
+    if(!p_dir)
+    {
+        return PKSAV_ERROR_FILE_IO;
+    }
+
+    enum pksav_error error = PKSAV_ERROR_NONE;
+
+    char** pp_filepaths = NULL;
+    size_t num_filepaths = 0;
+    size_t filepaths_capacity = 0;
+
+    size_t dirpath_len = strlen(dirpath);
+    bool needs_separator = (dirpath_len > 0) && (dirpath[dirpath_len-1] != '/');
+
+    struct dirent* p_entry = NULL;
+    while(!error && ((p_entry = readdir(p_dir)) != NULL))
+    {
+        size_t name_len = strlen(p_entry->d_name);
+        char* p_filepath = malloc(dirpath_len + name_len + 2);
+        if(!p_filepath)
+        {
+            error = PKSAV_ERROR_FILE_IO;
+            break;
+        }
+        snprintf(
+            p_filepath, dirpath_len + name_len + 2,
+            "%s%s%s",
+            dirpath, needs_separator ? "/" : "", p_entry->d_name
+        );
+
+        // Symlinks are followed, but only regular files are listed.
+        struct stat file_stat;
+        if(stat(p_filepath, &file_stat) || !S_ISREG(file_stat.st_mode))
+        {
+            free(p_filepath);
+            continue;
+        }
+
+        if(num_filepaths == filepaths_capacity)
+        {
+            size_t new_capacity = (filepaths_capacity > 0)
+                                ? (filepaths_capacity * 2) : 64;
+            char** pp_new_filepaths = realloc(
+                                          pp_filepaths,
+                                          new_capacity * sizeof(char*)
+                                      );
+            if(!pp_new_filepaths)
+            {
+                free(p_filepath);
+                error = PKSAV_ERROR_FILE_IO;
+                break;
+            }
+
+            pp_filepaths = pp_new_filepaths;
+            filepaths_capacity = new_capacity;
+        }
+
+        pp_filepaths[num_filepaths++] = p_filepath;
+    }
+
+    closedir(p_dir);
+
+    if(error)
+    {
+        pksav_fs_free_directory_list(pp_filepaths, num_filepaths);
+    }
+    else
+    {
+        *ppp_filepaths_out = pp_filepaths;
+        *p_num_filepaths_out = num_filepaths;
+    }
+
+    return error;
+}
+
+#else
+
+enum pksav_error pksav_fs_list_directory(
+    const char* dirpath,
+    char*** ppp_filepaths_out,
+    size_t* p_num_filepaths_out
+)
+{
+    assert(dirpath != NULL);
+    assert(ppp_filepaths_out != NULL);
+    assert(p_num_filepaths_out != NULL);
+
+    (void)dirpath;
+    (void)ppp_filepaths_out;
+    (void)p_num_filepaths_out;
+
+    // There's no portable way to list a directory without POSIX.
+    return PKSAV_ERROR_FILE_IO;
+}
+
+#endif /* PKSAV_FS_HAVE_DIRENT */
+
+void pksav_fs_free_directory_list(
+    char** pp_filepaths,
+    size_t num_filepaths
+)
+{
+    for(size_t filepath_index = 0;
+        filepath_index < num_filepaths;
+        ++filepath_index)
+    {
+        free(pp_filepaths[filepath_index]);
+    }
+    free(pp_filepaths);
+}
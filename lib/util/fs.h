@@ -9,10 +9,35 @@
 #define PKSAV_UTIL_FS_H
 
 #include <pksav/error.h>
+#include <pksav/io.h>
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
 
+enum pksav_fs_map_mode
+{
+    // Pages can only be read. Meant for detection and inspection.
+    PKSAV_FS_MAP_READ_ONLY,
+    // Pages can be written, but changes stay private to this process
+    // until they're explicitly written out.
+    PKSAV_FS_MAP_COPY_ON_WRITE,
+    // Pages can be written, and changes go straight to the file. This is
+    // only possible with mmap, so it never falls back to reading the file.
+    PKSAV_FS_MAP_SHARED
+};
+
+struct pksav_fs_file_buffer
+{
+    uint8_t* p_buffer;
+    size_t buffer_len;
+
+    // If false, p_buffer was allocated with malloc.
+    bool is_mapped;
+    // If true, writes to p_buffer are writes to the file.
+    bool is_shared;
+};
+
 enum pksav_error pksav_fs_filesize(
     const char* filepath,
     size_t* filesize_out
@@ -24,10 +49,99 @@ enum pksav_error pksav_fs_read_file_to_buffer(
     size_t* buffer_len_out
 );
 
+/*
+ * Like pksav_fs_read_file_to_buffer, but fails with
+ * PKSAV_ERROR_PARAM_OUT_OF_RANGE without reading anything if the file is
+ * larger than max_len.
+ */
+enum pksav_error pksav_fs_read_file_to_buffer_with_max_len(
+    const char* filepath,
+    size_t max_len,
+    uint8_t** buffer_ptr,
+    size_t* buffer_len_out
+);
+
+/*
+ * Maps the given file into memory, falling back to reading it into an
+ * uninitialized buffer on platforms without mmap. Either way, the result
+ * must be released with pksav_fs_unmap_file.
+ */
+enum pksav_error pksav_fs_map_file(
+    const char* filepath,
+    enum pksav_fs_map_mode map_mode,
+    struct pksav_fs_file_buffer* p_file_buffer_out
+);
+
+void pksav_fs_unmap_file(
+    struct pksav_fs_file_buffer* p_file_buffer
+);
+
+/*
+ * Flushes the pages of a shared mapping that overlap the given range. Only
+ * pages that were actually written to are written back.
+ */
+enum pksav_error pksav_fs_sync_file_buffer(
+    const struct pksav_fs_file_buffer* p_file_buffer,
+    size_t offset,
+    size_t len
+);
+
+/*
+ * Reads everything behind an I/O backend into a newly allocated buffer,
+ * which must be released with pksav_fs_unmap_file.
+ */
+enum pksav_error pksav_fs_read_io_to_buffer(
+    const struct pksav_io* p_io,
+    struct pksav_fs_file_buffer* p_file_buffer_out
+);
+
+/*
+ * Opens an existing file through an I/O backend, for callers that only
+ * need a few small reads or writes. Where possible, this is a file
+ * descriptor, so each read or write is a single pread or pwrite. It must
+ * be closed with pksav_fs_close_io.
+ */
+enum pksav_error pksav_fs_open_io(
+    const char* filepath,
+    bool is_writable,
+    struct pksav_io* p_io_out
+);
+
+void pksav_fs_close_io(
+    struct pksav_io* p_io
+);
+
+/*
+ * Writes only the bytes of the buffer that differ from what's already
+ * behind the backend, which is read in chunks to compare. Anything past
+ * the end of the existing data is written as-is.
+ */
+enum pksav_error pksav_fs_write_changes_to_io(
+    const struct pksav_io* p_io,
+    const uint8_t* buffer,
+    size_t buffer_len
+);
+
 enum pksav_error pksav_fs_write_buffer_to_file(
     const char* filepath,
     const uint8_t* buffer,
     size_t buffer_len
 );
 
+/*
+ * Lists the regular files directly inside a directory, in no particular
+ * order. Each path starts with dirpath. The list must be released with
+ * pksav_fs_free_directory_list.
+ */
+enum pksav_error pksav_fs_list_directory(
+    const char* dirpath,
+    char*** ppp_filepaths_out,
+    size_t* p_num_filepaths_out
+);
+
+void pksav_fs_free_directory_list(
+    char** pp_filepaths,
+    size_t num_filepaths
+);
+
 #endif /* PKSAV_UTIL_FS_H */
@@ -0,0 +1,461 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "util/text_batch.h"
+#include "util/text_common.h"
+
+#include "util/cpu.h"
+
+#include <assert.h>
+#include <string.h>
+
+#ifdef PKSAV_CPU_X86_DISPATCH
+#    include <immintrin.h>
+#endif
+
+void pksav_text_batch_table_init(
+    struct pksav_text_batch_table* p_table,
+    const wchar_t* p_char_map,
+    size_t num_valid_chars
+)
+{
+    assert(p_table != NULL);
+    assert(p_char_map != NULL);
+    assert(num_valid_chars <= 256);
+
+    memset(p_table, 0, sizeof(*p_table));
+
+    for(size_t game_char = 0; game_char < num_valid_chars; ++game_char)
+    {
+        // Anything that doesn't encode, including 0, is left as a length
+        // of 0, ending the string.
+        size_t char_len = pksav_utf8_encode(
+                              (uint32_t)p_char_map[game_char],
+                              (char*)p_table->utf8[game_char],
+                              PKSAV_TEXT_BATCH_MAX_UTF8_CHAR_LEN
+                          );
+        p_table->utf8_len[game_char] = (uint8_t)char_len;
+
+        if(char_len == 1)
+        {
+            p_table->ascii[game_char] = p_table->utf8[game_char][0];
+        }
+    }
+}
+
+/*
+ * Scalar
+ */
+
+static bool _pksav_text_batch_scalar_is_supported(void)
+{
+    return true;
+}
+
+// Converts the rest of a record, returning how many bytes were written.
+static inline size_t _pksav_text_batch_import_chars(
+    const struct pksav_text_batch_table* p_table,
+    const uint8_t* p_record,
+    size_t first_char_index,
+    size_t num_chars,
+    char* p_output
+)
+{
+    size_t num_bytes = 0;
+    for(size_t char_index = first_char_index; char_index < num_chars; ++char_index)
+    {
+        uint8_t game_char = p_record[char_index];
+        size_t char_len = p_table->utf8_len[game_char];
+        if(char_len == 0)
+        {
+            break;
+        }
+
+        memcpy(&p_output[num_bytes], p_table->utf8[game_char], char_len);
+        num_bytes += char_len;
+    }
+
+    return num_bytes;
+}
+
+static void _pksav_text_batch_import_scalar(
+    const struct pksav_text_batch_table* p_table,
+    const uint8_t* p_records,
+    size_t record_stride,
+    size_t num_records,
+    size_t num_chars,
+    char* p_arena,
+    size_t arena_len,
+    size_t* p_offsets
+)
+{
+    assert(p_table != NULL);
+    assert(p_records != NULL);
+    assert(p_arena != NULL);
+    assert(p_offsets != NULL);
+
+    (void)arena_len;
+
+    size_t offset = 0;
+    p_offsets[0] = 0;
+
+    for(size_t record_index = 0; record_index < num_records; ++record_index)
+    {
+        offset += _pksav_text_batch_import_chars(
+                      p_table,
+                      &p_records[record_index * record_stride],
+                      0,
+                      num_chars,
+                      &p_arena[offset]
+                  );
+        p_offsets[record_index + 1] = offset;
+    }
+}
+
+/*
+ * SSSE3/AVX2
+ *
+ * The ASCII table is split into 16 rows of 16, indexed by each character's
+ * high nibble, and every row is looked up by low nibble with pshufb. Masking
+ * each row's result to the characters with that high nibble and ORing them
+ * together translates 16 characters (32 with AVX2, one record per lane) at
+ * once. The ASCII run at the start of each record is stored as-is, and
+ * anything after it is finished with the scalar code, so names with accents
+ * or symbols still come out the same.
+ */
+
+#ifdef PKSAV_CPU_X86_DISPATCH
+
+#define PKSAV_TEXT_BATCH_VECTOR_LEN 16
+
+/*
+ * Only rows with an ASCII character in them are looked up, which in the
+ * games' maps is about half of them.
+ */
+struct pksav_text_batch_rows_ssse3
+{
+    size_t num_rows;
+    __m128i rows[16];
+    __m128i row_indices[16];
+};
+
+__attribute__((target("ssse3")))
+static inline void _pksav_text_batch_load_rows_ssse3(
+    const struct pksav_text_batch_table* p_table,
+    struct pksav_text_batch_rows_ssse3* p_rows
+)
+{
+    p_rows->num_rows = 0;
+
+    for(size_t row_index = 0; row_index < 16; ++row_index)
+    {
+        __m128i row = _mm_loadu_si128((const __m128i*)&p_table->ascii[row_index * 16]);
+        if(_mm_movemask_epi8(_mm_cmpeq_epi8(row, _mm_setzero_si128())) != 0xFFFF)
+        {
+            p_rows->rows[p_rows->num_rows] = row;
+            p_rows->row_indices[p_rows->num_rows] = _mm_set1_epi8((char)row_index);
+            ++p_rows->num_rows;
+        }
+    }
+}
+
+__attribute__((target("ssse3")))
+static inline __m128i _pksav_text_batch_lookup_ssse3(
+    const struct pksav_text_batch_rows_ssse3* p_rows,
+    __m128i game_chars
+)
+{
+    const __m128i nibble_mask = _mm_set1_epi8(0x0F);
+    __m128i low_nibbles = _mm_and_si128(game_chars, nibble_mask);
+    __m128i high_nibbles = _mm_and_si128(_mm_srli_epi16(game_chars, 4), nibble_mask);
+
+    __m128i ascii_chars = _mm_setzero_si128();
+    for(size_t row_index = 0; row_index < p_rows->num_rows; ++row_index)
+    {
+        __m128i row_chars = _mm_shuffle_epi8(p_rows->rows[row_index], low_nibbles);
+        __m128i is_in_row = _mm_cmpeq_epi8(high_nibbles, p_rows->row_indices[row_index]);
+        ascii_chars = _mm_or_si128(ascii_chars, _mm_and_si128(row_chars, is_in_row));
+    }
+
+    return ascii_chars;
+}
+
+// Only reads past the record if it's still inside the records.
+__attribute__((target("ssse3")))
+static inline __m128i _pksav_text_batch_load_record_ssse3(
+    const uint8_t* p_records,
+    size_t records_len,
+    size_t record_start,
+    size_t num_chars
+)
+{
+    if((record_start + PKSAV_TEXT_BATCH_VECTOR_LEN) <= records_len)
+    {
+        return _mm_loadu_si128((const __m128i*)&p_records[record_start]);
+    }
+    else
+    {
+        uint8_t record[PKSAV_TEXT_BATCH_VECTOR_LEN] = {0};
+        memcpy(record, &p_records[record_start], num_chars);
+
+        return _mm_loadu_si128((const __m128i*)record);
+    }
+}
+
+// Stores the record's leading ASCII run, then finishes it with the scalar
+// code. Returns how many bytes were written.
+__attribute__((target("ssse3")))
+static inline size_t _pksav_text_batch_finish_record_ssse3(
+    const struct pksav_text_batch_table* p_table,
+    const uint8_t* p_record,
+    size_t num_chars,
+    __m128i ascii_chars,
+    uint32_t non_ascii_mask,
+    char* p_arena,
+    size_t arena_len,
+    size_t offset
+)
+{
+    // Anything past the record ends the run too.
+    non_ascii_mask |= (~(uint32_t)0) << num_chars;
+    size_t ascii_run_len = (size_t)__builtin_ctz(non_ascii_mask);
+
+    char* p_output = &p_arena[offset];
+    if((offset + PKSAV_TEXT_BATCH_VECTOR_LEN) <= arena_len)
+    {
+        _mm_storeu_si128((__m128i*)p_output, ascii_chars);
+    }
+    else
+    {
+        uint8_t output[PKSAV_TEXT_BATCH_VECTOR_LEN];
+        _mm_storeu_si128((__m128i*)output, ascii_chars);
+        memcpy(p_output, output, ascii_run_len);
+    }
+
+    return ascii_run_len + _pksav_text_batch_import_chars(
+                               p_table,
+                               p_record,
+                               ascii_run_len,
+                               num_chars,
+                               &p_output[ascii_run_len]
+                           );
+}
+
+__attribute__((target("ssse3")))
+static void _pksav_text_batch_import_ssse3(
+    const struct pksav_text_batch_table* p_table,
+    const uint8_t* p_records,
+    size_t record_stride,
+    size_t num_records,
+    size_t num_chars,
+    char* p_arena,
+    size_t arena_len,
+    size_t* p_offsets
+)
+{
+    assert(p_table != NULL);
+    assert(p_records != NULL);
+    assert(p_arena != NULL);
+    assert(p_offsets != NULL);
+
+    if((num_chars > PKSAV_TEXT_BATCH_VECTOR_LEN) || (num_records == 0))
+    {
+        _pksav_text_batch_import_scalar(
+            p_table, p_records, record_stride, num_records,
+            num_chars, p_arena, arena_len, p_offsets
+        );
+        return;
+    }
+
+    struct pksav_text_batch_rows_ssse3 rows;
+    _pksav_text_batch_load_rows_ssse3(p_table, &rows);
+
+    const size_t records_len = ((num_records - 1) * record_stride) + num_chars;
+    const __m128i zero = _mm_setzero_si128();
+
+    size_t offset = 0;
+    p_offsets[0] = 0;
+
+    for(size_t record_index = 0; record_index < num_records; ++record_index)
+    {
+        size_t record_start = record_index * record_stride;
+
+        __m128i game_chars = _pksav_text_batch_load_record_ssse3(
+                                 p_records, records_len, record_start, num_chars
+                             );
+        __m128i ascii_chars = _pksav_text_batch_lookup_ssse3(&rows, game_chars);
+        uint32_t non_ascii_mask = (uint32_t)_mm_movemask_epi8(
+                                      _mm_cmpeq_epi8(ascii_chars, zero)
+                                  );
+
+        offset += _pksav_text_batch_finish_record_ssse3(
+                      p_table, &p_records[record_start], num_chars,
+                      ascii_chars, non_ascii_mask,
+                      p_arena, arena_len, offset
+                  );
+        p_offsets[record_index + 1] = offset;
+    }
+}
+
+__attribute__((target("avx2")))
+static void _pksav_text_batch_import_avx2(
+    const struct pksav_text_batch_table* p_table,
+    const uint8_t* p_records,
+    size_t record_stride,
+    size_t num_records,
+    size_t num_chars,
+    char* p_arena,
+    size_t arena_len,
+    size_t* p_offsets
+)
+{
+    assert(p_table != NULL);
+    assert(p_records != NULL);
+    assert(p_arena != NULL);
+    assert(p_offsets != NULL);
+
+    if((num_chars > PKSAV_TEXT_BATCH_VECTOR_LEN) || (num_records == 0))
+    {
+        _pksav_text_batch_import_scalar(
+            p_table, p_records, record_stride, num_records,
+            num_chars, p_arena, arena_len, p_offsets
+        );
+        return;
+    }
+
+    struct pksav_text_batch_rows_ssse3 rows128;
+    _pksav_text_batch_load_rows_ssse3(p_table, &rows128);
+
+    __m256i rows[16];
+    __m256i row_indices[16];
+    for(size_t row_index = 0; row_index < rows128.num_rows; ++row_index)
+    {
+        rows[row_index] = _mm256_broadcastsi128_si256(rows128.rows[row_index]);
+        row_indices[row_index] = _mm256_broadcastsi128_si256(rows128.row_indices[row_index]);
+    }
+
+    const size_t records_len = ((num_records - 1) * record_stride) + num_chars;
+    const __m256i nibble_mask = _mm256_set1_epi8(0x0F);
+    const __m256i zero = _mm256_setzero_si256();
+
+    size_t offset = 0;
+    p_offsets[0] = 0;
+
+    size_t record_index = 0;
+    for(; (record_index + 2) <= num_records; record_index += 2)
+    {
+        size_t record_start0 = record_index * record_stride;
+        size_t record_start1 = record_start0 + record_stride;
+
+        __m256i game_chars = _mm256_inserti128_si256(
+                                 _mm256_castsi128_si256(
+                                     _pksav_text_batch_load_record_ssse3(
+                                         p_records, records_len, record_start0, num_chars
+                                     )
+                                 ),
+                                 _pksav_text_batch_load_record_ssse3(
+                                     p_records, records_len, record_start1, num_chars
+                                 ),
+                                 1
+                             );
+
+        // pshufb works within each 128-bit lane, so each lane is one record.
+        __m256i low_nibbles = _mm256_and_si256(game_chars, nibble_mask);
+        __m256i high_nibbles = _mm256_and_si256(_mm256_srli_epi16(game_chars, 4), nibble_mask);
+
+        __m256i ascii_chars = _mm256_setzero_si256();
+        for(size_t row_index = 0; row_index < rows128.num_rows; ++row_index)
+        {
+            __m256i row_chars = _mm256_shuffle_epi8(rows[row_index], low_nibbles);
+            __m256i is_in_row = _mm256_cmpeq_epi8(high_nibbles, row_indices[row_index]);
+            ascii_chars = _mm256_or_si256(ascii_chars, _mm256_and_si256(row_chars, is_in_row));
+        }
+
+        uint32_t non_ascii_mask = (uint32_t)_mm256_movemask_epi8(
+                                      _mm256_cmpeq_epi8(ascii_chars, zero)
+                                  );
+
+        offset += _pksav_text_batch_finish_record_ssse3(
+                      p_table, &p_records[record_start0], num_chars,
+                      _mm256_castsi256_si128(ascii_chars), (non_ascii_mask & 0xFFFF),
+                      p_arena, arena_len, offset
+                  );
+        p_offsets[record_index + 1] = offset;
+
+        offset += _pksav_text_batch_finish_record_ssse3(
+                      p_table, &p_records[record_start1], num_chars,
+                      _mm256_extracti128_si256(ascii_chars, 1), (non_ascii_mask >> 16),
+                      p_arena, arena_len, offset
+                  );
+        p_offsets[record_index + 2] = offset;
+    }
+
+    if(record_index < num_records)
+    {
+        size_t record_start = record_index * record_stride;
+
+        __m128i game_chars = _pksav_text_batch_load_record_ssse3(
+                                 p_records, records_len, record_start, num_chars
+                             );
+        __m128i ascii_chars = _pksav_text_batch_lookup_ssse3(&rows128, game_chars);
+        uint32_t non_ascii_mask = (uint32_t)_mm_movemask_epi8(
+                                      _mm_cmpeq_epi8(ascii_chars, _mm_setzero_si128())
+                                  );
+
+        offset += _pksav_text_batch_finish_record_ssse3(
+                      p_table, &p_records[record_start], num_chars,
+                      ascii_chars, non_ascii_mask,
+                      p_arena, arena_len, offset
+                  );
+        p_offsets[record_index + 1] = offset;
+    }
+}
+
+#endif /* PKSAV_CPU_X86_DISPATCH */
+
+/*
+ * Dispatch
+ */
+
+const struct pksav_text_batch_kernel pksav_text_batch_kernels[] =
+{
+    {"scalar", _pksav_text_batch_scalar_is_supported, _pksav_text_batch_import_scalar},
+#ifdef PKSAV_CPU_X86_DISPATCH
+    {"ssse3",  pksav_cpu_has_ssse3,                   _pksav_text_batch_import_ssse3},
+    {"avx2",   pksav_cpu_has_avx2,                    _pksav_text_batch_import_avx2},
+#endif
+};
+
+const size_t pksav_text_batch_num_kernels =
+    sizeof(pksav_text_batch_kernels) / sizeof(pksav_text_batch_kernels[0]);
+
+// The fastest kernel the current CPU supports, found on first use.
+static const void* _pksav_text_batch_kernel = NULL;
+
+void pksav_text_batch_import(
+    const struct pksav_text_batch_table* p_table,
+    const uint8_t* p_records,
+    size_t record_stride,
+    size_t num_records,
+    size_t num_chars,
+    char* p_arena,
+    size_t arena_len,
+    size_t* p_offsets
+)
+{
+    const struct pksav_text_batch_kernel* p_kernel =
+        PKSAV_CPU_RESOLVE_KERNEL(
+            _pksav_text_batch_kernel,
+            pksav_text_batch_kernels,
+            pksav_text_batch_num_kernels
+        );
+
+    p_kernel->import_text(
+        p_table, p_records, record_stride, num_records,
+        num_chars, p_arena, arena_len, p_offsets
+    );
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef PKSAV_UTIL_TEXT_BATCH_H
+#define PKSAV_UTIL_TEXT_BATCH_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <wchar.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Every character in the single-byte maps is in the Basic Multilingual Plane.
+#define PKSAV_TEXT_BATCH_MAX_UTF8_CHAR_LEN 3
+
+/*
+ * A single-byte character map, precomputed for batch conversion.
+ */
+struct pksav_text_batch_table
+{
+    // Each game character's UTF-8 encoding, and how many bytes it takes up.
+    // A length of 0 ends the string.
+    uint8_t utf8[256][4];
+    uint8_t utf8_len[256];
+
+    // Each game character's ASCII value, or 0 if it's anything else. The
+    // SIMD kernels translate runs of these directly.
+    uint8_t ascii[256];
+};
+
+/*
+ * Fills in the table from a forward map. Game characters at or past
+ * num_valid_chars end the string, as does anything mapped to 0.
+ */
+void pksav_text_batch_table_init(
+    struct pksav_text_batch_table* p_table,
+    const wchar_t* p_char_map,
+    size_t num_valid_chars
+);
+
+/*
+ * An implementation of batch import. Record i starts at
+ * p_records + (i * record_stride) and is num_chars game characters long.
+ * Its UTF-8 is written to p_arena from p_offsets[i] to p_offsets[i+1], with
+ * no NUL, and p_offsets has num_records + 1 entries.
+ *
+ * The arena must be at least num_records * num_chars *
+ * PKSAV_TEXT_BATCH_MAX_UTF8_CHAR_LEN bytes. Bytes past the last offset may
+ * be overwritten.
+ *
+ * Every kernel must write exactly what the scalar kernel does, up to the
+ * last offset.
+ */
+struct pksav_text_batch_kernel
+{
+    const char* p_name;
+
+    // Whether the current CPU can run this kernel.
+    bool (*is_supported)(void);
+
+    void (*import_text)(
+        const struct pksav_text_batch_table* p_table,
+        const uint8_t* p_records,
+        size_t record_stride,
+        size_t num_records,
+        size_t num_chars,
+        char* p_arena,
+        size_t arena_len,
+        size_t* p_offsets
+    );
+};
+
+// All kernels compiled into this build, from slowest to fastest. The
+// first is always the scalar kernel.
+extern const struct pksav_text_batch_kernel pksav_text_batch_kernels[];
+extern const size_t pksav_text_batch_num_kernels;
+
+// Imports the records with the fastest kernel the current CPU supports.
+void pksav_text_batch_import(
+    const struct pksav_text_batch_table* p_table,
+    const uint8_t* p_records,
+    size_t record_stride,
+    size_t num_records,
+    size_t num_chars,
+    char* p_arena,
+    size_t arena_len,
+    size_t* p_offsets
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PKSAV_UTIL_TEXT_BATCH_H */
@@ -7,98 +7,448 @@
 
 #include "util/text_common.h"
 
-#include <locale.h>
-#include <stdio.h>
+#include <assert.h>
 #include <string.h>
 
-#if defined(PKSAV_PLATFORM_MINGW) || defined(PKSAV_PLATFORM_WIN32)
+#define PKSAV_UNICODE_MAX 0x10FFFF
 
-#include <windows.h>
+#define PKSAV_IS_SURROGATE(code_point) \
+    (((code_point) >= 0xD800) && ((code_point) <= 0xDFFF))
 
-void pksav_mbstowcs(
-    wchar_t* p_output,
-    const char* p_input,
-    size_t num_chars
+size_t pksav_utf8_encoded_len(
+    uint32_t code_point
 )
 {
-    MultiByteToWideChar(
-        CP_UTF8,
-        0,
-        p_input,
-        -1,
-        p_output,
-        (int)num_chars
-    );
+    size_t num_bytes = 0;
+
+    if((code_point == 0) || (code_point > PKSAV_UNICODE_MAX) ||
+       PKSAV_IS_SURROGATE(code_point))
+    {
+        num_bytes = 0;
+    }
+    else if(code_point < 0x80)
+    {
+        num_bytes = 1;
+    }
+    else if(code_point < 0x800)
+    {
+        num_bytes = 2;
+    }
+    else if(code_point < 0x10000)
+    {
+        num_bytes = 3;
+    }
+    else
+    {
+        num_bytes = 4;
+    }
+
+    return num_bytes;
 }
 
-void pksav_wcstombs(
+// Done by hand so conversions don't depend on (or change) the C locale.
+size_t pksav_utf8_encode(
+    uint32_t code_point,
     char* p_output,
-    const wchar_t* p_input,
-    size_t num_chars
+    size_t output_len
 )
 {
-    WideCharToMultiByte(
-        CP_UTF8,
-        0,
-        p_input,
-        -1,
-        p_output,
-        (int)num_chars,
-        NULL,
-        NULL
-    );
-}
+    assert(p_output != NULL);
 
-#else
+    size_t num_bytes = pksav_utf8_encoded_len(code_point);
+    if((num_bytes == 0) || (num_bytes > output_len))
+    {
+        return 0;
+    }
 
-void pksav_mbstowcs(
-    wchar_t* p_output,
+    switch(num_bytes)
+    {
+        case 1:
+            p_output[0] = (char)code_point;
+            break;
+
+        case 2:
+            p_output[0] = (char)(0xC0 | (code_point >> 6));
+            p_output[1] = (char)(0x80 | (code_point & 0x3F));
+            break;
+
+        case 3:
+            p_output[0] = (char)(0xE0 | (code_point >> 12));
+            p_output[1] = (char)(0x80 | ((code_point >> 6) & 0x3F));
+            p_output[2] = (char)(0x80 | (code_point & 0x3F));
+            break;
+
+        default:
+            p_output[0] = (char)(0xF0 | (code_point >> 18));
+            p_output[1] = (char)(0x80 | ((code_point >> 12) & 0x3F));
+            p_output[2] = (char)(0x80 | ((code_point >> 6) & 0x3F));
+            p_output[3] = (char)(0x80 | (code_point & 0x3F));
+            break;
+    }
+
+    return num_bytes;
+}
+
+size_t pksav_utf8_decode(
     const char* p_input,
-    size_t num_chars
+    uint32_t* p_code_point_out
 )
 {
-    char* p_old_locale = setlocale(LC_CTYPE, NULL);
-    setlocale(LC_CTYPE, "en_US.utf8");
-    mbstowcs(p_output, p_input, num_chars);
-    if(p_old_locale)
+    assert(p_input != NULL);
+    assert(p_code_point_out != NULL);
+
+    const uint8_t* p_bytes = (const uint8_t*)p_input;
+
+    size_t num_bytes = 0;
+    uint32_t code_point = 0;
+    uint32_t min_code_point = 0;
+
+    if(p_bytes[0] == 0)
+    {
+        return 0;
+    }
+    else if(p_bytes[0] < 0x80)
+    {
+        *p_code_point_out = p_bytes[0];
+        return 1;
+    }
+    else if((p_bytes[0] & 0xE0) == 0xC0)
+    {
+        num_bytes = 2;
+        code_point = p_bytes[0] & 0x1F;
+        min_code_point = 0x80;
+    }
+    else if((p_bytes[0] & 0xF0) == 0xE0)
+    {
+        num_bytes = 3;
+        code_point = p_bytes[0] & 0x0F;
+        min_code_point = 0x800;
+    }
+    else if((p_bytes[0] & 0xF8) == 0xF0)
+    {
+        num_bytes = 4;
+        code_point = p_bytes[0] & 0x07;
+        min_code_point = 0x10000;
+    }
+    else
+    {
+        return 0;
+    }
+
+    for(size_t byte_index = 1; byte_index < num_bytes; ++byte_index)
+    {
+        // The NUL at the end of the string fails this too, so a truncated
+        // sequence never reads past it.
+        if((p_bytes[byte_index] & 0xC0) != 0x80)
+        {
+            return 0;
+        }
+
+        code_point = (code_point << 6) | (p_bytes[byte_index] & 0x3F);
+    }
+
+    // Overlong encodings, surrogates, and anything past U+10FFFF.
+    if((code_point < min_code_point) || (code_point > PKSAV_UNICODE_MAX) ||
+       PKSAV_IS_SURROGATE(code_point))
     {
-        (void)setlocale(LC_CTYPE, p_old_locale);
+        return 0;
     }
+
+    *p_code_point_out = code_point;
+
+    return num_bytes;
 }
 
-void pksav_wcstombs(
-    char* p_output,
-    const wchar_t* p_input,
-    size_t num_chars
+ssize_t pksav_text_reverse_map_find(
+    const struct pksav_text_reverse_map_entry* p_reverse_map,
+    size_t reverse_map_size,
+    uint32_t code_point
 )
 {
-    char* p_old_locale = setlocale(LC_CTYPE, NULL);
-    setlocale(LC_CTYPE, "en_US.utf8");
-    wcstombs(p_output, p_input, num_chars);
-    if(p_old_locale)
+    assert(p_reverse_map != NULL);
+
+    // Every character in the maps is in the Basic Multilingual Plane.
+    if(code_point > UINT16_MAX)
     {
-        (void)setlocale(LC_CTYPE, p_old_locale);
+        return -1;
     }
+
+    size_t begin = 0;
+    size_t end = reverse_map_size;
+    while(begin < end)
+    {
+        size_t middle = begin + ((end - begin) / 2);
+        if(p_reverse_map[middle].code_point < code_point)
+        {
+            begin = middle + 1;
+        }
+        else if(p_reverse_map[middle].code_point > code_point)
+        {
+            end = middle;
+        }
+        else
+        {
+            return p_reverse_map[middle].game_char;
+        }
+    }
+
+    return -1;
 }
 
-#endif
+static inline uint16_t _pksav_text_get_char(
+    const struct pksav_text_codec* p_codec,
+    const void* p_buffer,
+    size_t char_index
+)
+{
+    return (p_codec->char_size == 1) ? ((const uint8_t*)p_buffer)[char_index]
+                                     : ((const uint16_t*)p_buffer)[char_index];
+}
 
-// C equivalent of std::distance
-ssize_t wchar_map_index(
-    const wchar_t* p_char_map,
-    size_t char_map_size,
-    wchar_t to_find
+static inline void _pksav_text_set_char(
+    const struct pksav_text_codec* p_codec,
+    void* p_buffer,
+    size_t char_index,
+    uint16_t game_char
 )
 {
-    for(size_t char_index = 0;
-        char_index < char_map_size;
-        ++char_index)
+    if(p_codec->char_size == 1)
+    {
+        ((uint8_t*)p_buffer)[char_index] = (uint8_t)game_char;
+    }
+    else
     {
-        if(p_char_map[char_index] == to_find)
+        ((uint16_t*)p_buffer)[char_index] = game_char;
+    }
+}
+
+/*
+ * Converts until a terminator or num_chars characters, writing at most
+ * output_text_len bytes and no NUL.
+ */
+static void _pksav_text_import(
+    const struct pksav_text_codec* p_codec,
+    const void* p_input_buffer,
+    size_t num_chars,
+    char* p_output_text,
+    size_t output_text_len,
+    size_t* p_num_bytes_out,
+    bool* p_is_truncated_out
+)
+{
+    assert(p_codec != NULL);
+    assert(p_input_buffer != NULL);
+    assert(p_output_text != NULL);
+    assert(p_num_bytes_out != NULL);
+    assert(p_is_truncated_out != NULL);
+
+    size_t output_index = 0;
+    bool is_truncated = false;
+
+    for(size_t char_index = 0; char_index < num_chars; ++char_index)
+    {
+        uint32_t code_point = p_codec->p_import_char(
+                                  _pksav_text_get_char(p_codec, p_input_buffer, char_index)
+                              );
+
+        size_t num_bytes = pksav_utf8_encoded_len(code_point);
+        if(num_bytes == 0)
         {
-            return char_index;
+            break;
         }
+        else if(num_bytes > (output_text_len - output_index))
+        {
+            is_truncated = true;
+            break;
+        }
+
+        output_index += pksav_utf8_encode(
+                            code_point,
+                            &p_output_text[output_index],
+                            output_text_len - output_index
+                        );
     }
-    return -1;
+
+    *p_num_bytes_out = output_index;
+    *p_is_truncated_out = is_truncated;
 }
 
+static void _pksav_text_export(
+    const struct pksav_text_codec* p_codec,
+    const char* p_input_text,
+    void* p_output_buffer,
+    size_t num_chars,
+    size_t* p_num_chars_out,
+    bool* p_is_truncated_out
+)
+{
+    assert(p_codec != NULL);
+    assert(p_input_text != NULL);
+    assert(p_output_buffer != NULL);
+    assert(p_num_chars_out != NULL);
+    assert(p_is_truncated_out != NULL);
+
+    if(p_codec->char_size == 1)
+    {
+        memset(p_output_buffer, (int)p_codec->terminator, num_chars);
+    }
+    else
+    {
+        for(size_t char_index = 0; char_index < num_chars; ++char_index)
+        {
+            ((uint16_t*)p_output_buffer)[char_index] = p_codec->terminator;
+        }
+    }
+
+    const char* p_input = p_input_text;
+    size_t char_index = 0;
+    for(; char_index < num_chars; ++char_index)
+    {
+        uint32_t code_point = 0;
+        size_t num_bytes = pksav_utf8_decode(p_input, &code_point);
+        if(num_bytes == 0)
+        {
+            break;
+        }
+
+        ssize_t game_char = p_codec->p_export_char(code_point);
+        if(game_char == -1)
+        {
+            break;
+        }
+
+        _pksav_text_set_char(p_codec, p_output_buffer, char_index, (uint16_t)game_char);
+
+        p_input += num_bytes;
+    }
+
+    // Whatever's left either didn't fit or couldn't be converted.
+    *p_num_chars_out = char_index;
+    *p_is_truncated_out = (*p_input != '\0');
+}
+
+enum pksav_error pksav_text_import(
+    const struct pksav_text_codec* p_codec,
+    const void* p_input_buffer,
+    char* p_output_text,
+    size_t num_chars
+)
+{
+    assert(p_codec != NULL);
+
+    if(!p_input_buffer || !p_output_text)
+    {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    memset(p_output_text, 0, num_chars);
+
+    size_t num_bytes = 0;
+    bool is_truncated = false;
+    _pksav_text_import(
+        p_codec,
+        p_input_buffer,
+        num_chars,
+        p_output_text,
+        num_chars,
+        &num_bytes,
+        &is_truncated
+    );
+
+    return PKSAV_ERROR_NONE;
+}
+
+enum pksav_error pksav_text_import_bounded(
+    const struct pksav_text_codec* p_codec,
+    const void* p_input_buffer,
+    size_t num_chars,
+    char* p_output_text,
+    size_t output_text_len,
+    size_t* p_num_bytes_out,
+    bool* p_is_truncated_out
+)
+{
+    assert(p_codec != NULL);
+
+    if(!p_input_buffer || !p_output_text ||
+       !p_num_bytes_out || !p_is_truncated_out)
+    {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    if(output_text_len == 0)
+    {
+        return PKSAV_ERROR_PARAM_OUT_OF_RANGE;
+    }
+
+    // Leave room for the NUL.
+    _pksav_text_import(
+        p_codec,
+        p_input_buffer,
+        num_chars,
+        p_output_text,
+        output_text_len - 1,
+        p_num_bytes_out,
+        p_is_truncated_out
+    );
+    p_output_text[*p_num_bytes_out] = '\0';
+
+    return PKSAV_ERROR_NONE;
+}
+
+enum pksav_error pksav_text_export(
+    const struct pksav_text_codec* p_codec,
+    const char* p_input_text,
+    void* p_output_buffer,
+    size_t num_chars
+)
+{
+    assert(p_codec != NULL);
+
+    if(!p_input_text || !p_output_buffer)
+    {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    size_t num_chars_written = 0;
+    bool is_truncated = false;
+    _pksav_text_export(
+        p_codec,
+        p_input_text,
+        p_output_buffer,
+        num_chars,
+        &num_chars_written,
+        &is_truncated
+    );
+
+    return PKSAV_ERROR_NONE;
+}
+
+enum pksav_error pksav_text_export_bounded(
+    const struct pksav_text_codec* p_codec,
+    const char* p_input_text,
+    void* p_output_buffer,
+    size_t num_chars,
+    size_t* p_num_chars_out,
+    bool* p_is_truncated_out
+)
+{
+    assert(p_codec != NULL);
+
+    if(!p_input_text || !p_output_buffer ||
+       !p_num_chars_out || !p_is_truncated_out)
+    {
+        return PKSAV_ERROR_NULL_POINTER;
+    }
+
+    _pksav_text_export(
+        p_codec,
+        p_input_text,
+        p_output_buffer,
+        num_chars,
+        p_num_chars_out,
+        p_is_truncated_out
+    );
+
+    return PKSAV_ERROR_NONE;
+}
@@ -0,0 +1,358 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+#
+# Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+# or copy at http://opensource.org/licenses/MIT)
+#
+
+"""
+Regenerates the character tables derived from each generation's forward
+character map, rewriting them in place:
+
+ * The reverse map used to export text. Each code point maps to the lowest
+   game character that decodes to it, and the entries are sorted by code
+   point so they can be binary searched.
+ * For single-byte generations, the table used to import text in batches,
+   as filled in by pksav_text_batch_table_init.
+ * For generations with paged forward maps, the pages and page indices
+   themselves. Pages are deduplicated, ranges with no characters point to
+   the empty page 0, and trailing empty ranges are dropped.
+
+Run this after editing a forward map. With --check, nothing is written,
+and the exit code is 1 if any table is out of date.
+"""
+
+import argparse
+import ast
+import os
+import re
+import sys
+
+REPO_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+ENTRIES_PER_LINE = 8
+
+BYTES_PER_LINE = 16
+
+# Matches PKSAV_TEXT_BATCH_MAX_UTF8_CHAR_LEN.
+BATCH_MAX_UTF8_CHAR_LEN = 3
+
+# Matches PKSAV_TEXT_PAGE_SIZE.
+PAGE_SIZE = 64
+
+# (source file, forward map, reverse map, batch table, number of valid
+# game characters)
+#
+# Gen III's characters past PKSAV_GEN3_LAST_CHAR are control characters,
+# which end the string when importing.
+FLAT_MAPS = [
+    ("lib/gen1/text.c", "PKSAV_GEN1_CHAR_MAP", "PKSAV_GEN1_REVERSE_CHAR_MAP",
+     "PKSAV_GEN1_TEXT_BATCH_TABLE", 0x100),
+    ("lib/gen2/text.c", "PKSAV_GEN2_CHAR_MAP", "PKSAV_GEN2_REVERSE_CHAR_MAP",
+     "PKSAV_GEN2_TEXT_BATCH_TABLE", 0x100),
+    ("lib/gen3/text.c", "PKSAV_GEN3_CHAR_MAP", "PKSAV_GEN3_REVERSE_CHAR_MAP",
+     "PKSAV_GEN3_TEXT_BATCH_TABLE", 0xFA),
+]
+
+# (source file, pages, page indices, reverse map)
+PAGED_MAPS = [
+    ("lib/gen4/text.c", "PKSAV_GEN4_CHAR_PAGES", "PKSAV_GEN4_CHAR_PAGE_INDICES",
+     "PKSAV_GEN4_REVERSE_CHAR_MAP"),
+]
+
+def parse_array_body(body):
+    body = re.sub(r"//[^\n]*", "", body)
+    body = re.sub(r"/\*.*?\*/", "", body, flags=re.S)
+
+    values = []
+    for token in body.replace("{", ",").replace("}", ",").split(","):
+        token = token.strip()
+        if not token:
+            continue
+        elif token.startswith("'") or token.startswith("L'"):
+            values.append(ord(ast.literal_eval(token.lstrip("L"))))
+        else:
+            values.append(int(token, 0))
+
+    return values
+
+def parse_array(source, name):
+    match = re.search(r"\b%s(\[[^\]]*\])+\s*=\s*\{" % re.escape(name), source)
+    if not match:
+        raise ValueError("Couldn't find %s." % name)
+
+    body_start = match.end()
+    body_end = source.index("};", body_start)
+
+    return parse_array_body(source[body_start:body_end])
+
+def make_reverse_map(forward_map):
+    reverse_map = {}
+    for game_char, code_point in forward_map:
+        if code_point and (code_point not in reverse_map):
+            reverse_map[code_point] = game_char
+
+    return sorted(reverse_map.items())
+
+def format_reverse_map(name, entries, game_char_format):
+    lines = [
+        "static const struct pksav_text_reverse_map_entry %s[] =" % name,
+        "{",
+    ]
+    for line_start in range(0, len(entries), ENTRIES_PER_LINE):
+        lines.append("    " + "".join(
+            "{0x%04X,%s}," % (code_point, game_char_format % game_char)
+            for (code_point, game_char) in entries[line_start:line_start+ENTRIES_PER_LINE]
+        ))
+    lines += [
+        "};",
+        "static const size_t %s_SIZE =" % name,
+        "    sizeof(%s)/sizeof(%s[0]);" % (name, name),
+    ]
+
+    return "\n".join(lines) + "\n"
+
+def utf8_encode(code_point):
+    # Matches pksav_utf8_encode, which encodes neither NUL nor surrogates.
+    if (code_point == 0) or (0xD800 <= code_point <= 0xDFFF) or (code_point > 0x10FFFF):
+        return b""
+
+    return chr(code_point).encode("utf-8")
+
+def format_byte_rows(values, value_format):
+    return [
+        "        " + ",".join(value_format % value for value in values[row_start:row_start+BYTES_PER_LINE]) + ","
+        for row_start in range(0, len(values), BYTES_PER_LINE)
+    ]
+
+def format_batch_table(name, char_map, num_valid_chars):
+    encodings = []
+    for game_char in range(256):
+        encoding = b""
+        if game_char < min(num_valid_chars, len(char_map)):
+            encoding = utf8_encode(char_map[game_char])
+            if len(encoding) > BATCH_MAX_UTF8_CHAR_LEN:
+                encoding = b""
+        encodings.append(encoding)
+
+    lines = [
+        "static const struct pksav_text_batch_table %s =" % name,
+        "{",
+        "    .utf8 =",
+        "    {",
+    ]
+    for row_start in range(0, 256, ENTRIES_PER_LINE):
+        lines.append("        " + "".join(
+            "{%s}," % (",".join("0x%02X" % byte for byte in encoding) or "0")
+            for encoding in encodings[row_start:row_start+ENTRIES_PER_LINE]
+        ))
+    lines += [
+        "    },",
+        "    .utf8_len =",
+        "    {",
+    ]
+    lines += format_byte_rows([len(encoding) for encoding in encodings], "%d")
+    lines += [
+        "    },",
+        "    .ascii =",
+        "    {",
+    ]
+    lines += format_byte_rows(
+                 [encoding[0] if (len(encoding) == 1) else 0 for encoding in encodings],
+                 "0x%02X"
+             )
+    lines += [
+        "    }",
+        "};",
+    ]
+
+    return "\n".join(lines) + "\n"
+
+def replace_batch_table(source, name, new_batch_table):
+    match = re.search(
+                r"static const struct pksav_text_batch_table %s =\n\{\n.*?\n\};\n" % re.escape(name),
+                source,
+                flags=re.S
+            )
+    if not match:
+        raise ValueError("Couldn't find %s." % name)
+
+    return source[:match.start()] + new_batch_table + source[match.end():]
+
+def replace_reverse_map(source, name, new_reverse_map):
+    match = re.search(
+                r"static const struct pksav_text_reverse_map_entry %s\[\] =.*?"
+                r"sizeof\(%s\)/sizeof\(%s\[0\]\);\n" % ((re.escape(name),) * 3),
+                source,
+                flags=re.S
+            )
+    if not match:
+        raise ValueError("Couldn't find %s." % name)
+
+    return source[:match.start()] + new_reverse_map + source[match.end():]
+
+def flatten_paged_map(pages, page_indices):
+    if len(pages) % PAGE_SIZE:
+        raise ValueError("The pages don't hold a whole number of characters.")
+
+    return [
+        pages[(page_indices[page_index] * PAGE_SIZE) + char_index]
+        for page_index in range(len(page_indices))
+        for char_index in range(PAGE_SIZE)
+    ]
+
+def make_pages(char_map):
+    empty_page = (0,) * PAGE_SIZE
+    pages = [empty_page]
+    page_starts = [None]
+    page_indices = []
+    for page_start in range(0, len(char_map), PAGE_SIZE):
+        page = tuple(char_map[page_start:page_start+PAGE_SIZE])
+        page += (0,) * (PAGE_SIZE - len(page))
+        if page not in pages:
+            pages.append(page)
+            page_starts.append(page_start)
+        page_indices.append(pages.index(page))
+
+    while page_indices and (page_indices[-1] == 0):
+        page_indices.pop()
+    if len(pages) > 0x100:
+        raise ValueError("Too many pages for uint8_t page indices.")
+
+    return (pages, page_starts, page_indices)
+
+def format_paged_map(pages_name, page_indices_name, char_map):
+    (pages, page_starts, page_indices) = make_pages(char_map)
+
+    lines = [
+        "static const uint16_t %s[][PKSAV_TEXT_PAGE_SIZE] =" % pages_name,
+        "{",
+    ]
+    for (page, page_start) in zip(pages, page_starts):
+        lines.append("    { // %s" % ("Empty" if page_start is None else ("0x%04X" % page_start)))
+        for row_start in range(0, PAGE_SIZE, BYTES_PER_LINE):
+            lines.append("        " + ",".join("0x%04X" % code_point for code_point in page[row_start:row_start+BYTES_PER_LINE]) + ",")
+        lines.append("    },")
+    lines += [
+        "};",
+        "",
+        "static const uint8_t %s[] =" % page_indices_name,
+        "{",
+    ]
+    for row_start in range(0, len(page_indices), BYTES_PER_LINE):
+        lines.append("    " + ",".join("%d" % page_index for page_index in page_indices[row_start:row_start+BYTES_PER_LINE]) + ",")
+    lines.append("};")
+
+    return "\n".join(lines) + "\n"
+
+def replace_paged_map(source, pages_name, page_indices_name, new_paged_map):
+    match = re.search(
+                r"static const uint16_t %s\[\]\[PKSAV_TEXT_PAGE_SIZE\] =\n\{\n.*?\n\};\n\n"
+                r"static const uint8_t %s\[\] =\n\{\n.*?\n\};\n" % (re.escape(pages_name), re.escape(page_indices_name)),
+                source,
+                flags=re.S
+            )
+    if not match:
+        raise ValueError("Couldn't find %s and %s." % (pages_name, page_indices_name))
+
+    return source[:match.start()] + new_paged_map + source[match.end():]
+
+def update_file(relative_path, update_source, should_check):
+    path = os.path.join(REPO_DIR, relative_path)
+    with open(path, encoding="utf-8", newline="") as source_file:
+        source = source_file.read()
+
+    new_source = update_source(source)
+    if new_source == source:
+        return True
+    elif should_check:
+        print("%s is out of date." % relative_path, file=sys.stderr)
+        return False
+
+    with open(path, "w", encoding="utf-8", newline="") as source_file:
+        source_file.write(new_source)
+    print("Updated %s." % relative_path)
+
+    return True
+
+def update_flat_map(source, forward_name, reverse_name, batch_table_name, num_valid_chars):
+    char_map = parse_array(source, forward_name)
+
+    source = replace_reverse_map(
+                 source,
+                 reverse_name,
+                 format_reverse_map(
+                     reverse_name,
+                     make_reverse_map(enumerate(char_map)),
+                     "0x%02X"
+                 )
+             )
+
+    return replace_batch_table(
+               source,
+               batch_table_name,
+               format_batch_table(batch_table_name, char_map, num_valid_chars)
+           )
+
+def update_paged_map(source, pages_name, page_indices_name, reverse_name):
+    char_map = flatten_paged_map(
+                   parse_array(source, pages_name),
+                   parse_array(source, page_indices_name)
+               )
+
+    source = replace_paged_map(
+                 source,
+                 pages_name,
+                 page_indices_name,
+                 format_paged_map(pages_name, page_indices_name, char_map)
+             )
+
+    return replace_reverse_map(
+               source,
+               reverse_name,
+               format_reverse_map(
+                   reverse_name,
+                   make_reverse_map(enumerate(char_map)),
+                   "0x%04X"
+               )
+           )
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().split("\n")[0])
+    parser.add_argument(
+        "--check",
+        action="store_true",
+        help="Only check whether the tables are up to date."
+    )
+    args = parser.parse_args()
+
+    is_up_to_date = True
+    for (path, forward_name, reverse_name, batch_table_name, num_valid_chars) in FLAT_MAPS:
+        is_up_to_date &= update_file(
+                             path,
+                             lambda source: update_flat_map(
+                                                source,
+                                                forward_name,
+                                                reverse_name,
+                                                batch_table_name,
+                                                num_valid_chars
+                                            ),
+                             args.check
+                         )
+    for (path, pages_name, page_indices_name, reverse_name) in PAGED_MAPS:
+        is_up_to_date &= update_file(
+                             path,
+                             lambda source: update_paged_map(
+                                                source,
+                                                pages_name,
+                                                page_indices_name,
+                                                reverse_name
+                                            ),
+                             args.check
+                         )
+
+    return 0 if is_up_to_date else 1
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+/*
+ * Checks every Gen III section checksum kernel supported by this CPU against
+ * the scalar kernel, then reports each one's throughput over a full save
+ * slot's worth of sections.
+ */
+
+#include "gen3/checksum_kernels.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define NUM_SECTIONS       (14)
+#define SECTION_SIZE_WORDS (4096/4)
+#define NUM_ITERATIONS     (20000)
+
+// How many bytes in each section are read for the checksum
+static const size_t section_sizes[NUM_SECTIONS] =
+{
+    3884,3968,3968,3968,3848,3968,3968,
+    3968,3968,3968,3968,3968,3968,2000
+};
+
+static uint32_t slot[NUM_SECTIONS][SECTION_SIZE_WORDS];
+
+static int check_kernel(
+    const struct pksav_gen3_checksum_kernel* p_kernel
+)
+{
+    const struct pksav_gen3_checksum_kernel* p_scalar_kernel =
+        &pksav_gen3_checksum_kernels[0];
+
+    // Check every length so each tail path is hit.
+    const uint32_t* p_data32 = &slot[0][0];
+
+    for(size_t num_words = 0; num_words < SECTION_SIZE_WORDS; ++num_words)
+    {
+        if(p_kernel->sum_words(p_data32, num_words) !=
+           p_scalar_kernel->sum_words(p_data32, num_words))
+        {
+            fprintf(stderr, "%s: mismatch with %u words.\n",
+                    p_kernel->p_name, (unsigned)num_words);
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+static void benchmark_kernel(
+    const struct pksav_gen3_checksum_kernel* p_kernel
+)
+{
+    size_t num_bytes = 0;
+    uint32_t result = 0;
+
+    clock_t start = clock();
+    for(size_t iteration = 0; iteration < NUM_ITERATIONS; ++iteration)
+    {
+        for(size_t section_index = 0; section_index < NUM_SECTIONS; ++section_index)
+        {
+            result += p_kernel->sum_words(
+                          slot[section_index],
+                          (section_sizes[section_index] / 4)
+                      );
+            num_bytes += section_sizes[section_index];
+        }
+    }
+    clock_t end = clock();
+
+    double seconds = (double)(end - start) / CLOCKS_PER_SEC;
+    printf("%-8s %8.2f GB/s (0x%08x)\n",
+           p_kernel->p_name,
+           (seconds > 0.0) ? ((double)num_bytes / seconds / 1e9) : 0.0,
+           (unsigned)result);
+}
+
+int main(void)
+{
+    srand(0x08012025);
+    for(size_t section_index = 0; section_index < NUM_SECTIONS; ++section_index)
+    {
+        for(size_t word_index = 0; word_index < SECTION_SIZE_WORDS; ++word_index)
+        {
+            slot[section_index][word_index] = ((uint32_t)rand() << 16) ^ (uint32_t)rand();
+        }
+    }
+
+    int ret = 0;
+    for(size_t kernel_index = 0;
+        kernel_index < pksav_gen3_num_checksum_kernels;
+        ++kernel_index)
+    {
+        const struct pksav_gen3_checksum_kernel* p_kernel =
+            &pksav_gen3_checksum_kernels[kernel_index];
+
+        if(!p_kernel->is_supported())
+        {
+            printf("%-8s unsupported\n", p_kernel->p_name);
+            continue;
+        }
+
+        if(check_kernel(p_kernel))
+        {
+            ret = 1;
+            continue;
+        }
+
+        benchmark_kernel(p_kernel);
+    }
+
+    return ret;
+}
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+/*
+ * Checks every Gen III Pokémon crypt kernel supported by this CPU against
+ * the scalar kernel, then reports each one's throughput over a full PC's
+ * worth of Pokémon.
+ */
+
+#include "gen3/crypt.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define NUM_POKEMON    (PKSAV_GEN3_NUM_POKEMON_BOXES * PKSAV_GEN3_BOX_NUM_POKEMON)
+#define NUM_ITERATIONS (20000)
+
+static struct pksav_gen3_pc_pokemon original_pokemon[NUM_POKEMON];
+static struct pksav_gen3_pc_pokemon scalar_pokemon[NUM_POKEMON];
+static struct pksav_gen3_pc_pokemon kernel_pokemon[NUM_POKEMON];
+
+static int check_kernel(
+    const struct pksav_gen3_crypt_kernel* p_kernel
+)
+{
+    const struct pksav_gen3_crypt_kernel* p_scalar_kernel =
+        &pksav_gen3_crypt_kernels[0];
+
+    memcpy(scalar_pokemon, original_pokemon, sizeof(original_pokemon));
+    memcpy(kernel_pokemon, original_pokemon, sizeof(original_pokemon));
+
+    for(int should_encrypt = 0; should_encrypt <= 1; ++should_encrypt)
+    {
+        p_scalar_kernel->crypt_pokemon(scalar_pokemon, NUM_POKEMON, (bool)should_encrypt);
+        p_kernel->crypt_pokemon(kernel_pokemon, NUM_POKEMON, (bool)should_encrypt);
+
+        if(memcmp(scalar_pokemon, kernel_pokemon, sizeof(scalar_pokemon)))
+        {
+            fprintf(stderr, "%s: mismatch when %s.\n",
+                    p_kernel->p_name,
+                    should_encrypt ? "encrypting" : "decrypting");
+            return 1;
+        }
+    }
+
+    // Decrypting and encrypting should give back the original Pokémon.
+    if(memcmp(original_pokemon, kernel_pokemon, sizeof(original_pokemon)))
+    {
+        fprintf(stderr, "%s: crypting isn't reversible.\n", p_kernel->p_name);
+        return 1;
+    }
+
+    return 0;
+}
+
+static void benchmark_kernel(
+    const struct pksav_gen3_crypt_kernel* p_kernel
+)
+{
+    clock_t start = clock();
+    for(size_t iteration = 0; iteration < NUM_ITERATIONS; ++iteration)
+    {
+        p_kernel->crypt_pokemon(kernel_pokemon, NUM_POKEMON, (iteration % 2) == 1);
+    }
+    clock_t end = clock();
+
+    double seconds = (double)(end - start) / CLOCKS_PER_SEC;
+    double num_pokemon = (double)NUM_POKEMON * NUM_ITERATIONS;
+    printf("%-8s %8.2f M Pokémon/s %8.2f GB/s\n",
+           p_kernel->p_name,
+           (seconds > 0.0) ? (num_pokemon / seconds / 1e6) : 0.0,
+           (seconds > 0.0) ? (num_pokemon * sizeof(struct pksav_gen3_pc_pokemon) / seconds / 1e9) : 0.0);
+}
+
+int main(void)
+{
+    srand(0x08012025);
+    uint8_t* p_original_pokemon = (uint8_t*)original_pokemon;
+    for(size_t index = 0; index < sizeof(original_pokemon); ++index)
+    {
+        p_original_pokemon[index] = (uint8_t)rand();
+    }
+
+    int ret = 0;
+    for(size_t kernel_index = 0;
+        kernel_index < pksav_gen3_num_crypt_kernels;
+        ++kernel_index)
+    {
+        const struct pksav_gen3_crypt_kernel* p_kernel =
+            &pksav_gen3_crypt_kernels[kernel_index];
+
+        if(!p_kernel->is_supported())
+        {
+            printf("%-8s unsupported\n", p_kernel->p_name);
+            continue;
+        }
+
+        if(check_kernel(p_kernel))
+        {
+            ret = 1;
+            continue;
+        }
+
+        benchmark_kernel(p_kernel);
+    }
+
+    return ret;
+}
@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+/*
+ * Checks every batch text import kernel supported by this CPU against the
+ * scalar kernel, then reports each one's throughput over a full Gen III
+ * PC's worth of nicknames, along with that of the public Gen III call.
+ */
+
+#include "util/text_batch.h"
+
+#include <pksav/gen3/text.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define NUM_RECORDS    (420)
+#define RECORD_STRIDE  (80) // sizeof(struct pksav_gen3_pc_pokemon)
+#define NUM_CHARS      (10)
+#define MAX_NUM_CHARS  (20)
+#define NUM_ITERATIONS (20000)
+
+#define ARENA_LEN (NUM_RECORDS * MAX_NUM_CHARS * PKSAV_TEXT_BATCH_MAX_UTF8_CHAR_LEN)
+
+static struct pksav_text_batch_table table;
+
+static uint8_t records[NUM_RECORDS * RECORD_STRIDE];
+
+static char scalar_arena[ARENA_LEN];
+static char kernel_arena[ARENA_LEN];
+static size_t scalar_offsets[NUM_RECORDS + 1];
+static size_t kernel_offsets[NUM_RECORDS + 1];
+
+/*
+ * A stand-in for a game's character map, laid out like Gen III's: a space,
+ * kana, then digits and letters, with a terminator at the end. One of the
+ * kana is unmapped.
+ */
+static void init_table(void)
+{
+    wchar_t char_map[256] = {0};
+
+    char_map[0x00] = L' ';
+    for(size_t game_char = 0x01; game_char < 0xA1; ++game_char)
+    {
+        char_map[game_char] = (wchar_t)(0x3041 + game_char);
+    }
+    char_map[0x50] = 0;
+    for(size_t game_char = 0xA1; game_char < 0xAB; ++game_char)
+    {
+        char_map[game_char] = (wchar_t)('0' + (game_char - 0xA1));
+    }
+    char_map[0xB5] = 0x2642; // ♂
+    char_map[0xB6] = 0x2640; // ♀
+    for(size_t game_char = 0xBB; game_char < 0xD5; ++game_char)
+    {
+        char_map[game_char] = (wchar_t)('A' + (game_char - 0xBB));
+    }
+    for(size_t game_char = 0xD5; game_char < 0xEF; ++game_char)
+    {
+        char_map[game_char] = (wchar_t)('a' + (game_char - 0xD5));
+    }
+
+    pksav_text_batch_table_init(&table, char_map, 0xFA);
+}
+
+// Random bytes, then mostly short names made of letters, like a real PC.
+static void init_records(void)
+{
+    for(size_t byte_index = 0; byte_index < sizeof(records); ++byte_index)
+    {
+        records[byte_index] = (uint8_t)rand();
+    }
+    for(size_t record_index = 0; record_index < (NUM_RECORDS - 8); ++record_index)
+    {
+        uint8_t* p_record = &records[record_index * RECORD_STRIDE];
+
+        size_t name_len = 3 + (size_t)(rand() % (NUM_CHARS - 2));
+        for(size_t char_index = 0; char_index < name_len; ++char_index)
+        {
+            p_record[char_index] = (uint8_t)(0xBB + (rand() % 52));
+        }
+        if(name_len < NUM_CHARS)
+        {
+            p_record[name_len] = 0xFF;
+        }
+        if((record_index % 8) == 0)
+        {
+            p_record[rand() % name_len] = (uint8_t)(0xB5 + (rand() % 2));
+        }
+    }
+}
+
+static int check_kernel(
+    const struct pksav_text_batch_kernel* p_kernel
+)
+{
+    const struct pksav_text_batch_kernel* p_scalar_kernel =
+        &pksav_text_batch_kernels[0];
+
+    // Check every record length and stride up to a few past a vector, with
+    // every record count up to a few past a pair, so each tail path is hit.
+    for(size_t num_chars = 0; num_chars <= MAX_NUM_CHARS; ++num_chars)
+    {
+        for(size_t record_stride = (num_chars > 0) ? num_chars : 1;
+            record_stride <= (MAX_NUM_CHARS + 1);
+            ++record_stride)
+        {
+            for(size_t num_records = 0; num_records <= 5; ++num_records)
+            {
+                memset(scalar_arena, 0, sizeof(scalar_arena));
+                memset(kernel_arena, 0, sizeof(kernel_arena));
+
+                // Put the records at the very end so reading past them
+                // would go outside the buffer.
+                size_t records_len = (num_records > 0)
+                                   ? (((num_records - 1) * record_stride) + num_chars)
+                                   : 0;
+                const uint8_t* p_records = &records[sizeof(records) - records_len];
+
+                // And make the arena exactly as big as required.
+                size_t arena_len = num_records * num_chars * PKSAV_TEXT_BATCH_MAX_UTF8_CHAR_LEN;
+
+                p_scalar_kernel->import_text(
+                    &table, p_records, record_stride, num_records,
+                    num_chars, scalar_arena, arena_len, scalar_offsets
+                );
+                p_kernel->import_text(
+                    &table, p_records, record_stride, num_records,
+                    num_chars, kernel_arena, arena_len, kernel_offsets
+                );
+
+                if(memcmp(scalar_offsets, kernel_offsets, (num_records + 1) * sizeof(size_t)) ||
+                   memcmp(scalar_arena, kernel_arena, scalar_offsets[num_records]))
+                {
+                    fprintf(stderr, "%s: mismatch with %u records of %u characters, %u apart.\n",
+                            p_kernel->p_name,
+                            (unsigned)num_records,
+                            (unsigned)num_chars,
+                            (unsigned)record_stride);
+                    return 1;
+                }
+            }
+        }
+    }
+
+    return 0;
+}
+
+static void benchmark_kernel(
+    const struct pksav_text_batch_kernel* p_kernel
+)
+{
+    size_t num_names = 0;
+    size_t num_bytes = 0;
+
+    clock_t start = clock();
+    for(size_t iteration = 0; iteration < NUM_ITERATIONS; ++iteration)
+    {
+        p_kernel->import_text(
+            &table, records, RECORD_STRIDE, NUM_RECORDS,
+            NUM_CHARS, kernel_arena, sizeof(kernel_arena), kernel_offsets
+        );
+        num_names += NUM_RECORDS;
+        num_bytes += kernel_offsets[NUM_RECORDS];
+    }
+    clock_t end = clock();
+
+    double seconds = (double)(end - start) / CLOCKS_PER_SEC;
+    printf("%-8s %8.2f M names/s (%u bytes)\n",
+           p_kernel->p_name,
+           (seconds > 0.0) ? ((double)num_names / seconds / 1e6) : 0.0,
+           (unsigned)(num_bytes / NUM_ITERATIONS));
+}
+
+// Everything a caller pays for, including checks and kernel dispatch.
+static void benchmark_gen3_import_text_batch(void)
+{
+    size_t num_names = 0;
+    size_t num_bytes = 0;
+
+    clock_t start = clock();
+    for(size_t iteration = 0; iteration < NUM_ITERATIONS; ++iteration)
+    {
+        pksav_gen3_import_text_batch(
+            records, RECORD_STRIDE, NUM_RECORDS,
+            NUM_CHARS, kernel_arena, sizeof(kernel_arena), kernel_offsets
+        );
+        num_names += NUM_RECORDS;
+        num_bytes += kernel_offsets[NUM_RECORDS];
+    }
+    clock_t end = clock();
+
+    double seconds = (double)(end - start) / CLOCKS_PER_SEC;
+    printf("%-8s %8.2f M names/s (%u bytes)\n",
+           "gen3",
+           (seconds > 0.0) ? ((double)num_names / seconds / 1e6) : 0.0,
+           (unsigned)(num_bytes / NUM_ITERATIONS));
+}
+
+int main(void)
+{
+    srand(0x08012025);
+    init_table();
+    init_records();
+
+    int ret = 0;
+    for(size_t kernel_index = 0;
+        kernel_index < pksav_text_batch_num_kernels;
+        ++kernel_index)
+    {
+        const struct pksav_text_batch_kernel* p_kernel =
+            &pksav_text_batch_kernels[kernel_index];
+
+        if(!p_kernel->is_supported())
+        {
+            printf("%-8s unsupported\n", p_kernel->p_name);
+            continue;
+        }
+
+        if(check_kernel(p_kernel))
+        {
+            ret = 1;
+            continue;
+        }
+
+        benchmark_kernel(p_kernel);
+    }
+
+    benchmark_gen3_import_text_batch();
+
+    return ret;
+}
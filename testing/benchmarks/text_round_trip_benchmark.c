@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+/*
+ * Checks that nicknames survive a round trip through each 16-bit text codec,
+ * then reports each one's export and import throughput.
+ */
+
+#include <pksav/gen4/text.h>
+#include <pksav/gen5/text.h>
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define NUM_CHARS      (11) // Nickname length, including the terminator
+#define NUM_ITERATIONS (200000)
+
+struct text_codec
+{
+    const char* p_name;
+
+    enum pksav_error (*import_text_bounded)(
+        const uint16_t*, size_t, char*, size_t, size_t*, bool*
+    );
+    enum pksav_error (*export_text_bounded)(
+        const char*, uint16_t*, size_t, size_t*, bool*
+    );
+};
+
+static const struct text_codec codecs[] =
+{
+    {"gen4", pksav_gen4_import_text_bounded, pksav_gen4_export_text_bounded},
+    {"gen5", pksav_gen5_import_text_bounded, pksav_gen5_export_text_bounded},
+};
+static const size_t num_codecs = sizeof(codecs)/sizeof(codecs[0]);
+
+// A mix of Western, Japanese, and Korean nicknames, which Gen IV keeps in
+// different ranges of its character map.
+static const char* names[] =
+{
+    "Pikachu",
+    "Nidoran♀",
+    "Farfetch’d",
+    "Mr. Mime",
+    "Porygon-Z",
+    "Flabébé",
+    "ピカチュウ",
+    "ニドラン♂",
+    "フシギダネ",
+    "피카츄",
+    "이상해씨",
+    "꼬부기",
+};
+static const size_t num_names = sizeof(names)/sizeof(names[0]);
+
+static uint16_t game_buffers[sizeof(names)/sizeof(names[0])][NUM_CHARS];
+
+static int check_codec(
+    const struct text_codec* p_codec
+)
+{
+    for(size_t name_index = 0; name_index < num_names; ++name_index)
+    {
+        char strbuffer[64] = {0};
+        size_t num_written = 0;
+        bool is_truncated = false;
+
+        p_codec->export_text_bounded(
+            names[name_index], game_buffers[name_index], NUM_CHARS,
+            &num_written, &is_truncated
+        );
+        if(is_truncated)
+        {
+            fprintf(stderr, "%s: couldn't export \"%s\".\n",
+                    p_codec->p_name,
+                    names[name_index]);
+            return 1;
+        }
+
+        p_codec->import_text_bounded(
+            game_buffers[name_index], NUM_CHARS, strbuffer, sizeof(strbuffer),
+            &num_written, &is_truncated
+        );
+        if(is_truncated || strcmp(names[name_index], strbuffer))
+        {
+            fprintf(stderr, "%s: \"%s\" came back as \"%s\".\n",
+                    p_codec->p_name,
+                    names[name_index],
+                    strbuffer);
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+static void benchmark_codec(
+    const struct text_codec* p_codec
+)
+{
+    char strbuffer[64] = {0};
+    size_t num_written = 0;
+    size_t num_bytes = 0;
+    bool is_truncated = false;
+
+    clock_t start = clock();
+    for(size_t iteration = 0; iteration < NUM_ITERATIONS; ++iteration)
+    {
+        for(size_t name_index = 0; name_index < num_names; ++name_index)
+        {
+            p_codec->export_text_bounded(
+                names[name_index], game_buffers[name_index], NUM_CHARS,
+                &num_written, &is_truncated
+            );
+        }
+    }
+    clock_t middle = clock();
+    for(size_t iteration = 0; iteration < NUM_ITERATIONS; ++iteration)
+    {
+        for(size_t name_index = 0; name_index < num_names; ++name_index)
+        {
+            p_codec->import_text_bounded(
+                game_buffers[name_index], NUM_CHARS, strbuffer, sizeof(strbuffer),
+                &num_written, &is_truncated
+            );
+            num_bytes += num_written;
+        }
+    }
+    clock_t end = clock();
+
+    double export_seconds = (double)(middle - start) / CLOCKS_PER_SEC;
+    double import_seconds = (double)(end - middle) / CLOCKS_PER_SEC;
+    double total_num_names = (double)num_names * NUM_ITERATIONS;
+    printf("%-8s export %8.2f M names/s, import %8.2f M names/s (%u bytes)\n",
+           p_codec->p_name,
+           (export_seconds > 0.0) ? (total_num_names / export_seconds / 1e6) : 0.0,
+           (import_seconds > 0.0) ? (total_num_names / import_seconds / 1e6) : 0.0,
+           (unsigned)(num_bytes / NUM_ITERATIONS));
+}
+
+int main(void)
+{
+    int ret = 0;
+    for(size_t codec_index = 0; codec_index < num_codecs; ++codec_index)
+    {
+        if(check_codec(&codecs[codec_index]))
+        {
+            ret = 1;
+            continue;
+        }
+
+        benchmark_codec(&codecs[codec_index]);
+    }
+
+    return ret;
+}
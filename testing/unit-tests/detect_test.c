@@ -0,0 +1,426 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "c_test_common.h"
+#include "test-utils.h"
+
+#include "util/fs.h"
+
+#include <pksav/detect.h>
+#include <pksav/gen1/save.h>
+#include <pksav/gen2/save.h>
+#include <pksav/gen3/save.h>
+
+#include <stdio.h>
+#include <string.h>
+
+struct detect_test_save
+{
+    const char* subdir;
+    const char* save_name;
+    struct pksav_save_type expected_save_type;
+};
+
+static const struct detect_test_save DETECT_TEST_SAVES[] =
+{
+    {"red_blue", "pokemon_red.sav",
+     {PKSAV_GENERATION_1, PKSAV_GEN1_SAVE_TYPE_RED_BLUE, PKSAV_GEN2_SAVE_TYPE_NONE, PKSAV_GEN3_SAVE_TYPE_NONE}},
+    {"yellow", "pokemon_yellow.sav",
+     {PKSAV_GENERATION_1, PKSAV_GEN1_SAVE_TYPE_YELLOW, PKSAV_GEN2_SAVE_TYPE_NONE, PKSAV_GEN3_SAVE_TYPE_NONE}},
+    {"gold_silver", "pokemon_gold.sav",
+     {PKSAV_GENERATION_2, PKSAV_GEN1_SAVE_TYPE_NONE, PKSAV_GEN2_SAVE_TYPE_GS, PKSAV_GEN3_SAVE_TYPE_NONE}},
+    {"crystal", "pokemon_crystal.sav",
+     {PKSAV_GENERATION_2, PKSAV_GEN1_SAVE_TYPE_NONE, PKSAV_GEN2_SAVE_TYPE_CRYSTAL, PKSAV_GEN3_SAVE_TYPE_NONE}},
+    {"ruby_sapphire", "pokemon_ruby.sav",
+     {PKSAV_GENERATION_3, PKSAV_GEN1_SAVE_TYPE_NONE, PKSAV_GEN2_SAVE_TYPE_NONE, PKSAV_GEN3_SAVE_TYPE_RS}},
+    {"emerald", "pokemon_emerald.sav",
+     {PKSAV_GENERATION_3, PKSAV_GEN1_SAVE_TYPE_NONE, PKSAV_GEN2_SAVE_TYPE_NONE, PKSAV_GEN3_SAVE_TYPE_EMERALD}},
+    {"firered_leafgreen", "pokemon_firered.sav",
+     {PKSAV_GENERATION_3, PKSAV_GEN1_SAVE_TYPE_NONE, PKSAV_GEN2_SAVE_TYPE_NONE, PKSAV_GEN3_SAVE_TYPE_FRLG}}
+};
+#define NUM_DETECT_TEST_SAVES (sizeof(DETECT_TEST_SAVES)/sizeof(DETECT_TEST_SAVES[0]))
+
+static void assert_save_types_equal(
+    const struct pksav_save_type* p_expected_save_type,
+    const struct pksav_save_type* p_actual_save_type
+)
+{
+    TEST_ASSERT_NOT_NULL(p_expected_save_type);
+    TEST_ASSERT_NOT_NULL(p_actual_save_type);
+
+    TEST_ASSERT_EQUAL(p_expected_save_type->generation, p_actual_save_type->generation);
+    TEST_ASSERT_EQUAL(p_expected_save_type->gen1_save_type, p_actual_save_type->gen1_save_type);
+    TEST_ASSERT_EQUAL(p_expected_save_type->gen2_save_type, p_actual_save_type->gen2_save_type);
+    TEST_ASSERT_EQUAL(p_expected_save_type->gen3_save_type, p_actual_save_type->gen3_save_type);
+}
+
+static void get_test_save_filepath(
+    const struct detect_test_save* p_test_save,
+    char* p_filepath_out,
+    size_t filepath_len
+)
+{
+    char* pksav_test_saves = getenv("PKSAV_TEST_SAVES");
+    if(!pksav_test_saves)
+    {
+        // TEST_FAIL_MESSAGE doesn't return, but the compiler can't tell.
+        TEST_FAIL_MESSAGE("Failed to get test save directory.");
+        return;
+    }
+
+    snprintf(
+        p_filepath_out, filepath_len,
+        "%s%s%s%s%s",
+        pksav_test_saves, FS_SEPARATOR, p_test_save->subdir,
+        FS_SEPARATOR, p_test_save->save_name
+    );
+}
+
+// Anything too small to be a save, or that no generation accepts, is
+// rejected without a generation. A zeroed buffer would pass the Generation
+// II checksums, so the buffers are filled with 0xFF instead.
+static void detect_invalid_buffer_test()
+{
+    static const size_t buffer_lens[] =
+    {
+        0, 0x100, PKSAV_GEN1_SAVE_SIZE - 1, PKSAV_GEN1_SAVE_SIZE, PKSAV_GEN3_SAVE_SIZE
+    };
+
+    uint8_t* p_buffer = malloc(PKSAV_GEN3_SAVE_SIZE);
+    TEST_ASSERT_NOT_NULL(p_buffer);
+    memset(p_buffer, 0xFF, PKSAV_GEN3_SAVE_SIZE);
+
+    for(size_t len_index = 0;
+        len_index < (sizeof(buffer_lens)/sizeof(buffer_lens[0]));
+        ++len_index)
+    {
+        struct pksav_save_type save_type;
+        memset(&save_type, 0xFF, sizeof(save_type));
+
+        enum pksav_error error = pksav_detect_save_type(
+                                     p_buffer,
+                                     buffer_lens[len_index],
+                                     &save_type
+                                 );
+        TEST_ASSERT_EQUAL(PKSAV_ERROR_INVALID_SAVE, error);
+        TEST_ASSERT_EQUAL(PKSAV_GENERATION_NONE, save_type.generation);
+    }
+
+    free(p_buffer);
+}
+
+// Detection must agree with each generation's own checks, whether it's
+// given the file or a buffer.
+static void detect_save_test()
+{
+    for(size_t save_index = 0; save_index < NUM_DETECT_TEST_SAVES; ++save_index)
+    {
+        const struct detect_test_save* p_test_save = &DETECT_TEST_SAVES[save_index];
+
+        char filepath[256] = {0};
+        get_test_save_filepath(p_test_save, filepath, sizeof(filepath));
+
+        struct pksav_save_type save_type;
+        enum pksav_error error = pksav_detect_file_save_type(
+                                     filepath,
+                                     &save_type
+                                 );
+        PKSAV_TEST_ASSERT_SUCCESS(error);
+        assert_save_types_equal(&p_test_save->expected_save_type, &save_type);
+
+        uint8_t* p_buffer = NULL;
+        size_t buffer_len = 0;
+        if(pksav_fs_read_file_to_buffer(filepath, &p_buffer, &buffer_len))
+        {
+            TEST_FAIL_MESSAGE("Failed to read save.");
+        }
+
+        error = pksav_detect_save_type(
+                    p_buffer,
+                    buffer_len,
+                    &save_type
+                );
+        free(p_buffer);
+        PKSAV_TEST_ASSERT_SUCCESS(error);
+        assert_save_types_equal(&p_test_save->expected_save_type, &save_type);
+
+        switch(save_type.generation)
+        {
+            case PKSAV_GENERATION_1:
+            {
+                enum pksav_gen1_save_type gen1_save_type = PKSAV_GEN1_SAVE_TYPE_NONE;
+                error = pksav_gen1_get_file_save_type(filepath, &gen1_save_type);
+                PKSAV_TEST_ASSERT_SUCCESS(error);
+                TEST_ASSERT_EQUAL(gen1_save_type, save_type.gen1_save_type);
+                break;
+            }
+
+            case PKSAV_GENERATION_2:
+            {
+                enum pksav_gen2_save_type gen2_save_type = PKSAV_GEN2_SAVE_TYPE_NONE;
+                error = pksav_gen2_get_file_save_type(filepath, &gen2_save_type);
+                PKSAV_TEST_ASSERT_SUCCESS(error);
+                TEST_ASSERT_EQUAL(gen2_save_type, save_type.gen2_save_type);
+                break;
+            }
+
+            case PKSAV_GENERATION_3:
+            {
+                enum pksav_gen3_save_type gen3_save_type = PKSAV_GEN3_SAVE_TYPE_NONE;
+                error = pksav_gen3_get_file_save_type(filepath, &gen3_save_type);
+                PKSAV_TEST_ASSERT_SUCCESS(error);
+                TEST_ASSERT_EQUAL(gen3_save_type, save_type.gen3_save_type);
+                break;
+            }
+
+            default:
+                TEST_FAIL_MESSAGE("Unexpected generation.");
+        }
+    }
+
+    struct pksav_save_type save_type;
+    enum pksav_error error = pksav_detect_file_save_type(
+                                 "/this/file/does/not/exist",
+                                 &save_type
+                             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_FILE_IO, error);
+}
+
+/*
+ * Scanning
+ */
+
+#define SCAN_TEST_MAX_FILES (NUM_DETECT_TEST_SAVES + 2)
+
+struct scan_test_result
+{
+    char filepath[256];
+    enum pksav_error error;
+    struct pksav_save_type save_type;
+};
+
+struct scan_test_results
+{
+    struct scan_test_result results[SCAN_TEST_MAX_FILES * 4];
+    size_t num_results;
+};
+
+static void scan_test_callback(
+    const char* p_filepath,
+    enum pksav_error error,
+    const struct pksav_save_type* p_save_type,
+    void* p_user_data
+)
+{
+    TEST_ASSERT_NOT_NULL(p_filepath);
+    TEST_ASSERT_NOT_NULL(p_save_type);
+    TEST_ASSERT_NOT_NULL(p_user_data);
+
+    struct scan_test_results* p_results = p_user_data;
+    if(p_results->num_results >= (sizeof(p_results->results)/sizeof(p_results->results[0])))
+    {
+        return;
+    }
+
+    struct scan_test_result* p_result = &p_results->results[p_results->num_results++];
+    snprintf(p_result->filepath, sizeof(p_result->filepath), "%s", p_filepath);
+    p_result->error = error;
+    p_result->save_type = *p_save_type;
+}
+
+static const struct scan_test_result* find_scan_test_result(
+    const struct scan_test_results* p_results,
+    const char* p_filepath
+)
+{
+    const struct scan_test_result* p_found_result = NULL;
+
+    for(size_t result_index = 0; result_index < p_results->num_results; ++result_index)
+    {
+        if(!strcmp(p_results->results[result_index].filepath, p_filepath))
+        {
+            // Each file should only be reported once.
+            TEST_ASSERT_NULL(p_found_result);
+            p_found_result = &p_results->results[result_index];
+        }
+    }
+
+    return p_found_result;
+}
+
+static void scan_save_files_test()
+{
+    char filepaths[SCAN_TEST_MAX_FILES][256];
+    const char* p_filepaths[SCAN_TEST_MAX_FILES] = {NULL};
+    size_t num_filepaths = 0;
+
+    for(size_t save_index = 0; save_index < NUM_DETECT_TEST_SAVES; ++save_index)
+    {
+        get_test_save_filepath(
+            &DETECT_TEST_SAVES[save_index],
+            filepaths[num_filepaths],
+            sizeof(filepaths[num_filepaths])
+        );
+        p_filepaths[num_filepaths] = filepaths[num_filepaths];
+        ++num_filepaths;
+    }
+
+    // Something that isn't a save and something that isn't there.
+    const size_t not_save_index = num_filepaths++;
+    snprintf(
+        filepaths[not_save_index], sizeof(filepaths[not_save_index]),
+        "%s%spksav_%d_not_a_save",
+        get_tmp_dir(), FS_SEPARATOR, get_pid()
+    );
+    p_filepaths[not_save_index] = filepaths[not_save_index];
+
+    uint8_t not_save_buffer[PKSAV_GEN1_SAVE_SIZE];
+    memset(not_save_buffer, 0xFF, sizeof(not_save_buffer));
+    if(pksav_fs_write_buffer_to_file(filepaths[not_save_index], not_save_buffer, sizeof(not_save_buffer)))
+    {
+        TEST_FAIL_MESSAGE("Failed to write file.");
+    }
+
+    const size_t missing_index = num_filepaths++;
+    snprintf(
+        filepaths[missing_index], sizeof(filepaths[missing_index]),
+        "%s%spksav_%d_missing_dir%snot_a_save",
+        get_tmp_dir(), FS_SEPARATOR, get_pid(), FS_SEPARATOR
+    );
+    p_filepaths[missing_index] = filepaths[missing_index];
+
+    // Try more threads than files too, which should be capped.
+    static const size_t thread_counts[] = {0, 1, 3, SCAN_TEST_MAX_FILES * 2};
+    for(size_t count_index = 0;
+        count_index < (sizeof(thread_counts)/sizeof(thread_counts[0]));
+        ++count_index)
+    {
+        struct pksav_scan_options options = {thread_counts[count_index]};
+        struct scan_test_results results;
+        memset(&results, 0, sizeof(results));
+
+        enum pksav_error error = pksav_scan_save_files(
+                                     p_filepaths,
+                                     num_filepaths,
+                                     &options,
+                                     scan_test_callback,
+                                     &results
+                                 );
+        PKSAV_TEST_ASSERT_SUCCESS(error);
+        TEST_ASSERT_EQUAL(num_filepaths, results.num_results);
+
+        for(size_t save_index = 0; save_index < NUM_DETECT_TEST_SAVES; ++save_index)
+        {
+            const struct scan_test_result* p_result = find_scan_test_result(
+                                                          &results,
+                                                          p_filepaths[save_index]
+                                                      );
+            TEST_ASSERT_NOT_NULL(p_result);
+            PKSAV_TEST_ASSERT_SUCCESS(p_result->error);
+            assert_save_types_equal(
+                &DETECT_TEST_SAVES[save_index].expected_save_type,
+                &p_result->save_type
+            );
+        }
+
+        const struct scan_test_result* p_not_save_result = find_scan_test_result(
+                                                               &results,
+                                                               p_filepaths[not_save_index]
+                                                           );
+        TEST_ASSERT_NOT_NULL(p_not_save_result);
+        TEST_ASSERT_EQUAL(PKSAV_ERROR_INVALID_SAVE, p_not_save_result->error);
+        TEST_ASSERT_EQUAL(PKSAV_GENERATION_NONE, p_not_save_result->save_type.generation);
+
+        const struct scan_test_result* p_missing_result = find_scan_test_result(
+                                                              &results,
+                                                              p_filepaths[missing_index]
+                                                          );
+        TEST_ASSERT_NOT_NULL(p_missing_result);
+        TEST_ASSERT_EQUAL(PKSAV_ERROR_FILE_IO, p_missing_result->error);
+    }
+
+    // An empty list is never an error.
+    struct scan_test_results results;
+    memset(&results, 0, sizeof(results));
+    enum pksav_error error = pksav_scan_save_files(
+                                 p_filepaths,
+                                 0,
+                                 NULL,
+                                 scan_test_callback,
+                                 &results
+                             );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL(0, results.num_results);
+
+    if(delete_file(filepaths[not_save_index]))
+    {
+        TEST_FAIL_MESSAGE("Failed to clean up temp file.");
+    }
+}
+
+static void scan_save_directory_test()
+{
+    char dirpath[256] = {0};
+    char filepath[256] = {0};
+
+    // The save is expected among whatever else is in its directory.
+    const struct detect_test_save* p_test_save = &DETECT_TEST_SAVES[NUM_DETECT_TEST_SAVES-1];
+    get_test_save_filepath(p_test_save, filepath, sizeof(filepath));
+
+    char* pksav_test_saves = getenv("PKSAV_TEST_SAVES");
+    if(!pksav_test_saves)
+    {
+        TEST_FAIL_MESSAGE("Failed to get test save directory.");
+    }
+    snprintf(
+        dirpath, sizeof(dirpath),
+        "%s%s%s",
+        pksav_test_saves, FS_SEPARATOR, p_test_save->subdir
+    );
+
+    struct scan_test_results results;
+    memset(&results, 0, sizeof(results));
+
+    enum pksav_error error = pksav_scan_save_directory(
+                                 dirpath,
+                                 NULL,
+                                 scan_test_callback,
+                                 &results
+                             );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    for(size_t result_index = 0; result_index < results.num_results; ++result_index)
+    {
+        TEST_ASSERT_EQUAL(
+            0,
+            strncmp(dirpath, results.results[result_index].filepath, strlen(dirpath))
+        );
+    }
+
+    const struct scan_test_result* p_result = find_scan_test_result(
+                                                  &results,
+                                                  filepath
+                                              );
+    TEST_ASSERT_NOT_NULL(p_result);
+    PKSAV_TEST_ASSERT_SUCCESS(p_result->error);
+    assert_save_types_equal(&p_test_save->expected_save_type, &p_result->save_type);
+
+    error = pksav_scan_save_directory(
+                "/this/directory/does/not/exist",
+                NULL,
+                scan_test_callback,
+                &results
+            );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_FILE_IO, error);
+}
+
+PKSAV_TEST_MAIN(
+    PKSAV_TEST(detect_invalid_buffer_test)
+    PKSAV_TEST(detect_save_test)
+    PKSAV_TEST(scan_save_files_test)
+    PKSAV_TEST(scan_save_directory_test)
+)
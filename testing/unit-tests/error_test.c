@@ -14,7 +14,7 @@
 static void pksav_strerror_test()
 {
     static const enum pksav_error MIN_ERROR_CODE = PKSAV_ERROR_NONE;
-    static const enum pksav_error MAX_ERROR_CODE = PKSAV_ERROR_NULL_POINTER;
+    static const enum pksav_error MAX_ERROR_CODE = PKSAV_ERROR_OUT_OF_MEMORY;
 
     const char* min_strerror = pksav_strerror(MIN_ERROR_CODE);
     TEST_ASSERT_NOT_NULL(min_strerror);
@@ -378,6 +378,32 @@ static void gen1_save_test(
     }
     TEST_ASSERT_FALSE(files_differ);
 
+    // Saving to a buffer should give the same result.
+    uint8_t* p_original_save_buffer = NULL;
+    size_t original_save_size = 0;
+    if(pksav_fs_read_file_to_buffer(original_filepath, &p_original_save_buffer, &original_save_size))
+    {
+        TEST_FAIL_MESSAGE("Failed to read save into buffer.");
+    }
+
+    uint8_t* p_tmp_save_buffer = malloc(PKSAV_GEN1_SAVE_SIZE);
+    TEST_ASSERT_NOT_NULL(p_tmp_save_buffer);
+
+    error = pksav_gen1_save_save_to_buffer(
+                p_gen1_save,
+                p_tmp_save_buffer,
+                PKSAV_GEN1_SAVE_SIZE
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL_MEMORY(
+        p_original_save_buffer,
+        p_tmp_save_buffer,
+        PKSAV_GEN1_SAVE_SIZE
+    );
+
+    free(p_tmp_save_buffer);
+    free(p_original_save_buffer);
+
     // Make sure setting the current box works as expected.
     for(uint8_t box_index = 0; box_index < PKSAV_GEN1_NUM_POKEMON_BOXES; ++box_index)
     {
@@ -522,6 +548,687 @@ static void gen1_save_from_file_test(
     );
 }
 
+static void gen1_in_place_test(
+    const char* subdir,
+    const char* save_name
+)
+{
+    TEST_ASSERT_NOT_NULL(subdir);
+    TEST_ASSERT_NOT_NULL(save_name);
+
+    char original_filepath[256] = {0};
+    char tmp_save_filepath[256] = {0};
+    struct pksav_gen1_save in_place_gen1_save = EMPTY_GEN1_SAVE;
+    struct pksav_gen1_save committed_gen1_save = EMPTY_GEN1_SAVE;
+    enum pksav_error error = PKSAV_ERROR_NONE;
+
+    char* pksav_test_saves = getenv("PKSAV_TEST_SAVES");
+    if(!pksav_test_saves)
+    {
+        TEST_FAIL_MESSAGE("Failed to get test save directory.");
+    }
+
+    snprintf(
+        original_filepath, sizeof(original_filepath),
+        "%s%s%s%s%s",
+        pksav_test_saves, FS_SEPARATOR, subdir, FS_SEPARATOR, save_name
+    );
+    snprintf(
+        tmp_save_filepath, sizeof(tmp_save_filepath),
+        "%s%spksav_%d_in_place_%s",
+        get_tmp_dir(), FS_SEPARATOR, get_pid(), save_name
+    );
+
+    // Edit a copy, since the edits go straight to the file.
+    uint8_t* save_buffer = NULL;
+    size_t save_size = 0;
+    if(pksav_fs_read_file_to_buffer(original_filepath, &save_buffer, &save_size))
+    {
+        TEST_FAIL_MESSAGE("Failed to read save into buffer.");
+    }
+    if(pksav_fs_write_buffer_to_file(tmp_save_filepath, save_buffer, save_size))
+    {
+        TEST_FAIL_MESSAGE("Failed to write save copy.");
+    }
+    free(save_buffer);
+
+    error = pksav_gen1_load_save_from_file_in_place(
+                tmp_save_filepath,
+                &in_place_gen1_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    error = pksav_export_bcd(
+                123456,
+                in_place_gen1_save.trainer_info.p_money,
+                3
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    error = pksav_gen1_save_commit(&in_place_gen1_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    // The committed file should load normally, with the edit.
+    error = pksav_gen1_load_save_from_file(
+                tmp_save_filepath,
+                &committed_gen1_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL_MEMORY(
+        in_place_gen1_save.trainer_info.p_money,
+        committed_gen1_save.trainer_info.p_money,
+        3
+    );
+
+    // Only saves loaded in place can be committed.
+    error = pksav_gen1_save_commit(&committed_gen1_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_PARAM_OUT_OF_RANGE, error);
+
+    error = pksav_gen1_free_save(&committed_gen1_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    error = pksav_gen1_free_save(&in_place_gen1_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    if(delete_file(tmp_save_filepath))
+    {
+        TEST_FAIL_MESSAGE("Failed to clean up temp file.");
+    }
+}
+
+static void gen1_save_changes_test(
+    const char* subdir,
+    const char* save_name
+)
+{
+    TEST_ASSERT_NOT_NULL(subdir);
+    TEST_ASSERT_NOT_NULL(save_name);
+
+    char original_filepath[256] = {0};
+    char tmp_save_filepath[256] = {0};
+    struct pksav_gen1_save gen1_save = EMPTY_GEN1_SAVE;
+    struct pksav_gen1_save saved_gen1_save = EMPTY_GEN1_SAVE;
+    enum pksav_error error = PKSAV_ERROR_NONE;
+
+    char* pksav_test_saves = getenv("PKSAV_TEST_SAVES");
+    if(!pksav_test_saves)
+    {
+        TEST_FAIL_MESSAGE("Failed to get test save directory.");
+    }
+
+    snprintf(
+        original_filepath, sizeof(original_filepath),
+        "%s%s%s%s%s",
+        pksav_test_saves, FS_SEPARATOR, subdir, FS_SEPARATOR, save_name
+    );
+    snprintf(
+        tmp_save_filepath, sizeof(tmp_save_filepath),
+        "%s%spksav_%d_save_changes_%s",
+        get_tmp_dir(), FS_SEPARATOR, get_pid(), save_name
+    );
+
+    // Only the changes are written, so the file must already exist.
+    error = pksav_gen1_load_save_from_file(
+                original_filepath,
+                &gen1_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    error = pksav_gen1_save_save_changes(
+                tmp_save_filepath,
+                &gen1_save,
+                false // should_sync
+            );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_FILE_IO, error);
+
+    error = pksav_gen1_save_save(
+                tmp_save_filepath,
+                &gen1_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    error = pksav_gen1_free_save(&gen1_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    // Load the copy, so the save is saved over the file it was loaded from.
+    error = pksav_gen1_load_save_from_file(
+                tmp_save_filepath,
+                &gen1_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    error = pksav_export_bcd(
+                123456,
+                gen1_save.trainer_info.p_money,
+                3
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    error = pksav_gen1_save_save_changes(
+                tmp_save_filepath,
+                &gen1_save,
+                true // should_sync
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    // The saved file should load normally, with the edit.
+    error = pksav_gen1_load_save_from_file(
+                tmp_save_filepath,
+                &saved_gen1_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL_MEMORY(
+        gen1_save.trainer_info.p_money,
+        saved_gen1_save.trainer_info.p_money,
+        3
+    );
+
+    error = pksav_gen1_free_save(&saved_gen1_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    error = pksav_gen1_free_save(&gen1_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    if(delete_file(tmp_save_filepath))
+    {
+        TEST_FAIL_MESSAGE("Failed to clean up temp file.");
+    }
+}
+
+#define GEN1_ASYNC_NUM_WRITES 8
+
+struct gen1_async_results
+{
+    size_t num_calls;
+    size_t num_errors;
+};
+
+// Every write here is to one file, so these are never called concurrently.
+static void gen1_async_callback(
+    enum pksav_error error,
+    void* p_user_data
+)
+{
+    TEST_ASSERT_NOT_NULL(p_user_data);
+
+    struct gen1_async_results* p_results = p_user_data;
+    ++p_results->num_calls;
+    if(error)
+    {
+        ++p_results->num_errors;
+    }
+}
+
+static void gen1_save_async_test(
+    const char* subdir,
+    const char* save_name
+)
+{
+    TEST_ASSERT_NOT_NULL(subdir);
+    TEST_ASSERT_NOT_NULL(save_name);
+
+    char original_filepath[256] = {0};
+    char tmp_save_filepath[256] = {0};
+    char bad_filepath[256] = {0};
+    struct pksav_gen1_save gen1_save = EMPTY_GEN1_SAVE;
+    struct pksav_gen1_save saved_gen1_save = EMPTY_GEN1_SAVE;
+    enum pksav_error error = PKSAV_ERROR_NONE;
+
+    char* pksav_test_saves = getenv("PKSAV_TEST_SAVES");
+    if(!pksav_test_saves)
+    {
+        TEST_FAIL_MESSAGE("Failed to get test save directory.");
+    }
+
+    snprintf(
+        original_filepath, sizeof(original_filepath),
+        "%s%s%s%s%s",
+        pksav_test_saves, FS_SEPARATOR, subdir, FS_SEPARATOR, save_name
+    );
+    snprintf(
+        tmp_save_filepath, sizeof(tmp_save_filepath),
+        "%s%spksav_%d_save_async_%s",
+        get_tmp_dir(), FS_SEPARATOR, get_pid(), save_name
+    );
+    snprintf(
+        bad_filepath, sizeof(bad_filepath),
+        "%s%spksav_%d_missing_dir%s%s",
+        get_tmp_dir(), FS_SEPARATOR, get_pid(), FS_SEPARATOR, save_name
+    );
+
+    error = pksav_gen1_load_save_from_file(
+                original_filepath,
+                &gen1_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    struct pksav_async_writer writer;
+    error = pksav_async_writer_init(2, &writer);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    // Edit the save between writes. Whichever writes are coalesced, the
+    // last edit must be what ends up in the file.
+    struct gen1_async_results results = {0, 0};
+    for(size_t write_index = 0; write_index < GEN1_ASYNC_NUM_WRITES; ++write_index)
+    {
+        gen1_save.trainer_info.p_name[0] = (uint8_t)(0x80 + write_index);
+
+        error = pksav_gen1_save_save_async(
+                    tmp_save_filepath,
+                    &gen1_save,
+                    &writer,
+                    gen1_async_callback,
+                    &results
+                );
+        PKSAV_TEST_ASSERT_SUCCESS(error);
+    }
+
+    // Failures are reported through the callback.
+    struct gen1_async_results bad_results = {0, 0};
+    error = pksav_gen1_save_save_async(
+                bad_filepath,
+                &gen1_save,
+                &writer,
+                gen1_async_callback,
+                &bad_results
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    error = pksav_async_writer_wait(&writer);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    size_t num_pending = 1;
+    error = pksav_async_writer_get_num_pending(&writer, &num_pending);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL(0, num_pending);
+
+    TEST_ASSERT_EQUAL(GEN1_ASYNC_NUM_WRITES, results.num_calls);
+    TEST_ASSERT_EQUAL(0, results.num_errors);
+    TEST_ASSERT_EQUAL(1, bad_results.num_calls);
+    TEST_ASSERT_EQUAL(1, bad_results.num_errors);
+
+    error = pksav_async_writer_free(&writer);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    error = pksav_gen1_load_save_from_file(
+                tmp_save_filepath,
+                &saved_gen1_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL(
+        0x80 + GEN1_ASYNC_NUM_WRITES - 1,
+        saved_gen1_save.trainer_info.p_name[0]
+    );
+
+    error = pksav_gen1_free_save(&saved_gen1_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    error = pksav_gen1_free_save(&gen1_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    if(delete_file(tmp_save_filepath))
+    {
+        TEST_FAIL_MESSAGE("Failed to clean up temp file.");
+    }
+}
+
+static void gen1_save_to_batch_test(
+    const char* subdir,
+    const char* save_name
+)
+{
+    TEST_ASSERT_NOT_NULL(subdir);
+    TEST_ASSERT_NOT_NULL(save_name);
+
+    char original_filepath[256] = {0};
+    char existing_filepath[256] = {0};
+    char new_filepath[256] = {0};
+    struct pksav_gen1_save gen1_save = EMPTY_GEN1_SAVE;
+    struct pksav_gen1_save saved_gen1_save = EMPTY_GEN1_SAVE;
+    enum pksav_error error = PKSAV_ERROR_NONE;
+
+    char* pksav_test_saves = getenv("PKSAV_TEST_SAVES");
+    if(!pksav_test_saves)
+    {
+        TEST_FAIL_MESSAGE("Failed to get test save directory.");
+    }
+
+    snprintf(
+        original_filepath, sizeof(original_filepath),
+        "%s%s%s%s%s",
+        pksav_test_saves, FS_SEPARATOR, subdir, FS_SEPARATOR, save_name
+    );
+    snprintf(
+        existing_filepath, sizeof(existing_filepath),
+        "%s%spksav_%d_batch_existing_%s",
+        get_tmp_dir(), FS_SEPARATOR, get_pid(), save_name
+    );
+    snprintf(
+        new_filepath, sizeof(new_filepath),
+        "%s%spksav_%d_batch_new_%s",
+        get_tmp_dir(), FS_SEPARATOR, get_pid(), save_name
+    );
+
+    error = pksav_gen1_load_save_from_file(
+                original_filepath,
+                &gen1_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    uint8_t original_first_char = gen1_save.trainer_info.p_name[0];
+
+    error = pksav_gen1_save_save(
+                existing_filepath,
+                &gen1_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    struct pksav_save_batch batch;
+    error = pksav_save_batch_init(&batch);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    // The last save added to a destination is the one that ends up there.
+    gen1_save.trainer_info.p_name[0] = 0x80;
+    error = pksav_gen1_save_save_to_batch(existing_filepath, &gen1_save, &batch);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    gen1_save.trainer_info.p_name[0] = 0x81;
+    error = pksav_gen1_save_save_to_batch(new_filepath, &gen1_save, &batch);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    gen1_save.trainer_info.p_name[0] = 0x82;
+    error = pksav_gen1_save_save_to_batch(existing_filepath, &gen1_save, &batch);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    // Nothing is moved into place until the batch is committed.
+    error = pksav_gen1_load_save_from_file(
+                existing_filepath,
+                &saved_gen1_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL(original_first_char, saved_gen1_save.trainer_info.p_name[0]);
+    error = pksav_gen1_free_save(&saved_gen1_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    error = pksav_gen1_load_save_from_file(
+                new_filepath,
+                &saved_gen1_save
+            );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_FILE_IO, error);
+
+    error = pksav_save_batch_commit(&batch);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    error = pksav_gen1_load_save_from_file(
+                existing_filepath,
+                &saved_gen1_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL(0x82, saved_gen1_save.trainer_info.p_name[0]);
+    error = pksav_gen1_free_save(&saved_gen1_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    error = pksav_gen1_load_save_from_file(
+                new_filepath,
+                &saved_gen1_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL(0x81, saved_gen1_save.trainer_info.p_name[0]);
+    error = pksav_gen1_free_save(&saved_gen1_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    // Freeing a batch discards anything that wasn't committed.
+    gen1_save.trainer_info.p_name[0] = 0x83;
+    error = pksav_gen1_save_save_to_batch(existing_filepath, &gen1_save, &batch);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    error = pksav_save_batch_free(&batch);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    error = pksav_gen1_load_save_from_file(
+                existing_filepath,
+                &saved_gen1_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL(0x82, saved_gen1_save.trainer_info.p_name[0]);
+
+    error = pksav_gen1_free_save(&saved_gen1_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    error = pksav_gen1_free_save(&gen1_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    if(delete_file(existing_filepath) || delete_file(new_filepath))
+    {
+        TEST_FAIL_MESSAGE("Failed to clean up temp file.");
+    }
+}
+
+static void gen1_peek_test(
+    const char* subdir,
+    const char* save_name,
+    enum pksav_gen1_save_type expected_save_type
+)
+{
+    TEST_ASSERT_NOT_NULL(subdir);
+    TEST_ASSERT_NOT_NULL(save_name);
+
+    char filepath[256] = {0};
+    struct pksav_gen1_save gen1_save = EMPTY_GEN1_SAVE;
+    enum pksav_error error = PKSAV_ERROR_NONE;
+
+    char* pksav_test_saves = getenv("PKSAV_TEST_SAVES");
+    if(!pksav_test_saves)
+    {
+        TEST_FAIL_MESSAGE("Failed to get test save directory.");
+    }
+
+    snprintf(
+        filepath, sizeof(filepath),
+        "%s%s%s%s%s",
+        pksav_test_saves, FS_SEPARATOR, subdir, FS_SEPARATOR, save_name
+    );
+
+    struct pksav_gen1_save_peek peek;
+    error = pksav_gen1_peek_save_from_file(
+                filepath,
+                &peek
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    // Everything peeked should match a full load.
+    error = pksav_gen1_load_save_from_file(
+                filepath,
+                &gen1_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    TEST_ASSERT_EQUAL(expected_save_type, peek.save_type);
+    TEST_ASSERT_EQUAL_MEMORY(
+        gen1_save.trainer_info.p_name,
+        peek.trainer_name,
+        sizeof(peek.trainer_name)
+    );
+    TEST_ASSERT_EQUAL(*gen1_save.trainer_info.p_id, peek.trainer_id);
+    TEST_ASSERT_EQUAL_MEMORY(
+        gen1_save.p_time_played,
+        &peek.time_played,
+        sizeof(peek.time_played)
+    );
+
+    const struct pksav_gen1_pokemon_party* p_party = gen1_save.pokemon_storage.p_party;
+    TEST_ASSERT_EQUAL(p_party->count, peek.party_count);
+    TEST_ASSERT_EQUAL_MEMORY(
+        p_party->species,
+        peek.party_species,
+        peek.party_count
+    );
+
+    error = pksav_gen1_free_save(&gen1_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    // A buffer that isn't a save should be rejected.
+    uint8_t zero_buffer[PKSAV_GEN1_SAVE_SIZE] = {0};
+    struct pksav_io memory_io;
+    error = pksav_io_init_memory(
+                zero_buffer,
+                sizeof(zero_buffer),
+                &memory_io
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    error = pksav_gen1_peek_save_from_io(
+                &memory_io,
+                &peek
+            );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_INVALID_SAVE, error);
+}
+
+#define GEN1_BULK_NUM_SAVES (2)
+#define GEN1_BULK_NUM_FILEPATHS (3 * (GEN1_BULK_NUM_SAVES + 1))
+
+struct gen1_bulk_result
+{
+    size_t num_calls;
+    enum pksav_error error;
+    enum pksav_gen1_save_type save_type;
+    uint8_t trainer_name[PKSAV_GEN1_TRAINER_NAME_LENGTH];
+};
+
+static void gen1_bulk_callback(
+    size_t filepath_index,
+    enum pksav_error error,
+    struct pksav_gen1_save* p_gen1_save,
+    void* p_user_data
+)
+{
+    TEST_ASSERT_NOT_NULL(p_user_data);
+    TEST_ASSERT_TRUE(filepath_index < GEN1_BULK_NUM_FILEPATHS);
+    TEST_ASSERT_EQUAL(!error, (p_gen1_save != NULL));
+
+    struct gen1_bulk_result* p_result = &((struct gen1_bulk_result*)p_user_data)[filepath_index];
+    ++p_result->num_calls;
+    p_result->error = error;
+    if(p_gen1_save)
+    {
+        p_result->save_type = p_gen1_save->save_type;
+        memcpy(
+            p_result->trainer_name,
+            p_gen1_save->trainer_info.p_name,
+            sizeof(p_result->trainer_name)
+        );
+    }
+}
+
+static void gen1_bulk_load_test()
+{
+    static const char* SAVE_FILES[GEN1_BULK_NUM_SAVES][2] =
+    {
+        {"red_blue", "pokemon_red.sav"},
+        {"yellow", "pokemon_yellow.sav"}
+    };
+    static const enum pksav_bulk_backend BACKENDS[] =
+    {
+        PKSAV_BULK_BACKEND_AUTO,
+        PKSAV_BULK_BACKEND_IO_URING,
+        PKSAV_BULK_BACKEND_THREADS,
+        PKSAV_BULK_BACKEND_SERIAL
+    };
+
+    char* pksav_test_saves = getenv("PKSAV_TEST_SAVES");
+    if(!pksav_test_saves)
+    {
+        TEST_FAIL_MESSAGE("Failed to get test save directory.");
+    }
+
+    // Every save plus a missing file, several times over, so there are
+    // more files than the queue depth.
+    char filepaths[GEN1_BULK_NUM_SAVES + 1][256];
+    struct gen1_bulk_result expected_results[GEN1_BULK_NUM_SAVES + 1];
+    memset(filepaths, 0, sizeof(filepaths));
+    memset(expected_results, 0, sizeof(expected_results));
+
+    enum pksav_error error = PKSAV_ERROR_NONE;
+    for(size_t save_index = 0; save_index < GEN1_BULK_NUM_SAVES; ++save_index)
+    {
+        snprintf(
+            filepaths[save_index], sizeof(filepaths[save_index]),
+            "%s%s%s%s%s",
+            pksav_test_saves, FS_SEPARATOR,
+            SAVE_FILES[save_index][0], FS_SEPARATOR,
+            SAVE_FILES[save_index][1]
+        );
+
+        struct pksav_gen1_save gen1_save;
+        error = pksav_gen1_load_save_from_file(
+                    filepaths[save_index],
+                    &gen1_save
+                );
+        PKSAV_TEST_ASSERT_SUCCESS(error);
+
+        expected_results[save_index].num_calls = 1;
+        expected_results[save_index].save_type = gen1_save.save_type;
+        memcpy(
+            expected_results[save_index].trainer_name,
+            gen1_save.trainer_info.p_name,
+            sizeof(expected_results[save_index].trainer_name)
+        );
+
+        error = pksav_gen1_free_save(&gen1_save);
+        PKSAV_TEST_ASSERT_SUCCESS(error);
+    }
+    snprintf(
+        filepaths[GEN1_BULK_NUM_SAVES], sizeof(filepaths[GEN1_BULK_NUM_SAVES]),
+        "%s%spksav_%d_bulk_load_missing",
+        get_tmp_dir(), FS_SEPARATOR, get_pid()
+    );
+    expected_results[GEN1_BULK_NUM_SAVES].num_calls = 1;
+    expected_results[GEN1_BULK_NUM_SAVES].error = PKSAV_ERROR_FILE_IO;
+
+    const char* p_filepaths[GEN1_BULK_NUM_FILEPATHS] = {NULL};
+    for(size_t filepath_index = 0;
+        filepath_index < GEN1_BULK_NUM_FILEPATHS;
+        ++filepath_index)
+    {
+        p_filepaths[filepath_index] = filepaths[filepath_index % (GEN1_BULK_NUM_SAVES + 1)];
+    }
+
+    for(size_t backend_index = 0;
+        backend_index < (sizeof(BACKENDS) / sizeof(BACKENDS[0]));
+        ++backend_index)
+    {
+        struct pksav_bulk_load_options options =
+        {
+            .queue_depth = 2,
+            .backend = BACKENDS[backend_index]
+        };
+        struct gen1_bulk_result results[GEN1_BULK_NUM_FILEPATHS];
+        memset(results, 0, sizeof(results));
+
+        error = pksav_gen1_bulk_load_saves(
+                    p_filepaths,
+                    GEN1_BULK_NUM_FILEPATHS,
+                    &options,
+                    gen1_bulk_callback,
+                    results
+                );
+        if((BACKENDS[backend_index] == PKSAV_BULK_BACKEND_IO_URING) &&
+           (error == PKSAV_ERROR_FILE_IO))
+        {
+            // This kernel doesn't support io_uring.
+            continue;
+        }
+        PKSAV_TEST_ASSERT_SUCCESS(error);
+
+        for(size_t filepath_index = 0;
+            filepath_index < GEN1_BULK_NUM_FILEPATHS;
+            ++filepath_index)
+        {
+            const struct gen1_bulk_result* p_expected_result =
+                &expected_results[filepath_index % (GEN1_BULK_NUM_SAVES + 1)];
+
+            TEST_ASSERT_EQUAL_MEMORY(
+                p_expected_result,
+                &results[filepath_index],
+                sizeof(*p_expected_result)
+            );
+        }
+    }
+}
+
 static void pksav_buffer_is_red_save_test()
 {
     pksav_gen1_get_buffer_save_type_test(
@@ -558,6 +1265,47 @@ static void red_save_from_file_test()
     );
 }
 
+static void red_save_changes_test()
+{
+    gen1_save_changes_test(
+        "red_blue",
+        "pokemon_red.sav"
+    );
+}
+
+static void red_save_async_test()
+{
+    gen1_save_async_test(
+        "red_blue",
+        "pokemon_red.sav"
+    );
+}
+
+static void red_save_to_batch_test()
+{
+    gen1_save_to_batch_test(
+        "red_blue",
+        "pokemon_red.sav"
+    );
+}
+
+static void red_peek_test()
+{
+    gen1_peek_test(
+        "red_blue",
+        "pokemon_red.sav",
+        PKSAV_GEN1_SAVE_TYPE_RED_BLUE
+    );
+}
+
+static void red_in_place_test()
+{
+    gen1_in_place_test(
+        "red_blue",
+        "pokemon_red.sav"
+    );
+}
+
 static void pksav_buffer_is_yellow_save_test()
 {
     pksav_gen1_get_buffer_save_type_test(
@@ -594,16 +1342,68 @@ static void yellow_save_from_file_test()
     );
 }
 
+static void yellow_save_changes_test()
+{
+    gen1_save_changes_test(
+        "yellow",
+        "pokemon_yellow.sav"
+    );
+}
+
+static void yellow_save_async_test()
+{
+    gen1_save_async_test(
+        "yellow",
+        "pokemon_yellow.sav"
+    );
+}
+
+static void yellow_save_to_batch_test()
+{
+    gen1_save_to_batch_test(
+        "yellow",
+        "pokemon_yellow.sav"
+    );
+}
+
+static void yellow_peek_test()
+{
+    gen1_peek_test(
+        "yellow",
+        "pokemon_yellow.sav",
+        PKSAV_GEN1_SAVE_TYPE_YELLOW
+    );
+}
+
+static void yellow_in_place_test()
+{
+    gen1_in_place_test(
+        "yellow",
+        "pokemon_yellow.sav"
+    );
+}
+
 PKSAV_TEST_MAIN(
     PKSAV_TEST(pksav_gen1_get_buffer_save_type_on_random_buffer_test)
+    PKSAV_TEST(gen1_bulk_load_test)
 
     PKSAV_TEST(pksav_buffer_is_red_save_test)
     PKSAV_TEST(pksav_file_is_red_save_test)
     PKSAV_TEST(red_save_from_buffer_test)
     PKSAV_TEST(red_save_from_file_test)
+    PKSAV_TEST(red_in_place_test)
+    PKSAV_TEST(red_save_changes_test)
+    PKSAV_TEST(red_save_async_test)
+    PKSAV_TEST(red_save_to_batch_test)
+    PKSAV_TEST(red_peek_test)
 
     PKSAV_TEST(pksav_buffer_is_yellow_save_test)
     PKSAV_TEST(pksav_file_is_yellow_save_test)
     PKSAV_TEST(yellow_save_from_buffer_test)
     PKSAV_TEST(yellow_save_from_file_test)
+    PKSAV_TEST(yellow_in_place_test)
+    PKSAV_TEST(yellow_save_changes_test)
+    PKSAV_TEST(yellow_save_async_test)
+    PKSAV_TEST(yellow_save_to_batch_test)
+    PKSAV_TEST(yellow_peek_test)
 )
@@ -536,6 +536,33 @@ static void gen2_save_test(
         TEST_FAIL_MESSAGE("Failed to clean up temp file.");
     }
 
+    // Saving to a buffer should give the same result.
+    uint8_t* p_tmp_save_buffer = malloc(PKSAV_GEN2_SAVE_SIZE);
+    TEST_ASSERT_NOT_NULL(p_tmp_save_buffer);
+
+    error = pksav_gen2_save_save_to_buffer(
+                p_gen2_save,
+                p_tmp_save_buffer,
+                PKSAV_GEN2_SAVE_SIZE
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    error = pksav_gen2_load_save_from_buffer(
+                p_tmp_save_buffer,
+                PKSAV_GEN2_SAVE_SIZE,
+                &tmp_gen2_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    compare_gen2_saves(
+        p_gen2_save,
+        &tmp_gen2_save
+    );
+
+    error = pksav_gen2_free_save(&tmp_gen2_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    free(p_tmp_save_buffer);
+
     // Make sure setting the current box works as expected.
     for(uint8_t box_index = 0; box_index < PKSAV_GEN2_NUM_POKEMON_BOXES; ++box_index)
     {
@@ -681,6 +708,690 @@ static void gen2_save_from_file_test(
     );
 }
 
+static void gen2_in_place_test(
+    const char* subdir,
+    const char* save_name
+)
+{
+    TEST_ASSERT_NOT_NULL(subdir);
+    TEST_ASSERT_NOT_NULL(save_name);
+
+    char original_filepath[256] = {0};
+    char tmp_save_filepath[256] = {0};
+    struct pksav_gen2_save in_place_gen2_save = EMPTY_GEN2_SAVE;
+    struct pksav_gen2_save committed_gen2_save = EMPTY_GEN2_SAVE;
+    enum pksav_error error = PKSAV_ERROR_NONE;
+
+    char* pksav_test_saves = getenv("PKSAV_TEST_SAVES");
+    if(!pksav_test_saves)
+    {
+        TEST_FAIL_MESSAGE("Failed to get test save directory.");
+    }
+
+    snprintf(
+        original_filepath, sizeof(original_filepath),
+        "%s%s%s%s%s",
+        pksav_test_saves, FS_SEPARATOR, subdir, FS_SEPARATOR, save_name
+    );
+    snprintf(
+        tmp_save_filepath, sizeof(tmp_save_filepath),
+        "%s%spksav_%d_in_place_%s",
+        get_tmp_dir(), FS_SEPARATOR, get_pid(), save_name
+    );
+
+    // Edit a copy, since the edits go straight to the file.
+    uint8_t* save_buffer = NULL;
+    size_t save_size = 0;
+    if(pksav_fs_read_file_to_buffer(original_filepath, &save_buffer, &save_size))
+    {
+        TEST_FAIL_MESSAGE("Failed to read save into buffer.");
+    }
+    if(pksav_fs_write_buffer_to_file(tmp_save_filepath, save_buffer, save_size))
+    {
+        TEST_FAIL_MESSAGE("Failed to write save copy.");
+    }
+    free(save_buffer);
+
+    error = pksav_gen2_load_save_from_file_in_place(
+                tmp_save_filepath,
+                &in_place_gen2_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    error = pksav_export_bcd(
+                123456,
+                in_place_gen2_save.trainer_info.p_money,
+                3
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    error = pksav_gen2_save_commit(&in_place_gen2_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    // The committed file should load normally, with the edit.
+    error = pksav_gen2_load_save_from_file(
+                tmp_save_filepath,
+                &committed_gen2_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL_MEMORY(
+        in_place_gen2_save.trainer_info.p_money,
+        committed_gen2_save.trainer_info.p_money,
+        3
+    );
+
+    // Only saves loaded in place can be committed.
+    error = pksav_gen2_save_commit(&committed_gen2_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_PARAM_OUT_OF_RANGE, error);
+
+    error = pksav_gen2_free_save(&committed_gen2_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    error = pksav_gen2_free_save(&in_place_gen2_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    if(delete_file(tmp_save_filepath))
+    {
+        TEST_FAIL_MESSAGE("Failed to clean up temp file.");
+    }
+}
+
+static void gen2_save_changes_test(
+    const char* subdir,
+    const char* save_name
+)
+{
+    TEST_ASSERT_NOT_NULL(subdir);
+    TEST_ASSERT_NOT_NULL(save_name);
+
+    char original_filepath[256] = {0};
+    char tmp_save_filepath[256] = {0};
+    struct pksav_gen2_save gen2_save = EMPTY_GEN2_SAVE;
+    struct pksav_gen2_save saved_gen2_save = EMPTY_GEN2_SAVE;
+    enum pksav_error error = PKSAV_ERROR_NONE;
+
+    char* pksav_test_saves = getenv("PKSAV_TEST_SAVES");
+    if(!pksav_test_saves)
+    {
+        TEST_FAIL_MESSAGE("Failed to get test save directory.");
+    }
+
+    snprintf(
+        original_filepath, sizeof(original_filepath),
+        "%s%s%s%s%s",
+        pksav_test_saves, FS_SEPARATOR, subdir, FS_SEPARATOR, save_name
+    );
+    snprintf(
+        tmp_save_filepath, sizeof(tmp_save_filepath),
+        "%s%spksav_%d_save_changes_%s",
+        get_tmp_dir(), FS_SEPARATOR, get_pid(), save_name
+    );
+
+    // Only the changes are written, so the file must already exist.
+    error = pksav_gen2_load_save_from_file(
+                original_filepath,
+                &gen2_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    error = pksav_gen2_save_save_changes(
+                tmp_save_filepath,
+                &gen2_save,
+                false // should_sync
+            );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_FILE_IO, error);
+
+    error = pksav_gen2_save_save(
+                tmp_save_filepath,
+                &gen2_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    error = pksav_gen2_free_save(&gen2_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    // Load the copy, so the save is saved over the file it was loaded from.
+    error = pksav_gen2_load_save_from_file(
+                tmp_save_filepath,
+                &gen2_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    error = pksav_export_bcd(
+                123456,
+                gen2_save.trainer_info.p_money,
+                3
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    error = pksav_gen2_save_save_changes(
+                tmp_save_filepath,
+                &gen2_save,
+                true // should_sync
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    // The saved file should load normally, with the edit.
+    error = pksav_gen2_load_save_from_file(
+                tmp_save_filepath,
+                &saved_gen2_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL_MEMORY(
+        gen2_save.trainer_info.p_money,
+        saved_gen2_save.trainer_info.p_money,
+        3
+    );
+
+    error = pksav_gen2_free_save(&saved_gen2_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    error = pksav_gen2_free_save(&gen2_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    if(delete_file(tmp_save_filepath))
+    {
+        TEST_FAIL_MESSAGE("Failed to clean up temp file.");
+    }
+}
+
+#define GEN2_ASYNC_NUM_WRITES 8
+
+struct gen2_async_results
+{
+    size_t num_calls;
+    size_t num_errors;
+};
+
+// Every write here is to one file, so these are never called concurrently.
+static void gen2_async_callback(
+    enum pksav_error error,
+    void* p_user_data
+)
+{
+    TEST_ASSERT_NOT_NULL(p_user_data);
+
+    struct gen2_async_results* p_results = p_user_data;
+    ++p_results->num_calls;
+    if(error)
+    {
+        ++p_results->num_errors;
+    }
+}
+
+static void gen2_save_async_test(
+    const char* subdir,
+    const char* save_name
+)
+{
+    TEST_ASSERT_NOT_NULL(subdir);
+    TEST_ASSERT_NOT_NULL(save_name);
+
+    char original_filepath[256] = {0};
+    char tmp_save_filepath[256] = {0};
+    char bad_filepath[256] = {0};
+    struct pksav_gen2_save gen2_save = EMPTY_GEN2_SAVE;
+    struct pksav_gen2_save saved_gen2_save = EMPTY_GEN2_SAVE;
+    enum pksav_error error = PKSAV_ERROR_NONE;
+
+    char* pksav_test_saves = getenv("PKSAV_TEST_SAVES");
+    if(!pksav_test_saves)
+    {
+        TEST_FAIL_MESSAGE("Failed to get test save directory.");
+    }
+
+    snprintf(
+        original_filepath, sizeof(original_filepath),
+        "%s%s%s%s%s",
+        pksav_test_saves, FS_SEPARATOR, subdir, FS_SEPARATOR, save_name
+    );
+    snprintf(
+        tmp_save_filepath, sizeof(tmp_save_filepath),
+        "%s%spksav_%d_save_async_%s",
+        get_tmp_dir(), FS_SEPARATOR, get_pid(), save_name
+    );
+    snprintf(
+        bad_filepath, sizeof(bad_filepath),
+        "%s%spksav_%d_missing_dir%s%s",
+        get_tmp_dir(), FS_SEPARATOR, get_pid(), FS_SEPARATOR, save_name
+    );
+
+    error = pksav_gen2_load_save_from_file(
+                original_filepath,
+                &gen2_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    struct pksav_async_writer writer;
+    error = pksav_async_writer_init(2, &writer);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    // Edit the save between writes. Whichever writes are coalesced, the
+    // last edit must be what ends up in the file.
+    struct gen2_async_results results = {0, 0};
+    for(size_t write_index = 0; write_index < GEN2_ASYNC_NUM_WRITES; ++write_index)
+    {
+        gen2_save.trainer_info.p_name[0] = (uint8_t)(0x80 + write_index);
+
+        error = pksav_gen2_save_save_async(
+                    tmp_save_filepath,
+                    &gen2_save,
+                    &writer,
+                    gen2_async_callback,
+                    &results
+                );
+        PKSAV_TEST_ASSERT_SUCCESS(error);
+    }
+
+    // Failures are reported through the callback.
+    struct gen2_async_results bad_results = {0, 0};
+    error = pksav_gen2_save_save_async(
+                bad_filepath,
+                &gen2_save,
+                &writer,
+                gen2_async_callback,
+                &bad_results
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    error = pksav_async_writer_wait(&writer);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    size_t num_pending = 1;
+    error = pksav_async_writer_get_num_pending(&writer, &num_pending);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL(0, num_pending);
+
+    TEST_ASSERT_EQUAL(GEN2_ASYNC_NUM_WRITES, results.num_calls);
+    TEST_ASSERT_EQUAL(0, results.num_errors);
+    TEST_ASSERT_EQUAL(1, bad_results.num_calls);
+    TEST_ASSERT_EQUAL(1, bad_results.num_errors);
+
+    error = pksav_async_writer_free(&writer);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    error = pksav_gen2_load_save_from_file(
+                tmp_save_filepath,
+                &saved_gen2_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL(
+        0x80 + GEN2_ASYNC_NUM_WRITES - 1,
+        saved_gen2_save.trainer_info.p_name[0]
+    );
+
+    error = pksav_gen2_free_save(&saved_gen2_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    error = pksav_gen2_free_save(&gen2_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    if(delete_file(tmp_save_filepath))
+    {
+        TEST_FAIL_MESSAGE("Failed to clean up temp file.");
+    }
+}
+
+static void gen2_save_to_batch_test(
+    const char* subdir,
+    const char* save_name
+)
+{
+    TEST_ASSERT_NOT_NULL(subdir);
+    TEST_ASSERT_NOT_NULL(save_name);
+
+    char original_filepath[256] = {0};
+    char existing_filepath[256] = {0};
+    char new_filepath[256] = {0};
+    struct pksav_gen2_save gen2_save = EMPTY_GEN2_SAVE;
+    struct pksav_gen2_save saved_gen2_save = EMPTY_GEN2_SAVE;
+    enum pksav_error error = PKSAV_ERROR_NONE;
+
+    char* pksav_test_saves = getenv("PKSAV_TEST_SAVES");
+    if(!pksav_test_saves)
+    {
+        TEST_FAIL_MESSAGE("Failed to get test save directory.");
+    }
+
+    snprintf(
+        original_filepath, sizeof(original_filepath),
+        "%s%s%s%s%s",
+        pksav_test_saves, FS_SEPARATOR, subdir, FS_SEPARATOR, save_name
+    );
+    snprintf(
+        existing_filepath, sizeof(existing_filepath),
+        "%s%spksav_%d_batch_existing_%s",
+        get_tmp_dir(), FS_SEPARATOR, get_pid(), save_name
+    );
+    snprintf(
+        new_filepath, sizeof(new_filepath),
+        "%s%spksav_%d_batch_new_%s",
+        get_tmp_dir(), FS_SEPARATOR, get_pid(), save_name
+    );
+
+    error = pksav_gen2_load_save_from_file(
+                original_filepath,
+                &gen2_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    uint8_t original_first_char = gen2_save.trainer_info.p_name[0];
+
+    error = pksav_gen2_save_save(
+                existing_filepath,
+                &gen2_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    struct pksav_save_batch batch;
+    error = pksav_save_batch_init(&batch);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    // The last save added to a destination is the one that ends up there.
+    gen2_save.trainer_info.p_name[0] = 0x80;
+    error = pksav_gen2_save_save_to_batch(existing_filepath, &gen2_save, &batch);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    gen2_save.trainer_info.p_name[0] = 0x81;
+    error = pksav_gen2_save_save_to_batch(new_filepath, &gen2_save, &batch);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    gen2_save.trainer_info.p_name[0] = 0x82;
+    error = pksav_gen2_save_save_to_batch(existing_filepath, &gen2_save, &batch);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    // Nothing is moved into place until the batch is committed.
+    error = pksav_gen2_load_save_from_file(
+                existing_filepath,
+                &saved_gen2_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL(original_first_char, saved_gen2_save.trainer_info.p_name[0]);
+    error = pksav_gen2_free_save(&saved_gen2_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    error = pksav_gen2_load_save_from_file(
+                new_filepath,
+                &saved_gen2_save
+            );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_FILE_IO, error);
+
+    error = pksav_save_batch_commit(&batch);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    error = pksav_gen2_load_save_from_file(
+                existing_filepath,
+                &saved_gen2_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL(0x82, saved_gen2_save.trainer_info.p_name[0]);
+    error = pksav_gen2_free_save(&saved_gen2_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    error = pksav_gen2_load_save_from_file(
+                new_filepath,
+                &saved_gen2_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL(0x81, saved_gen2_save.trainer_info.p_name[0]);
+    error = pksav_gen2_free_save(&saved_gen2_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    // Freeing a batch discards anything that wasn't committed.
+    gen2_save.trainer_info.p_name[0] = 0x83;
+    error = pksav_gen2_save_save_to_batch(existing_filepath, &gen2_save, &batch);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    error = pksav_save_batch_free(&batch);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    error = pksav_gen2_load_save_from_file(
+                existing_filepath,
+                &saved_gen2_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL(0x82, saved_gen2_save.trainer_info.p_name[0]);
+
+    error = pksav_gen2_free_save(&saved_gen2_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    error = pksav_gen2_free_save(&gen2_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    if(delete_file(existing_filepath) || delete_file(new_filepath))
+    {
+        TEST_FAIL_MESSAGE("Failed to clean up temp file.");
+    }
+}
+
+static void gen2_peek_test(
+    const char* subdir,
+    const char* save_name,
+    enum pksav_gen2_save_type expected_save_type
+)
+{
+    TEST_ASSERT_NOT_NULL(subdir);
+    TEST_ASSERT_NOT_NULL(save_name);
+
+    char filepath[256] = {0};
+    struct pksav_gen2_save gen2_save = EMPTY_GEN2_SAVE;
+    enum pksav_error error = PKSAV_ERROR_NONE;
+
+    char* pksav_test_saves = getenv("PKSAV_TEST_SAVES");
+    if(!pksav_test_saves)
+    {
+        TEST_FAIL_MESSAGE("Failed to get test save directory.");
+    }
+
+    snprintf(
+        filepath, sizeof(filepath),
+        "%s%s%s%s%s",
+        pksav_test_saves, FS_SEPARATOR, subdir, FS_SEPARATOR, save_name
+    );
+
+    struct pksav_gen2_save_peek peek;
+    error = pksav_gen2_peek_save_from_file(
+                filepath,
+                &peek
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    // Everything peeked should match a full load.
+    error = pksav_gen2_load_save_from_file(
+                filepath,
+                &gen2_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    TEST_ASSERT_EQUAL(expected_save_type, peek.save_type);
+    TEST_ASSERT_EQUAL_MEMORY(
+        gen2_save.trainer_info.p_name,
+        peek.trainer_name,
+        sizeof(peek.trainer_name)
+    );
+    TEST_ASSERT_EQUAL(*gen2_save.trainer_info.p_id, peek.trainer_id);
+    TEST_ASSERT_EQUAL_MEMORY(
+        gen2_save.save_time.p_time_played,
+        &peek.time_played,
+        sizeof(peek.time_played)
+    );
+
+    const struct pksav_gen2_pokemon_party* p_party = gen2_save.pokemon_storage.p_party;
+    TEST_ASSERT_EQUAL(p_party->count, peek.party_count);
+    TEST_ASSERT_EQUAL_MEMORY(
+        p_party->species,
+        peek.party_species,
+        peek.party_count
+    );
+
+    error = pksav_gen2_free_save(&gen2_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    // A buffer that isn't a save should be rejected. A zeroed buffer has
+    // valid checksums, so fill it with something else.
+    uint8_t invalid_buffer[PKSAV_GEN2_SAVE_SIZE];
+    memset(invalid_buffer, 0xFF, sizeof(invalid_buffer));
+
+    struct pksav_io memory_io;
+    error = pksav_io_init_memory(
+                invalid_buffer,
+                sizeof(invalid_buffer),
+                &memory_io
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    error = pksav_gen2_peek_save_from_io(
+                &memory_io,
+                &peek
+            );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_INVALID_SAVE, error);
+}
+
+#define GEN2_BULK_NUM_SAVES (2)
+#define GEN2_BULK_NUM_FILEPATHS (3 * (GEN2_BULK_NUM_SAVES + 1))
+
+struct gen2_bulk_result
+{
+    size_t num_calls;
+    enum pksav_error error;
+    enum pksav_gen2_save_type save_type;
+    uint8_t trainer_name[PKSAV_GEN2_TRAINER_NAME_LENGTH];
+};
+
+static void gen2_bulk_callback(
+    size_t filepath_index,
+    enum pksav_error error,
+    struct pksav_gen2_save* p_gen2_save,
+    void* p_user_data
+)
+{
+    TEST_ASSERT_NOT_NULL(p_user_data);
+    TEST_ASSERT_TRUE(filepath_index < GEN2_BULK_NUM_FILEPATHS);
+    TEST_ASSERT_EQUAL(!error, (p_gen2_save != NULL));
+
+    struct gen2_bulk_result* p_result = &((struct gen2_bulk_result*)p_user_data)[filepath_index];
+    ++p_result->num_calls;
+    p_result->error = error;
+    if(p_gen2_save)
+    {
+        p_result->save_type = p_gen2_save->save_type;
+        memcpy(
+            p_result->trainer_name,
+            p_gen2_save->trainer_info.p_name,
+            sizeof(p_result->trainer_name)
+        );
+    }
+}
+
+static void gen2_bulk_load_test()
+{
+    static const char* SAVE_FILES[GEN2_BULK_NUM_SAVES][2] =
+    {
+        {"gold_silver", "pokemon_gold.sav"},
+        {"crystal", "pokemon_crystal.sav"}
+    };
+    static const enum pksav_bulk_backend BACKENDS[] =
+    {
+        PKSAV_BULK_BACKEND_AUTO,
+        PKSAV_BULK_BACKEND_IO_URING,
+        PKSAV_BULK_BACKEND_THREADS,
+        PKSAV_BULK_BACKEND_SERIAL
+    };
+
+    char* pksav_test_saves = getenv("PKSAV_TEST_SAVES");
+    if(!pksav_test_saves)
+    {
+        TEST_FAIL_MESSAGE("Failed to get test save directory.");
+    }
+
+    // Every save plus a missing file, several times over, so there are
+    // more files than the queue depth.
+    char filepaths[GEN2_BULK_NUM_SAVES + 1][256];
+    struct gen2_bulk_result expected_results[GEN2_BULK_NUM_SAVES + 1];
+    memset(filepaths, 0, sizeof(filepaths));
+    memset(expected_results, 0, sizeof(expected_results));
+
+    enum pksav_error error = PKSAV_ERROR_NONE;
+    for(size_t save_index = 0; save_index < GEN2_BULK_NUM_SAVES; ++save_index)
+    {
+        snprintf(
+            filepaths[save_index], sizeof(filepaths[save_index]),
+            "%s%s%s%s%s",
+            pksav_test_saves, FS_SEPARATOR,
+            SAVE_FILES[save_index][0], FS_SEPARATOR,
+            SAVE_FILES[save_index][1]
+        );
+
+        struct pksav_gen2_save gen2_save;
+        error = pksav_gen2_load_save_from_file(
+                    filepaths[save_index],
+                    &gen2_save
+                );
+        PKSAV_TEST_ASSERT_SUCCESS(error);
+
+        expected_results[save_index].num_calls = 1;
+        expected_results[save_index].save_type = gen2_save.save_type;
+        memcpy(
+            expected_results[save_index].trainer_name,
+            gen2_save.trainer_info.p_name,
+            sizeof(expected_results[save_index].trainer_name)
+        );
+
+        error = pksav_gen2_free_save(&gen2_save);
+        PKSAV_TEST_ASSERT_SUCCESS(error);
+    }
+    snprintf(
+        filepaths[GEN2_BULK_NUM_SAVES], sizeof(filepaths[GEN2_BULK_NUM_SAVES]),
+        "%s%spksav_%d_bulk_load_missing",
+        get_tmp_dir(), FS_SEPARATOR, get_pid()
+    );
+    expected_results[GEN2_BULK_NUM_SAVES].num_calls = 1;
+    expected_results[GEN2_BULK_NUM_SAVES].error = PKSAV_ERROR_FILE_IO;
+
+    const char* p_filepaths[GEN2_BULK_NUM_FILEPATHS] = {NULL};
+    for(size_t filepath_index = 0;
+        filepath_index < GEN2_BULK_NUM_FILEPATHS;
+        ++filepath_index)
+    {
+        p_filepaths[filepath_index] = filepaths[filepath_index % (GEN2_BULK_NUM_SAVES + 1)];
+    }
+
+    for(size_t backend_index = 0;
+        backend_index < (sizeof(BACKENDS) / sizeof(BACKENDS[0]));
+        ++backend_index)
+    {
+        struct pksav_bulk_load_options options =
+        {
+            .queue_depth = 2,
+            .backend = BACKENDS[backend_index]
+        };
+        struct gen2_bulk_result results[GEN2_BULK_NUM_FILEPATHS];
+        memset(results, 0, sizeof(results));
+
+        error = pksav_gen2_bulk_load_saves(
+                    p_filepaths,
+                    GEN2_BULK_NUM_FILEPATHS,
+                    &options,
+                    gen2_bulk_callback,
+                    results
+                );
+        if((BACKENDS[backend_index] == PKSAV_BULK_BACKEND_IO_URING) &&
+           (error == PKSAV_ERROR_FILE_IO))
+        {
+            // This kernel doesn't support io_uring.
+            continue;
+        }
+        PKSAV_TEST_ASSERT_SUCCESS(error);
+
+        for(size_t filepath_index = 0;
+            filepath_index < GEN2_BULK_NUM_FILEPATHS;
+            ++filepath_index)
+        {
+            const struct gen2_bulk_result* p_expected_result =
+                &expected_results[filepath_index % (GEN2_BULK_NUM_SAVES + 1)];
+
+            TEST_ASSERT_EQUAL_MEMORY(
+                p_expected_result,
+                &results[filepath_index],
+                sizeof(*p_expected_result)
+            );
+        }
+    }
+}
+
 static void pksav_buffer_is_gold_save_test()
 {
     pksav_gen2_get_buffer_save_type_test(
@@ -717,6 +1428,47 @@ static void gold_save_from_file_test()
     );
 }
 
+static void gold_save_changes_test()
+{
+    gen2_save_changes_test(
+        "gold_silver",
+        "pokemon_gold.sav"
+    );
+}
+
+static void gold_save_async_test()
+{
+    gen2_save_async_test(
+        "gold_silver",
+        "pokemon_gold.sav"
+    );
+}
+
+static void gold_save_to_batch_test()
+{
+    gen2_save_to_batch_test(
+        "gold_silver",
+        "pokemon_gold.sav"
+    );
+}
+
+static void gold_peek_test()
+{
+    gen2_peek_test(
+        "gold_silver",
+        "pokemon_gold.sav",
+        PKSAV_GEN2_SAVE_TYPE_GS
+    );
+}
+
+static void gold_in_place_test()
+{
+    gen2_in_place_test(
+        "gold_silver",
+        "pokemon_gold.sav"
+    );
+}
+
 static void pksav_buffer_is_crystal_save_test()
 {
     pksav_gen2_get_buffer_save_type_test(
@@ -753,16 +1505,68 @@ static void crystal_save_from_file_test()
     );
 }
 
+static void crystal_save_changes_test()
+{
+    gen2_save_changes_test(
+        "crystal",
+        "pokemon_crystal.sav"
+    );
+}
+
+static void crystal_save_async_test()
+{
+    gen2_save_async_test(
+        "crystal",
+        "pokemon_crystal.sav"
+    );
+}
+
+static void crystal_save_to_batch_test()
+{
+    gen2_save_to_batch_test(
+        "crystal",
+        "pokemon_crystal.sav"
+    );
+}
+
+static void crystal_peek_test()
+{
+    gen2_peek_test(
+        "crystal",
+        "pokemon_crystal.sav",
+        PKSAV_GEN2_SAVE_TYPE_CRYSTAL
+    );
+}
+
+static void crystal_in_place_test()
+{
+    gen2_in_place_test(
+        "crystal",
+        "pokemon_crystal.sav"
+    );
+}
+
 PKSAV_TEST_MAIN(
     PKSAV_TEST(pksav_gen2_get_buffer_save_type_on_random_buffer_test)
+    PKSAV_TEST(gen2_bulk_load_test)
 
     PKSAV_TEST(pksav_buffer_is_gold_save_test)
     PKSAV_TEST(pksav_file_is_gold_save_test)
     PKSAV_TEST(gold_save_from_buffer_test)
     PKSAV_TEST(gold_save_from_file_test)
+    PKSAV_TEST(gold_in_place_test)
+    PKSAV_TEST(gold_save_changes_test)
+    PKSAV_TEST(gold_save_async_test)
+    PKSAV_TEST(gold_save_to_batch_test)
+    PKSAV_TEST(gold_peek_test)
 
     PKSAV_TEST(pksav_buffer_is_crystal_save_test)
     PKSAV_TEST(pksav_file_is_crystal_save_test)
     PKSAV_TEST(crystal_save_from_buffer_test)
     PKSAV_TEST(crystal_save_from_file_test)
+    PKSAV_TEST(crystal_in_place_test)
+    PKSAV_TEST(crystal_save_changes_test)
+    PKSAV_TEST(crystal_save_async_test)
+    PKSAV_TEST(crystal_save_to_batch_test)
+    PKSAV_TEST(crystal_peek_test)
 )
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+/*
+ * Saves only ever run the fastest kernel the CPU supports, so these check
+ * every supported kernel against the scalar kernel directly.
+ */
+
+#include "c_test_common.h"
+#include "test-utils.h"
+
+#include "gen3/checksum_kernels.h"
+#include "gen3/crypt.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#define SECTION_SIZE_WORDS (4096/4)
+
+// Starting a few words in moves the data against every vector alignment.
+#define MAX_START_WORD (8)
+
+#define NUM_RANDOM_SECTIONS (8)
+
+// A Pokémon's blocks are in one of this many orders, picked by its
+// personality.
+#define NUM_BLOCK_ORDERS (24)
+
+// Enough Pokémon for every block order to show up a few times, in every
+// position relative to how many a kernel crypts at once.
+#define NUM_POKEMON (NUM_BLOCK_ORDERS * 4)
+
+#define NUM_RANDOM_POKEMON_ARRAYS (8)
+
+#define STRBUFFER_LEN (64)
+
+static uint32_t section[SECTION_SIZE_WORDS + MAX_START_WORD];
+
+static struct pksav_gen3_pc_pokemon original_pokemon[NUM_POKEMON];
+static struct pksav_gen3_pc_pokemon scalar_pokemon[NUM_POKEMON];
+static struct pksav_gen3_pc_pokemon kernel_pokemon[NUM_POKEMON];
+
+static void check_checksum_kernel(
+    const struct pksav_gen3_checksum_kernel* p_kernel
+)
+{
+    TEST_ASSERT_NOT_NULL(p_kernel);
+
+    const struct pksav_gen3_checksum_kernel* p_scalar_kernel =
+        &pksav_gen3_checksum_kernels[0];
+
+    char message[STRBUFFER_LEN] = {0};
+
+    // Check every length so each tail path is hit.
+    for(size_t start_word = 0; start_word < MAX_START_WORD; ++start_word)
+    {
+        for(size_t num_words = 0; num_words <= SECTION_SIZE_WORDS; ++num_words)
+        {
+            uint32_t expected_sum = p_scalar_kernel->sum_words(
+                                        &section[start_word],
+                                        num_words
+                                    );
+            uint32_t sum = p_kernel->sum_words(
+                               &section[start_word],
+                               num_words
+                           );
+            if(sum != expected_sum)
+            {
+                snprintf(
+                    message, sizeof(message),
+                    "%s: %u words from word %u",
+                    p_kernel->p_name, (unsigned)num_words, (unsigned)start_word
+                );
+                TEST_ASSERT_EQUAL_HEX32_MESSAGE(expected_sum, sum, message);
+            }
+        }
+    }
+}
+
+static void checksum_kernel_test()
+{
+    for(size_t kernel_index = 1;
+        kernel_index < pksav_gen3_num_checksum_kernels;
+        ++kernel_index)
+    {
+        const struct pksav_gen3_checksum_kernel* p_kernel =
+            &pksav_gen3_checksum_kernels[kernel_index];
+        if(!p_kernel->is_supported())
+        {
+            continue;
+        }
+
+        // Every word at its maximum makes every lane overflow.
+        memset(section, 0xFF, sizeof(section));
+        check_checksum_kernel(p_kernel);
+
+        for(size_t run_index = 0; run_index < NUM_RANDOM_SECTIONS; ++run_index)
+        {
+            randomize_buffer((uint8_t*)section, sizeof(section));
+            check_checksum_kernel(p_kernel);
+        }
+    }
+}
+
+static void check_crypt_kernel(
+    const struct pksav_gen3_crypt_kernel* p_kernel
+)
+{
+    TEST_ASSERT_NOT_NULL(p_kernel);
+
+    const struct pksav_gen3_crypt_kernel* p_scalar_kernel =
+        &pksav_gen3_crypt_kernels[0];
+
+    char message[STRBUFFER_LEN] = {0};
+
+    // Check every array length so each tail path is hit.
+    for(size_t num_pokemon = 0; num_pokemon <= NUM_POKEMON; ++num_pokemon)
+    {
+        memcpy(scalar_pokemon, original_pokemon, sizeof(original_pokemon));
+        memcpy(kernel_pokemon, original_pokemon, sizeof(original_pokemon));
+
+        for(int should_encrypt = 0; should_encrypt <= 1; ++should_encrypt)
+        {
+            p_scalar_kernel->crypt_pokemon(scalar_pokemon, num_pokemon, (bool)should_encrypt);
+            p_kernel->crypt_pokemon(kernel_pokemon, num_pokemon, (bool)should_encrypt);
+
+            snprintf(
+                message, sizeof(message),
+                "%s: %s %u Pokémon",
+                p_kernel->p_name,
+                should_encrypt ? "encrypting" : "decrypting",
+                (unsigned)num_pokemon
+            );
+            TEST_ASSERT_EQUAL_MEMORY_MESSAGE(
+                scalar_pokemon,
+                kernel_pokemon,
+                sizeof(scalar_pokemon),
+                message
+            );
+        }
+
+        // Decrypting and encrypting should give back the original Pokémon,
+        // and nothing past the end of the array should be touched.
+        TEST_ASSERT_EQUAL_MEMORY(
+            original_pokemon,
+            kernel_pokemon,
+            sizeof(original_pokemon)
+        );
+    }
+}
+
+static void crypt_kernel_test()
+{
+    for(size_t kernel_index = 1;
+        kernel_index < pksav_gen3_num_crypt_kernels;
+        ++kernel_index)
+    {
+        const struct pksav_gen3_crypt_kernel* p_kernel =
+            &pksav_gen3_crypt_kernels[kernel_index];
+        if(!p_kernel->is_supported())
+        {
+            continue;
+        }
+
+        for(size_t run_index = 0; run_index < NUM_RANDOM_POKEMON_ARRAYS; ++run_index)
+        {
+            randomize_buffer((uint8_t*)original_pokemon, sizeof(original_pokemon));
+
+            // Keep the rest of each personality random, but cycle through
+            // every block order.
+            for(size_t pokemon_index = 0; pokemon_index < NUM_POKEMON; ++pokemon_index)
+            {
+                uint32_t personality = original_pokemon[pokemon_index].personality;
+                original_pokemon[pokemon_index].personality =
+                    ((personality % (UINT32_MAX / NUM_BLOCK_ORDERS)) * NUM_BLOCK_ORDERS)
+                  + (uint32_t)(pokemon_index % NUM_BLOCK_ORDERS);
+            }
+
+            check_crypt_kernel(p_kernel);
+        }
+    }
+}
+
+PKSAV_TEST_MAIN(
+    PKSAV_TEST(checksum_kernel_test)
+    PKSAV_TEST(crypt_kernel_test)
+)
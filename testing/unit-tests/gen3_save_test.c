@@ -8,6 +8,7 @@
 #include "c_test_common.h"
 #include "test-utils.h"
 
+#include "gen3/checksum.h"
 #include "gen3/save_internal.h"
 #include "util/fs.h"
 
@@ -461,12 +462,31 @@ static void gen3_save_test(
     // is not guaranteed to be set for some reason, compare each part.
     //
 
+    const struct pksav_gen3_pokemon_party party_before_save = *p_gen3_save->pokemon_storage.p_party;
+    const union pksav_gen3_item_bag item_bag_before_save = *p_gen3_save->item_storage.p_bag;
+    const uint32_t money_before_save = *p_gen3_save->player_info.p_money;
+    const uint16_t casino_coins_before_save = *p_gen3_save->misc_fields.p_casino_coins;
+
     error = pksav_gen3_save_save(
                 tmp_save_filepath,
                 p_gen3_save
             );
     PKSAV_TEST_ASSERT_SUCCESS(error);
 
+    // Saving shouldn't touch the decrypted state.
+    TEST_ASSERT_EQUAL_MEMORY(
+        &party_before_save,
+        p_gen3_save->pokemon_storage.p_party,
+        sizeof(party_before_save)
+    );
+    TEST_ASSERT_EQUAL_MEMORY(
+        &item_bag_before_save,
+        p_gen3_save->item_storage.p_bag,
+        sizeof(item_bag_before_save)
+    );
+    TEST_ASSERT_EQUAL(money_before_save, *p_gen3_save->player_info.p_money);
+    TEST_ASSERT_EQUAL(casino_coins_before_save, *p_gen3_save->misc_fields.p_casino_coins);
+
     struct pksav_gen3_save tmp_gen3_save = EMPTY_GEN3_SAVE;
     error = pksav_gen3_load_save_from_file(
                 tmp_save_filepath,
@@ -487,6 +507,35 @@ static void gen3_save_test(
         TEST_FAIL_MESSAGE("Failed to clean up temp file.");
     }
 
+    // Saving to a buffer should give the same result.
+    struct pksav_gen3_save_internal* p_internal = p_gen3_save->p_internal;
+    size_t tmp_save_buffer_len = p_internal->save_len;
+    uint8_t* p_tmp_save_buffer = malloc(tmp_save_buffer_len);
+    TEST_ASSERT_NOT_NULL(p_tmp_save_buffer);
+
+    error = pksav_gen3_save_save_to_buffer(
+                p_gen3_save,
+                p_tmp_save_buffer,
+                tmp_save_buffer_len
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    error = pksav_gen3_load_save_from_buffer(
+                p_tmp_save_buffer,
+                tmp_save_buffer_len,
+                &tmp_gen3_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    compare_gen3_saves(
+        p_gen3_save,
+        &tmp_gen3_save
+    );
+
+    error = pksav_gen3_free_save(&tmp_gen3_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    free(p_tmp_save_buffer);
+
     //
     // Free the save and make sure all fields are set to NULL or default.
     //
@@ -620,6 +669,255 @@ static void gen3_save_from_file_test(
     );
 }
 
+static void gen3_lazy_pc_test(
+    const char* subdir,
+    const char* save_name
+)
+{
+    TEST_ASSERT_NOT_NULL(subdir);
+    TEST_ASSERT_NOT_NULL(save_name);
+
+    char original_filepath[256] = {0};
+    struct pksav_gen3_save eager_gen3_save = EMPTY_GEN3_SAVE;
+    struct pksav_gen3_save lazy_gen3_save = EMPTY_GEN3_SAVE;
+    enum pksav_error error = PKSAV_ERROR_NONE;
+
+    char* pksav_test_saves = getenv("PKSAV_TEST_SAVES");
+    if(!pksav_test_saves)
+    {
+        TEST_FAIL_MESSAGE("Failed to get test save directory.");
+    }
+
+    snprintf(
+        original_filepath, sizeof(original_filepath),
+        "%s%s%s%s%s",
+        pksav_test_saves, FS_SEPARATOR, subdir, FS_SEPARATOR, save_name
+    );
+
+    error = pksav_gen3_load_save_from_file(
+                original_filepath,
+                &eager_gen3_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    error = pksav_gen3_load_save_from_file_with_flags(
+                original_filepath,
+                PKSAV_GEN3_LOAD_LAZY_PC,
+                &lazy_gen3_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    // Each box should decrypt to the same thing, no matter how often it's
+    // accessed.
+    for(uint8_t box_num = 0; box_num < PKSAV_GEN3_NUM_POKEMON_BOXES; ++box_num)
+    {
+        struct pksav_gen3_pokemon_box* p_box = NULL;
+
+        error = pksav_gen3_save_get_pc_box(&lazy_gen3_save, box_num, &p_box);
+        PKSAV_TEST_ASSERT_SUCCESS(error);
+        TEST_ASSERT_EQUAL_MEMORY(
+            &eager_gen3_save.pokemon_storage.p_pc->boxes[box_num],
+            p_box,
+            sizeof(*p_box)
+        );
+
+        error = pksav_gen3_save_get_pc_box(&lazy_gen3_save, box_num, &p_box);
+        PKSAV_TEST_ASSERT_SUCCESS(error);
+        TEST_ASSERT_EQUAL_MEMORY(
+            &eager_gen3_save.pokemon_storage.p_pc->boxes[box_num],
+            p_box,
+            sizeof(*p_box)
+        );
+    }
+
+    struct pksav_gen3_pokemon_box* p_box = NULL;
+    error = pksav_gen3_save_get_pc_box(
+                &lazy_gen3_save,
+                PKSAV_GEN3_NUM_POKEMON_BOXES,
+                &p_box
+            );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_PARAM_OUT_OF_RANGE, error);
+
+    error = pksav_gen3_free_save(&lazy_gen3_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    error = pksav_gen3_free_save(&eager_gen3_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+}
+
+static void gen3_compact_test(
+    const char* subdir,
+    const char* save_name
+)
+{
+    TEST_ASSERT_NOT_NULL(subdir);
+    TEST_ASSERT_NOT_NULL(save_name);
+
+    char original_filepath[256] = {0};
+    struct pksav_gen3_save eager_gen3_save = EMPTY_GEN3_SAVE;
+    struct pksav_gen3_save compact_gen3_save = EMPTY_GEN3_SAVE;
+    enum pksav_error error = PKSAV_ERROR_NONE;
+
+    char* pksav_test_saves = getenv("PKSAV_TEST_SAVES");
+    if(!pksav_test_saves)
+    {
+        TEST_FAIL_MESSAGE("Failed to get test save directory.");
+    }
+
+    snprintf(
+        original_filepath, sizeof(original_filepath),
+        "%s%s%s%s%s",
+        pksav_test_saves, FS_SEPARATOR, subdir, FS_SEPARATOR, save_name
+    );
+
+    error = pksav_gen3_load_save_from_file(
+                original_filepath,
+                &eager_gen3_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    error = pksav_gen3_load_save_from_file_with_flags(
+                original_filepath,
+                PKSAV_GEN3_LOAD_COMPACT,
+                &compact_gen3_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    // The PC shouldn't be consolidated until it's accessed.
+    TEST_ASSERT_NULL(compact_gen3_save.pokemon_storage.p_pc);
+
+    // Accessing a box only decrypts that box.
+    struct pksav_gen3_pokemon_box* p_box = NULL;
+    error = pksav_gen3_save_get_pc_box(&compact_gen3_save, 1, &p_box);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_NULL(compact_gen3_save.pokemon_storage.p_pc);
+    TEST_ASSERT_EQUAL_MEMORY(
+        &eager_gen3_save.pokemon_storage.p_pc->boxes[1],
+        p_box,
+        sizeof(*p_box)
+    );
+
+    // Changes to a box in its own buffer should be saved.
+    p_box->entries[0].personality ^= 0x5A5A5A5A;
+    eager_gen3_save.pokemon_storage.p_pc->boxes[1].entries[0].personality ^= 0x5A5A5A5A;
+
+    struct pksav_gen3_save_internal* p_internal = compact_gen3_save.p_internal;
+    size_t save_buffer_len = p_internal->save_len;
+    uint8_t* p_save_buffer = malloc(save_buffer_len);
+    TEST_ASSERT_NOT_NULL(p_save_buffer);
+
+    error = pksav_gen3_save_save_to_buffer(
+                &compact_gen3_save,
+                p_save_buffer,
+                save_buffer_len
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    struct pksav_gen3_save saved_gen3_save = EMPTY_GEN3_SAVE;
+    error = pksav_gen3_load_save_from_buffer(
+                p_save_buffer,
+                save_buffer_len,
+                &saved_gen3_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL_MEMORY(
+        eager_gen3_save.pokemon_storage.p_pc,
+        saved_gen3_save.pokemon_storage.p_pc,
+        sizeof(struct pksav_gen3_pokemon_pc)
+    );
+
+    error = pksav_gen3_free_save(&saved_gen3_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    free(p_save_buffer);
+
+    // Getting the whole PC consolidates it, keeping the accessed box.
+
+    struct pksav_gen3_pokemon_pc* p_pc = NULL;
+    error = pksav_gen3_save_get_pc(&compact_gen3_save, &p_pc);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL_PTR(compact_gen3_save.pokemon_storage.p_pc, p_pc);
+    TEST_ASSERT_EQUAL_MEMORY(
+        eager_gen3_save.pokemon_storage.p_pc,
+        p_pc,
+        sizeof(*p_pc)
+    );
+
+    error = pksav_gen3_free_save(&compact_gen3_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    error = pksav_gen3_free_save(&eager_gen3_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+}
+
+static void gen3_pokemon_checksum_report_test(
+    const char* subdir,
+    const char* save_name
+)
+{
+    TEST_ASSERT_NOT_NULL(subdir);
+    TEST_ASSERT_NOT_NULL(save_name);
+
+    char original_filepath[256] = {0};
+    struct pksav_gen3_save verified_gen3_save = EMPTY_GEN3_SAVE;
+    struct pksav_gen3_save lazy_gen3_save = EMPTY_GEN3_SAVE;
+    enum pksav_error error = PKSAV_ERROR_NONE;
+
+    char* pksav_test_saves = getenv("PKSAV_TEST_SAVES");
+    if(!pksav_test_saves)
+    {
+        TEST_FAIL_MESSAGE("Failed to get test save directory.");
+    }
+
+    snprintf(
+        original_filepath, sizeof(original_filepath),
+        "%s%s%s%s%s",
+        pksav_test_saves, FS_SEPARATOR, subdir, FS_SEPARATOR, save_name
+    );
+
+    error = pksav_gen3_load_save_from_file_with_flags(
+                original_filepath,
+                PKSAV_GEN3_LOAD_VERIFY_POKEMON_CHECKSUMS,
+                &verified_gen3_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    error = pksav_gen3_load_save_from_file_with_flags(
+                original_filepath,
+                PKSAV_GEN3_LOAD_LAZY_PC,
+                &lazy_gen3_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    // The report made while loading should match one made afterwards from
+    // still-encrypted boxes.
+    struct pksav_gen3_pokemon_checksum_report verified_report;
+    struct pksav_gen3_pokemon_checksum_report lazy_report;
+    memset(&verified_report, 0, sizeof(verified_report));
+    memset(&lazy_report, 0, sizeof(lazy_report));
+
+    error = pksav_gen3_save_get_pokemon_checksum_report(
+                &verified_gen3_save,
+                &verified_report
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    error = pksav_gen3_save_get_pokemon_checksum_report(
+                &lazy_gen3_save,
+                &lazy_report
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    TEST_ASSERT_EQUAL(verified_report.party, lazy_report.party);
+    TEST_ASSERT_EQUAL_UINT32_ARRAY(
+        verified_report.pc_boxes,
+        lazy_report.pc_boxes,
+        PKSAV_GEN3_NUM_POKEMON_BOXES
+    );
+    TEST_ASSERT_EQUAL(verified_report.daycare, lazy_report.daycare);
+
+    error = pksav_gen3_free_save(&lazy_gen3_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    error = pksav_gen3_free_save(&verified_gen3_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+}
+
 static void convenience_macro_test()
 {
     struct pksav_gen3_pc_pokemon pc_pokemon;
@@ -661,92 +959,1584 @@ static void convenience_macro_test()
     TEST_ASSERT_EQUAL(PKSAV_GEN3_CONTEST_RIBBON_SUPER,  tough_contest_level);
 }
 
-static void pksav_buffer_is_ruby_save_test()
+static void crypt_pokemon_array_test()
 {
-    pksav_gen3_get_buffer_save_type_test(
-        "ruby_sapphire",
-        "pokemon_ruby.sav",
-        PKSAV_GEN3_SAVE_TYPE_RS
-    );
-}
+    enum pksav_error error = PKSAV_ERROR_NONE;
 
-static void pksav_file_is_ruby_save_test()
-{
-    pksav_gen3_get_file_save_type_test(
-        "ruby_sapphire",
-        "pokemon_ruby.sav",
-        PKSAV_GEN3_SAVE_TYPE_RS
-    );
-}
+    struct pksav_gen3_pokemon_box pokemon_box;
+    struct pksav_gen3_pokemon_box pokemon_box_copy;
 
-static void ruby_save_from_buffer_test()
-{
-    gen3_save_from_buffer_test(
-        "ruby_sapphire",
-        "pokemon_ruby.sav",
-        PKSAV_GEN3_SAVE_TYPE_RS
-    );
-}
+    randomize_buffer((uint8_t*)&pokemon_box, sizeof(pokemon_box));
+    memcpy(&pokemon_box_copy, &pokemon_box, sizeof(pokemon_box));
 
-static void ruby_save_from_file_test()
-{
-    gen3_save_from_file_test(
-        "ruby_sapphire",
-        "pokemon_ruby.sav",
-        PKSAV_GEN3_SAVE_TYPE_RS
-    );
-}
+    // Encrypting and decrypting should give back the original Pokémon.
+    error = pksav_gen3_crypt_pokemon_array(
+                pokemon_box.entries,
+                PKSAV_GEN3_BOX_NUM_POKEMON,
+                true // should_encrypt
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_TRUE(memcmp(&pokemon_box, &pokemon_box_copy, sizeof(pokemon_box)));
 
-static void pksav_buffer_is_emerald_save_test()
-{
-    pksav_gen3_get_buffer_save_type_test(
-        "emerald",
-        "pokemon_emerald.sav",
-        PKSAV_GEN3_SAVE_TYPE_EMERALD
-    );
-}
+    error = pksav_gen3_crypt_pokemon_array(
+                pokemon_box.entries,
+                PKSAV_GEN3_BOX_NUM_POKEMON,
+                false // should_encrypt
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL_MEMORY(&pokemon_box_copy, &pokemon_box, sizeof(pokemon_box));
 
-static void pksav_file_is_emerald_save_test()
-{
-    pksav_gen3_get_file_save_type_test(
-        "emerald",
-        "pokemon_emerald.sav",
-        PKSAV_GEN3_SAVE_TYPE_EMERALD
-    );
-}
+    // A personality of 8 stores the blocks in the order attacks, effort,
+    // growth, misc.
+    struct pksav_gen3_pc_pokemon pc_pokemon;
+    memset(&pc_pokemon, 0, sizeof(pc_pokemon));
+    pc_pokemon.personality = 8;
+    pc_pokemon.ot_id.id = 0x12345678;
 
-static void emerald_save_from_buffer_test()
-{
-    gen3_save_from_buffer_test(
-        "emerald",
-        "pokemon_emerald.sav",
-        PKSAV_GEN3_SAVE_TYPE_EMERALD
-    );
-}
+    uint8_t* p_blocks8 = (uint8_t*)&pc_pokemon.blocks;
+    for(size_t index = 0; index < sizeof(pc_pokemon.blocks); ++index)
+    {
+        p_blocks8[index] = (uint8_t)index;
+    }
+    struct pksav_gen3_pokemon_blocks blocks_copy = pc_pokemon.blocks;
 
-static void emerald_save_from_file_test()
-{
-    gen3_save_from_file_test(
-        "emerald",
-        "pokemon_emerald.sav",
-        PKSAV_GEN3_SAVE_TYPE_EMERALD
-    );
-}
+    error = pksav_gen3_crypt_pokemon_array(
+                &pc_pokemon,
+                1,
+                true // should_encrypt
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
 
-static void pksav_buffer_is_firered_save_test()
-{
-    pksav_gen3_get_buffer_save_type_test(
-        "firered_leafgreen",
-        "pokemon_firered.sav",
-        PKSAV_GEN3_SAVE_TYPE_FRLG
-    );
+    const uint32_t security_key = 0x12345678 ^ 8;
+    uint32_t expected_words[12];
+    memcpy(&expected_words[0], &blocks_copy.attacks, 12);
+    memcpy(&expected_words[3], &blocks_copy.effort,  12);
+    memcpy(&expected_words[6], &blocks_copy.growth,  12);
+    memcpy(&expected_words[9], &blocks_copy.misc,    12);
+    for(size_t index = 0; index < 12; ++index)
+    {
+        expected_words[index] ^= security_key;
+    }
+    TEST_ASSERT_EQUAL_MEMORY(expected_words, &pc_pokemon.blocks, sizeof(expected_words));
 }
 
-static void pksav_file_is_firered_save_test()
+static void verify_pokemon_checksums_test()
 {
-    pksav_gen3_get_file_save_type_test(
-        "firered_leafgreen",
-        "pokemon_firered.sav",
+    enum pksav_error error = PKSAV_ERROR_NONE;
+
+    struct pksav_gen3_pokemon_box pokemon_box;
+    randomize_buffer((uint8_t*)&pokemon_box, sizeof(pokemon_box));
+
+    // Only give every third Pokémon a valid checksum.
+    uint8_t expected_bad_checksums[(PKSAV_GEN3_BOX_NUM_POKEMON + 7) / 8] = {0};
+    for(size_t pokemon_index = 0;
+        pokemon_index < PKSAV_GEN3_BOX_NUM_POKEMON;
+        ++pokemon_index)
+    {
+        struct pksav_gen3_pc_pokemon* p_pokemon = &pokemon_box.entries[pokemon_index];
+        uint16_t checksum = pksav_gen3_get_pokemon_checksum(p_pokemon);
+
+        if((pokemon_index % 3) == 0)
+        {
+            p_pokemon->checksum = checksum;
+        }
+        else
+        {
+            p_pokemon->checksum = (uint16_t)(checksum + 1);
+            expected_bad_checksums[pokemon_index / 8] |= (uint8_t)(1 << (pokemon_index % 8));
+        }
+    }
+
+    uint8_t bad_checksums[sizeof(expected_bad_checksums)] = {0};
+    error = pksav_gen3_verify_pokemon_checksums(
+                pokemon_box.entries,
+                PKSAV_GEN3_BOX_NUM_POKEMON,
+                false, // are_encrypted
+                bad_checksums
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected_bad_checksums, bad_checksums, sizeof(bad_checksums));
+
+    // Encrypted Pokémon should give the same result.
+    error = pksav_gen3_crypt_pokemon_array(
+                pokemon_box.entries,
+                PKSAV_GEN3_BOX_NUM_POKEMON,
+                true // should_encrypt
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    memset(bad_checksums, 0xFF, sizeof(bad_checksums));
+    error = pksav_gen3_verify_pokemon_checksums(
+                pokemon_box.entries,
+                PKSAV_GEN3_BOX_NUM_POKEMON,
+                true, // are_encrypted
+                bad_checksums
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected_bad_checksums, bad_checksums, sizeof(bad_checksums));
+}
+
+static void gen3_in_place_test(
+    const char* subdir,
+    const char* save_name
+)
+{
+    TEST_ASSERT_NOT_NULL(subdir);
+    TEST_ASSERT_NOT_NULL(save_name);
+
+    char original_filepath[256] = {0};
+    char tmp_save_filepath[256] = {0};
+    struct pksav_gen3_save in_place_gen3_save = EMPTY_GEN3_SAVE;
+    struct pksav_gen3_save committed_gen3_save = EMPTY_GEN3_SAVE;
+    enum pksav_error error = PKSAV_ERROR_NONE;
+
+    char* pksav_test_saves = getenv("PKSAV_TEST_SAVES");
+    if(!pksav_test_saves)
+    {
+        TEST_FAIL_MESSAGE("Failed to get test save directory.");
+    }
+
+    snprintf(
+        original_filepath, sizeof(original_filepath),
+        "%s%s%s%s%s",
+        pksav_test_saves, FS_SEPARATOR, subdir, FS_SEPARATOR, save_name
+    );
+    snprintf(
+        tmp_save_filepath, sizeof(tmp_save_filepath),
+        "%s%spksav_%d_in_place_%s",
+        get_tmp_dir(), FS_SEPARATOR, get_pid(), save_name
+    );
+
+    // Edit a copy, since the edits go straight to the file.
+    uint8_t* save_buffer = NULL;
+    size_t save_size = 0;
+    if(pksav_fs_read_file_to_buffer(original_filepath, &save_buffer, &save_size))
+    {
+        TEST_FAIL_MESSAGE("Failed to read save into buffer.");
+    }
+    if(pksav_fs_write_buffer_to_file(tmp_save_filepath, save_buffer, save_size))
+    {
+        TEST_FAIL_MESSAGE("Failed to write save copy.");
+    }
+
+    error = pksav_gen3_load_save_from_file_in_place(
+                tmp_save_filepath,
+                PKSAV_GEN3_LOAD_FLAGS_NONE,
+                &in_place_gen3_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    *in_place_gen3_save.player_info.p_money = pksav_littleendian32(123456);
+
+    // Saving anywhere else shouldn't touch the file until it's committed.
+    uint8_t* saved_buffer = malloc(save_size);
+    TEST_ASSERT_NOT_NULL(saved_buffer);
+    error = pksav_gen3_save_save_to_buffer(
+                &in_place_gen3_save,
+                saved_buffer,
+                save_size
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    uint8_t* file_buffer = NULL;
+    size_t file_size = 0;
+    if(pksav_fs_read_file_to_buffer(tmp_save_filepath, &file_buffer, &file_size))
+    {
+        TEST_FAIL_MESSAGE("Failed to read save copy.");
+    }
+    TEST_ASSERT_EQUAL(save_size, file_size);
+    TEST_ASSERT_EQUAL_MEMORY(save_buffer, file_buffer, save_size);
+    free(file_buffer);
+    free(save_buffer);
+
+    error = pksav_gen3_load_save_from_buffer(
+                saved_buffer,
+                save_size,
+                &committed_gen3_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL(
+        pksav_littleendian32(123456),
+        *committed_gen3_save.player_info.p_money
+    );
+    error = pksav_gen3_free_save(&committed_gen3_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    free(saved_buffer);
+
+    error = pksav_gen3_save_commit(&in_place_gen3_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    // The committed file should load normally, with the edit.
+    error = pksav_gen3_load_save_from_file(
+                tmp_save_filepath,
+                &committed_gen3_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL(
+        pksav_littleendian32(123456),
+        *committed_gen3_save.player_info.p_money
+    );
+    TEST_ASSERT_EQUAL_MEMORY(
+        in_place_gen3_save.pokemon_storage.p_party,
+        committed_gen3_save.pokemon_storage.p_party,
+        sizeof(struct pksav_gen3_pokemon_party)
+    );
+
+    // Only saves loaded in place can be committed.
+    error = pksav_gen3_save_commit(&committed_gen3_save);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_PARAM_OUT_OF_RANGE, error);
+
+    error = pksav_gen3_free_save(&committed_gen3_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    error = pksav_gen3_free_save(&in_place_gen3_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    if(delete_file(tmp_save_filepath))
+    {
+        TEST_FAIL_MESSAGE("Failed to clean up temp file.");
+    }
+}
+
+static void gen3_save_changes_test(
+    const char* subdir,
+    const char* save_name
+)
+{
+    TEST_ASSERT_NOT_NULL(subdir);
+    TEST_ASSERT_NOT_NULL(save_name);
+
+    char original_filepath[256] = {0};
+    char tmp_save_filepath[256] = {0};
+    struct pksav_gen3_save gen3_save = EMPTY_GEN3_SAVE;
+    struct pksav_gen3_save saved_gen3_save = EMPTY_GEN3_SAVE;
+    enum pksav_error error = PKSAV_ERROR_NONE;
+
+    char* pksav_test_saves = getenv("PKSAV_TEST_SAVES");
+    if(!pksav_test_saves)
+    {
+        TEST_FAIL_MESSAGE("Failed to get test save directory.");
+    }
+
+    snprintf(
+        original_filepath, sizeof(original_filepath),
+        "%s%s%s%s%s",
+        pksav_test_saves, FS_SEPARATOR, subdir, FS_SEPARATOR, save_name
+    );
+    snprintf(
+        tmp_save_filepath, sizeof(tmp_save_filepath),
+        "%s%spksav_%d_save_changes_%s",
+        get_tmp_dir(), FS_SEPARATOR, get_pid(), save_name
+    );
+
+    // Only the changes are written, so the file must already exist.
+    error = pksav_gen3_load_save_from_file(
+                original_filepath,
+                &gen3_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    error = pksav_gen3_save_save_changes(
+                tmp_save_filepath,
+                &gen3_save,
+                false // should_sync
+            );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_FILE_IO, error);
+
+    error = pksav_gen3_save_save(
+                tmp_save_filepath,
+                &gen3_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    error = pksav_gen3_free_save(&gen3_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    // Load the copy, so the save is saved over the file it was loaded from.
+    error = pksav_gen3_load_save_from_file(
+                tmp_save_filepath,
+                &gen3_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    *gen3_save.player_info.p_money = pksav_littleendian32(123456);
+
+    error = pksav_gen3_save_save_changes(
+                tmp_save_filepath,
+                &gen3_save,
+                true // should_sync
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    // The file should match the save exactly, even though only one slot
+    // was written.
+    uint8_t* p_file_buffer = NULL;
+    size_t file_size = 0;
+    if(pksav_fs_read_file_to_buffer(tmp_save_filepath, &p_file_buffer, &file_size))
+    {
+        TEST_FAIL_MESSAGE("Failed to read save into buffer.");
+    }
+
+    struct pksav_gen3_save_internal* p_internal = gen3_save.p_internal;
+    TEST_ASSERT_EQUAL(p_internal->save_len, file_size);
+    TEST_ASSERT_EQUAL_MEMORY(p_internal->p_raw_save, p_file_buffer, file_size);
+    free(p_file_buffer);
+
+    error = pksav_gen3_load_save_from_file(
+                tmp_save_filepath,
+                &saved_gen3_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL(
+        pksav_littleendian32(123456),
+        *saved_gen3_save.player_info.p_money
+    );
+    TEST_ASSERT_EQUAL_MEMORY(
+        gen3_save.pokemon_storage.p_party,
+        saved_gen3_save.pokemon_storage.p_party,
+        sizeof(struct pksav_gen3_pokemon_party)
+    );
+
+    error = pksav_gen3_free_save(&saved_gen3_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    error = pksav_gen3_free_save(&gen3_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    if(delete_file(tmp_save_filepath))
+    {
+        TEST_FAIL_MESSAGE("Failed to clean up temp file.");
+    }
+}
+
+#define GEN3_ASYNC_NUM_WRITES 8
+
+struct gen3_async_results
+{
+    size_t num_calls;
+    size_t num_errors;
+};
+
+// Every write here is to one file, so these are never called concurrently.
+static void gen3_async_callback(
+    enum pksav_error error,
+    void* p_user_data
+)
+{
+    TEST_ASSERT_NOT_NULL(p_user_data);
+
+    struct gen3_async_results* p_results = p_user_data;
+    ++p_results->num_calls;
+    if(error)
+    {
+        ++p_results->num_errors;
+    }
+}
+
+static void gen3_save_async_test(
+    const char* subdir,
+    const char* save_name
+)
+{
+    TEST_ASSERT_NOT_NULL(subdir);
+    TEST_ASSERT_NOT_NULL(save_name);
+
+    char original_filepath[256] = {0};
+    char tmp_save_filepath[256] = {0};
+    char bad_filepath[256] = {0};
+    struct pksav_gen3_save gen3_save = EMPTY_GEN3_SAVE;
+    struct pksav_gen3_save saved_gen3_save = EMPTY_GEN3_SAVE;
+    enum pksav_error error = PKSAV_ERROR_NONE;
+
+    char* pksav_test_saves = getenv("PKSAV_TEST_SAVES");
+    if(!pksav_test_saves)
+    {
+        TEST_FAIL_MESSAGE("Failed to get test save directory.");
+    }
+
+    snprintf(
+        original_filepath, sizeof(original_filepath),
+        "%s%s%s%s%s",
+        pksav_test_saves, FS_SEPARATOR, subdir, FS_SEPARATOR, save_name
+    );
+    snprintf(
+        tmp_save_filepath, sizeof(tmp_save_filepath),
+        "%s%spksav_%d_save_async_%s",
+        get_tmp_dir(), FS_SEPARATOR, get_pid(), save_name
+    );
+    snprintf(
+        bad_filepath, sizeof(bad_filepath),
+        "%s%spksav_%d_missing_dir%s%s",
+        get_tmp_dir(), FS_SEPARATOR, get_pid(), FS_SEPARATOR, save_name
+    );
+
+    error = pksav_gen3_load_save_from_file(
+                original_filepath,
+                &gen3_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    struct pksav_async_writer writer;
+    error = pksav_async_writer_init(2, &writer);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    // Edit the save between writes. Whichever writes are coalesced, the
+    // last edit must be what ends up in the file.
+    struct gen3_async_results results = {0, 0};
+    for(size_t write_index = 0; write_index < GEN3_ASYNC_NUM_WRITES; ++write_index)
+    {
+        gen3_save.player_info.p_name[0] = (uint8_t)(0x80 + write_index);
+
+        error = pksav_gen3_save_save_async(
+                    tmp_save_filepath,
+                    &gen3_save,
+                    &writer,
+                    gen3_async_callback,
+                    &results
+                );
+        PKSAV_TEST_ASSERT_SUCCESS(error);
+    }
+
+    // Failures are reported through the callback.
+    struct gen3_async_results bad_results = {0, 0};
+    error = pksav_gen3_save_save_async(
+                bad_filepath,
+                &gen3_save,
+                &writer,
+                gen3_async_callback,
+                &bad_results
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    error = pksav_async_writer_wait(&writer);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    size_t num_pending = 1;
+    error = pksav_async_writer_get_num_pending(&writer, &num_pending);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL(0, num_pending);
+
+    TEST_ASSERT_EQUAL(GEN3_ASYNC_NUM_WRITES, results.num_calls);
+    TEST_ASSERT_EQUAL(0, results.num_errors);
+    TEST_ASSERT_EQUAL(1, bad_results.num_calls);
+    TEST_ASSERT_EQUAL(1, bad_results.num_errors);
+
+    error = pksav_async_writer_free(&writer);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    error = pksav_gen3_load_save_from_file(
+                tmp_save_filepath,
+                &saved_gen3_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL(
+        0x80 + GEN3_ASYNC_NUM_WRITES - 1,
+        saved_gen3_save.player_info.p_name[0]
+    );
+
+    error = pksav_gen3_free_save(&saved_gen3_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    error = pksav_gen3_free_save(&gen3_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    if(delete_file(tmp_save_filepath))
+    {
+        TEST_FAIL_MESSAGE("Failed to clean up temp file.");
+    }
+}
+
+static void gen3_save_to_batch_test(
+    const char* subdir,
+    const char* save_name
+)
+{
+    TEST_ASSERT_NOT_NULL(subdir);
+    TEST_ASSERT_NOT_NULL(save_name);
+
+    char original_filepath[256] = {0};
+    char existing_filepath[256] = {0};
+    char new_filepath[256] = {0};
+    struct pksav_gen3_save gen3_save = EMPTY_GEN3_SAVE;
+    struct pksav_gen3_save saved_gen3_save = EMPTY_GEN3_SAVE;
+    enum pksav_error error = PKSAV_ERROR_NONE;
+
+    char* pksav_test_saves = getenv("PKSAV_TEST_SAVES");
+    if(!pksav_test_saves)
+    {
+        TEST_FAIL_MESSAGE("Failed to get test save directory.");
+    }
+
+    snprintf(
+        original_filepath, sizeof(original_filepath),
+        "%s%s%s%s%s",
+        pksav_test_saves, FS_SEPARATOR, subdir, FS_SEPARATOR, save_name
+    );
+    snprintf(
+        existing_filepath, sizeof(existing_filepath),
+        "%s%spksav_%d_batch_existing_%s",
+        get_tmp_dir(), FS_SEPARATOR, get_pid(), save_name
+    );
+    snprintf(
+        new_filepath, sizeof(new_filepath),
+        "%s%spksav_%d_batch_new_%s",
+        get_tmp_dir(), FS_SEPARATOR, get_pid(), save_name
+    );
+
+    error = pksav_gen3_load_save_from_file(
+                original_filepath,
+                &gen3_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    uint8_t original_first_char = gen3_save.player_info.p_name[0];
+
+    error = pksav_gen3_save_save(
+                existing_filepath,
+                &gen3_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    struct pksav_save_batch batch;
+    error = pksav_save_batch_init(&batch);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    // The last save added to a destination is the one that ends up there.
+    gen3_save.player_info.p_name[0] = 0x80;
+    error = pksav_gen3_save_save_to_batch(existing_filepath, &gen3_save, &batch);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    gen3_save.player_info.p_name[0] = 0x81;
+    error = pksav_gen3_save_save_to_batch(new_filepath, &gen3_save, &batch);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    gen3_save.player_info.p_name[0] = 0x82;
+    error = pksav_gen3_save_save_to_batch(existing_filepath, &gen3_save, &batch);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    // Nothing is moved into place until the batch is committed.
+    error = pksav_gen3_load_save_from_file(
+                existing_filepath,
+                &saved_gen3_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL(original_first_char, saved_gen3_save.player_info.p_name[0]);
+    error = pksav_gen3_free_save(&saved_gen3_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    error = pksav_gen3_load_save_from_file(
+                new_filepath,
+                &saved_gen3_save
+            );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_FILE_IO, error);
+
+    error = pksav_save_batch_commit(&batch);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    error = pksav_gen3_load_save_from_file(
+                existing_filepath,
+                &saved_gen3_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL(0x82, saved_gen3_save.player_info.p_name[0]);
+    error = pksav_gen3_free_save(&saved_gen3_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    error = pksav_gen3_load_save_from_file(
+                new_filepath,
+                &saved_gen3_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL(0x81, saved_gen3_save.player_info.p_name[0]);
+    error = pksav_gen3_free_save(&saved_gen3_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    // Freeing a batch discards anything that wasn't committed.
+    gen3_save.player_info.p_name[0] = 0x83;
+    error = pksav_gen3_save_save_to_batch(existing_filepath, &gen3_save, &batch);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    error = pksav_save_batch_free(&batch);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    error = pksav_gen3_load_save_from_file(
+                existing_filepath,
+                &saved_gen3_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL(0x82, saved_gen3_save.player_info.p_name[0]);
+
+    error = pksav_gen3_free_save(&saved_gen3_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    error = pksav_gen3_free_save(&gen3_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    if(delete_file(existing_filepath) || delete_file(new_filepath))
+    {
+        TEST_FAIL_MESSAGE("Failed to clean up temp file.");
+    }
+}
+
+static void gen3_io_test(
+    const char* subdir,
+    const char* save_name,
+    enum pksav_gen3_save_type expected_save_type
+)
+{
+    TEST_ASSERT_NOT_NULL(subdir);
+    TEST_ASSERT_NOT_NULL(save_name);
+
+    char original_filepath[256] = {0};
+    struct pksav_gen3_save file_gen3_save = EMPTY_GEN3_SAVE;
+    struct pksav_gen3_save io_gen3_save = EMPTY_GEN3_SAVE;
+    enum pksav_error error = PKSAV_ERROR_NONE;
+
+    char* pksav_test_saves = getenv("PKSAV_TEST_SAVES");
+    if(!pksav_test_saves)
+    {
+        TEST_FAIL_MESSAGE("Failed to get test save directory.");
+    }
+
+    snprintf(
+        original_filepath, sizeof(original_filepath),
+        "%s%s%s%s%s",
+        pksav_test_saves, FS_SEPARATOR, subdir, FS_SEPARATOR, save_name
+    );
+
+    error = pksav_gen3_load_save_from_file(
+                original_filepath,
+                &file_gen3_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    FILE* p_file = fopen(original_filepath, "rb");
+    TEST_ASSERT_NOT_NULL(p_file);
+
+    struct pksav_io file_io;
+    error = pksav_io_init_file(p_file, &file_io);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    enum pksav_gen3_save_type save_type = PKSAV_GEN3_SAVE_TYPE_NONE;
+    error = pksav_gen3_get_io_save_type(
+                &file_io,
+                &save_type
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL(expected_save_type, save_type);
+
+    error = pksav_gen3_load_save_from_io(
+                &file_io,
+                PKSAV_GEN3_LOAD_FLAGS_NONE,
+                &io_gen3_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL(0, fclose(p_file));
+
+    TEST_ASSERT_EQUAL(expected_save_type, io_gen3_save.save_type);
+    TEST_ASSERT_EQUAL_MEMORY(
+        file_gen3_save.pokemon_storage.p_party,
+        io_gen3_save.pokemon_storage.p_party,
+        sizeof(struct pksav_gen3_pokemon_party)
+    );
+    TEST_ASSERT_EQUAL_MEMORY(
+        file_gen3_save.pokemon_storage.p_pc,
+        io_gen3_save.pokemon_storage.p_pc,
+        sizeof(struct pksav_gen3_pokemon_pc)
+    );
+
+    // Saving through a memory backend should give the same save as saving
+    // to a buffer.
+    struct pksav_gen3_save_internal* p_internal = file_gen3_save.p_internal;
+    size_t save_buffer_len = p_internal->save_len;
+    uint8_t* p_buffer_save = malloc(save_buffer_len);
+    uint8_t* p_io_save = malloc(save_buffer_len);
+    TEST_ASSERT_NOT_NULL(p_buffer_save);
+    TEST_ASSERT_NOT_NULL(p_io_save);
+
+    error = pksav_gen3_save_save_to_buffer(
+                &file_gen3_save,
+                p_buffer_save,
+                save_buffer_len
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    struct pksav_io memory_io;
+    error = pksav_io_init_memory(
+                p_io_save,
+                save_buffer_len,
+                &memory_io
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    error = pksav_gen3_save_save_to_io(
+                &io_gen3_save,
+                &memory_io
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL_MEMORY(p_buffer_save, p_io_save, save_buffer_len);
+
+    free(p_io_save);
+    free(p_buffer_save);
+
+    error = pksav_gen3_free_save(&io_gen3_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    error = pksav_gen3_free_save(&file_gen3_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+}
+
+static void gen3_peek_test(
+    const char* subdir,
+    const char* save_name,
+    enum pksav_gen3_save_type expected_save_type
+)
+{
+    TEST_ASSERT_NOT_NULL(subdir);
+    TEST_ASSERT_NOT_NULL(save_name);
+
+    char filepath[256] = {0};
+    struct pksav_gen3_save gen3_save = EMPTY_GEN3_SAVE;
+    enum pksav_error error = PKSAV_ERROR_NONE;
+
+    char* pksav_test_saves = getenv("PKSAV_TEST_SAVES");
+    if(!pksav_test_saves)
+    {
+        TEST_FAIL_MESSAGE("Failed to get test save directory.");
+    }
+
+    snprintf(
+        filepath, sizeof(filepath),
+        "%s%s%s%s%s",
+        pksav_test_saves, FS_SEPARATOR, subdir, FS_SEPARATOR, save_name
+    );
+
+    struct pksav_gen3_save_peek peek;
+    error = pksav_gen3_peek_save_from_file(
+                filepath,
+                &peek
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    // Everything peeked should match a full load.
+    error = pksav_gen3_load_save_from_file(
+                filepath,
+                &gen3_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    TEST_ASSERT_EQUAL(expected_save_type, peek.save_type);
+    TEST_ASSERT_EQUAL_MEMORY(
+        gen3_save.player_info.p_name,
+        peek.trainer_name,
+        sizeof(peek.trainer_name)
+    );
+    TEST_ASSERT_EQUAL(gen3_save.player_info.p_id->id, peek.trainer_id.id);
+    TEST_ASSERT_EQUAL_MEMORY(
+        gen3_save.p_time_played,
+        &peek.time_played,
+        sizeof(peek.time_played)
+    );
+
+    const struct pksav_gen3_pokemon_party* p_party = gen3_save.pokemon_storage.p_party;
+    TEST_ASSERT_EQUAL(pksav_littleendian32(p_party->count), peek.party_count);
+    for(size_t party_index = 0;
+        party_index < PKSAV_GEN3_PARTY_NUM_POKEMON;
+        ++party_index)
+    {
+        uint16_t expected_species = 0;
+        if(party_index < peek.party_count)
+        {
+            expected_species = p_party->party[party_index].pc_data.blocks.growth.species;
+        }
+
+        TEST_ASSERT_EQUAL(expected_species, peek.party_species[party_index]);
+    }
+
+    error = pksav_gen3_free_save(&gen3_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    // A buffer that isn't a save should be rejected.
+    uint8_t zero_buffer[PKSAV_GEN3_SAVE_SIZE] = {0};
+    struct pksav_io memory_io;
+    error = pksav_io_init_memory(
+                zero_buffer,
+                sizeof(zero_buffer),
+                &memory_io
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    error = pksav_gen3_peek_save_from_io(
+                &memory_io,
+                &peek
+            );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_INVALID_SAVE, error);
+}
+
+#define GEN3_BULK_NUM_SAVES (3)
+#define GEN3_BULK_NUM_FILEPATHS (3 * (GEN3_BULK_NUM_SAVES + 1))
+
+struct gen3_bulk_result
+{
+    size_t num_calls;
+    enum pksav_error error;
+    enum pksav_gen3_save_type save_type;
+    uint8_t trainer_name[PKSAV_GEN3_TRAINER_NAME_LENGTH];
+};
+
+static void gen3_bulk_callback(
+    size_t filepath_index,
+    enum pksav_error error,
+    struct pksav_gen3_save* p_gen3_save,
+    void* p_user_data
+)
+{
+    TEST_ASSERT_NOT_NULL(p_user_data);
+    TEST_ASSERT_TRUE(filepath_index < GEN3_BULK_NUM_FILEPATHS);
+    TEST_ASSERT_EQUAL(!error, (p_gen3_save != NULL));
+
+    struct gen3_bulk_result* p_result = &((struct gen3_bulk_result*)p_user_data)[filepath_index];
+    ++p_result->num_calls;
+    p_result->error = error;
+    if(p_gen3_save)
+    {
+        p_result->save_type = p_gen3_save->save_type;
+        memcpy(
+            p_result->trainer_name,
+            p_gen3_save->player_info.p_name,
+            sizeof(p_result->trainer_name)
+        );
+    }
+}
+
+static void gen3_bulk_load_test()
+{
+    static const char* SAVE_FILES[GEN3_BULK_NUM_SAVES][2] =
+    {
+        {"ruby_sapphire", "pokemon_ruby.sav"},
+        {"emerald", "pokemon_emerald.sav"},
+        {"firered_leafgreen", "pokemon_firered.sav"}
+    };
+    static const enum pksav_bulk_backend BACKENDS[] =
+    {
+        PKSAV_BULK_BACKEND_AUTO,
+        PKSAV_BULK_BACKEND_IO_URING,
+        PKSAV_BULK_BACKEND_THREADS,
+        PKSAV_BULK_BACKEND_SERIAL
+    };
+
+    char* pksav_test_saves = getenv("PKSAV_TEST_SAVES");
+    if(!pksav_test_saves)
+    {
+        TEST_FAIL_MESSAGE("Failed to get test save directory.");
+    }
+
+    // Every save plus a missing file, several times over, so there are
+    // more files than the queue depth.
+    char filepaths[GEN3_BULK_NUM_SAVES + 1][256];
+    struct gen3_bulk_result expected_results[GEN3_BULK_NUM_SAVES + 1];
+    memset(filepaths, 0, sizeof(filepaths));
+    memset(expected_results, 0, sizeof(expected_results));
+
+    enum pksav_error error = PKSAV_ERROR_NONE;
+    for(size_t save_index = 0; save_index < GEN3_BULK_NUM_SAVES; ++save_index)
+    {
+        snprintf(
+            filepaths[save_index], sizeof(filepaths[save_index]),
+            "%s%s%s%s%s",
+            pksav_test_saves, FS_SEPARATOR,
+            SAVE_FILES[save_index][0], FS_SEPARATOR,
+            SAVE_FILES[save_index][1]
+        );
+
+        struct pksav_gen3_save gen3_save;
+        error = pksav_gen3_load_save_from_file(
+                    filepaths[save_index],
+                    &gen3_save
+                );
+        PKSAV_TEST_ASSERT_SUCCESS(error);
+
+        expected_results[save_index].num_calls = 1;
+        expected_results[save_index].save_type = gen3_save.save_type;
+        memcpy(
+            expected_results[save_index].trainer_name,
+            gen3_save.player_info.p_name,
+            sizeof(expected_results[save_index].trainer_name)
+        );
+
+        error = pksav_gen3_free_save(&gen3_save);
+        PKSAV_TEST_ASSERT_SUCCESS(error);
+    }
+    snprintf(
+        filepaths[GEN3_BULK_NUM_SAVES], sizeof(filepaths[GEN3_BULK_NUM_SAVES]),
+        "%s%spksav_%d_bulk_load_missing",
+        get_tmp_dir(), FS_SEPARATOR, get_pid()
+    );
+    expected_results[GEN3_BULK_NUM_SAVES].num_calls = 1;
+    expected_results[GEN3_BULK_NUM_SAVES].error = PKSAV_ERROR_FILE_IO;
+
+    const char* p_filepaths[GEN3_BULK_NUM_FILEPATHS] = {NULL};
+    for(size_t filepath_index = 0;
+        filepath_index < GEN3_BULK_NUM_FILEPATHS;
+        ++filepath_index)
+    {
+        p_filepaths[filepath_index] = filepaths[filepath_index % (GEN3_BULK_NUM_SAVES + 1)];
+    }
+
+    for(size_t backend_index = 0;
+        backend_index < (sizeof(BACKENDS) / sizeof(BACKENDS[0]));
+        ++backend_index)
+    {
+        struct pksav_bulk_load_options options =
+        {
+            .queue_depth = 2,
+            .backend = BACKENDS[backend_index]
+        };
+        struct gen3_bulk_result results[GEN3_BULK_NUM_FILEPATHS];
+        memset(results, 0, sizeof(results));
+
+        error = pksav_gen3_bulk_load_saves(
+                    p_filepaths,
+                    GEN3_BULK_NUM_FILEPATHS,
+                PKSAV_GEN3_LOAD_FLAGS_NONE,
+                    &options,
+                    gen3_bulk_callback,
+                    results
+                );
+        if((BACKENDS[backend_index] == PKSAV_BULK_BACKEND_IO_URING) &&
+           (error == PKSAV_ERROR_FILE_IO))
+        {
+            // This kernel doesn't support io_uring.
+            continue;
+        }
+        PKSAV_TEST_ASSERT_SUCCESS(error);
+
+        for(size_t filepath_index = 0;
+            filepath_index < GEN3_BULK_NUM_FILEPATHS;
+            ++filepath_index)
+        {
+            const struct gen3_bulk_result* p_expected_result =
+                &expected_results[filepath_index % (GEN3_BULK_NUM_SAVES + 1)];
+
+            TEST_ASSERT_EQUAL_MEMORY(
+                p_expected_result,
+                &results[filepath_index],
+                sizeof(*p_expected_result)
+            );
+        }
+    }
+}
+
+// A slot whose footers are all valid but which repeats a section ID still
+// has a section 0, but saving it would index a missing section, so it must
+// be rejected before it's loaded.
+static void gen3_duplicate_section_test(
+    const char* subdir,
+    const char* save_name
+)
+{
+    TEST_ASSERT_NOT_NULL(subdir);
+    TEST_ASSERT_NOT_NULL(save_name);
+
+    char filepath[256] = {0};
+    struct pksav_gen3_save gen3_save = EMPTY_GEN3_SAVE;
+    struct pksav_gen3_save_peek peek;
+    enum pksav_error error = PKSAV_ERROR_NONE;
+
+    char* pksav_test_saves = getenv("PKSAV_TEST_SAVES");
+    if(!pksav_test_saves)
+    {
+        TEST_FAIL_MESSAGE("Failed to get test save directory.");
+    }
+
+    snprintf(
+        filepath, sizeof(filepath),
+        "%s%s%s%s%s",
+        pksav_test_saves, FS_SEPARATOR, subdir, FS_SEPARATOR, save_name
+    );
+
+    uint8_t* save_buffer = NULL;
+    size_t filesize = 0;
+    if(pksav_fs_read_file_to_buffer(filepath, &save_buffer, &filesize))
+    {
+        TEST_FAIL_MESSAGE("Failed to read save into buffer.");
+    }
+    TEST_ASSERT_TRUE(filesize >= PKSAV_GEN3_SAVE_SIZE);
+
+    // Give section 1 the ID of section 2 in both slots, so whichever slot
+    // is active holds section 2 twice and no section 1.
+    union pksav_gen3_save_slot* p_save_slots = (union pksav_gen3_save_slot*)save_buffer;
+    for(size_t slot_index = 0; slot_index < 2; ++slot_index)
+    {
+        for(size_t section_index = 0;
+            section_index < PKSAV_GEN3_NUM_SAVE_SECTIONS;
+            ++section_index)
+        {
+            struct pksav_gen3_section_footer* p_footer =
+                &p_save_slots[slot_index].sections_arr[section_index].footer;
+            if(p_footer->section_id == 1)
+            {
+                p_footer->section_id = 2;
+            }
+        }
+    }
+
+    enum pksav_gen3_save_type save_type = PKSAV_GEN3_SAVE_TYPE_RS;
+    error = pksav_gen3_get_buffer_save_type(
+                save_buffer,
+                filesize,
+                &save_type
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL(PKSAV_GEN3_SAVE_TYPE_NONE, save_type);
+
+    error = pksav_gen3_load_save_from_buffer(
+                save_buffer,
+                filesize,
+                &gen3_save
+            );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_INVALID_SAVE, error);
+    TEST_ASSERT_NULL(gen3_save.p_internal);
+
+    struct pksav_io memory_io;
+    error = pksav_io_init_memory(
+                save_buffer,
+                filesize,
+                &memory_io
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    save_type = PKSAV_GEN3_SAVE_TYPE_RS;
+    error = pksav_gen3_get_io_save_type(
+                &memory_io,
+                &save_type
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL(PKSAV_GEN3_SAVE_TYPE_NONE, save_type);
+
+    error = pksav_gen3_peek_save_from_io(
+                &memory_io,
+                &peek
+            );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_INVALID_SAVE, error);
+
+    error = pksav_gen3_load_save_from_io(
+                &memory_io,
+                PKSAV_GEN3_LOAD_FLAGS_NONE,
+                &gen3_save
+            );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_INVALID_SAVE, error);
+    TEST_ASSERT_NULL(gen3_save.p_internal);
+
+    free(save_buffer);
+}
+
+static void gen3_bad_validation_test(
+    const char* subdir,
+    const char* save_name
+)
+{
+    TEST_ASSERT_NOT_NULL(subdir);
+    TEST_ASSERT_NOT_NULL(save_name);
+
+    char filepath[256] = {0};
+    struct pksav_gen3_save gen3_save = EMPTY_GEN3_SAVE;
+    struct pksav_gen3_save_peek peek;
+    enum pksav_error error = PKSAV_ERROR_NONE;
+
+    char* pksav_test_saves = getenv("PKSAV_TEST_SAVES");
+    if(!pksav_test_saves)
+    {
+        TEST_FAIL_MESSAGE("Failed to get test save directory.");
+    }
+
+    snprintf(
+        filepath, sizeof(filepath),
+        "%s%s%s%s%s",
+        pksav_test_saves, FS_SEPARATOR, subdir, FS_SEPARATOR, save_name
+    );
+
+    uint8_t* save_buffer = NULL;
+    size_t filesize = 0;
+    if(pksav_fs_read_file_to_buffer(filepath, &save_buffer, &filesize))
+    {
+        TEST_FAIL_MESSAGE("Failed to read save into buffer.");
+    }
+    TEST_ASSERT_TRUE(filesize >= PKSAV_GEN3_SAVE_SIZE);
+
+    // Break the first footer in both slots, so whichever slot is active
+    // is rejected before any of its other footers are read.
+    union pksav_gen3_save_slot* p_save_slots = (union pksav_gen3_save_slot*)save_buffer;
+    for(size_t slot_index = 0; slot_index < 2; ++slot_index)
+    {
+        p_save_slots[slot_index].sections_arr[0].footer.validation ^= 0xFFFFFFFF;
+    }
+
+    enum pksav_gen3_save_type save_type = PKSAV_GEN3_SAVE_TYPE_RS;
+    error = pksav_gen3_get_buffer_save_type(
+                save_buffer,
+                filesize,
+                &save_type
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL(PKSAV_GEN3_SAVE_TYPE_NONE, save_type);
+
+    error = pksav_gen3_load_save_from_buffer(
+                save_buffer,
+                filesize,
+                &gen3_save
+            );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_INVALID_SAVE, error);
+    TEST_ASSERT_NULL(gen3_save.p_internal);
+
+    struct pksav_io memory_io;
+    error = pksav_io_init_memory(
+                save_buffer,
+                filesize,
+                &memory_io
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    save_type = PKSAV_GEN3_SAVE_TYPE_RS;
+    error = pksav_gen3_get_io_save_type(
+                &memory_io,
+                &save_type
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL(PKSAV_GEN3_SAVE_TYPE_NONE, save_type);
+
+    error = pksav_gen3_peek_save_from_io(
+                &memory_io,
+                &peek
+            );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_INVALID_SAVE, error);
+
+    error = pksav_gen3_load_save_from_io(
+                &memory_io,
+                PKSAV_GEN3_LOAD_FLAGS_NONE,
+                &gen3_save
+            );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_INVALID_SAVE, error);
+    TEST_ASSERT_NULL(gen3_save.p_internal);
+
+    free(save_buffer);
+}
+
+static void gen3_modified_sections_test(
+    const char* subdir,
+    const char* save_name
+)
+{
+    TEST_ASSERT_NOT_NULL(subdir);
+    TEST_ASSERT_NOT_NULL(save_name);
+
+    char filepath[256] = {0};
+    struct pksav_gen3_save gen3_save = EMPTY_GEN3_SAVE;
+    struct pksav_gen3_save saved_gen3_save = EMPTY_GEN3_SAVE;
+    enum pksav_error error = PKSAV_ERROR_NONE;
+
+    char* pksav_test_saves = getenv("PKSAV_TEST_SAVES");
+    if(!pksav_test_saves)
+    {
+        TEST_FAIL_MESSAGE("Failed to get test save directory.");
+    }
+
+    snprintf(
+        filepath, sizeof(filepath),
+        "%s%s%s%s%s",
+        pksav_test_saves, FS_SEPARATOR, subdir, FS_SEPARATOR, save_name
+    );
+
+    error = pksav_gen3_load_save_from_file(
+                filepath,
+                &gen3_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    // Otherwise, sections would be given new checksums whether or not
+    // they were modified.
+    struct pksav_gen3_save_internal* p_internal = gen3_save.p_internal;
+    TEST_ASSERT_EQUAL_HEX16(
+        PKSAV_GEN3_ALL_SECTIONS_MASK,
+        p_internal->valid_section_checksums
+    );
+
+    uint8_t* p_original_save = malloc(p_internal->save_len);
+    uint8_t* p_saved_save = malloc(p_internal->save_len);
+    TEST_ASSERT_NOT_NULL(p_original_save);
+    TEST_ASSERT_NOT_NULL(p_saved_save);
+    memcpy(p_original_save, p_internal->p_raw_save, p_internal->save_len);
+
+    const union pksav_gen3_save_slot* p_original_slots =
+        (const union pksav_gen3_save_slot*)p_original_save;
+    const union pksav_gen3_save_slot* p_saved_slots =
+        (const union pksav_gen3_save_slot*)p_saved_save;
+
+    // Saving writes to whichever slot isn't active.
+    size_t active_slot_index = p_internal->is_save_from_first_slot ? 0 : 1;
+    size_t output_slot_index = 1 - active_slot_index;
+
+    size_t money_section_id =
+        (size_t)((const uint8_t*)gen3_save.player_info.p_money -
+                 p_internal->unshuffled_sections.data)
+        / sizeof(struct pksav_gen3_save_section);
+    TEST_ASSERT_TRUE(money_section_id < PKSAV_GEN3_NUM_SAVE_SECTIONS);
+
+    uint32_t new_money = pksav_littleendian32(
+                             pksav_littleendian32(*gen3_save.player_info.p_money) + 1
+                         );
+    *gen3_save.player_info.p_money = new_money;
+
+    error = pksav_gen3_save_save_to_buffer(
+                &gen3_save,
+                p_saved_save,
+                p_internal->save_len
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    // The slot written to keeps the active slot's section order.
+    char message[STRBUFFER_LEN] = {0};
+    for(size_t section_index = 0;
+        section_index < PKSAV_GEN3_NUM_SAVE_SECTIONS;
+        ++section_index)
+    {
+        const struct pksav_gen3_section_footer* p_original_footer =
+            &p_original_slots[active_slot_index].sections_arr[section_index].footer;
+        const struct pksav_gen3_section_footer* p_saved_footer =
+            &p_saved_slots[output_slot_index].sections_arr[section_index].footer;
+        TEST_ASSERT_EQUAL(p_original_footer->section_id, p_saved_footer->section_id);
+
+        snprintf(
+            message, sizeof(message),
+            "Section %u",
+            (unsigned)p_saved_footer->section_id
+        );
+        if(p_saved_footer->section_id == money_section_id)
+        {
+            TEST_ASSERT_NOT_EQUAL_MESSAGE(
+                p_original_footer->checksum,
+                p_saved_footer->checksum,
+                message
+            );
+        }
+        else
+        {
+            TEST_ASSERT_EQUAL_HEX16_MESSAGE(
+                p_original_footer->checksum,
+                p_saved_footer->checksum,
+                message
+            );
+        }
+    }
+
+    error = pksav_gen3_load_save_from_buffer(
+                p_saved_save,
+                p_internal->save_len,
+                &saved_gen3_save
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    struct pksav_gen3_save_internal* p_saved_internal = saved_gen3_save.p_internal;
+    TEST_ASSERT_EQUAL((output_slot_index == 0), p_saved_internal->is_save_from_first_slot);
+    TEST_ASSERT_EQUAL_HEX16(
+        PKSAV_GEN3_ALL_SECTIONS_MASK,
+        p_saved_internal->valid_section_checksums
+    );
+    TEST_ASSERT_EQUAL(new_money, *saved_gen3_save.player_info.p_money);
+    TEST_ASSERT_EQUAL_MEMORY(
+        gen3_save.pokemon_storage.p_party,
+        saved_gen3_save.pokemon_storage.p_party,
+        sizeof(struct pksav_gen3_pokemon_party)
+    );
+    TEST_ASSERT_EQUAL_MEMORY(
+        gen3_save.pokemon_storage.p_pc,
+        saved_gen3_save.pokemon_storage.p_pc,
+        sizeof(struct pksav_gen3_pokemon_pc)
+    );
+
+    error = pksav_gen3_free_save(&saved_gen3_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    error = pksav_gen3_free_save(&gen3_save);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    free(p_saved_save);
+    free(p_original_save);
+}
+
+static void pksav_buffer_is_ruby_save_test()
+{
+    pksav_gen3_get_buffer_save_type_test(
+        "ruby_sapphire",
+        "pokemon_ruby.sav",
+        PKSAV_GEN3_SAVE_TYPE_RS
+    );
+}
+
+static void pksav_file_is_ruby_save_test()
+{
+    pksav_gen3_get_file_save_type_test(
+        "ruby_sapphire",
+        "pokemon_ruby.sav",
+        PKSAV_GEN3_SAVE_TYPE_RS
+    );
+}
+
+static void ruby_save_from_buffer_test()
+{
+    gen3_save_from_buffer_test(
+        "ruby_sapphire",
+        "pokemon_ruby.sav",
+        PKSAV_GEN3_SAVE_TYPE_RS
+    );
+}
+
+static void ruby_save_from_file_test()
+{
+    gen3_save_from_file_test(
+        "ruby_sapphire",
+        "pokemon_ruby.sav",
+        PKSAV_GEN3_SAVE_TYPE_RS
+    );
+}
+
+static void ruby_io_test()
+{
+    gen3_io_test(
+        "ruby_sapphire",
+        "pokemon_ruby.sav",
+        PKSAV_GEN3_SAVE_TYPE_RS
+    );
+}
+
+static void ruby_peek_test()
+{
+    gen3_peek_test(
+        "ruby_sapphire",
+        "pokemon_ruby.sav",
+        PKSAV_GEN3_SAVE_TYPE_RS
+    );
+}
+
+static void ruby_in_place_test()
+{
+    gen3_in_place_test(
+        "ruby_sapphire",
+        "pokemon_ruby.sav"
+    );
+}
+
+static void ruby_save_changes_test()
+{
+    gen3_save_changes_test(
+        "ruby_sapphire",
+        "pokemon_ruby.sav"
+    );
+}
+
+static void ruby_save_async_test()
+{
+    gen3_save_async_test(
+        "ruby_sapphire",
+        "pokemon_ruby.sav"
+    );
+}
+
+static void ruby_save_to_batch_test()
+{
+    gen3_save_to_batch_test(
+        "ruby_sapphire",
+        "pokemon_ruby.sav"
+    );
+}
+
+static void ruby_lazy_pc_test()
+{
+    gen3_lazy_pc_test(
+        "ruby_sapphire",
+        "pokemon_ruby.sav"
+    );
+}
+
+static void ruby_compact_test()
+{
+    gen3_compact_test(
+        "ruby_sapphire",
+        "pokemon_ruby.sav"
+    );
+}
+
+static void ruby_pokemon_checksum_report_test()
+{
+    gen3_pokemon_checksum_report_test(
+        "ruby_sapphire",
+        "pokemon_ruby.sav"
+    );
+}
+
+static void ruby_duplicate_section_test()
+{
+    gen3_duplicate_section_test(
+        "ruby_sapphire",
+        "pokemon_ruby.sav"
+    );
+}
+
+static void ruby_bad_validation_test()
+{
+    gen3_bad_validation_test(
+        "ruby_sapphire",
+        "pokemon_ruby.sav"
+    );
+}
+
+static void ruby_modified_sections_test()
+{
+    gen3_modified_sections_test(
+        "ruby_sapphire",
+        "pokemon_ruby.sav"
+    );
+}
+
+static void pksav_buffer_is_emerald_save_test()
+{
+    pksav_gen3_get_buffer_save_type_test(
+        "emerald",
+        "pokemon_emerald.sav",
+        PKSAV_GEN3_SAVE_TYPE_EMERALD
+    );
+}
+
+static void pksav_file_is_emerald_save_test()
+{
+    pksav_gen3_get_file_save_type_test(
+        "emerald",
+        "pokemon_emerald.sav",
+        PKSAV_GEN3_SAVE_TYPE_EMERALD
+    );
+}
+
+static void emerald_save_from_buffer_test()
+{
+    gen3_save_from_buffer_test(
+        "emerald",
+        "pokemon_emerald.sav",
+        PKSAV_GEN3_SAVE_TYPE_EMERALD
+    );
+}
+
+static void emerald_save_from_file_test()
+{
+    gen3_save_from_file_test(
+        "emerald",
+        "pokemon_emerald.sav",
+        PKSAV_GEN3_SAVE_TYPE_EMERALD
+    );
+}
+
+static void emerald_io_test()
+{
+    gen3_io_test(
+        "emerald",
+        "pokemon_emerald.sav",
+        PKSAV_GEN3_SAVE_TYPE_EMERALD
+    );
+}
+
+static void emerald_peek_test()
+{
+    gen3_peek_test(
+        "emerald",
+        "pokemon_emerald.sav",
+        PKSAV_GEN3_SAVE_TYPE_EMERALD
+    );
+}
+
+static void emerald_in_place_test()
+{
+    gen3_in_place_test(
+        "emerald",
+        "pokemon_emerald.sav"
+    );
+}
+
+static void emerald_save_changes_test()
+{
+    gen3_save_changes_test(
+        "emerald",
+        "pokemon_emerald.sav"
+    );
+}
+
+static void emerald_save_async_test()
+{
+    gen3_save_async_test(
+        "emerald",
+        "pokemon_emerald.sav"
+    );
+}
+
+static void emerald_save_to_batch_test()
+{
+    gen3_save_to_batch_test(
+        "emerald",
+        "pokemon_emerald.sav"
+    );
+}
+
+static void emerald_lazy_pc_test()
+{
+    gen3_lazy_pc_test(
+        "emerald",
+        "pokemon_emerald.sav"
+    );
+}
+
+static void emerald_compact_test()
+{
+    gen3_compact_test(
+        "emerald",
+        "pokemon_emerald.sav"
+    );
+}
+
+static void emerald_pokemon_checksum_report_test()
+{
+    gen3_pokemon_checksum_report_test(
+        "emerald",
+        "pokemon_emerald.sav"
+    );
+}
+
+static void emerald_duplicate_section_test()
+{
+    gen3_duplicate_section_test(
+        "emerald",
+        "pokemon_emerald.sav"
+    );
+}
+
+static void emerald_bad_validation_test()
+{
+    gen3_bad_validation_test(
+        "emerald",
+        "pokemon_emerald.sav"
+    );
+}
+
+static void emerald_modified_sections_test()
+{
+    gen3_modified_sections_test(
+        "emerald",
+        "pokemon_emerald.sav"
+    );
+}
+
+static void pksav_buffer_is_firered_save_test()
+{
+    pksav_gen3_get_buffer_save_type_test(
+        "firered_leafgreen",
+        "pokemon_firered.sav",
+        PKSAV_GEN3_SAVE_TYPE_FRLG
+    );
+}
+
+static void pksav_file_is_firered_save_test()
+{
+    pksav_gen3_get_file_save_type_test(
+        "firered_leafgreen",
+        "pokemon_firered.sav",
         PKSAV_GEN3_SAVE_TYPE_FRLG
     );
 }
@@ -769,23 +2559,160 @@ static void firered_save_from_file_test()
     );
 }
 
+static void firered_io_test()
+{
+    gen3_io_test(
+        "firered_leafgreen",
+        "pokemon_firered.sav",
+        PKSAV_GEN3_SAVE_TYPE_FRLG
+    );
+}
+
+static void firered_peek_test()
+{
+    gen3_peek_test(
+        "firered_leafgreen",
+        "pokemon_firered.sav",
+        PKSAV_GEN3_SAVE_TYPE_FRLG
+    );
+}
+
+static void firered_in_place_test()
+{
+    gen3_in_place_test(
+        "firered_leafgreen",
+        "pokemon_firered.sav"
+    );
+}
+
+static void firered_save_changes_test()
+{
+    gen3_save_changes_test(
+        "firered_leafgreen",
+        "pokemon_firered.sav"
+    );
+}
+
+static void firered_save_async_test()
+{
+    gen3_save_async_test(
+        "firered_leafgreen",
+        "pokemon_firered.sav"
+    );
+}
+
+static void firered_save_to_batch_test()
+{
+    gen3_save_to_batch_test(
+        "firered_leafgreen",
+        "pokemon_firered.sav"
+    );
+}
+
+static void firered_lazy_pc_test()
+{
+    gen3_lazy_pc_test(
+        "firered_leafgreen",
+        "pokemon_firered.sav"
+    );
+}
+
+static void firered_compact_test()
+{
+    gen3_compact_test(
+        "firered_leafgreen",
+        "pokemon_firered.sav"
+    );
+}
+
+static void firered_pokemon_checksum_report_test()
+{
+    gen3_pokemon_checksum_report_test(
+        "firered_leafgreen",
+        "pokemon_firered.sav"
+    );
+}
+
+static void firered_duplicate_section_test()
+{
+    gen3_duplicate_section_test(
+        "firered_leafgreen",
+        "pokemon_firered.sav"
+    );
+}
+
+static void firered_bad_validation_test()
+{
+    gen3_bad_validation_test(
+        "firered_leafgreen",
+        "pokemon_firered.sav"
+    );
+}
+
+static void firered_modified_sections_test()
+{
+    gen3_modified_sections_test(
+        "firered_leafgreen",
+        "pokemon_firered.sav"
+    );
+}
+
 PKSAV_TEST_MAIN(
     PKSAV_TEST(pksav_gen3_get_buffer_save_type_on_random_buffer_test)
 
     PKSAV_TEST(convenience_macro_test)
+    PKSAV_TEST(crypt_pokemon_array_test)
+    PKSAV_TEST(verify_pokemon_checksums_test)
+    PKSAV_TEST(gen3_bulk_load_test)
 
     PKSAV_TEST(pksav_buffer_is_ruby_save_test)
     PKSAV_TEST(pksav_file_is_ruby_save_test)
     PKSAV_TEST(ruby_save_from_buffer_test)
     PKSAV_TEST(ruby_save_from_file_test)
+    PKSAV_TEST(ruby_io_test)
+    PKSAV_TEST(ruby_peek_test)
+    PKSAV_TEST(ruby_in_place_test)
+    PKSAV_TEST(ruby_save_changes_test)
+    PKSAV_TEST(ruby_save_async_test)
+    PKSAV_TEST(ruby_save_to_batch_test)
+    PKSAV_TEST(ruby_lazy_pc_test)
+    PKSAV_TEST(ruby_compact_test)
+    PKSAV_TEST(ruby_pokemon_checksum_report_test)
+    PKSAV_TEST(ruby_duplicate_section_test)
+    PKSAV_TEST(ruby_bad_validation_test)
+    PKSAV_TEST(ruby_modified_sections_test)
 
     PKSAV_TEST(pksav_buffer_is_emerald_save_test)
     PKSAV_TEST(pksav_file_is_emerald_save_test)
     PKSAV_TEST(emerald_save_from_buffer_test)
     PKSAV_TEST(emerald_save_from_file_test)
+    PKSAV_TEST(emerald_io_test)
+    PKSAV_TEST(emerald_peek_test)
+    PKSAV_TEST(emerald_in_place_test)
+    PKSAV_TEST(emerald_save_changes_test)
+    PKSAV_TEST(emerald_save_async_test)
+    PKSAV_TEST(emerald_save_to_batch_test)
+    PKSAV_TEST(emerald_lazy_pc_test)
+    PKSAV_TEST(emerald_compact_test)
+    PKSAV_TEST(emerald_pokemon_checksum_report_test)
+    PKSAV_TEST(emerald_duplicate_section_test)
+    PKSAV_TEST(emerald_bad_validation_test)
+    PKSAV_TEST(emerald_modified_sections_test)
 
     PKSAV_TEST(pksav_buffer_is_firered_save_test)
     PKSAV_TEST(pksav_file_is_firered_save_test)
     PKSAV_TEST(firered_save_from_buffer_test)
     PKSAV_TEST(firered_save_from_file_test)
+    PKSAV_TEST(firered_io_test)
+    PKSAV_TEST(firered_peek_test)
+    PKSAV_TEST(firered_in_place_test)
+    PKSAV_TEST(firered_save_changes_test)
+    PKSAV_TEST(firered_save_async_test)
+    PKSAV_TEST(firered_save_to_batch_test)
+    PKSAV_TEST(firered_lazy_pc_test)
+    PKSAV_TEST(firered_compact_test)
+    PKSAV_TEST(firered_pokemon_checksum_report_test)
+    PKSAV_TEST(firered_duplicate_section_test)
+    PKSAV_TEST(firered_bad_validation_test)
+    PKSAV_TEST(firered_modified_sections_test)
 )
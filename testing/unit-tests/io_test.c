@@ -0,0 +1,276 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "c_test_common.h"
+#include "test-utils.h"
+
+#include "util/fs.h"
+
+#include <pksav/io.h>
+
+#include <stdio.h>
+#include <string.h>
+
+#ifndef PKSAV_PLATFORM_WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#define IO_TEST_BUFFER_SIZE 64
+
+// Writes a pattern partway into the backend and reads it back.
+static void io_backend_test(
+    const struct pksav_io* p_io,
+    size_t expected_size
+)
+{
+    TEST_ASSERT_NOT_NULL(p_io);
+    TEST_ASSERT_NOT_NULL(p_io->read_at);
+    TEST_ASSERT_NOT_NULL(p_io->write_at);
+    TEST_ASSERT_NOT_NULL(p_io->get_size);
+
+    enum pksav_error error = PKSAV_ERROR_NONE;
+
+    size_t io_size = 0;
+    error = p_io->get_size(p_io, &io_size);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL(expected_size, io_size);
+
+    uint8_t pattern[16] = {0};
+    for(size_t index = 0; index < sizeof(pattern); ++index)
+    {
+        pattern[index] = (uint8_t)(0xA0 + index);
+    }
+
+    error = p_io->write_at(p_io, 8, pattern, sizeof(pattern));
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    uint8_t read_buffer[sizeof(pattern)] = {0};
+    error = p_io->read_at(p_io, 8, read_buffer, sizeof(read_buffer));
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL_MEMORY(pattern, read_buffer, sizeof(pattern));
+
+    // Writing in place shouldn't change the size.
+    error = p_io->get_size(p_io, &io_size);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL(expected_size, io_size);
+
+    // Reading past the end should fail rather than return short.
+    error = p_io->read_at(p_io, expected_size - 4, read_buffer, 8);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_FILE_IO, error);
+}
+
+static void memory_io_test()
+{
+    uint8_t buffer[IO_TEST_BUFFER_SIZE] = {0};
+    struct pksav_io io;
+
+    enum pksav_error error = pksav_io_init_memory(
+                                 buffer,
+                                 sizeof(buffer),
+                                 &io
+                             );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    io_backend_test(&io, sizeof(buffer));
+
+    // The memory backend should have written straight into the buffer.
+    TEST_ASSERT_EQUAL(0xA0, buffer[8]);
+
+    // Writes past the end fail instead of growing the buffer.
+    uint8_t byte = 0;
+    error = io.write_at(&io, sizeof(buffer), &byte, 1);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_FILE_IO, error);
+
+    // There's nothing to sync.
+    TEST_ASSERT_NULL(io.sync);
+}
+
+static void file_io_test()
+{
+    char tmp_filepath[256] = {0};
+    snprintf(
+        tmp_filepath, sizeof(tmp_filepath),
+        "%s%spksav_%d_file_io_test",
+        get_tmp_dir(), FS_SEPARATOR, get_pid()
+    );
+
+    FILE* p_file = fopen(tmp_filepath, "w+b");
+    TEST_ASSERT_NOT_NULL(p_file);
+
+    uint8_t zeros[IO_TEST_BUFFER_SIZE] = {0};
+    TEST_ASSERT_EQUAL(sizeof(zeros), fwrite(zeros, 1, sizeof(zeros), p_file));
+    TEST_ASSERT_EQUAL(0, fflush(p_file));
+
+    struct pksav_io io;
+    enum pksav_error error = pksav_io_init_file(p_file, &io);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    io_backend_test(&io, sizeof(zeros));
+
+    TEST_ASSERT_NOT_NULL(io.sync);
+    error = io.sync(&io);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    TEST_ASSERT_EQUAL(0, fclose(p_file));
+
+    if(delete_file(tmp_filepath))
+    {
+        TEST_FAIL_MESSAGE("Failed to clean up temp file.");
+    }
+}
+
+static void fd_io_test()
+{
+#ifndef PKSAV_PLATFORM_WIN32
+    char tmp_filepath[256] = {0};
+    snprintf(
+        tmp_filepath, sizeof(tmp_filepath),
+        "%s%spksav_%d_fd_io_test",
+        get_tmp_dir(), FS_SEPARATOR, get_pid()
+    );
+
+    int fd = open(tmp_filepath, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    TEST_ASSERT_TRUE(fd >= 0);
+
+    uint8_t zeros[IO_TEST_BUFFER_SIZE] = {0};
+    TEST_ASSERT_EQUAL(sizeof(zeros), write(fd, zeros, sizeof(zeros)));
+
+    struct pksav_io io;
+    enum pksav_error error = pksav_io_init_fd(fd, &io);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    io_backend_test(&io, sizeof(zeros));
+
+    // Positioned I/O shouldn't move the descriptor's offset.
+    TEST_ASSERT_EQUAL(sizeof(zeros), lseek(fd, 0, SEEK_CUR));
+
+    TEST_ASSERT_NOT_NULL(io.sync);
+    error = io.sync(&io);
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    error = pksav_io_init_fd(-1, &io);
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_PARAM_OUT_OF_RANGE, error);
+
+    TEST_ASSERT_EQUAL(0, close(fd));
+
+    if(delete_file(tmp_filepath))
+    {
+        TEST_FAIL_MESSAGE("Failed to clean up temp file.");
+    }
+#endif
+}
+
+struct counting_io_state
+{
+    struct pksav_io memory_io;
+    size_t num_writes;
+    size_t num_bytes_written;
+};
+
+// Passes everything through to a memory backend, counting writes.
+static enum pksav_error counting_io_write_at(
+    const struct pksav_io* p_io,
+    size_t offset,
+    const uint8_t* p_buffer,
+    size_t num_bytes
+)
+{
+    struct counting_io_state* p_state = p_io->p_context;
+    ++p_state->num_writes;
+    p_state->num_bytes_written += num_bytes;
+
+    return p_state->memory_io.write_at(
+               &p_state->memory_io,
+               offset,
+               p_buffer,
+               num_bytes
+           );
+}
+
+static enum pksav_error counting_io_read_at(
+    const struct pksav_io* p_io,
+    size_t offset,
+    uint8_t* p_buffer_out,
+    size_t num_bytes
+)
+{
+    struct counting_io_state* p_state = p_io->p_context;
+
+    return p_state->memory_io.read_at(
+               &p_state->memory_io,
+               offset,
+               p_buffer_out,
+               num_bytes
+           );
+}
+
+static enum pksav_error counting_io_get_size(
+    const struct pksav_io* p_io,
+    size_t* p_size_out
+)
+{
+    struct counting_io_state* p_state = p_io->p_context;
+
+    return p_state->memory_io.get_size(
+               &p_state->memory_io,
+               p_size_out
+           );
+}
+
+static void write_changes_test()
+{
+    static uint8_t old_buffer[3 * IO_TEST_BUFFER_SIZE * 64];
+    static uint8_t new_buffer[sizeof(old_buffer)];
+
+    for(size_t index = 0; index < sizeof(old_buffer); ++index)
+    {
+        old_buffer[index] = (uint8_t)index;
+    }
+    memcpy(new_buffer, old_buffer, sizeof(new_buffer));
+
+    // Two changes close together, across a chunk boundary, and one far
+    // from them.
+    new_buffer[4094] ^= 0xFF;
+    new_buffer[4100] ^= 0xFF;
+    new_buffer[10000] ^= 0xFF;
+
+    struct counting_io_state state;
+    memset(&state, 0, sizeof(state));
+    enum pksav_error error = pksav_io_init_memory(
+                                 old_buffer,
+                                 sizeof(old_buffer),
+                                 &state.memory_io
+                             );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+
+    struct pksav_io io;
+    memset(&io, 0, sizeof(io));
+    io.read_at = counting_io_read_at;
+    io.write_at = counting_io_write_at;
+    io.get_size = counting_io_get_size;
+    io.p_context = &state;
+
+    error = pksav_fs_write_changes_to_io(&io, new_buffer, sizeof(new_buffer));
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL_MEMORY(new_buffer, old_buffer, sizeof(old_buffer));
+    TEST_ASSERT_EQUAL(2, state.num_writes);
+    TEST_ASSERT_EQUAL(8, state.num_bytes_written);
+
+    // Nothing is written if nothing changed.
+    state.num_writes = 0;
+    error = pksav_fs_write_changes_to_io(&io, new_buffer, sizeof(new_buffer));
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL(0, state.num_writes);
+}
+
+PKSAV_TEST_MAIN(
+    PKSAV_TEST(memory_io_test)
+    PKSAV_TEST(file_io_test)
+    PKSAV_TEST(fd_io_test)
+    PKSAV_TEST(write_changes_test)
+)
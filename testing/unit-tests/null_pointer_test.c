@@ -9,6 +9,8 @@
 
 #include <pksav.h>
 
+#include <string.h>
+
 /*
  * pksav/common/pokedex.h
  */
@@ -134,69 +136,1316 @@ static void pksav_common_stats_h_test()
 }
 
 /*
- * pksav/gen1/save.h
+ * pksav/io.h
  */
-static void pksav_gen1_save_h_test() {
+static void pksav_io_h_test()
+{
+    enum pksav_error status = PKSAV_ERROR_NONE;
+
+    struct pksav_io dummy_io;
+    uint8_t dummy_uint8_t = 0;
+
+    /*
+     * pksav_io_init_fd
+     */
+
+    status = pksav_io_init_fd(
+                 0,
+                 NULL // p_io_out
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_io_init_file
+     */
+
+    status = pksav_io_init_file(
+                 NULL, // p_file
+                 &dummy_io
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_io_init_file(
+                 stdin,
+                 NULL // p_io_out
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_io_init_memory
+     */
+
+    status = pksav_io_init_memory(
+                 NULL, // p_buffer
+                 1,
+                 &dummy_io
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_io_init_memory(
+                 &dummy_uint8_t,
+                 1,
+                 NULL // p_io_out
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 }
 
 /*
- * pksav/gen1/text.h
+ * pksav/async.h
  */
-static void pksav_gen1_text_h_test()
+static void pksav_async_h_test()
 {
+    enum pksav_error status = PKSAV_ERROR_NONE;
+
+    struct pksav_async_writer dummy_writer = {NULL};
+    size_t dummy_size_t = 0;
+
+    /*
+     * pksav_async_writer_init
+     */
+
+    status = pksav_async_writer_init(
+                 1,
+                 NULL // p_writer_out
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_async_writer_get_num_pending
+     */
+
+    status = pksav_async_writer_get_num_pending(
+                 NULL, // p_writer
+                 &dummy_size_t
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_async_writer_get_num_pending(
+                 &dummy_writer,
+                 NULL // p_num_pending_out
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_async_writer_wait
+     */
+
+    status = pksav_async_writer_wait(
+                 NULL // p_writer
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_async_writer_free
+     */
+
+    status = pksav_async_writer_free(
+                 NULL // p_writer
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 }
 
 /*
- * pksav/gen2/save.h
+ * pksav/batch.h
  */
-static void pksav_gen2_save_h_test()
+static void pksav_batch_h_test()
 {
+    enum pksav_error status = PKSAV_ERROR_NONE;
+
+    /*
+     * pksav_save_batch_init
+     */
+
+    status = pksav_save_batch_init(
+                 NULL // p_batch_out
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_save_batch_commit
+     */
+
+    status = pksav_save_batch_commit(
+                 NULL // p_batch
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_save_batch_free
+     */
+
+    status = pksav_save_batch_free(
+                 NULL // p_batch
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 }
 
 /*
- * pksav/gen2/text.h
+ * pksav/detect.h
  */
-static void pksav_gen2_text_h_test()
+static void dummy_scan_callback(
+    const char* p_filepath,
+    enum pksav_error error,
+    const struct pksav_save_type* p_save_type,
+    void* p_user_data
+)
 {
+    (void)p_filepath;
+    (void)error;
+    (void)p_save_type;
+    (void)p_user_data;
 }
 
-/*
- * pksav/gen2/time.h
- */
-static void pksav_gen2_time_h_test() {
+static void pksav_detect_h_test()
+{
     enum pksav_error status = PKSAV_ERROR_NONE;
 
-    time_t dummy_time_t = 0;
-    uint16_t dummy_uint16_t = 0;
+    uint8_t dummy_buffer[1] = {0};
+    struct pksav_save_type dummy_save_type;
+    const char* dummy_filepaths[1] = {"dummy"};
 
     /*
-     * pksav_gen2_set_caught_data_time_field
+     * pksav_detect_save_type
      */
 
-    status = pksav_gen2_set_caught_data_time_field(
-        NULL,
-        &dummy_uint16_t
-    );
+    status = pksav_detect_save_type(
+                 NULL, // p_buffer
+                 sizeof(dummy_buffer),
+                 &dummy_save_type
+             );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
-    status = pksav_gen2_set_caught_data_time_field(
-        &dummy_time_t,
-        NULL
-    );
+    status = pksav_detect_save_type(
+                 dummy_buffer,
+                 sizeof(dummy_buffer),
+                 NULL // p_save_type_out
+             );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 
-    status = pksav_gen2_set_caught_data_time_field(
-        NULL,
-        NULL
-    );
+    /*
+     * pksav_detect_file_save_type
+     */
+
+    status = pksav_detect_file_save_type(
+                 NULL, // p_filepath
+                 &dummy_save_type
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_detect_file_save_type(
+                 "dummy",
+                 NULL // p_save_type_out
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_scan_save_files
+     */
+
+    status = pksav_scan_save_files(
+                 NULL, // pp_filepaths
+                 1,
+                 NULL,
+                 dummy_scan_callback,
+                 NULL
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_scan_save_files(
+                 dummy_filepaths,
+                 1,
+                 NULL,
+                 NULL, // p_callback
+                 NULL
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_scan_save_directory
+     */
+
+    status = pksav_scan_save_directory(
+                 NULL, // p_dirpath
+                 NULL,
+                 dummy_scan_callback,
+                 NULL
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_scan_save_directory(
+                 "dummy",
+                 NULL,
+                 NULL, // p_callback
+                 NULL
+             );
     TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 }
 
+static void dummy_gen1_bulk_callback(
+    size_t filepath_index,
+    enum pksav_error error,
+    struct pksav_gen1_save* p_gen1_save,
+    void* p_user_data
+)
+{
+    (void)filepath_index;
+    (void)error;
+    (void)p_gen1_save;
+    (void)p_user_data;
+}
+
 /*
- * pksav/gen3/save.h
+ * pksav/gen1/save.h
  */
-static void pksav_gen3_save_h_test()
+static void pksav_gen1_save_h_test()
 {
+    enum pksav_error status = PKSAV_ERROR_NONE;
+
+    struct pksav_gen1_save dummy_gen1_save;
+    uint8_t dummy_uint8_t = 0;
+
+    /*
+     * pksav_gen1_load_save_from_file_in_place
+     */
+
+    status = pksav_gen1_load_save_from_file_in_place(
+                 NULL, // p_filepath
+                 &dummy_gen1_save
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen1_load_save_from_file_in_place(
+                 "dummy",
+                 NULL // p_gen1_save_out
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen1_save_commit
+     */
+
+    status = pksav_gen1_save_commit(
+                 NULL // p_gen1_save
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen1_get_io_save_type
+     */
+
+    struct pksav_io dummy_io;
+    enum pksav_gen1_save_type dummy_gen1_save_type = PKSAV_GEN1_SAVE_TYPE_NONE;
+    memset(&dummy_io, 0, sizeof(dummy_io));
+
+    status = pksav_gen1_get_io_save_type(
+                 NULL, // p_io
+                 &dummy_gen1_save_type
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen1_get_io_save_type(
+                 &dummy_io,
+                 NULL // p_save_type_out
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    // The dummy backend has no callbacks.
+    status = pksav_gen1_get_io_save_type(
+                 &dummy_io,
+                 &dummy_gen1_save_type
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen1_load_save_from_io
+     */
+
+    status = pksav_gen1_load_save_from_io(
+                 NULL, // p_io
+                 &dummy_gen1_save
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen1_load_save_from_io(
+                 &dummy_io,
+                 NULL // p_gen1_save_out
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen1_load_save_from_io(
+                 &dummy_io,
+                 &dummy_gen1_save
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen1_peek_save_from_file
+     */
+
+    struct pksav_gen1_save_peek dummy_gen1_save_peek;
+
+    status = pksav_gen1_peek_save_from_file(
+                 NULL, // p_filepath
+                 &dummy_gen1_save_peek
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen1_peek_save_from_file(
+                 "dummy",
+                 NULL // p_peek_out
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen1_peek_save_from_io
+     */
+
+    status = pksav_gen1_peek_save_from_io(
+                 NULL, // p_io
+                 &dummy_gen1_save_peek
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen1_peek_save_from_io(
+                 &dummy_io,
+                 NULL // p_peek_out
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    // The dummy backend has no callbacks.
+    status = pksav_gen1_peek_save_from_io(
+                 &dummy_io,
+                 &dummy_gen1_save_peek
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen1_save_save_changes
+     */
+
+    status = pksav_gen1_save_save_changes(
+                 NULL, // p_filepath
+                 &dummy_gen1_save,
+                 false // should_sync
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen1_save_save_changes(
+                 "dummy",
+                 NULL, // p_gen1_save
+                 false // should_sync
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen1_save_save_changes_to_io
+     */
+
+    status = pksav_gen1_save_save_changes_to_io(
+                 NULL, // p_gen1_save
+                 &dummy_io
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen1_save_save_changes_to_io(
+                 &dummy_gen1_save,
+                 NULL // p_io
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen1_save_save_changes_to_io(
+                 &dummy_gen1_save,
+                 &dummy_io
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen1_save_save_to_io
+     */
+
+    status = pksav_gen1_save_save_to_io(
+                 NULL, // p_gen1_save
+                 &dummy_io
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen1_save_save_to_io(
+                 &dummy_gen1_save,
+                 NULL // p_io
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen1_save_save_to_io(
+                 &dummy_gen1_save,
+                 &dummy_io
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen1_save_save_to_buffer
+     */
+
+    status = pksav_gen1_save_save_to_buffer(
+                 NULL, // p_gen1_save
+                 &dummy_uint8_t,
+                 1
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen1_save_save_to_buffer(
+                 &dummy_gen1_save,
+                 NULL, // p_buffer
+                 1
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen1_save_save_async
+     */
+
+    struct pksav_async_writer dummy_writer = {NULL};
+
+    status = pksav_gen1_save_save_async(
+                 NULL, // p_filepath
+                 &dummy_gen1_save,
+                 &dummy_writer,
+                 NULL,
+                 NULL
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen1_save_save_async(
+                 "dummy",
+                 NULL, // p_gen1_save
+                 &dummy_writer,
+                 NULL,
+                 NULL
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen1_save_save_async(
+                 "dummy",
+                 &dummy_gen1_save,
+                 NULL, // p_writer
+                 NULL,
+                 NULL
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen1_save_save_to_batch
+     */
+
+    struct pksav_save_batch dummy_batch = {NULL};
+
+    status = pksav_gen1_save_save_to_batch(
+                 NULL, // p_filepath
+                 &dummy_gen1_save,
+                 &dummy_batch
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen1_save_save_to_batch(
+                 "dummy",
+                 NULL, // p_gen1_save
+                 &dummy_batch
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen1_save_save_to_batch(
+                 "dummy",
+                 &dummy_gen1_save,
+                 NULL // p_batch
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen1_bulk_load_saves
+     */
+
+    const char* bulk_filepaths[] = {"dummy", NULL};
+
+    status = pksav_gen1_bulk_load_saves(
+                 NULL, // pp_filepaths
+                 1,
+                 NULL,
+                 dummy_gen1_bulk_callback,
+                 NULL
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen1_bulk_load_saves(
+                 bulk_filepaths,
+                 2, // Includes a NULL filepath
+                 NULL,
+                 dummy_gen1_bulk_callback,
+                 NULL
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen1_bulk_load_saves(
+                 bulk_filepaths,
+                 1,
+                 NULL,
+                 NULL, // p_callback
+                 NULL
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+}
+
+/*
+ * pksav/gen1/text.h
+ */
+static void pksav_gen1_text_h_test()
+{
+}
+
+static void dummy_gen2_bulk_callback(
+    size_t filepath_index,
+    enum pksav_error error,
+    struct pksav_gen2_save* p_gen2_save,
+    void* p_user_data
+)
+{
+    (void)filepath_index;
+    (void)error;
+    (void)p_gen2_save;
+    (void)p_user_data;
+}
+
+/*
+ * pksav/gen2/save.h
+ */
+static void pksav_gen2_save_h_test()
+{
+    enum pksav_error status = PKSAV_ERROR_NONE;
+
+    struct pksav_gen2_save dummy_gen2_save;
+    uint8_t dummy_uint8_t = 0;
+
+    /*
+     * pksav_gen2_load_save_from_file_in_place
+     */
+
+    status = pksav_gen2_load_save_from_file_in_place(
+                 NULL, // p_filepath
+                 &dummy_gen2_save
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen2_load_save_from_file_in_place(
+                 "dummy",
+                 NULL // p_gen2_save_out
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen2_save_commit
+     */
+
+    status = pksav_gen2_save_commit(
+                 NULL // p_gen2_save
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen2_get_io_save_type
+     */
+
+    struct pksav_io dummy_io;
+    enum pksav_gen2_save_type dummy_gen2_save_type = PKSAV_GEN2_SAVE_TYPE_NONE;
+    memset(&dummy_io, 0, sizeof(dummy_io));
+
+    status = pksav_gen2_get_io_save_type(
+                 NULL, // p_io
+                 &dummy_gen2_save_type
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen2_get_io_save_type(
+                 &dummy_io,
+                 NULL // p_save_type_out
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    // The dummy backend has no callbacks.
+    status = pksav_gen2_get_io_save_type(
+                 &dummy_io,
+                 &dummy_gen2_save_type
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen2_load_save_from_io
+     */
+
+    status = pksav_gen2_load_save_from_io(
+                 NULL, // p_io
+                 &dummy_gen2_save
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen2_load_save_from_io(
+                 &dummy_io,
+                 NULL // p_gen2_save_out
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen2_load_save_from_io(
+                 &dummy_io,
+                 &dummy_gen2_save
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen2_peek_save_from_file
+     */
+
+    struct pksav_gen2_save_peek dummy_gen2_save_peek;
+
+    status = pksav_gen2_peek_save_from_file(
+                 NULL, // p_filepath
+                 &dummy_gen2_save_peek
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen2_peek_save_from_file(
+                 "dummy",
+                 NULL // p_peek_out
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen2_peek_save_from_io
+     */
+
+    status = pksav_gen2_peek_save_from_io(
+                 NULL, // p_io
+                 &dummy_gen2_save_peek
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen2_peek_save_from_io(
+                 &dummy_io,
+                 NULL // p_peek_out
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    // The dummy backend has no callbacks.
+    status = pksav_gen2_peek_save_from_io(
+                 &dummy_io,
+                 &dummy_gen2_save_peek
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen2_save_save_changes
+     */
+
+    status = pksav_gen2_save_save_changes(
+                 NULL, // p_filepath
+                 &dummy_gen2_save,
+                 false // should_sync
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen2_save_save_changes(
+                 "dummy",
+                 NULL, // p_gen2_save
+                 false // should_sync
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen2_save_save_changes_to_io
+     */
+
+    status = pksav_gen2_save_save_changes_to_io(
+                 NULL, // p_gen2_save
+                 &dummy_io
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen2_save_save_changes_to_io(
+                 &dummy_gen2_save,
+                 NULL // p_io
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen2_save_save_changes_to_io(
+                 &dummy_gen2_save,
+                 &dummy_io
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen2_save_save_to_io
+     */
+
+    status = pksav_gen2_save_save_to_io(
+                 NULL, // p_gen2_save
+                 &dummy_io
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen2_save_save_to_io(
+                 &dummy_gen2_save,
+                 NULL // p_io
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen2_save_save_to_io(
+                 &dummy_gen2_save,
+                 &dummy_io
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen2_save_save_to_buffer
+     */
+
+    status = pksav_gen2_save_save_to_buffer(
+                 NULL, // p_gen2_save
+                 &dummy_uint8_t,
+                 1
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen2_save_save_to_buffer(
+                 &dummy_gen2_save,
+                 NULL, // p_buffer
+                 1
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen2_save_save_async
+     */
+
+    struct pksav_async_writer dummy_writer = {NULL};
+
+    status = pksav_gen2_save_save_async(
+                 NULL, // p_filepath
+                 &dummy_gen2_save,
+                 &dummy_writer,
+                 NULL,
+                 NULL
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen2_save_save_async(
+                 "dummy",
+                 NULL, // p_gen2_save
+                 &dummy_writer,
+                 NULL,
+                 NULL
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen2_save_save_async(
+                 "dummy",
+                 &dummy_gen2_save,
+                 NULL, // p_writer
+                 NULL,
+                 NULL
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen2_save_save_to_batch
+     */
+
+    struct pksav_save_batch dummy_batch = {NULL};
+
+    status = pksav_gen2_save_save_to_batch(
+                 NULL, // p_filepath
+                 &dummy_gen2_save,
+                 &dummy_batch
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen2_save_save_to_batch(
+                 "dummy",
+                 NULL, // p_gen2_save
+                 &dummy_batch
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen2_save_save_to_batch(
+                 "dummy",
+                 &dummy_gen2_save,
+                 NULL // p_batch
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen2_bulk_load_saves
+     */
+
+    const char* bulk_filepaths[] = {"dummy", NULL};
+
+    status = pksav_gen2_bulk_load_saves(
+                 NULL, // pp_filepaths
+                 1,
+                 NULL,
+                 dummy_gen2_bulk_callback,
+                 NULL
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen2_bulk_load_saves(
+                 bulk_filepaths,
+                 2, // Includes a NULL filepath
+                 NULL,
+                 dummy_gen2_bulk_callback,
+                 NULL
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen2_bulk_load_saves(
+                 bulk_filepaths,
+                 1,
+                 NULL,
+                 NULL, // p_callback
+                 NULL
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+}
+
+/*
+ * pksav/gen2/text.h
+ */
+static void pksav_gen2_text_h_test()
+{
+}
+
+/*
+ * pksav/gen2/time.h
+ */
+static void pksav_gen2_time_h_test() {
+    enum pksav_error status = PKSAV_ERROR_NONE;
+
+    time_t dummy_time_t = 0;
+    uint16_t dummy_uint16_t = 0;
+
+    /*
+     * pksav_gen2_set_caught_data_time_field
+     */
+
+    status = pksav_gen2_set_caught_data_time_field(
+        NULL,
+        &dummy_uint16_t
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen2_set_caught_data_time_field(
+        &dummy_time_t,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen2_set_caught_data_time_field(
+        NULL,
+        NULL
+    );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+}
+
+/*
+ * pksav/gen3/pokemon.h
+ */
+static void pksav_gen3_pokemon_h_test()
+{
+    enum pksav_error status = PKSAV_ERROR_NONE;
+
+    /*
+     * pksav_gen3_crypt_pokemon_array
+     */
+
+    status = pksav_gen3_crypt_pokemon_array(
+                 NULL, // p_pokemon_array
+                 1,
+                 true
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen3_verify_pokemon_checksums
+     */
+
+    struct pksav_gen3_pc_pokemon dummy_pc_pokemon;
+    uint8_t dummy_uint8_t = 0;
+
+    status = pksav_gen3_verify_pokemon_checksums(
+                 NULL, // p_pokemon_array
+                 1,
+                 false,
+                 &dummy_uint8_t
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen3_verify_pokemon_checksums(
+                 &dummy_pc_pokemon,
+                 1,
+                 false,
+                 NULL // p_bad_checksums_out
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+}
+
+static void dummy_gen3_bulk_callback(
+    size_t filepath_index,
+    enum pksav_error error,
+    struct pksav_gen3_save* p_gen3_save,
+    void* p_user_data
+)
+{
+    (void)filepath_index;
+    (void)error;
+    (void)p_gen3_save;
+    (void)p_user_data;
+}
+
+/*
+ * pksav/gen3/save.h
+ */
+static void pksav_gen3_save_h_test()
+{
+    enum pksav_error status = PKSAV_ERROR_NONE;
+
+    struct pksav_gen3_save dummy_gen3_save;
+    struct pksav_gen3_pokemon_checksum_report dummy_report;
+    uint8_t dummy_uint8_t = 0;
+
+    /*
+     * pksav_gen3_save_get_pc
+     */
+
+    struct pksav_gen3_pokemon_pc* p_dummy_pc = NULL;
+
+    status = pksav_gen3_save_get_pc(
+                 NULL, // p_gen3_save
+                 &p_dummy_pc
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen3_save_get_pc(
+                 &dummy_gen3_save,
+                 NULL // pp_pc_out
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen3_save_get_pokemon_checksum_report
+     */
+
+    status = pksav_gen3_save_get_pokemon_checksum_report(
+                 NULL, // p_gen3_save
+                 &dummy_report
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen3_save_get_pokemon_checksum_report(
+                 &dummy_gen3_save,
+                 NULL // p_report_out
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen3_load_save_from_file_in_place
+     */
+
+    status = pksav_gen3_load_save_from_file_in_place(
+                 NULL, // p_filepath
+                 PKSAV_GEN3_LOAD_FLAGS_NONE,
+                 &dummy_gen3_save
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen3_load_save_from_file_in_place(
+                 "dummy",
+                 PKSAV_GEN3_LOAD_FLAGS_NONE,
+                 NULL // p_gen3_save_out
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen3_save_commit
+     */
+
+    status = pksav_gen3_save_commit(
+                 NULL // p_gen3_save
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen3_get_io_save_type
+     */
+
+    struct pksav_io dummy_io;
+    enum pksav_gen3_save_type dummy_gen3_save_type = PKSAV_GEN3_SAVE_TYPE_NONE;
+    memset(&dummy_io, 0, sizeof(dummy_io));
+
+    status = pksav_gen3_get_io_save_type(
+                 NULL, // p_io
+                 &dummy_gen3_save_type
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen3_get_io_save_type(
+                 &dummy_io,
+                 NULL // p_save_type_out
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    // The dummy backend has no callbacks.
+    status = pksav_gen3_get_io_save_type(
+                 &dummy_io,
+                 &dummy_gen3_save_type
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen3_load_save_from_io
+     */
+
+    status = pksav_gen3_load_save_from_io(
+                 NULL, // p_io
+                 PKSAV_GEN3_LOAD_FLAGS_NONE,
+                 &dummy_gen3_save
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen3_load_save_from_io(
+                 &dummy_io,
+                 PKSAV_GEN3_LOAD_FLAGS_NONE,
+                 NULL // p_gen3_save_out
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen3_load_save_from_io(
+                 &dummy_io,
+                 PKSAV_GEN3_LOAD_FLAGS_NONE,
+                 &dummy_gen3_save
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen3_peek_save_from_file
+     */
+
+    struct pksav_gen3_save_peek dummy_gen3_save_peek;
+
+    status = pksav_gen3_peek_save_from_file(
+                 NULL, // p_filepath
+                 &dummy_gen3_save_peek
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen3_peek_save_from_file(
+                 "dummy",
+                 NULL // p_peek_out
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen3_peek_save_from_io
+     */
+
+    status = pksav_gen3_peek_save_from_io(
+                 NULL, // p_io
+                 &dummy_gen3_save_peek
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen3_peek_save_from_io(
+                 &dummy_io,
+                 NULL // p_peek_out
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    // The dummy backend has no callbacks.
+    status = pksav_gen3_peek_save_from_io(
+                 &dummy_io,
+                 &dummy_gen3_save_peek
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen3_save_save_changes
+     */
+
+    status = pksav_gen3_save_save_changes(
+                 NULL, // p_filepath
+                 &dummy_gen3_save,
+                 false // should_sync
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen3_save_save_changes(
+                 "dummy",
+                 NULL, // p_gen3_save
+                 false // should_sync
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen3_save_save_changes_to_io
+     */
+
+    status = pksav_gen3_save_save_changes_to_io(
+                 NULL, // p_gen3_save
+                 &dummy_io
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen3_save_save_changes_to_io(
+                 &dummy_gen3_save,
+                 NULL // p_io
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen3_save_save_changes_to_io(
+                 &dummy_gen3_save,
+                 &dummy_io
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen3_save_save_to_io
+     */
+
+    status = pksav_gen3_save_save_to_io(
+                 NULL, // p_gen3_save
+                 &dummy_io
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen3_save_save_to_io(
+                 &dummy_gen3_save,
+                 NULL // p_io
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen3_save_save_to_io(
+                 &dummy_gen3_save,
+                 &dummy_io
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen3_save_save_to_buffer
+     */
+
+    status = pksav_gen3_save_save_to_buffer(
+                 NULL, // p_gen3_save
+                 &dummy_uint8_t,
+                 1
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen3_save_save_to_buffer(
+                 &dummy_gen3_save,
+                 NULL, // p_buffer
+                 1
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen3_save_save_async
+     */
+
+    struct pksav_async_writer dummy_writer = {NULL};
+
+    status = pksav_gen3_save_save_async(
+                 NULL, // p_filepath
+                 &dummy_gen3_save,
+                 &dummy_writer,
+                 NULL,
+                 NULL
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen3_save_save_async(
+                 "dummy",
+                 NULL, // p_gen3_save
+                 &dummy_writer,
+                 NULL,
+                 NULL
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen3_save_save_async(
+                 "dummy",
+                 &dummy_gen3_save,
+                 NULL, // p_writer
+                 NULL,
+                 NULL
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen3_save_save_to_batch
+     */
+
+    struct pksav_save_batch dummy_batch = {NULL};
+
+    status = pksav_gen3_save_save_to_batch(
+                 NULL, // p_filepath
+                 &dummy_gen3_save,
+                 &dummy_batch
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen3_save_save_to_batch(
+                 "dummy",
+                 NULL, // p_gen3_save
+                 &dummy_batch
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen3_save_save_to_batch(
+                 "dummy",
+                 &dummy_gen3_save,
+                 NULL // p_batch
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    /*
+     * pksav_gen3_bulk_load_saves
+     */
+
+    const char* bulk_filepaths[] = {"dummy", NULL};
+
+    status = pksav_gen3_bulk_load_saves(
+                 NULL, // pp_filepaths
+                 1,
+                 PKSAV_GEN3_LOAD_FLAGS_NONE,
+                 NULL,
+                 dummy_gen3_bulk_callback,
+                 NULL
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen3_bulk_load_saves(
+                 bulk_filepaths,
+                 2, // Includes a NULL filepath
+                 PKSAV_GEN3_LOAD_FLAGS_NONE,
+                 NULL,
+                 dummy_gen3_bulk_callback,
+                 NULL
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
+
+    status = pksav_gen3_bulk_load_saves(
+                 bulk_filepaths,
+                 1,
+                 PKSAV_GEN3_LOAD_FLAGS_NONE,
+                 NULL,
+                 NULL, // p_callback
+                 NULL
+             );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_NULL_POINTER, status);
 }
 
 /*
@@ -211,11 +1460,16 @@ PKSAV_TEST_MAIN(
     PKSAV_TEST(pksav_common_pokerus_h_test)
     PKSAV_TEST(pksav_common_prng_h_test)
     PKSAV_TEST(pksav_common_stats_h_test)
+    PKSAV_TEST(pksav_io_h_test)
+    PKSAV_TEST(pksav_async_h_test)
+    PKSAV_TEST(pksav_batch_h_test)
+    PKSAV_TEST(pksav_detect_h_test)
     PKSAV_TEST(pksav_gen1_save_h_test)
     PKSAV_TEST(pksav_gen1_text_h_test)
     PKSAV_TEST(pksav_gen2_save_h_test)
     PKSAV_TEST(pksav_gen2_text_h_test)
     PKSAV_TEST(pksav_gen2_time_h_test)
+    PKSAV_TEST(pksav_gen3_pokemon_h_test)
     PKSAV_TEST(pksav_gen3_save_h_test)
     PKSAV_TEST(pksav_gen3_text_h_test)
 )
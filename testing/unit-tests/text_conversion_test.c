@@ -10,6 +10,10 @@
 
 #include <pksav.h>
 
+#include <locale.h>
+#include <stdbool.h>
+#include <string.h>
+
 #define BUFFER_LEN (256)
 
 static const char* strings[] =
@@ -243,10 +247,636 @@ static void pksav_gen5_text_test()
     }
 }
 
+/*
+ * Every character that imports to something should export back to a
+ * character that imports to the same thing, which checks that each reverse
+ * map agrees with its forward map.
+ */
+static void all_chars_round_trip_test(
+    enum pksav_error (*import_fcn)(const uint8_t*, char*, size_t),
+    enum pksav_error (*export_fcn)(const char*, uint8_t*, size_t),
+    uint8_t terminator
+)
+{
+    enum pksav_error error = PKSAV_ERROR_NONE;
+
+    for(size_t game_char = 0; game_char < 256; ++game_char)
+    {
+        uint8_t game_buffer[8] = {0};
+        char strbuffer[sizeof(game_buffer)] = {0};
+        char strbuffer2[sizeof(game_buffer)] = {0};
+
+        memset(game_buffer, terminator, sizeof(game_buffer));
+        game_buffer[0] = (uint8_t)game_char;
+
+        error = import_fcn(game_buffer, strbuffer, 1);
+        PKSAV_TEST_ASSERT_SUCCESS(error);
+
+        // The character either has no mapping or is a terminator.
+        if(strbuffer[0] == '\0')
+        {
+            continue;
+        }
+
+        error = import_fcn(game_buffer, strbuffer, sizeof(strbuffer));
+        PKSAV_TEST_ASSERT_SUCCESS(error);
+
+        error = export_fcn(strbuffer, game_buffer, 1);
+        PKSAV_TEST_ASSERT_SUCCESS(error);
+
+        error = import_fcn(game_buffer, strbuffer2, sizeof(strbuffer2));
+        PKSAV_TEST_ASSERT_SUCCESS(error);
+
+        TEST_ASSERT_EQUAL_STRING(strbuffer, strbuffer2);
+    }
+}
+
+static void pksav_gen1_all_chars_test()
+{
+    all_chars_round_trip_test(
+        pksav_gen1_import_text,
+        pksav_gen1_export_text,
+        PKSAV_GEN1_TEXT_TERMINATOR
+    );
+}
+
+static void pksav_gen2_all_chars_test()
+{
+    all_chars_round_trip_test(
+        pksav_gen2_import_text,
+        pksav_gen2_export_text,
+        PKSAV_GEN2_TEXT_TERMINATOR
+    );
+}
+
+static void pksav_gen3_all_chars_test()
+{
+    all_chars_round_trip_test(
+        pksav_gen3_import_text,
+        pksav_gen3_export_text,
+        0xFF
+    );
+}
+
+/*
+ * Every 16-bit character either has no mapping or survives a round trip.
+ * Returns how many characters have a mapping.
+ */
+static size_t wide_all_chars_round_trip_test(
+    enum pksav_error (*import_bounded_fcn)(
+        const uint16_t*, size_t, char*, size_t, size_t*, bool*
+    ),
+    enum pksav_error (*export_bounded_fcn)(
+        const char*, uint16_t*, size_t, size_t*, bool*
+    )
+)
+{
+    enum pksav_error error = PKSAV_ERROR_NONE;
+    size_t num_mapped_chars = 0;
+
+    for(size_t game_char = 0; game_char <= UINT16_MAX; ++game_char)
+    {
+        uint16_t game_buffer[2] = {(uint16_t)game_char, 0xFFFF};
+        char strbuffer[8] = {0};
+        char strbuffer2[sizeof(strbuffer)] = {0};
+        size_t num_written = 0;
+        bool is_truncated = true;
+
+        error = import_bounded_fcn(
+                    game_buffer,
+                    1,
+                    strbuffer,
+                    sizeof(strbuffer),
+                    &num_written,
+                    &is_truncated
+                );
+        PKSAV_TEST_ASSERT_SUCCESS(error);
+        TEST_ASSERT_FALSE(is_truncated);
+
+        // The character either has no mapping or is a terminator.
+        if(num_written == 0)
+        {
+            continue;
+        }
+        ++num_mapped_chars;
+
+        error = export_bounded_fcn(
+                    strbuffer,
+                    game_buffer,
+                    1,
+                    &num_written,
+                    &is_truncated
+                );
+        PKSAV_TEST_ASSERT_SUCCESS(error);
+        TEST_ASSERT_EQUAL(1, num_written);
+        TEST_ASSERT_FALSE(is_truncated);
+
+        error = import_bounded_fcn(
+                    game_buffer,
+                    1,
+                    strbuffer2,
+                    sizeof(strbuffer2),
+                    &num_written,
+                    &is_truncated
+                );
+        PKSAV_TEST_ASSERT_SUCCESS(error);
+
+        TEST_ASSERT_EQUAL_STRING(strbuffer, strbuffer2);
+    }
+
+    return num_mapped_chars;
+}
+
+static void pksav_gen4_all_chars_test()
+{
+    // Anything read from past either range of the character map would
+    // show up here.
+    size_t num_mapped_chars = wide_all_chars_round_trip_test(
+                                  pksav_gen4_import_text_bounded,
+                                  pksav_gen4_export_text_bounded
+                              );
+    TEST_ASSERT_EQUAL(2871, num_mapped_chars);
+}
+
+static void pksav_gen5_all_chars_test()
+{
+    // Everything in the Basic Multilingual Plane but NUL, the terminator,
+    // and surrogate halves.
+    size_t num_mapped_chars = wide_all_chars_round_trip_test(
+                                  pksav_gen5_import_text_bounded,
+                                  pksav_gen5_export_text_bounded
+                              );
+    TEST_ASSERT_EQUAL(0x10000 - 0x800 - 2, num_mapped_chars);
+}
+
+/*
+ * The bounded variants report how much was written and whether anything was
+ * cut off.
+ */
+static void text_bounded_test(
+    enum pksav_error (*import_bounded_fcn)(
+        const uint8_t*, size_t, char*, size_t, size_t*, bool*
+    ),
+    enum pksav_error (*export_bounded_fcn)(
+        const char*, uint8_t*, size_t, size_t*, bool*
+    )
+)
+{
+    enum pksav_error error = PKSAV_ERROR_NONE;
+    uint8_t game_buffer[BUFFER_LEN] = {0};
+    char strbuffer[BUFFER_LEN] = {0};
+    size_t num_written = 0;
+    bool is_truncated = true;
+
+    // "♀" is three bytes in UTF-8.
+    static const char* TEST_STRING = "Nidoran♀";
+    const size_t test_string_len = strlen(TEST_STRING);
+
+    error = export_bounded_fcn(
+                TEST_STRING,
+                game_buffer,
+                BUFFER_LEN,
+                &num_written,
+                &is_truncated
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL(8, num_written);
+    TEST_ASSERT_FALSE(is_truncated);
+
+    error = import_bounded_fcn(
+                game_buffer,
+                BUFFER_LEN,
+                strbuffer,
+                sizeof(strbuffer),
+                &num_written,
+                &is_truncated
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL(test_string_len, num_written);
+    TEST_ASSERT_FALSE(is_truncated);
+    TEST_ASSERT_EQUAL_STRING(TEST_STRING, strbuffer);
+
+    // Exactly enough room, including the NUL.
+    error = import_bounded_fcn(
+                game_buffer,
+                BUFFER_LEN,
+                strbuffer,
+                test_string_len + 1,
+                &num_written,
+                &is_truncated
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL(test_string_len, num_written);
+    TEST_ASSERT_FALSE(is_truncated);
+    TEST_ASSERT_EQUAL_STRING(TEST_STRING, strbuffer);
+
+    // One byte short, so the last character is dropped whole.
+    error = import_bounded_fcn(
+                game_buffer,
+                BUFFER_LEN,
+                strbuffer,
+                test_string_len,
+                &num_written,
+                &is_truncated
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL(7, num_written);
+    TEST_ASSERT_TRUE(is_truncated);
+    TEST_ASSERT_EQUAL_STRING("Nidoran", strbuffer);
+
+    error = import_bounded_fcn(
+                game_buffer,
+                BUFFER_LEN,
+                strbuffer,
+                0,
+                &num_written,
+                &is_truncated
+            );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_PARAM_OUT_OF_RANGE, error);
+
+    // Too long for the output buffer
+    error = export_bounded_fcn(
+                TEST_STRING,
+                game_buffer,
+                4,
+                &num_written,
+                &is_truncated
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL(4, num_written);
+    TEST_ASSERT_TRUE(is_truncated);
+
+    // Invalid UTF-8
+    error = export_bounded_fcn(
+                "AB\xC3(",
+                game_buffer,
+                BUFFER_LEN,
+                &num_written,
+                &is_truncated
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL(2, num_written);
+    TEST_ASSERT_TRUE(is_truncated);
+}
+
+static void wide_text_bounded_test(
+    enum pksav_error (*import_bounded_fcn)(
+        const uint16_t*, size_t, char*, size_t, size_t*, bool*
+    ),
+    enum pksav_error (*export_bounded_fcn)(
+        const char*, uint16_t*, size_t, size_t*, bool*
+    )
+)
+{
+    enum pksav_error error = PKSAV_ERROR_NONE;
+    uint16_t game_buffer[BUFFER_LEN] = {0};
+    char strbuffer[BUFFER_LEN] = {0};
+    size_t num_written = 0;
+    bool is_truncated = true;
+
+    // "♀" is three bytes in UTF-8.
+    static const char* TEST_STRING = "Nidoran♀";
+    const size_t test_string_len = strlen(TEST_STRING);
+
+    error = export_bounded_fcn(
+                TEST_STRING,
+                game_buffer,
+                BUFFER_LEN,
+                &num_written,
+                &is_truncated
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL(8, num_written);
+    TEST_ASSERT_FALSE(is_truncated);
+
+    error = import_bounded_fcn(
+                game_buffer,
+                BUFFER_LEN,
+                strbuffer,
+                sizeof(strbuffer),
+                &num_written,
+                &is_truncated
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL(test_string_len, num_written);
+    TEST_ASSERT_FALSE(is_truncated);
+    TEST_ASSERT_EQUAL_STRING(TEST_STRING, strbuffer);
+
+    // Exactly enough room, including the NUL.
+    error = import_bounded_fcn(
+                game_buffer,
+                BUFFER_LEN,
+                strbuffer,
+                test_string_len + 1,
+                &num_written,
+                &is_truncated
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL(test_string_len, num_written);
+    TEST_ASSERT_FALSE(is_truncated);
+    TEST_ASSERT_EQUAL_STRING(TEST_STRING, strbuffer);
+
+    // One byte short, so the last character is dropped whole.
+    error = import_bounded_fcn(
+                game_buffer,
+                BUFFER_LEN,
+                strbuffer,
+                test_string_len,
+                &num_written,
+                &is_truncated
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL(7, num_written);
+    TEST_ASSERT_TRUE(is_truncated);
+    TEST_ASSERT_EQUAL_STRING("Nidoran", strbuffer);
+
+    error = import_bounded_fcn(
+                game_buffer,
+                BUFFER_LEN,
+                strbuffer,
+                0,
+                &num_written,
+                &is_truncated
+            );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_PARAM_OUT_OF_RANGE, error);
+
+    // Too long for the output buffer
+    error = export_bounded_fcn(
+                TEST_STRING,
+                game_buffer,
+                4,
+                &num_written,
+                &is_truncated
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL(4, num_written);
+    TEST_ASSERT_TRUE(is_truncated);
+
+    // Invalid UTF-8
+    error = export_bounded_fcn(
+                "AB\xC3(",
+                game_buffer,
+                BUFFER_LEN,
+                &num_written,
+                &is_truncated
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL(2, num_written);
+    TEST_ASSERT_TRUE(is_truncated);
+}
+
+static void pksav_gen1_text_bounded_test()
+{
+    text_bounded_test(
+        pksav_gen1_import_text_bounded,
+        pksav_gen1_export_text_bounded
+    );
+}
+
+static void pksav_gen2_text_bounded_test()
+{
+    text_bounded_test(
+        pksav_gen2_import_text_bounded,
+        pksav_gen2_export_text_bounded
+    );
+}
+
+static void pksav_gen3_text_bounded_test()
+{
+    text_bounded_test(
+        pksav_gen3_import_text_bounded,
+        pksav_gen3_export_text_bounded
+    );
+}
+
+static void pksav_gen4_text_bounded_test()
+{
+    wide_text_bounded_test(
+        pksav_gen4_import_text_bounded,
+        pksav_gen4_export_text_bounded
+    );
+}
+
+static void pksav_gen5_text_bounded_test()
+{
+    wide_text_bounded_test(
+        pksav_gen5_import_text_bounded,
+        pksav_gen5_export_text_bounded
+    );
+}
+
+/*
+ * Batch conversion should give the same text as converting each record on
+ * its own. An odd number of records with an odd stride covers every SIMD
+ * tail case.
+ */
+#define BATCH_NUM_RECORDS   (33)
+#define BATCH_RECORD_STRIDE (13)
+#define BATCH_NUM_CHARS     (10)
+
+static void text_batch_test(
+    enum pksav_error (*import_batch_fcn)(
+        const uint8_t*, size_t, size_t, size_t, char*, size_t, size_t*
+    ),
+    enum pksav_error (*import_bounded_fcn)(
+        const uint8_t*, size_t, char*, size_t, size_t*, bool*
+    ),
+    enum pksav_error (*export_fcn)(const char*, uint8_t*, size_t)
+)
+{
+    enum pksav_error error = PKSAV_ERROR_NONE;
+    uint8_t records[BATCH_NUM_RECORDS * BATCH_RECORD_STRIDE] = {0};
+    char arena[BATCH_NUM_RECORDS * BATCH_NUM_CHARS * 3] = {0};
+    size_t offsets[BATCH_NUM_RECORDS + 1] = {0};
+    char strbuffer[BUFFER_LEN] = {0};
+
+    for(size_t run_index = 0; run_index < FUZZING_TEST_NUM_ITERATIONS; ++run_index)
+    {
+        // Random records, plus some that should convert in full.
+        randomize_buffer(records, sizeof(records));
+        for(size_t string_index = 0; strings[string_index] != NULL; ++string_index)
+        {
+            error = export_fcn(
+                        strings[string_index],
+                        &records[string_index * 2 * BATCH_RECORD_STRIDE],
+                        BATCH_NUM_CHARS
+                    );
+            PKSAV_TEST_ASSERT_SUCCESS(error);
+        }
+
+        error = import_batch_fcn(
+                    records,
+                    BATCH_RECORD_STRIDE,
+                    BATCH_NUM_RECORDS,
+                    BATCH_NUM_CHARS,
+                    arena,
+                    sizeof(arena),
+                    offsets
+                );
+        PKSAV_TEST_ASSERT_SUCCESS(error);
+        TEST_ASSERT_EQUAL(0, offsets[0]);
+
+        for(size_t record_index = 0; record_index < BATCH_NUM_RECORDS; ++record_index)
+        {
+            size_t num_bytes = 0;
+            bool is_truncated = true;
+
+            error = import_bounded_fcn(
+                        &records[record_index * BATCH_RECORD_STRIDE],
+                        BATCH_NUM_CHARS,
+                        strbuffer,
+                        sizeof(strbuffer),
+                        &num_bytes,
+                        &is_truncated
+                    );
+            PKSAV_TEST_ASSERT_SUCCESS(error);
+
+            TEST_ASSERT_EQUAL(
+                num_bytes,
+                (offsets[record_index + 1] - offsets[record_index])
+            );
+            if(num_bytes > 0)
+            {
+                TEST_ASSERT_EQUAL_MEMORY(
+                    strbuffer,
+                    &arena[offsets[record_index]],
+                    num_bytes
+                );
+            }
+        }
+    }
+
+    // The arena is too small.
+    error = import_batch_fcn(
+                records,
+                BATCH_RECORD_STRIDE,
+                BATCH_NUM_RECORDS,
+                BATCH_NUM_CHARS,
+                arena,
+                sizeof(arena) - 1,
+                offsets
+            );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_PARAM_OUT_OF_RANGE, error);
+
+    // The records overlap.
+    error = import_batch_fcn(
+                records,
+                BATCH_NUM_CHARS - 1,
+                BATCH_NUM_RECORDS,
+                BATCH_NUM_CHARS,
+                arena,
+                sizeof(arena),
+                offsets
+            );
+    TEST_ASSERT_EQUAL(PKSAV_ERROR_PARAM_OUT_OF_RANGE, error);
+}
+
+static void pksav_gen1_text_batch_test()
+{
+    text_batch_test(
+        pksav_gen1_import_text_batch,
+        pksav_gen1_import_text_bounded,
+        pksav_gen1_export_text
+    );
+}
+
+static void pksav_gen2_text_batch_test()
+{
+    text_batch_test(
+        pksav_gen2_import_text_batch,
+        pksav_gen2_import_text_bounded,
+        pksav_gen2_export_text
+    );
+}
+
+static void pksav_gen3_text_batch_test()
+{
+    text_batch_test(
+        pksav_gen3_import_text_batch,
+        pksav_gen3_import_text_bounded,
+        pksav_gen3_export_text
+    );
+}
+
+// Conversions shouldn't depend on or change the process's locale.
+static void pksav_text_c_locale_test()
+{
+    enum pksav_error error = PKSAV_ERROR_NONE;
+    uint8_t gen3_buffer[BUFFER_LEN] = {0};
+    char strbuffer[BUFFER_LEN] = {0};
+
+    TEST_ASSERT_NOT_NULL(setlocale(LC_ALL, "C"));
+
+    for(size_t string_index = 0; strings[string_index] != NULL; ++string_index)
+    {
+        error = pksav_gen3_export_text(
+                    strings[string_index],
+                    gen3_buffer,
+                    BUFFER_LEN
+                );
+        PKSAV_TEST_ASSERT_SUCCESS(error);
+
+        error = pksav_gen3_import_text(
+                    gen3_buffer,
+                    strbuffer,
+                    BUFFER_LEN
+                );
+        PKSAV_TEST_ASSERT_SUCCESS(error);
+
+        TEST_ASSERT_EQUAL_STRING(strings[string_index], strbuffer);
+        TEST_ASSERT_EQUAL_STRING("C", setlocale(LC_CTYPE, NULL));
+    }
+
+    // Exporting stops at invalid UTF-8, leaving the rest terminated.
+    error = pksav_gen3_export_text(
+                "AB\xC3(CD",
+                gen3_buffer,
+                BUFFER_LEN
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    error = pksav_gen3_import_text(
+                gen3_buffer,
+                strbuffer,
+                BUFFER_LEN
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL_STRING("AB", strbuffer);
+
+    // Importing stops before a character that doesn't fit.
+    error = pksav_gen3_export_text(
+                "Ab\xC3\xA9",
+                gen3_buffer,
+                BUFFER_LEN
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    memset(strbuffer, 0x7F, sizeof(strbuffer));
+    error = pksav_gen3_import_text(
+                gen3_buffer,
+                strbuffer,
+                3
+            );
+    PKSAV_TEST_ASSERT_SUCCESS(error);
+    TEST_ASSERT_EQUAL_MEMORY("Ab\0", strbuffer, 3);
+}
+
 PKSAV_TEST_MAIN(
     PKSAV_TEST(pksav_gen1_text_test)
     PKSAV_TEST(pksav_gen2_text_test)
     PKSAV_TEST(pksav_gen3_text_test)
     PKSAV_TEST(pksav_gen4_text_test)
     PKSAV_TEST(pksav_gen5_text_test)
+    PKSAV_TEST(pksav_gen1_all_chars_test)
+    PKSAV_TEST(pksav_gen2_all_chars_test)
+    PKSAV_TEST(pksav_gen3_all_chars_test)
+    PKSAV_TEST(pksav_gen4_all_chars_test)
+    PKSAV_TEST(pksav_gen5_all_chars_test)
+    PKSAV_TEST(pksav_gen1_text_bounded_test)
+    PKSAV_TEST(pksav_gen2_text_bounded_test)
+    PKSAV_TEST(pksav_gen3_text_bounded_test)
+    PKSAV_TEST(pksav_gen4_text_bounded_test)
+    PKSAV_TEST(pksav_gen5_text_bounded_test)
+    PKSAV_TEST(pksav_gen1_text_batch_test)
+    PKSAV_TEST(pksav_gen2_text_batch_test)
+    PKSAV_TEST(pksav_gen3_text_batch_test)
+    PKSAV_TEST(pksav_text_c_locale_test)
 )